@@ -534,6 +534,22 @@ namespace ramses
         */
         RAMSES_API void setStatisticsLogLevel(ELogLevel logLevel);
 
+        /**
+        * Sets the number of worker threads used by #update in addition to the calling thread.
+        * Logic nodes are still processed in the same order as without worker threads, only dirty
+        * #ramses::AnimationNode instances which directly follow each other in that order and are not linked
+        * (also not weakly linked) to each other are updated concurrently. All other node types
+        * (scripts, interfaces, bindings, timers, anchor points and skin bindings) access Lua or Ramses
+        * objects which are not thread safe and are always updated on the calling thread.
+        * The resulting property values, the order in which links are activated and the node reported by
+        * a failing #update are the same as without worker threads.
+        * While the update report is enabled (see #enableUpdateReport) nodes are updated serially
+        * so that execution times of individual nodes can be measured.
+        *
+        * @param threadCount number of worker threads, 0 (default) disables multi-threaded update
+        */
+        RAMSES_API void setUpdateWorkerThreadCount(uint32_t threadCount);
+
         /**
          * Links a property of a #ramses::LogicNode to another #ramses::Property of another #ramses::LogicNode.
          * After linking, calls to #update will propagate the value of \p sourceProperty to
@@ -16,7 +16,7 @@
 #include "internals/ErrorReporting.h"
 #include "generated/AnimationNodeGen.h"
 #include "fmt/format.h"
-#include "glm/gtx/range.hpp"
+#include "glm/gtc/type_ptr.hpp"
 #include <cmath>
 
 namespace ramses::internal
@@ -26,10 +26,8 @@ namespace ramses::internal
         , m_channels{ std::move(channels) }
         , m_hasChannelDataExposedViaProperties{ exposeDataAsProperties }
     {
-        m_channelsWorkData.resize(m_channels.size());
-        for (size_t i = 0u; i < m_channels.size(); ++i)
+        for (const auto& channel : m_channels)
         {
-            const auto& channel = m_channels[i];
             assert(channel.timeStamps && channel.keyframes);
             assert(channel.timeStamps->getNumElements() == channel.keyframes->getNumElements());
             assert(!channel.tangentsIn || channel.timeStamps->getNumElements() == channel.tangentsIn->getNumElements());
@@ -38,9 +36,7 @@ namespace ramses::internal
 
             // extract basic channel data to work containers, update logic operates with these containers instead of original channel data
             // (for timestamps and keyframes at least), it also makes it possible to modify this data in runtime while keeping original data constant
-            assert(m_channels[i].timeStamps->getDataType() == EPropertyType::Float && m_channels[i].timeStamps->getNumElements() > 0);
-            m_channelsWorkData[i].timestamps = *m_channels[i].timeStamps->getData<float>();
-            m_channelsWorkData[i].keyframes = m_channels[i].keyframes->m_impl.getDataVariant();
+            m_evaluator.addChannel(channel);
 
             // overall duration equals longest channel in animation
             m_maxChannelDuration = std::max(m_maxChannelDuration, channel.timeStamps->getData<float>()->back());
@@ -118,179 +114,87 @@ namespace ramses::internal
         const float progress = *getInputs()->getChild(EInputIdx_Progress)->get<float>();
         const float localAnimationTime = progress * m_maxChannelDuration;
 
-        for (size_t i = 0u; i < m_channels.size(); ++i)
-            updateChannel(i, localAnimationTime);
+        m_evaluator.evaluate(localAnimationTime);
+        setChannelOutputs();
 
         return std::nullopt;
     }
 
-    void AnimationNodeImpl::updateChannel(size_t channelIdx, float localAnimationTime)
+    void AnimationNodeImpl::collectChannelOutputProperties()
     {
-        const auto& channelWorkData = m_channelsWorkData[channelIdx];
-        const auto& channel = m_channels[channelIdx];
-        const auto& timeStamps = channelWorkData.timestamps;
-
-        // find upper/lower timestamp neighbor of elapsed timestamp
-        auto tsUpperIt = std::upper_bound(timeStamps.cbegin(), timeStamps.cend(), localAnimationTime);
-        const auto tsLowerIt = (tsUpperIt == timeStamps.cbegin() ? timeStamps.cbegin() : tsUpperIt - 1);
-        tsUpperIt = (tsUpperIt == timeStamps.cend() ? tsUpperIt - 1 : tsUpperIt);
-
-        // get index into corresponding keyframes
-        const auto lowerIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), tsLowerIt));
-        const auto upperIdx = static_cast<size_t>(std::distance(timeStamps.cbegin(), tsUpperIt));
-        assert(lowerIdx < channel.keyframes->getNumElements());
-        assert(upperIdx < channel.keyframes->getNumElements());
-
-        // calculate interpolation ratio between the elapsed time and timestamp neighbors [0.0, 1.0] (0.0=lower, 1.0=upper)
-        float interpRatio = 0.f;
-        float timeBetweenKeys = *tsUpperIt - *tsLowerIt;
-        if (tsUpperIt != tsLowerIt)
-            interpRatio = (localAnimationTime - *tsLowerIt) / timeBetweenKeys;
-        // no clamping needed mathematically but to avoid float precision issues
-        interpRatio = std::clamp(interpRatio, 0.f, 1.f);
-
-        using DataVariant = std::variant<
-            float,
-            vec2f,
-            vec3f,
-            vec4f,
-            int32_t,
-            vec2i,
-            vec3i,
-            vec4i,
-            std::vector<float>
-        >;
-        DataVariant interpolatedValue;
-        std::visit([&](const auto& v) {
-            switch (channel.interpolationType)
-            {
-            case EInterpolationType::Step:
-                interpolatedValue = v[lowerIdx];
-                break;
-            case EInterpolationType::Linear:
-            case EInterpolationType::Linear_Quaternions:
-                interpolatedValue = interpolateKeyframes_linear(v[lowerIdx], v[upperIdx], interpRatio);
-                break;
-            case EInterpolationType::Cubic:
-            case EInterpolationType::Cubic_Quaternions:
-            {
-                using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v.front())>>;
-                const auto& tIn = *channel.tangentsIn->getData<ValueType>();
-                const auto& tOut = *channel.tangentsOut->getData<ValueType>();
-                interpolatedValue = interpolateKeyframes_cubic(v[lowerIdx], v[upperIdx], tOut[lowerIdx], tIn[upperIdx], interpRatio, timeBetweenKeys);
-                break;
-            }
-            }
-        }, channelWorkData.keyframes);
-
-        if (channel.interpolationType == EInterpolationType::Linear_Quaternions || channel.interpolationType == EInterpolationType::Cubic_Quaternions)
+        assert(m_channelOutputProperties.empty());
+        // 'duration' is at index 0, channel outputs are shifted by one
+        Property* outputs = getOutputs();
+        for (size_t channelIdx = 0u; channelIdx < m_channels.size(); ++channelIdx)
         {
-            auto& asQuaternion = std::get<vec4f>(interpolatedValue);
-            const float normalizationFactor = 1 / std::sqrt(
-                asQuaternion[0] * asQuaternion[0] +
-                asQuaternion[1] * asQuaternion[1] +
-                asQuaternion[2] * asQuaternion[2] +
-                asQuaternion[3] * asQuaternion[3]);
-
-            asQuaternion[0] *= normalizationFactor;
-            asQuaternion[1] *= normalizationFactor;
-            asQuaternion[2] *= normalizationFactor;
-            asQuaternion[3] *= normalizationFactor;
-        }
-
-        // 'progress' is at index 0, channel outputs are shifted by one
-        auto outputValueProp = getOutputs()->getChild(channelIdx + EOutputIdx_ChannelsBegin);
-        std::visit([outputValueProp](const auto& v) {
-            using ValueType = std::remove_const_t<std::remove_reference_t<decltype(v)>>;
-            if constexpr (std::is_same_v<ValueType, std::vector<float>>)
+            Property* outputValueProp = outputs->getChild(channelIdx + EOutputIdx_ChannelsBegin);
+            if (m_evaluator.getValueType(channelIdx) == EPropertyType::Array)
             {
                 // array data type requires each array element to be set to individual output property
-                for (size_t arrayIdx = 0u; arrayIdx < v.size(); ++arrayIdx)
-                    outputValueProp->getChild(arrayIdx)->m_impl->setValue(v[arrayIdx]);
+                for (size_t arrayIdx = 0u; arrayIdx < outputValueProp->getChildCount(); ++arrayIdx)
+                    m_channelOutputProperties.push_back(outputValueProp->getChild(arrayIdx)->m_impl.get());
             }
             else
             {
-                outputValueProp->m_impl->setValue(PropertyValue{ v });
+                m_channelOutputProperties.push_back(outputValueProp->m_impl.get());
             }
-            }, interpolatedValue);
-    }
-
-    template <typename T>
-    T AnimationNodeImpl::interpolateKeyframes_linear(T lowerVal, T upperVal, float interpRatio)
-    {
-        // this will be compiled for variant visitor but must not be executed
-        if constexpr (std::is_same_v<T, bool>)
-            assert(false);
-
-        if constexpr (std::is_floating_point_v<T>)
-        {
-            return lowerVal + interpRatio * (upperVal - lowerVal);
-        }
-        else if constexpr (std::is_integral_v<T>)
-        {
-            return lowerVal + std::lround(interpRatio * static_cast<float>(upperVal - lowerVal));
-        }
-        else
-        {
-            T val = lowerVal;
-            auto valIt = begin(val);
-            auto lowerValIt = begin(lowerVal);
-            auto upperValIt = begin(upperVal);
-
-            // decompose vecXy and interpolate each component separately
-            for (; valIt != end(val); ++valIt, ++lowerValIt, ++upperValIt)
-                *valIt = interpolateKeyframes_linear(*lowerValIt, *upperValIt, interpRatio);
-
-            return val;
         }
     }
 
-    template <typename T>
-    T AnimationNodeImpl::interpolateKeyframes_cubic(T lowerVal, T upperVal, T lowerTangentOut, T upperTangentIn, float interpRatio, float timeBetweenKeys)
+    void AnimationNodeImpl::setChannelOutputs()
     {
-        // this will be compiled for variant visitor but must not be executed
-        if constexpr (std::is_same_v<T, bool>)
-            assert(false);
+        if (m_channelOutputProperties.empty())
+            collectChannelOutputProperties();
 
-        if constexpr (std::is_floating_point_v<T>)
-        {
-            // GLTF v2 Appendix C (https://github.com/KhronosGroup/glTF/tree/master/specification/2.0?ts=4#appendix-c-spline-interpolation)
-            const float t = interpRatio;
-            const float t2 = t * t;
-            const float t3 = t2 * t;
-            const T p0 = lowerVal;
-            const T p1 = upperVal;
-            const T m0 = timeBetweenKeys * lowerTangentOut;
-            const T m1 = timeBetweenKeys * upperTangentIn;
-            return (2.f*t3 - 3.f*t2 + 1.f) * p0 + (t3 - 2.f*t2 + t) * m0 + (-2.f*t3 + 3.f*t2) * p1 + (t3 - t2) * m1;
-        }
-        else if constexpr (std::is_integral_v<T>)
+        auto outputIt = m_channelOutputProperties.begin();
+        for (size_t channelIdx = 0u; channelIdx < m_channels.size(); ++channelIdx)
         {
-            return std::lround(interpolateKeyframes_cubic(
-                static_cast<float>(lowerVal),
-                static_cast<float>(upperVal),
-                static_cast<float>(lowerTangentOut),
-                static_cast<float>(upperTangentIn),
-                interpRatio,
-                timeBetweenKeys));
-        }
-        else
-        {
-            T val = lowerVal;
-            auto valIt = begin(val);
-            auto lowerValIt = begin(lowerVal);
-            auto upperValIt = begin(upperVal);
-            auto lowerTangentOutIt = begin(lowerTangentOut);
-            auto upperTangentInIt = begin(upperTangentIn);
-            assert((end(lowerVal) - begin(lowerVal)) == (end(lowerTangentOut) - begin(lowerTangentOut)));
-            assert((end(lowerVal) - begin(lowerVal)) == (end(upperTangentIn) - begin(upperTangentIn)));
-
-            // decompose vecXy and interpolate each component separately
-            for (; valIt != end(val); ++valIt, ++lowerValIt, ++upperValIt, ++lowerTangentOutIt, ++upperTangentInIt)
-                *valIt = interpolateKeyframes_cubic(*lowerValIt, *upperValIt, *lowerTangentOutIt, *upperTangentInIt, interpRatio, timeBetweenKeys);
-
-            return val;
+            PropertyImpl& output = **outputIt;
+            switch (m_evaluator.getValueType(channelIdx))
+            {
+            case EPropertyType::Float:
+                output.setValue(m_evaluator.getFloatResult(channelIdx)[0]);
+                break;
+            case EPropertyType::Vec2f:
+                output.setValue(glm::make_vec2(m_evaluator.getFloatResult(channelIdx)));
+                break;
+            case EPropertyType::Vec3f:
+                output.setValue(glm::make_vec3(m_evaluator.getFloatResult(channelIdx)));
+                break;
+            case EPropertyType::Vec4f:
+                output.setValue(glm::make_vec4(m_evaluator.getFloatResult(channelIdx)));
+                break;
+            case EPropertyType::Int32:
+                output.setValue(m_evaluator.getIntResult(channelIdx)[0]);
+                break;
+            case EPropertyType::Vec2i:
+                output.setValue(glm::make_vec2(m_evaluator.getIntResult(channelIdx)));
+                break;
+            case EPropertyType::Vec3i:
+                output.setValue(glm::make_vec3(m_evaluator.getIntResult(channelIdx)));
+                break;
+            case EPropertyType::Vec4i:
+                output.setValue(glm::make_vec4(m_evaluator.getIntResult(channelIdx)));
+                break;
+            case EPropertyType::Array:
+            {
+                const float* result = m_evaluator.getFloatResult(channelIdx);
+                const size_t arraySize = m_evaluator.getComponentCount(channelIdx);
+                for (size_t arrayIdx = 0u; arrayIdx < arraySize; ++arrayIdx)
+                    outputIt[static_cast<std::ptrdiff_t>(arrayIdx)]->setValue(result[arrayIdx]);
+                outputIt += static_cast<std::ptrdiff_t>(arraySize);
+                continue;
+            }
+            case EPropertyType::Int64:
+            case EPropertyType::Bool:
+            case EPropertyType::String:
+            case EPropertyType::Struct:
+                assert(!"unsupported animation data type");
+                break;
+            }
+            ++outputIt;
         }
+        assert(outputIt == m_channelOutputProperties.end());
     }
 
     flatbuffers::Offset<rlogic_serialization::AnimationNode> AnimationNodeImpl::Serialize(
@@ -451,18 +355,19 @@ namespace ramses::internal
     void AnimationNodeImpl::initAnimationDataPropertyValues()
     {
         Property* channelsData = getInputs()->getChild("channelsData");
-        assert(channelsData && channelsData->getChildCount() == m_channelsWorkData.size());
+        assert(channelsData && channelsData->getChildCount() == m_channels.size());
         for (size_t channelIdx = 0u; channelIdx < channelsData->getChildCount(); ++channelIdx)
         {
             Property* channelDataProp = channelsData->getChild(channelIdx);
             Property* timestampsProp = channelDataProp->getChild("timestamps");
             Property* keyframesProp = channelDataProp->getChild("keyframes");
             assert(timestampsProp && keyframesProp);
-            const auto& channelData = m_channelsWorkData[channelIdx];
-            assert(timestampsProp->getChildCount() == channelData.timestamps.size());
+            // work data is initialized from original channel data
+            const auto& channel = m_channels[channelIdx];
+            assert(timestampsProp->getChildCount() == m_evaluator.getKeyframeCount(channelIdx));
             assert(keyframesProp->getChildCount() == timestampsProp->getChildCount());
 
-            const auto& timestamps = channelData.timestamps;
+            const auto& timestamps = *channel.timeStamps->getData<float>();
             for (size_t i = 0u; i < timestamps.size(); ++i)
                 timestampsProp->getChild(i)->m_impl->setValue(timestamps[i]);
 
@@ -478,7 +383,7 @@ namespace ramses::internal
                     for (size_t i = 0u; i < keyframes.size(); ++i)
                         keyframesProp->getChild(i)->m_impl->setValue(keyframes[i]);
                 }
-            }, channelData.keyframes);
+            }, channel.keyframes->m_impl.getDataVariant());
         }
     }
 
@@ -490,18 +395,17 @@ namespace ramses::internal
             const auto channelDataProp = channelsDataProp->getChild(ch);
 
             const auto timestampsProp = channelDataProp->getChild(0u);
-            auto& timestamps = m_channelsWorkData[ch].timestamps;
-            assert(timestamps.size() == timestampsProp->getChildCount());
-            for (size_t i = 0u; i < timestamps.size(); ++i)
+            assert(m_evaluator.getKeyframeCount(ch) == timestampsProp->getChildCount());
+            for (size_t i = 0u; i < timestampsProp->getChildCount(); ++i)
             {
-                timestamps[i] = *timestampsProp->getChild(i)->get<float>();
-                m_maxChannelDuration = std::max(m_maxChannelDuration, timestamps[i]);
+                const float timestamp = *timestampsProp->getChild(i)->get<float>();
+                m_evaluator.setTimestamp(ch, i, timestamp);
+                m_maxChannelDuration = std::max(m_maxChannelDuration, timestamp);
             }
 
             const auto keyframesProp = channelDataProp->getChild(1u);
-            auto& keyframesVariant = m_channelsWorkData[ch].keyframes;
-            std::visit([&](auto& keyframes) {
-                using ValueType = std::remove_const_t<std::remove_reference_t<decltype(keyframes.front())>>;
+            std::visit([&](const auto& originalKeyframes) {
+                using ValueType = std::remove_const_t<std::remove_reference_t<decltype(originalKeyframes.front())>>;
                 // array data type requires each array element of each keyframe element to be read from individual input property
                 if constexpr (std::is_same_v<ValueType, std::vector<float>>)
                 {
@@ -509,10 +413,10 @@ namespace ramses::internal
                 }
                 else
                 {
-                    for (size_t i = 0u; i < keyframes.size(); ++i)
-                        keyframes[i] = *keyframesProp->getChild(i)->get<ValueType>();
+                    for (size_t i = 0u; i < keyframesProp->getChildCount(); ++i)
+                        m_evaluator.setKeyframe(ch, i, *keyframesProp->getChild(i)->get<ValueType>());
                 }
-            }, keyframesVariant);
+            }, m_channels[ch].keyframes->m_impl.getDataVariant());
         }
 
         getOutputs()->getChild(EOutputIdx_Duration)->set(m_maxChannelDuration);
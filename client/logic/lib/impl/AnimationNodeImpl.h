@@ -12,6 +12,7 @@
 
 #include "impl/LogicNodeImpl.h"
 #include "impl/DataArrayImpl.h"
+#include "internals/AnimationEvaluator.h"
 #include <memory>
 
 namespace rlogic_serialization
@@ -53,12 +54,8 @@ namespace ramses::internal
         void createRootProperties() final;
 
     private:
-        void updateChannel(size_t channelIdx, float localAnimationTime);
-
-        template <typename T>
-        T interpolateKeyframes_linear(T lowerVal, T upperVal, float interpRatio);
-        template <typename T>
-        T interpolateKeyframes_cubic(T lowerVal, T upperVal, T lowerTangentOut, T upperTangentIn, float interpRatio, float timeBetweenKeys);
+        void collectChannelOutputProperties();
+        void setChannelOutputs();
 
         void initAnimationDataPropertyValues();
         void updateAnimationDataFromProperties();
@@ -66,13 +63,12 @@ namespace ramses::internal
         // original channel data provided by user
         AnimationChannels m_channels;
 
-        // work data (extracted copy of subset of original data)
-        struct ChannelWorkData
-        {
-            std::vector<float> timestamps;
-            DataArrayImpl::DataArrayVariant keyframes;
-        };
-        std::vector<ChannelWorkData> m_channelsWorkData;
+        // work data (extracted copy of original data), evaluates all channels at once
+        // and makes it possible to modify timestamps and keyframes in runtime while keeping original data constant
+        AnimationEvaluator m_evaluator;
+
+        // output property per channel, array channels have output property per array element
+        std::vector<PropertyImpl*> m_channelOutputProperties;
 
         float m_maxChannelDuration = 0.f;
 
@@ -226,6 +226,11 @@ namespace ramses
         m_impl->setStatisticsLogLevel(logLevel);
     }
 
+    void LogicEngine::setUpdateWorkerThreadCount(uint32_t threadCount)
+    {
+        m_impl->setUpdateWorkerThreadCount(threadCount);
+    }
+
     bool LogicEngine::loadFromFile(std::string_view filename, ramses::Scene* ramsesScene /* = nullptr*/, bool enableMemoryVerification /* = true */)
     {
         return m_impl->loadFromFile(filename, ramsesScene, enableMemoryVerification);
@@ -25,6 +25,7 @@
 #include "ramses-logic/SkinBinding.h"
 
 #include "impl/LogicNodeImpl.h"
+#include "impl/AnimationNodeImpl.h"
 #include "impl/LoggerImpl.h"
 #include "impl/LuaScriptImpl.h"
 #include "impl/LuaModuleImpl.h"
@@ -46,6 +47,7 @@
 #include "generated/LogicEngineGen.h"
 #include "ramses-sdk-build-config.h"
 
+#include "Utils/TraceRecorder.h"
 #include "fmt/format.h"
 
 #include <string>
@@ -331,32 +333,18 @@ namespace ramses::internal
         return m_featureLevel;
     }
 
-    size_t LogicEngineImpl::activateLinksRecursive(PropertyImpl& output)
+    size_t LogicEngineImpl::ActivateLinks(LogicNodeImpl& node)
     {
         size_t activatedLinks = 0u;
 
-        const auto childCount = output.getChildCount();
-        for (size_t i = 0; i < childCount; ++i)
+        for (const auto& link : node.getOutputLinks())
         {
-            PropertyImpl& child = *output.getChild(i)->m_impl;
-
-            if (TypeUtils::CanHaveChildren(child.getType()))
+            PropertyImpl* linkedProp = link.input;
+            const bool valueChanged = linkedProp->setValueFrom(*link.output);
+            if (valueChanged || linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
             {
-                activatedLinks += activateLinksRecursive(child);
-            }
-            else
-            {
-                const auto& outgoingLinks = child.getOutgoingLinks();
-                for (const auto& outLink : outgoingLinks)
-                {
-                    PropertyImpl* linkedProp = outLink.property;
-                    const bool valueChanged = linkedProp->setValue(child.getValue());
-                    if (valueChanged || linkedProp->getPropertySemantics() == EPropertySemantics::AnimationInput)
-                    {
-                        linkedProp->getLogicNode().setDirty(true);
-                        ++activatedLinks;
-                    }
-                }
+                linkedProp->getLogicNode().setDirty(true);
+                ++activatedLinks;
             }
         }
 
@@ -365,6 +353,7 @@ namespace ramses::internal
 
     bool LogicEngineImpl::update()
     {
+        RAMSES_TRACE_SCOPE("logic", "LogicEngine::update");
         m_errors.clear();
 
         if (m_statisticsEnabled || m_updateReportEnabled)
@@ -390,7 +379,9 @@ namespace ramses::internal
         // force dirty all timer nodes, anchor points and skinbindings
         setNodeToBeAlwaysUpdatedDirty();
 
-        const bool success = updateNodes(*sortedNodes);
+        const bool success = (m_updateExecutor && !m_updateReportEnabled) ?
+            updateNodesConcurrently(*sortedNodes) :
+            updateNodes(*sortedNodes);
 
         if (m_statisticsEnabled || m_updateReportEnabled)
         {
@@ -423,26 +414,110 @@ namespace ramses::internal
             if (m_statisticsEnabled)
                 m_statistics.nodeExecuted();
 
-            const std::optional<LogicNodeRuntimeError> potentialError = node.update();
-            if (potentialError)
             {
-                m_errors.add(potentialError->message, &node.getLogicObject(), EErrorType::RuntimeError);
-                return false;
+                RAMSES_TRACE_SCOPE_ARG("logic", "LogicNode::update", "id", node.getId());
+                if (!processNodeUpdateResult(node, node.update()))
+                    return false;
             }
 
-            Property* outputs = node.getOutputs();
-            if (outputs != nullptr)
+            if (m_updateReportEnabled)
+                m_updateReport.nodeExecutionFinished();
+
+            node.setDirty(false);
+        }
+
+        return true;
+    }
+
+    bool LogicEngineImpl::updateNodesConcurrently(const NodeVector& sortedNodes)
+    {
+        // nodes are processed in the same topological order as by serial update, only a run of consecutive animation nodes
+        // not linked to each other is updated concurrently ahead, results are then processed in topological order
+        for (size_t nodeIdx = 0u; nodeIdx < sortedNodes.size();)
+        {
+            const size_t runEnd = findIndependentAnimationNodes(sortedNodes, nodeIdx);
+            if (runEnd == nodeIdx)
             {
-                const size_t activatedLinks = activateLinksRecursive(*outputs->m_impl);
+                LogicNodeImpl& node = *sortedNodes[nodeIdx];
+                ++nodeIdx;
+                if (!node.isDirty() && m_nodeDirtyMechanismEnabled)
+                    continue;
 
-                if (m_statisticsEnabled || m_updateReportEnabled)
-                    m_updateReport.linksActivated(activatedLinks);
+                if (m_statisticsEnabled)
+                    m_statistics.nodeExecuted();
+                {
+                    RAMSES_TRACE_SCOPE_ARG("logic", "LogicNode::update", "id", node.getId());
+                    if (!processNodeUpdateResult(node, node.update()))
+                        return false;
+                }
+                node.setDirty(false);
+                continue;
             }
 
-            if (m_updateReportEnabled)
-                m_updateReport.nodeExecutionFinished();
+            m_concurrentlyUpdatedNodes.clear();
+            for (; nodeIdx < runEnd; ++nodeIdx)
+            {
+                if (sortedNodes[nodeIdx]->isDirty() || !m_nodeDirtyMechanismEnabled)
+                    m_concurrentlyUpdatedNodes.push_back(sortedNodes[nodeIdx]);
+            }
 
-            node.setDirty(false);
+            m_concurrentUpdateResults.clear();
+            m_concurrentUpdateResults.resize(m_concurrentlyUpdatedNodes.size());
+            m_updateExecutor->execute(m_concurrentlyUpdatedNodes.size(), MinNodeCountPerUpdateThread, [this](size_t begin, size_t end) {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    RAMSES_TRACE_SCOPE_ARG("logic", "LogicNode::update", "id", m_concurrentlyUpdatedNodes[i]->getId());
+                    m_concurrentUpdateResults[i] = m_concurrentlyUpdatedNodes[i]->update();
+                }
+            });
+
+            // no node of the run can be dirtied by links activated here, so the result equals updating the nodes one after another
+            for (size_t i = 0u; i < m_concurrentlyUpdatedNodes.size(); ++i)
+            {
+                LogicNodeImpl& node = *m_concurrentlyUpdatedNodes[i];
+                if (m_statisticsEnabled)
+                    m_statistics.nodeExecuted();
+                if (!processNodeUpdateResult(node, m_concurrentUpdateResults[i]))
+                    return false;
+                node.setDirty(false);
+            }
+        }
+
+        return true;
+    }
+
+    size_t LogicEngineImpl::findIndependentAnimationNodes(const NodeVector& sortedNodes, size_t firstNodeIdx)
+    {
+        // animation node only reads its own inputs and writes its own outputs, run ends at first node which is not
+        // an animation node or which is a (possibly weak) link target of a node already in the run
+        m_concurrentRunLinkTargets.clear();
+        size_t nodeIdx = firstNodeIdx;
+        for (; nodeIdx < sortedNodes.size(); ++nodeIdx)
+        {
+            LogicNodeImpl* node = sortedNodes[nodeIdx];
+            if (dynamic_cast<AnimationNodeImpl*>(node) == nullptr || m_concurrentRunLinkTargets.count(node) != 0u)
+                break;
+            for (const auto& link : node->getOutputLinks())
+                m_concurrentRunLinkTargets.insert(&link.input->getLogicNode());
+        }
+
+        return nodeIdx;
+    }
+
+    bool LogicEngineImpl::processNodeUpdateResult(LogicNodeImpl& node, const std::optional<LogicNodeRuntimeError>& potentialError)
+    {
+        if (potentialError)
+        {
+            m_errors.add(potentialError->message, &node.getLogicObject(), EErrorType::RuntimeError);
+            return false;
+        }
+
+        if (node.getOutputs() != nullptr)
+        {
+            const size_t activatedLinks = ActivateLinks(node);
+
+            if (m_statisticsEnabled || m_updateReportEnabled)
+                m_updateReport.linksActivated(activatedLinks);
         }
 
         return true;
@@ -840,6 +915,13 @@ namespace ramses::internal
         m_statistics.setLogLevel(logLevel);
     }
 
+    void LogicEngineImpl::setUpdateWorkerThreadCount(uint32_t threadCount)
+    {
+        m_updateExecutor.reset();
+        if (threadCount > 0u)
+            m_updateExecutor = std::make_unique<ramses_internal::ParallelForExecutor>(threadCount);
+    }
+
     size_t LogicEngineImpl::getTotalSerializedSize(ELuaSavingMode luaSavingMode) const
     {
         return ApiObjectsSerializedSize::GetTotalSerializedSize(*m_apiObjects, luaSavingMode);
@@ -22,9 +22,12 @@
 
 #include "ramses-framework-api/RamsesFrameworkTypes.h"
 #include "ramses-client-api/ERotationType.h"
+#include "TaskFramework/ParallelForExecutor.h"
 
 #include <memory>
+#include <optional>
 #include <vector>
+#include <unordered_set>
 #include <string>
 #include <string_view>
 
@@ -149,12 +152,14 @@ namespace ramses::internal
         void setStatisticsLoggingRate(size_t loggingRate);
         void setStatisticsLogLevel(ELogLevel logLevel);
 
+        void setUpdateWorkerThreadCount(uint32_t threadCount);
+
         [[nodiscard]] size_t getTotalSerializedSize(ELuaSavingMode luaSavingMode) const;
         template<typename T>
         [[nodiscard]] size_t getSerializedSize(ELuaSavingMode luaSavingMode) const;
 
     private:
-        size_t activateLinksRecursive(PropertyImpl& output);
+        static size_t ActivateLinks(LogicNodeImpl& node);
         void setNodeToBeAlwaysUpdatedDirty();
 
         static bool CheckRamsesVersionFromFile(const rlogic_serialization::Version& ramsesVersion);
@@ -162,6 +167,9 @@ namespace ramses::internal
         static void LogAssetMetadata(const rlogic_serialization::Metadata& assetMetadata);
 
         [[nodiscard]] bool updateNodes(const NodeVector& nodes);
+        [[nodiscard]] bool updateNodesConcurrently(const NodeVector& sortedNodes);
+        [[nodiscard]] size_t findIndependentAnimationNodes(const NodeVector& sortedNodes, size_t firstNodeIdx);
+        [[nodiscard]] bool processNodeUpdateResult(LogicNodeImpl& node, const std::optional<LogicNodeRuntimeError>& potentialError);
 
         [[nodiscard]] bool loadFromByteData(const void* byteData, size_t byteSize, ramses::Scene* scene, bool enableMemoryVerification, const std::string& dataSourceDescription);
         [[nodiscard]] bool checkFileIdentifierBytes(const std::string& dataSourceDescription, const std::string& fileIdBytes);
@@ -177,6 +185,13 @@ namespace ramses::internal
         LogicNodeUpdateStatistics m_statistics;
 
         ramses::EFeatureLevel m_featureLevel;
+
+        // updates of nodes without access to Lua or Ramses objects are distributed to worker threads
+        static constexpr size_t MinNodeCountPerUpdateThread = 16u;
+        std::unique_ptr<ramses_internal::ParallelForExecutor> m_updateExecutor;
+        NodeVector m_concurrentlyUpdatedNodes;
+        std::vector<std::optional<LogicNodeRuntimeError>> m_concurrentUpdateResults;
+        std::unordered_set<const LogicNodeImpl*> m_concurrentRunLinkTargets;
     };
 
     template<typename T>
@@ -11,6 +11,7 @@
 #include "ramses-logic/Property.h"
 
 #include "impl/PropertyImpl.h"
+#include "internals/TypeUtils.h"
 
 namespace ramses::internal
 {
@@ -51,6 +52,44 @@ namespace ramses::internal
         return m_dirty;
     }
 
+    const std::vector<LogicNodeImpl::OutputLink>& LogicNodeImpl::getOutputLinks()
+    {
+        if (!m_outputLinksValid)
+        {
+            m_outputLinks.clear();
+            const Property* outputs = getOutputs();
+            if (outputs != nullptr)
+                collectOutputLinks(*outputs->m_impl);
+            m_outputLinksValid = true;
+        }
+
+        return m_outputLinks;
+    }
+
+    void LogicNodeImpl::invalidateOutputLinks()
+    {
+        m_outputLinksValid = false;
+    }
+
+    void LogicNodeImpl::collectOutputLinks(const PropertyImpl& output)
+    {
+        const auto childCount = output.getChildCount();
+        for (size_t i = 0; i < childCount; ++i)
+        {
+            const PropertyImpl& child = *output.getChild(i)->m_impl;
+
+            if (TypeUtils::CanHaveChildren(child.getType()))
+            {
+                collectOutputLinks(child);
+            }
+            else
+            {
+                for (const auto& outLink : child.getOutgoingLinks())
+                    m_outputLinks.push_back({ &child, outLink.property });
+            }
+        }
+    }
+
     void LogicNodeImpl::setRootProperties(std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput)
     {
         assert(!m_inputs);
@@ -41,10 +41,26 @@ namespace ramses::internal
         void setDirty(bool dirty);
         [[nodiscard]] bool isDirty() const;
 
+        // Flat table of all links going out of this node's outputs, in order of output leaves
+        // Link activation iterates over it instead of walking the output property tree
+        struct OutputLink
+        {
+            const PropertyImpl* output = nullptr;
+            PropertyImpl* input = nullptr;
+        };
+        [[nodiscard]] const std::vector<OutputLink>& getOutputLinks();
+        void invalidateOutputLinks();
+
     protected:
         void setRootProperties(std::unique_ptr<PropertyImpl> rootInput, std::unique_ptr<PropertyImpl> rootOutput);
 
     private:
+        void collectOutputLinks(const PropertyImpl& output);
+
+        // Declared before properties so that it outlives them, properties invalidate it when unlinked during destruction
+        std::vector<OutputLink> m_outputLinks;
+        bool m_outputLinksValid = false;
+
         PropertyUniquePtr m_inputs;
         PropertyUniquePtr m_outputs;
 
@@ -603,11 +603,28 @@ namespace ramses::internal
             m_bindingInputHasNewValue = true;
         }
 
-        const bool valueChanged = (m_value != value);
+        if (m_value == value)
+            return false;
 
         m_value = std::move(value);
+        return true;
+    }
+
+    bool PropertyImpl::setValueFrom(const PropertyImpl& other)
+    {
+        assert(m_value.index() == other.m_value.index());
+        assert(TypeUtils::IsPrimitiveType(m_typeData.type));
+
+        if (m_semantics == EPropertySemantics::BindingInput)
+        {
+            m_bindingInputHasNewValue = true;
+        }
+
+        if (m_value == other.m_value)
+            return false;
 
-        return valueChanged;
+        m_value = other.m_value;
+        return true;
     }
 
     void PropertyImpl::setPropertyInstance(Property& property)
@@ -707,6 +724,8 @@ namespace ramses::internal
 
         output.m_outgoingLinks.push_back({ this, isWeakLink });
         m_incomingLink = { &output, isWeakLink };
+        if (output.m_logicNode != nullptr)
+            output.m_logicNode->invalidateOutputLinks();
     }
 
     void PropertyImpl::resetIncomingLink()
@@ -716,6 +735,8 @@ namespace ramses::internal
         auto linkIter = std::find_if(srcPropertyLinks.begin(), srcPropertyLinks.end(), [this](const auto& p) { return p.property == this; });
         assert(linkIter != srcPropertyLinks.end());
         srcPropertyLinks.erase(linkIter);
+        if (m_incomingLink.property->m_logicNode != nullptr)
+            m_incomingLink.property->m_logicNode->invalidateOutputLinks();
         m_incomingLink = { nullptr, false };
     }
 
@@ -728,6 +749,16 @@ namespace ramses::internal
     PropertyUniquePtr PropertyImpl::CreateProperty(std::unique_ptr<PropertyImpl> impl)
     {
         assert(impl);
-        return PropertyUniquePtr{ new Property{ std::move(impl) }, [](Property* p) { delete p; } };
+        return PropertyUniquePtr{ new Property{ std::move(impl) } };
+    }
+
+    void PropertyImpl::DestroyProperty(Property* property)
+    {
+        delete property;
+    }
+
+    void PropertyDeleter::operator()(Property* property) const
+    {
+        PropertyImpl::DestroyProperty(property);
     }
 }
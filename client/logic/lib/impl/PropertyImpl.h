@@ -44,7 +44,17 @@ namespace ramses::internal
     class ErrorReporting;
 
     using PropertyValue = std::variant<int32_t, int64_t, float, bool, std::string, vec2f, vec3f, vec4f, vec2i, vec3i, vec4i>;
-    using PropertyUniquePtr = std::unique_ptr<Property, std::function<void(Property*)>>;
+
+    // Stateless deleter (Property destructor is not public), keeps PropertyUniquePtr the size of a plain pointer
+    struct PropertyDeleter
+    {
+        void operator()(Property* property) const;
+    };
+
+    using PropertyUniquePtr = std::unique_ptr<Property, PropertyDeleter>;
+    // Every Property and its PropertyImpl are still separate heap allocations (public Property owns its impl
+    // via std::unique_ptr), the list only holds pointers to them. Hot paths avoid walking the tree instead,
+    // see LogicNodeImpl::getOutputLinks and WrappedLuaProperty child name lookup.
     using PropertyList = std::vector<PropertyUniquePtr>;
 
     class PropertyImpl
@@ -103,6 +113,8 @@ namespace ramses::internal
 
         // Generic setter. Can optionally skip dirty-check
         bool setValue(PropertyValue value);
+        // Copies value of other property of same type, assigns only if changed (reuses string storage)
+        bool setValueFrom(const PropertyImpl& other);
         // Special setter for binding value init
         void initializeBindingInputValue(PropertyValue value);
 
@@ -137,6 +149,7 @@ namespace ramses::internal
         void resetIncomingLink();
 
         static PropertyUniquePtr CreateProperty(std::unique_ptr<PropertyImpl> impl);
+        static void DestroyProperty(Property* property);
 
     private:
         TypeData        m_typeData;
@@ -0,0 +1,352 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "internals/AnimationEvaluator.h"
+#include "ramses-logic/DataArray.h"
+#include "impl/DataArrayImpl.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RAMSES_ANIMATIONEVALUATOR_SSE2
+#endif
+
+namespace ramses::internal
+{
+    namespace
+    {
+        template <typename T>
+        size_t ComponentCount(const T& value)
+        {
+            if constexpr (std::is_arithmetic_v<T>)
+                return 1u;
+            else if constexpr (std::is_same_v<T, std::vector<float>>)
+                return value.size();
+            else
+                return static_cast<size_t>(T::length());
+        }
+
+        template <typename T>
+        constexpr bool IsIntegralValue()
+        {
+            if constexpr (std::is_arithmetic_v<T>)
+                return std::is_integral_v<T>;
+            else
+                return std::is_integral_v<typename T::value_type>;
+        }
+
+        template <typename Target, typename T>
+        void AppendComponents(std::vector<Target>& target, const T& value)
+        {
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                target.push_back(static_cast<Target>(value));
+            }
+            else if constexpr (std::is_same_v<T, std::vector<float>>)
+            {
+                for (const float component : value)
+                    target.push_back(static_cast<Target>(component));
+            }
+            else
+            {
+                for (typename T::length_type i = 0; i < T::length(); ++i)
+                    target.push_back(static_cast<Target>(value[i]));
+            }
+        }
+
+        size_t FindUpperKeyframe(const float* timestamps, size_t count, size_t cursor, float time)
+        {
+            // result is the same as std::upper_bound over all timestamps,
+            // timestamps before cursor are skipped if they are known to be smaller or equal to time
+            size_t first = 0u;
+            if (cursor == 0u || timestamps[cursor - 1u] <= time)
+            {
+                const size_t stepsEnd = std::min(count, cursor + AnimationEvaluator::MaxCursorSteps);
+                for (; cursor < stepsEnd; ++cursor)
+                {
+                    if (time < timestamps[cursor])
+                        return cursor;
+                }
+                if (cursor == count)
+                    return count;
+                first = cursor;
+            }
+
+            return static_cast<size_t>(std::upper_bound(timestamps + first, timestamps + count, time) - timestamps);
+        }
+
+        void InterpolateLinear(const float* lower, const float* upper, float interpRatio, float* result, size_t count)
+        {
+            size_t i = 0u;
+#if defined(RAMSES_ANIMATIONEVALUATOR_SSE2)
+            const __m128 ratio = _mm_set1_ps(interpRatio);
+            for (; i + 4u <= count; i += 4u)
+            {
+                const __m128 lowerVal = _mm_loadu_ps(lower + i);
+                const __m128 upperVal = _mm_loadu_ps(upper + i);
+                _mm_storeu_ps(result + i, _mm_add_ps(lowerVal, _mm_mul_ps(ratio, _mm_sub_ps(upperVal, lowerVal))));
+            }
+#endif
+            for (; i < count; ++i)
+                result[i] = lower[i] + interpRatio * (upper[i] - lower[i]);
+        }
+
+        // GLTF v2 Appendix C (https://github.com/KhronosGroup/glTF/tree/master/specification/2.0?ts=4#appendix-c-spline-interpolation)
+        struct CubicWeights
+        {
+            CubicWeights(float interpRatio, float timeBetweenKeys)
+            {
+                const float t = interpRatio;
+                const float t2 = t * t;
+                const float t3 = t2 * t;
+                p0 = 2.f*t3 - 3.f*t2 + 1.f;
+                m0 = t3 - 2.f*t2 + t;
+                p1 = -2.f*t3 + 3.f*t2;
+                m1 = t3 - t2;
+                tangentScale = timeBetweenKeys;
+            }
+
+            float p0;
+            float m0;
+            float p1;
+            float m1;
+            float tangentScale;
+        };
+
+        float InterpolateCubic(float lower, float upper, float lowerTangentOut, float upperTangentIn, const CubicWeights& w)
+        {
+            return w.p0 * lower + w.m0 * (w.tangentScale * lowerTangentOut) + w.p1 * upper + w.m1 * (w.tangentScale * upperTangentIn);
+        }
+
+        void InterpolateCubic(const float* lower, const float* upper, const float* lowerTangentOut, const float* upperTangentIn, const CubicWeights& w, float* result, size_t count)
+        {
+            size_t i = 0u;
+#if defined(RAMSES_ANIMATIONEVALUATOR_SSE2)
+            const __m128 wp0 = _mm_set1_ps(w.p0);
+            const __m128 wm0 = _mm_set1_ps(w.m0);
+            const __m128 wp1 = _mm_set1_ps(w.p1);
+            const __m128 wm1 = _mm_set1_ps(w.m1);
+            const __m128 scale = _mm_set1_ps(w.tangentScale);
+            for (; i + 4u <= count; i += 4u)
+            {
+                const __m128 p0 = _mm_mul_ps(wp0, _mm_loadu_ps(lower + i));
+                const __m128 m0 = _mm_mul_ps(wm0, _mm_mul_ps(scale, _mm_loadu_ps(lowerTangentOut + i)));
+                const __m128 p1 = _mm_mul_ps(wp1, _mm_loadu_ps(upper + i));
+                const __m128 m1 = _mm_mul_ps(wm1, _mm_mul_ps(scale, _mm_loadu_ps(upperTangentIn + i)));
+                _mm_storeu_ps(result + i, _mm_add_ps(_mm_add_ps(_mm_add_ps(p0, m0), p1), m1));
+            }
+#endif
+            for (; i < count; ++i)
+                result[i] = InterpolateCubic(lower[i], upper[i], lowerTangentOut[i], upperTangentIn[i], w);
+        }
+
+        void NormalizeQuaternion(float* quaternion)
+        {
+            const float normalizationFactor = 1 / std::sqrt(
+                quaternion[0] * quaternion[0] +
+                quaternion[1] * quaternion[1] +
+                quaternion[2] * quaternion[2] +
+                quaternion[3] * quaternion[3]);
+
+            quaternion[0] *= normalizationFactor;
+            quaternion[1] *= normalizationFactor;
+            quaternion[2] *= normalizationFactor;
+            quaternion[3] *= normalizationFactor;
+        }
+    }
+
+    void AnimationEvaluator::addChannel(const AnimationChannel& channel)
+    {
+        assert(channel.timeStamps && channel.keyframes);
+        assert(channel.timeStamps->getDataType() == EPropertyType::Float && channel.timeStamps->getNumElements() > 0);
+        assert(channel.timeStamps->getNumElements() == channel.keyframes->getNumElements());
+
+        Channel newChannel;
+        newChannel.interpolationType = channel.interpolationType;
+        newChannel.valueType = channel.keyframes->getDataType();
+        newChannel.keyframeCount = channel.keyframes->getNumElements();
+        newChannel.timestampsOffset = m_timestamps.size();
+        const auto& timestamps = *channel.timeStamps->getData<float>();
+        m_timestamps.insert(m_timestamps.end(), timestamps.cbegin(), timestamps.cend());
+
+        const bool cubic = (channel.interpolationType == EInterpolationType::Cubic || channel.interpolationType == EInterpolationType::Cubic_Quaternions);
+        std::visit([&](const auto& keyframes) {
+            using ValueType = typename std::remove_reference_t<decltype(keyframes)>::value_type;
+            newChannel.componentCount = ComponentCount(keyframes.front());
+            if constexpr (IsIntegralValue<ValueType>())
+            {
+                newChannel.integral = true;
+                newChannel.keyframesOffset = m_intKeyframes.size();
+                for (const auto& keyframe : keyframes)
+                    AppendComponents(m_intKeyframes, keyframe);
+                newChannel.resultOffset = m_intResults.size();
+                m_intResults.resize(m_intResults.size() + newChannel.componentCount, 0);
+            }
+            else
+            {
+                newChannel.keyframesOffset = m_keyframes.size();
+                for (const auto& keyframe : keyframes)
+                {
+                    assert(ComponentCount(keyframe) == newChannel.componentCount);
+                    AppendComponents(m_keyframes, keyframe);
+                }
+                newChannel.resultOffset = m_results.size();
+                m_results.resize(m_results.size() + newChannel.componentCount, 0.f);
+            }
+
+            if (cubic)
+            {
+                assert(channel.tangentsIn && channel.tangentsOut);
+                assert(channel.tangentsIn->getNumElements() == newChannel.keyframeCount && channel.tangentsOut->getNumElements() == newChannel.keyframeCount);
+                newChannel.tangentsOffset = m_tangentsIn.size();
+                for (const auto& tangent : *channel.tangentsIn->getData<ValueType>())
+                    AppendComponents(m_tangentsIn, tangent);
+                for (const auto& tangent : *channel.tangentsOut->getData<ValueType>())
+                    AppendComponents(m_tangentsOut, tangent);
+            }
+        }, channel.keyframes->m_impl.getDataVariant());
+
+        assert(newChannel.valueType != EPropertyType::Vec4f || newChannel.componentCount == 4u);
+        m_channels.push_back(newChannel);
+    }
+
+    void AnimationEvaluator::evaluate(float time)
+    {
+        for (auto& channel : m_channels)
+            evaluateChannel(channel, time);
+    }
+
+    void AnimationEvaluator::evaluateChannel(Channel& channel, float time)
+    {
+        const float* timestamps = m_timestamps.data() + channel.timestampsOffset;
+        const size_t count = channel.keyframeCount;
+
+        // find upper/lower timestamp neighbor of elapsed timestamp
+        channel.cursor = FindUpperKeyframe(timestamps, count, channel.cursor, time);
+        const size_t lowerIdx = (channel.cursor == 0u ? 0u : channel.cursor - 1u);
+        const size_t upperIdx = (channel.cursor == count ? count - 1u : channel.cursor);
+
+        // calculate interpolation ratio between the elapsed time and timestamp neighbors [0.0, 1.0] (0.0=lower, 1.0=upper)
+        float interpRatio = 0.f;
+        const float timeBetweenKeys = timestamps[upperIdx] - timestamps[lowerIdx];
+        if (upperIdx != lowerIdx)
+            interpRatio = (time - timestamps[lowerIdx]) / timeBetweenKeys;
+        // no clamping needed mathematically but to avoid float precision issues
+        interpRatio = std::clamp(interpRatio, 0.f, 1.f);
+
+        const size_t components = channel.componentCount;
+        const size_t lowerOffset = lowerIdx * components;
+        const size_t upperOffset = upperIdx * components;
+
+        if (channel.integral)
+        {
+            const int32_t* keyframes = m_intKeyframes.data() + channel.keyframesOffset;
+            int32_t* result = m_intResults.data() + channel.resultOffset;
+            switch (channel.interpolationType)
+            {
+            case EInterpolationType::Step:
+                std::copy_n(keyframes + lowerOffset, components, result);
+                break;
+            case EInterpolationType::Linear:
+            case EInterpolationType::Linear_Quaternions:
+                for (size_t i = 0u; i < components; ++i)
+                {
+                    const int32_t lowerVal = keyframes[lowerOffset + i];
+                    const int32_t upperVal = keyframes[upperOffset + i];
+                    result[i] = lowerVal + static_cast<int32_t>(std::lround(interpRatio * static_cast<float>(upperVal - lowerVal)));
+                }
+                break;
+            case EInterpolationType::Cubic:
+            case EInterpolationType::Cubic_Quaternions:
+            {
+                const CubicWeights weights{ interpRatio, timeBetweenKeys };
+                const float* tangentsOut = m_tangentsOut.data() + channel.tangentsOffset;
+                const float* tangentsIn = m_tangentsIn.data() + channel.tangentsOffset;
+                for (size_t i = 0u; i < components; ++i)
+                {
+                    result[i] = static_cast<int32_t>(std::lround(InterpolateCubic(
+                        static_cast<float>(keyframes[lowerOffset + i]),
+                        static_cast<float>(keyframes[upperOffset + i]),
+                        tangentsOut[lowerOffset + i],
+                        tangentsIn[upperOffset + i],
+                        weights)));
+                }
+                break;
+            }
+            }
+            return;
+        }
+
+        const float* keyframes = m_keyframes.data() + channel.keyframesOffset;
+        float* result = m_results.data() + channel.resultOffset;
+        switch (channel.interpolationType)
+        {
+        case EInterpolationType::Step:
+            std::copy_n(keyframes + lowerOffset, components, result);
+            break;
+        case EInterpolationType::Linear:
+        case EInterpolationType::Linear_Quaternions:
+            InterpolateLinear(keyframes + lowerOffset, keyframes + upperOffset, interpRatio, result, components);
+            break;
+        case EInterpolationType::Cubic:
+        case EInterpolationType::Cubic_Quaternions:
+            InterpolateCubic(keyframes + lowerOffset, keyframes + upperOffset,
+                m_tangentsOut.data() + channel.tangentsOffset + lowerOffset,
+                m_tangentsIn.data() + channel.tangentsOffset + upperOffset,
+                CubicWeights{ interpRatio, timeBetweenKeys }, result, components);
+            break;
+        }
+
+        if (channel.interpolationType == EInterpolationType::Linear_Quaternions || channel.interpolationType == EInterpolationType::Cubic_Quaternions)
+        {
+            assert(components == 4u);
+            NormalizeQuaternion(result);
+        }
+    }
+
+    size_t AnimationEvaluator::getChannelCount() const
+    {
+        return m_channels.size();
+    }
+
+    EPropertyType AnimationEvaluator::getValueType(size_t channelIdx) const
+    {
+        return m_channels[channelIdx].valueType;
+    }
+
+    size_t AnimationEvaluator::getComponentCount(size_t channelIdx) const
+    {
+        return m_channels[channelIdx].componentCount;
+    }
+
+    size_t AnimationEvaluator::getKeyframeCount(size_t channelIdx) const
+    {
+        return m_channels[channelIdx].keyframeCount;
+    }
+
+    const float* AnimationEvaluator::getFloatResult(size_t channelIdx) const
+    {
+        assert(!m_channels[channelIdx].integral);
+        return m_results.data() + m_channels[channelIdx].resultOffset;
+    }
+
+    const int32_t* AnimationEvaluator::getIntResult(size_t channelIdx) const
+    {
+        assert(m_channels[channelIdx].integral);
+        return m_intResults.data() + m_channels[channelIdx].resultOffset;
+    }
+
+    void AnimationEvaluator::setTimestamp(size_t channelIdx, size_t keyframeIdx, float timestamp)
+    {
+        const Channel& channel = m_channels[channelIdx];
+        assert(keyframeIdx < channel.keyframeCount);
+        m_timestamps[channel.timestampsOffset + keyframeIdx] = timestamp;
+    }
+}
@@ -0,0 +1,106 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#pragma once
+
+#include "ramses-logic/AnimationTypes.h"
+#include "ramses-logic/EPropertyType.h"
+
+#include <vector>
+#include <cstdint>
+#include <cassert>
+#include <type_traits>
+
+namespace ramses::internal
+{
+    // Evaluates all channels of an animation in a single pass, without allocations.
+    // Channel data is stored as structure of arrays - timestamps, keyframe components and tangent components
+    // of all channels are each stored in one contiguous buffer, results of all channels in another one.
+    // Every channel keeps a cursor to the keyframe found in previous evaluation, so that monotonic playback
+    // does not need to search timestamps (falls back to binary search when time jumps).
+    class AnimationEvaluator
+    {
+    public:
+        void addChannel(const AnimationChannel& channel);
+
+        void evaluate(float time);
+
+        [[nodiscard]] size_t getChannelCount() const;
+        [[nodiscard]] EPropertyType getValueType(size_t channelIdx) const;
+        [[nodiscard]] size_t getComponentCount(size_t channelIdx) const;
+        [[nodiscard]] size_t getKeyframeCount(size_t channelIdx) const;
+
+        // results of last evaluation, integral channels (int32 based types) have int results, others float results
+        [[nodiscard]] const float* getFloatResult(size_t channelIdx) const;
+        [[nodiscard]] const int32_t* getIntResult(size_t channelIdx) const;
+
+        // modification of channel data in runtime, value type must match channel data type
+        void setTimestamp(size_t channelIdx, size_t keyframeIdx, float timestamp);
+        template <typename T>
+        void setKeyframe(size_t channelIdx, size_t keyframeIdx, const T& value);
+
+        // timestamps are searched linearly starting from cursor up to this count of keyframes before falling back to binary search
+        static constexpr size_t MaxCursorSteps = 4u;
+
+    private:
+        struct Channel
+        {
+            EInterpolationType interpolationType = EInterpolationType::Linear;
+            EPropertyType valueType = EPropertyType::Float;
+            bool integral = false;
+            size_t componentCount = 0u;
+            size_t keyframeCount = 0u;
+            size_t timestampsOffset = 0u;
+            // offset into m_keyframes or m_intKeyframes (integral), tangents (cubic only) have same layout as float keyframes
+            size_t keyframesOffset = 0u;
+            size_t tangentsOffset = 0u;
+            // offset into m_results or m_intResults (integral)
+            size_t resultOffset = 0u;
+            // index of first timestamp greater than time of previous evaluation
+            size_t cursor = 0u;
+        };
+
+        void evaluateChannel(Channel& channel, float time);
+
+        std::vector<Channel> m_channels;
+        std::vector<float> m_timestamps;
+        std::vector<float> m_keyframes;
+        std::vector<int32_t> m_intKeyframes;
+        std::vector<float> m_tangentsIn;
+        std::vector<float> m_tangentsOut;
+        std::vector<float> m_results;
+        std::vector<int32_t> m_intResults;
+    };
+
+    template <typename T>
+    void AnimationEvaluator::setKeyframe(size_t channelIdx, size_t keyframeIdx, const T& value)
+    {
+        const Channel& channel = m_channels[channelIdx];
+        assert(keyframeIdx < channel.keyframeCount);
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            assert(channel.componentCount == 1u);
+            if constexpr (std::is_integral_v<T>)
+                m_intKeyframes[channel.keyframesOffset + keyframeIdx] = value;
+            else
+                m_keyframes[channel.keyframesOffset + keyframeIdx] = value;
+        }
+        else
+        {
+            assert(channel.componentCount == static_cast<size_t>(T::length()));
+            const size_t offset = channel.keyframesOffset + keyframeIdx * channel.componentCount;
+            for (size_t i = 0u; i < channel.componentCount; ++i)
+            {
+                if constexpr (std::is_integral_v<typename T::value_type>)
+                    m_intKeyframes[offset + i] = value[static_cast<typename T::length_type>(i)];
+                else
+                    m_keyframes[offset + i] = value[static_cast<typename T::length_type>(i)];
+            }
+        }
+    }
+}
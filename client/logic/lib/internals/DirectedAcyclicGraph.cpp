@@ -10,7 +10,6 @@
 
 #include <cassert>
 #include <algorithm>
-#include <unordered_set>
 #include <numeric>
 #include <iterator>
 
@@ -18,143 +17,96 @@ namespace ramses::internal
 {
     void DirectedAcyclicGraph::addNode(Node& node)
     {
-        assert(m_nodeOutgoingEdges.count(&node) == 0);
-        assert(m_nodeIncomingEdges.count(&node) == 0);
-        m_nodeOutgoingEdges.insert({ &node, {} });
-        m_nodeIncomingEdges.insert({ &node, {} });
+        assert(m_nodeIndices.count(&node) == 0);
+
+        NodeIndex nodeIndex = InvalidNodeIndex;
+        if (m_freeNodeIndices.empty())
+        {
+            nodeIndex = static_cast<NodeIndex>(m_nodes.size());
+            m_nodes.emplace_back();
+            m_visitedNodes.push_back(false);
+        }
+        else
+        {
+            nodeIndex = m_freeNodeIndices.back();
+            m_freeNodeIndices.pop_back();
+        }
+
+        // new node has no edges and can be put at the end of current order
+        NodeEntry& entry = m_nodes[nodeIndex];
+        entry.node = &node;
+        entry.rank = m_rankedNodes.size();
+        m_rankedNodes.push_back(nodeIndex);
+        m_nodeIndices.insert({ &node, nodeIndex });
     }
 
     void DirectedAcyclicGraph::removeNode(Node& nodeToRemove)
     {
-        assert(m_nodeOutgoingEdges.count(&nodeToRemove) != 0);
-        assert(m_nodeIncomingEdges.count(&nodeToRemove) != 0);
+        const NodeIndex nodeIndex = getNodeIndex(nodeToRemove);
+        NodeEntry& entry = m_nodes[nodeIndex];
 
         // remove node from all edge lists pointing to it from source nodes
-        const auto srcNodesIt = m_nodeIncomingEdges.find(&nodeToRemove);
-        for (const auto srcNode : srcNodesIt->second)
+        for (const NodeIndex srcNode : entry.sourceNodes)
         {
-            EdgeList& srcNodeOutgoingEdges = m_nodeOutgoingEdges.find(srcNode)->second;
-            const auto it = std::remove_if(srcNodeOutgoingEdges.begin(), srcNodeOutgoingEdges.end(),
-                [&nodeToRemove](const auto& e) { return e.target == &nodeToRemove; });
-            srcNodeOutgoingEdges.erase(it, srcNodeOutgoingEdges.end());
+            EdgeList& srcNodeOutgoingEdges = m_nodes[srcNode].outgoingEdges;
+            srcNodeOutgoingEdges.erase(FindEdgeToNode(srcNodeOutgoingEdges, nodeIndex));
         }
 
-        // remove node from all edge lists pointing to it from its target nodes
-        const auto tgtNodesIt = m_nodeOutgoingEdges.find(&nodeToRemove);
-        for (const auto& tgtNode : tgtNodesIt->second)
+        // remove node from all source lists of its target nodes
+        for (const auto& tgtNode : entry.outgoingEdges)
         {
-            auto& tgtNodeEdges = m_nodeIncomingEdges.find(tgtNode.target)->second;
-            tgtNodeEdges.erase(std::find(tgtNodeEdges.begin(), tgtNodeEdges.end(), &nodeToRemove));
+            auto& tgtNodeSources = m_nodes[tgtNode.target].sourceNodes;
+            tgtNodeSources.erase(std::find(tgtNodeSources.begin(), tgtNodeSources.end(), nodeIndex));
         }
 
-        // remove node from both maps
-        m_nodeIncomingEdges.erase(srcNodesIt);
-        m_nodeOutgoingEdges.erase(&nodeToRemove);
-    }
-
-    // This is a slightly exotic sorting algorithm for DAGs
-    // It works based on these general principles:
-    // - Traverse the DAG starting from the root nodes
-    // - Keep the nodes in a sparsely sorted queue (with more slots than actual nodes, and some empty slots)
-    // - Any time a new 'edge' is traversed, moves the 'target' node of the edge to the last position of the queue
-    // - If number of iterations exceeds N^2, there was a loop in the graph -> abort
-    // This is supposed to work fast, because the queue is never re-allocated or re-sorted, only grows incrementally, and
-    // we only need to run a second time and remove the 'empty slots' to get the final order.
-    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes() const
-    {
-        const size_t totalNodeCount = m_nodeOutgoingEdges.size();
+        // removing a node does not affect the relative order of the remaining nodes
+        m_rankedNodes[entry.rank] = InvalidNodeIndex;
+        ++m_rankedNodesHoleCount;
 
-        // This remembers temporarily the position of node N in 'nodeQueue' (see below)
-        // This index can change in different loops of the code below
-        std::unordered_map<const Node*, size_t> nodeIndexIntoQueue;
-        nodeIndexIntoQueue.reserve(totalNodeCount);
+        entry.node = nullptr;
+        entry.outgoingEdges.clear();
+        entry.sourceNodes.clear();
+        m_freeNodeIndices.push_back(nodeIndex);
+        m_nodeIndices.erase(&nodeToRemove);
 
-        // This is a queue of nodes which is:
-        // - partially sorted (at any given time during the loops, the first X entries are sorted, while the rest is not sorted yet)
-        // - sparse (some entries can be nullptr) - of nodes which were moved during the algorithm, see below
-        // - sorted at the end of the loop (by their topological rank)
-        // - starts with the root nodes (they are always at the beginning)
-        NodeVector sparseNodeQueue = collectRootNodes();
+        if (m_rankedNodesHoleCount > m_nodeIndices.size())
+            compactRanks();
+    }
 
-        // Cycle condition - can't find root nodes among a non-empty set of nodes
-        if (sparseNodeQueue.empty() && !m_nodeOutgoingEdges.empty())
-        {
+    std::optional<NodeVector> DirectedAcyclicGraph::getTopologicallySortedNodes()
+    {
+        if (m_hasCycle && !recomputeRanks())
             return std::nullopt;
-        }
 
-        // sparseNodeQueue grows here all the time
-        // TODO Violin rework algorithm to not grow and loop over the same container
-        for (size_t i = 0; i < sparseNodeQueue.size(); ++i)
+        NodeVector sortedNodes;
+        sortedNodes.reserve(m_nodeIndices.size());
+        for (const NodeIndex nodeIndex : m_rankedNodes)
         {
-            if (i > totalNodeCount * totalNodeCount)
-            {
-                // TODO Violin this is a primitive loop detection. Replace with a proper graph-based solution!
-                // The inner and the outer loop are bound by N(number of nodes), so exceeding that is a
-                // sufficient condition that there was a loop
-                return std::nullopt;
-            }
-
-            // Get the next node in the queue and process based on its outgoing edges
-            Node* nextNode = sparseNodeQueue[i];
-            // sparseNodeQueue has nullptr holes - skip those
-            if (nextNode != nullptr)
-            {
-                const EdgeList& nextNodeEdges = m_nodeOutgoingEdges.find(nextNode)->second;
-
-                // For each edge, put the 'target' node to the end of the queue (this order may be temporarily wrong,
-                // because we don't know if those nodes have also edges between them which would affect this order)
-                // What happens if it's wrong? see the if() inside the loop
-                for (const auto& outgoingEdge : nextNodeEdges)
-                {
-                    // Put the node at the end of the 'sparseNodeQueue' and remember the index
-                    Node* outgoingEdgeTarget = outgoingEdge.target;
-                    sparseNodeQueue.emplace_back(outgoingEdgeTarget);
-                    const size_t targetNodeIndex = sparseNodeQueue.size() - 1;
-
-                    const auto potentiallyAlreadyProcessedNode = nodeIndexIntoQueue.find(outgoingEdgeTarget);
-                    // target node not processed yet?
-                    if (potentiallyAlreadyProcessedNode == nodeIndexIntoQueue.end())
-                    {
-                        // => insert to processed queue, with current index from 'queue'
-                        nodeIndexIntoQueue.insert({ outgoingEdgeTarget, targetNodeIndex });
-                    }
-                    // target node processed already?
-                    else
-                    {
-                        // => move the node from its last computed index to the current one
-                        // (and set to nullptr on its last position so that it does not occur twice in the queue)
-                        // Why do we do this? Because it makes sure that any time there is a 'new edge' to a node,
-                        // it is moved to the last position in the queue, unless it has no 'incoming edges' (root node)
-                        // or it has exactly one incoming edge (and never needs to be re-sorted)
-                        sparseNodeQueue[potentiallyAlreadyProcessedNode->second] = nullptr;
-                        potentiallyAlreadyProcessedNode->second = targetNodeIndex;
-                    }
-                }
-            }
+            if (nodeIndex != InvalidNodeIndex)
+                sortedNodes.push_back(m_nodes[nodeIndex].node);
         }
 
-        // Some nodes are nullptr because of the special 'bubble sort' sorting method
-        sparseNodeQueue.erase(std::remove(sparseNodeQueue.begin(), sparseNodeQueue.end(), nullptr), sparseNodeQueue.end());
-
-        return sparseNodeQueue;
+        return sortedNodes;
     }
 
     bool DirectedAcyclicGraph::addEdge(Node& source, Node& target)
     {
-        assert(m_nodeOutgoingEdges.count(&source) != 0);
-        assert(m_nodeOutgoingEdges.count(&target) != 0);
-        assert(m_nodeIncomingEdges.count(&source) != 0);
-        assert(m_nodeIncomingEdges.count(&target) != 0);
+        const NodeIndex sourceIndex = getNodeIndex(source);
+        const NodeIndex targetIndex = getNodeIndex(target);
 
-        auto& nodeEdges = m_nodeOutgoingEdges.find(&source)->second;
-        auto edgeBetweenNodes = FindEdgeToNode(nodeEdges, target);
+        auto& nodeEdges = m_nodes[sourceIndex].outgoingEdges;
+        auto edgeBetweenNodes = FindEdgeToNode(nodeEdges, targetIndex);
         const bool isNewConnection = (edgeBetweenNodes == nodeEdges.end());
         if (isNewConnection)
         {
-            nodeEdges.push_back({ &target, 1u });
-            auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
-            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) == tgtToSourcesList.cend());
-            tgtToSourcesList.push_back(&source);
+            nodeEdges.push_back({ targetIndex, 1u });
+            auto& tgtToSourcesList = m_nodes[targetIndex].sourceNodes;
+            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), sourceIndex) == tgtToSourcesList.cend());
+            tgtToSourcesList.push_back(sourceIndex);
+
+            // only a new edge pointing against current order requires reordering
+            if (!m_hasCycle && m_nodes[targetIndex].rank < m_nodes[sourceIndex].rank)
+                reorderAffectedNodes(sourceIndex, targetIndex);
         }
         else
         {
@@ -166,36 +118,32 @@ namespace ramses::internal
 
     void DirectedAcyclicGraph::removeEdge(Node& source, Node& target)
     {
-        assert(m_nodeOutgoingEdges.count(&source) != 0);
-        assert(m_nodeOutgoingEdges.count(&target) != 0);
-        assert(m_nodeIncomingEdges.count(&source) != 0);
-        assert(m_nodeIncomingEdges.count(&target) != 0);
+        const NodeIndex sourceIndex = getNodeIndex(source);
+        const NodeIndex targetIndex = getNodeIndex(target);
 
-        auto& srcNodeEdges = m_nodeOutgoingEdges.find(&source)->second;
-        auto outgoingEdge = FindEdgeToNode(srcNodeEdges, target);
+        auto& srcNodeEdges = m_nodes[sourceIndex].outgoingEdges;
+        auto outgoingEdge = FindEdgeToNode(srcNodeEdges, targetIndex);
         assert(outgoingEdge != srcNodeEdges.end());
         assert(outgoingEdge->multiplicity > 0u);
         --outgoingEdge->multiplicity;
         if (outgoingEdge->multiplicity == 0)
         {
             srcNodeEdges.erase(outgoingEdge);
-            auto& tgtToSourcesList = m_nodeIncomingEdges.find(&target)->second;
-            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), &source) != tgtToSourcesList.cend());
-            tgtToSourcesList.erase(std::find(tgtToSourcesList.begin(), tgtToSourcesList.end(), &source));
+            auto& tgtToSourcesList = m_nodes[targetIndex].sourceNodes;
+            assert(std::find(tgtToSourcesList.cbegin(), tgtToSourcesList.cend(), sourceIndex) != tgtToSourcesList.cend());
+            tgtToSourcesList.erase(std::find(tgtToSourcesList.begin(), tgtToSourcesList.end(), sourceIndex));
         }
     }
 
     size_t DirectedAcyclicGraph::getInDegree(Node& node) const
     {
-        assert(m_nodeOutgoingEdges.count(&node) != 0);
-        assert(m_nodeIncomingEdges.count(&node) != 0);
+        const NodeIndex nodeIndex = getNodeIndex(node);
 
         size_t edgeCount = 0u;
-        const auto srcNodesList = m_nodeIncomingEdges.find(&node)->second;
-        for (const auto srcNode : srcNodesList)
+        for (const NodeIndex srcNode : m_nodes[nodeIndex].sourceNodes)
         {
-            const EdgeList& srcNodeOutgoingEdges = m_nodeOutgoingEdges.find(srcNode)->second;
-            const auto edgeIt = FindEdgeToNode(srcNodeOutgoingEdges, node);
+            const EdgeList& srcNodeOutgoingEdges = m_nodes[srcNode].outgoingEdges;
+            const auto edgeIt = FindEdgeToNode(srcNodeOutgoingEdges, nodeIndex);
             assert(edgeIt != srcNodeOutgoingEdges.cend());
             edgeCount += edgeIt->multiplicity;
         }
@@ -205,40 +153,185 @@ namespace ramses::internal
 
     size_t DirectedAcyclicGraph::getOutDegree(Node& node) const
     {
-        assert(containsNode(node));
-        const auto it = m_nodeOutgoingEdges.find(&node);
-        return std::accumulate(it->second.cbegin(), it->second.cend(), size_t(0u), [](size_t sum, const Edge& e) {
+        const EdgeList& outgoingEdges = m_nodes[getNodeIndex(node)].outgoingEdges;
+        return std::accumulate(outgoingEdges.cbegin(), outgoingEdges.cend(), size_t(0u), [](size_t sum, const Edge& e) {
             return sum + e.multiplicity;
         });
     }
 
-    NodeVector DirectedAcyclicGraph::collectRootNodes() const
+    bool DirectedAcyclicGraph::containsNode(Node& node) const
+    {
+        return m_nodeIndices.find(&node) != m_nodeIndices.end();
+    }
+
+    DirectedAcyclicGraph::NodeIndex DirectedAcyclicGraph::getNodeIndex(const Node& node) const
+    {
+        const auto it = m_nodeIndices.find(&node);
+        assert(it != m_nodeIndices.end());
+        return it->second;
+    }
+
+    // Pearce-Kelly reordering after adding edge source->target where target is currently ranked before source:
+    // - forward search from target collects all nodes reachable from it which are ranked before source
+    //   (reaching source means the new edge closed a cycle)
+    // - backward search from source collects all nodes reaching source which are ranked after target
+    // Only these nodes are in wrong order, they are reassigned to the ranks they occupied together,
+    // first the backward affected then the forward affected nodes, each group keeping its relative order.
+    void DirectedAcyclicGraph::reorderAffectedNodes(NodeIndex source, NodeIndex target)
     {
-        NodeVector rootNodes;
-        // reserve to all nodes count because it will be used to store all sorted nodes later
-        rootNodes.reserve(m_nodeIncomingEdges.size());
+        const size_t lowerRank = m_nodes[target].rank;
+        const size_t upperRank = m_nodes[source].rank;
 
-        for (const auto& nodeIngoingEdges : m_nodeIncomingEdges)
+        m_forwardAffectedNodes.clear();
+        m_backwardAffectedNodes.clear();
+        const bool closedCycle = !collectForwardAffectedNodes(target, upperRank);
+        if (!closedCycle)
+            collectBackwardAffectedNodes(source, lowerRank);
+
+        for (const NodeIndex nodeIndex : m_forwardAffectedNodes)
+            m_visitedNodes[nodeIndex] = false;
+        for (const NodeIndex nodeIndex : m_backwardAffectedNodes)
+            m_visitedNodes[nodeIndex] = false;
+
+        if (closedCycle)
         {
-            if (nodeIngoingEdges.second.empty())
-                rootNodes.push_back(nodeIngoingEdges.first);
+            m_hasCycle = true;
+            return;
         }
 
-        return rootNodes;
+        const auto byRank = [this](NodeIndex n1, NodeIndex n2) { return m_nodes[n1].rank < m_nodes[n2].rank; };
+        std::sort(m_forwardAffectedNodes.begin(), m_forwardAffectedNodes.end(), byRank);
+        std::sort(m_backwardAffectedNodes.begin(), m_backwardAffectedNodes.end(), byRank);
+
+        m_affectedRanks.clear();
+        for (const NodeIndex nodeIndex : m_backwardAffectedNodes)
+            m_affectedRanks.push_back(m_nodes[nodeIndex].rank);
+        for (const NodeIndex nodeIndex : m_forwardAffectedNodes)
+            m_affectedRanks.push_back(m_nodes[nodeIndex].rank);
+        std::sort(m_affectedRanks.begin(), m_affectedRanks.end());
+
+        size_t rankIdx = 0u;
+        for (const NodeIndexVector* affectedNodes : { &m_backwardAffectedNodes, &m_forwardAffectedNodes })
+        {
+            for (const NodeIndex nodeIndex : *affectedNodes)
+            {
+                const size_t rank = m_affectedRanks[rankIdx++];
+                m_nodes[nodeIndex].rank = rank;
+                m_rankedNodes[rank] = nodeIndex;
+            }
+        }
     }
 
-    bool DirectedAcyclicGraph::containsNode(Node& node) const
+    bool DirectedAcyclicGraph::collectForwardAffectedNodes(NodeIndex target, size_t upperRank)
+    {
+        m_traversalStack.clear();
+        m_traversalStack.push_back(target);
+        m_visitedNodes[target] = true;
+        m_forwardAffectedNodes.push_back(target);
+
+        while (!m_traversalStack.empty())
+        {
+            const NodeIndex nodeIndex = m_traversalStack.back();
+            m_traversalStack.pop_back();
+
+            for (const Edge& edge : m_nodes[nodeIndex].outgoingEdges)
+            {
+                const size_t rank = m_nodes[edge.target].rank;
+                if (rank == upperRank)
+                    return false;
+
+                if (!m_visitedNodes[edge.target] && rank < upperRank)
+                {
+                    m_visitedNodes[edge.target] = true;
+                    m_forwardAffectedNodes.push_back(edge.target);
+                    m_traversalStack.push_back(edge.target);
+                }
+            }
+        }
+
+        return true;
+    }
+
+    void DirectedAcyclicGraph::collectBackwardAffectedNodes(NodeIndex source, size_t lowerRank)
+    {
+        m_traversalStack.clear();
+        m_traversalStack.push_back(source);
+        m_visitedNodes[source] = true;
+        m_backwardAffectedNodes.push_back(source);
+
+        while (!m_traversalStack.empty())
+        {
+            const NodeIndex nodeIndex = m_traversalStack.back();
+            m_traversalStack.pop_back();
+
+            for (const NodeIndex srcNode : m_nodes[nodeIndex].sourceNodes)
+            {
+                if (!m_visitedNodes[srcNode] && m_nodes[srcNode].rank > lowerRank)
+                {
+                    m_visitedNodes[srcNode] = true;
+                    m_backwardAffectedNodes.push_back(srcNode);
+                    m_traversalStack.push_back(srcNode);
+                }
+            }
+        }
+    }
+
+    // Full topological sort (Kahn), only needed while graph contains or contained a cycle.
+    // Nodes without dependencies between them keep their previous relative order.
+    bool DirectedAcyclicGraph::recomputeRanks()
+    {
+        std::vector<size_t> remainingSourceCounts(m_nodes.size(), 0u);
+        for (const NodeIndex nodeIndex : m_rankedNodes)
+        {
+            if (nodeIndex != InvalidNodeIndex)
+                remainingSourceCounts[nodeIndex] = m_nodes[nodeIndex].sourceNodes.size();
+        }
+
+        NodeIndexVector sortedNodes;
+        sortedNodes.reserve(m_nodeIndices.size());
+        for (const NodeIndex nodeIndex : m_rankedNodes)
+        {
+            if (nodeIndex != InvalidNodeIndex && remainingSourceCounts[nodeIndex] == 0u)
+                sortedNodes.push_back(nodeIndex);
+        }
+
+        for (size_t i = 0u; i < sortedNodes.size(); ++i)
+        {
+            for (const Edge& edge : m_nodes[sortedNodes[i]].outgoingEdges)
+            {
+                if (--remainingSourceCounts[edge.target] == 0u)
+                    sortedNodes.push_back(edge.target);
+            }
+        }
+
+        // nodes in a cycle never reach zero remaining sources
+        if (sortedNodes.size() != m_nodeIndices.size())
+            return false;
+
+        m_rankedNodes = std::move(sortedNodes);
+        m_rankedNodesHoleCount = 0u;
+        for (size_t rank = 0u; rank < m_rankedNodes.size(); ++rank)
+            m_nodes[m_rankedNodes[rank]].rank = rank;
+        m_hasCycle = false;
+
+        return true;
+    }
+
+    void DirectedAcyclicGraph::compactRanks()
     {
-        return m_nodeOutgoingEdges.find(&node) != m_nodeOutgoingEdges.end();
+        m_rankedNodes.erase(std::remove(m_rankedNodes.begin(), m_rankedNodes.end(), InvalidNodeIndex), m_rankedNodes.end());
+        m_rankedNodesHoleCount = 0u;
+        for (size_t rank = 0u; rank < m_rankedNodes.size(); ++rank)
+            m_nodes[m_rankedNodes[rank]].rank = rank;
     }
 
-    DirectedAcyclicGraph::EdgeList::const_iterator DirectedAcyclicGraph::FindEdgeToNode(const EdgeList& vec, const Node& node)
+    DirectedAcyclicGraph::EdgeList::const_iterator DirectedAcyclicGraph::FindEdgeToNode(const EdgeList& vec, NodeIndex node)
     {
-        return std::find_if(vec.begin(), vec.end(), [&node](const auto& e) { return e.target == &node; });
+        return std::find_if(vec.begin(), vec.end(), [node](const auto& e) { return e.target == node; });
     }
 
-    DirectedAcyclicGraph::EdgeList::iterator DirectedAcyclicGraph::FindEdgeToNode(EdgeList& vec, const Node& node)
+    DirectedAcyclicGraph::EdgeList::iterator DirectedAcyclicGraph::FindEdgeToNode(EdgeList& vec, NodeIndex node)
     {
-        return std::find_if(vec.begin(), vec.end(), [&node](const auto& e) { return e.target == &node; });
+        return std::find_if(vec.begin(), vec.end(), [node](const auto& e) { return e.target == node; });
     }
 }
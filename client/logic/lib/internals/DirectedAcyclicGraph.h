@@ -12,6 +12,7 @@
 #include <optional>
 #include <unordered_map>
 #include <cstdint>
+#include <limits>
 
 namespace ramses::internal
 {
@@ -30,8 +31,9 @@ namespace ramses::internal
     // number of total links of node properties to other nodes' properties, i.e. if two nodes A and B have three connected
     // properties, and node A and C have two connected properties, then addEdge(A, B) will have been called 3 times,
     // addEdge(A, C) two times, and A will have outDegree=5.
-    // Topological sort result is cached because it's sensitive for performance (and is only
-    // executed once before update()
+    // The topological order is maintained incrementally (Pearce-Kelly dynamic topological sort): adding an edge
+    // which contradicts the current order only reorders the nodes affected by it, removing edges or nodes never
+    // invalidates the order. Only after an edge closed a cycle the order is fully recomputed until the cycle is resolved.
     class DirectedAcyclicGraph
     {
     public:
@@ -45,32 +47,62 @@ namespace ramses::internal
         bool addEdge(Node& source, Node& target);
         void removeEdge(Node& source, Node& target);
 
-        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes() const;
+        [[nodiscard]] std::optional<NodeVector> getTopologicallySortedNodes();
 
         // For testing only
         [[nodiscard]] size_t getInDegree(Node& node) const;
         [[nodiscard]] size_t getOutDegree(Node& node) const;
 
     private:
+        // Nodes are stored contiguously and referenced by their index, indices of removed nodes are reused
+        using NodeIndex = uint32_t;
+        static constexpr NodeIndex InvalidNodeIndex = std::numeric_limits<NodeIndex>::max();
+        using NodeIndexVector = std::vector<NodeIndex>;
+
         struct Edge
         {
-            Node* target = nullptr;
+            NodeIndex target = InvalidNodeIndex;
             size_t multiplicity = 0u;
         };
         using EdgeList = std::vector<Edge>;
 
-        NodeVector collectRootNodes() const;
+        struct NodeEntry
+        {
+            Node* node = nullptr;
+            // position of node in m_rankedNodes
+            size_t rank = 0u;
+            // Edges from this node to target nodes (edge can have more than 1 instance represented by multiplicity)
+            EdgeList outgoingEdges;
+            // Reverse relation to all source nodes of this node (here without keeping edge multiplicity count)
+            NodeIndexVector sourceNodes;
+        };
+
+        [[nodiscard]] NodeIndex getNodeIndex(const Node& node) const;
+        void reorderAffectedNodes(NodeIndex source, NodeIndex target);
+        [[nodiscard]] bool collectForwardAffectedNodes(NodeIndex target, size_t upperRank);
+        void collectBackwardAffectedNodes(NodeIndex source, size_t lowerRank);
+        [[nodiscard]] bool recomputeRanks();
+        void compactRanks();
+
+        static EdgeList::const_iterator FindEdgeToNode(const EdgeList& vec, NodeIndex node);
+        static EdgeList::iterator FindEdgeToNode(EdgeList& vec, NodeIndex node);
 
-        static EdgeList::const_iterator FindEdgeToNode(const EdgeList& vec, const Node& node);
-        static EdgeList::iterator FindEdgeToNode(EdgeList& vec, const Node& node);
+        std::vector<NodeEntry> m_nodes;
+        NodeIndexVector m_freeNodeIndices;
+        // Only used to resolve nodes passed to the public interface, all graph traversals use node indices
+        std::unordered_map<const Node*, NodeIndex> m_nodeIndices;
 
-        // Stores both nodes and their edges in one hashmap
-        // If a node has no outgoing links, the 'EdgeList' is empty
-        // Each entry in 'EdgeList' represents an edge to another node
+        // Nodes in topological order, removed nodes leave holes (InvalidNodeIndex) until compacted
+        NodeIndexVector m_rankedNodes;
+        size_t m_rankedNodesHoleCount = 0u;
+        // Set when an edge closed a cycle, ranks are invalid until cycle is resolved
+        bool m_hasCycle = false;
 
-        // Edges from source node to target nodes (edge can have more than 1 instance represented by multiplicity)
-        std::unordered_map<Node*, EdgeList> m_nodeOutgoingEdges;
-        // Reverse relation from target node to all its source nodes (here without keeping edge multiplicity count)
-        std::unordered_map<Node*, NodeVector> m_nodeIncomingEdges;
+        // Temporary data for reordering nodes, kept to avoid allocations
+        std::vector<bool> m_visitedNodes;
+        NodeIndexVector m_traversalStack;
+        NodeIndexVector m_forwardAffectedNodes;
+        NodeIndexVector m_backwardAffectedNodes;
+        std::vector<size_t> m_affectedRanks;
     };
 }
@@ -18,6 +18,7 @@
 #include "internals/TypeUtils.h"
 
 #include <cassert>
+#include <algorithm>
 #include "fmt/format.h"
 
 namespace ramses::internal
@@ -43,6 +44,11 @@ namespace ramses::internal
             NodeVector& cachedNodes = *m_cachedTopologicallySortedNodes;
             cachedNodes.erase(std::remove(cachedNodes.begin(), cachedNodes.end(), &node), cachedNodes.end());
         }
+        else
+        {
+            // removed node might have been part of a cycle
+            m_nodeTopologyChanged = true;
+        }
     }
 
     bool LogicNodeDependencies::isLinked(const LogicNodeImpl& logicNode) const
@@ -199,6 +205,10 @@ namespace ramses::internal
             auto& node = output.getLogicNode();
             auto& targetNode = input.getLogicNode();
             m_logicNodeDAG.removeEdge(node, targetNode);
+
+            // removed edge might have been part of a cycle
+            if (!m_cachedTopologicallySortedNodes)
+                m_nodeTopologyChanged = true;
         }
 
         input.resetIncomingLink();
@@ -223,5 +233,8 @@ namespace ramses::internal
         assert(&node != &binding);
 
         m_logicNodeDAG.removeEdge(binding, node);
+
+        if (!m_cachedTopologicallySortedNodes)
+            m_nodeTopologyChanged = true;
     }
 }
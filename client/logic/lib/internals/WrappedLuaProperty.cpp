@@ -14,6 +14,8 @@
 
 #include "impl/PropertyImpl.h"
 
+#include <algorithm>
+
 namespace ramses::internal
 {
     class BadStructAccess : public sol::error
@@ -37,6 +39,13 @@ namespace ramses::internal
         {
             m_wrappedChildProperties.emplace_back(*propertyToWrap.getChild(i)->m_impl);
         }
+
+        if (propertyToWrap.getType() == EPropertyType::Struct)
+        {
+            m_childNames.reserve(m_wrappedChildProperties.size());
+            for (const auto& child : m_wrappedChildProperties)
+                m_childNames.push_back(child.m_wrappedProperty.get().getName());
+        }
     }
 
     sol::object WrappedLuaProperty::index(sol::this_state solState, const sol::object& index) const
@@ -225,12 +234,10 @@ namespace ramses::internal
                 sol_helper::throwSolException("Bad access to property '{}'! {}", m_wrappedProperty.get().getName(), structFieldName.getError());
             }
 
-            for (size_t i = 0; i < m_wrappedChildProperties.size(); ++i)
+            const auto nameIt = std::find(m_childNames.cbegin(), m_childNames.cend(), structFieldName.getData());
+            if (nameIt != m_childNames.cend())
             {
-                if (m_wrappedChildProperties[i].m_wrappedProperty.get().getName() == structFieldName.getData())
-                {
-                    return i;
-                }
+                return static_cast<size_t>(std::distance(m_childNames.cbegin(), nameIt));
             }
 
             throw BadStructAccess(std::string(structFieldName.getData()), fmt::format("Tried to access undefined struct property '{}'", structFieldName.getData()));
@@ -276,7 +283,7 @@ namespace ramses::internal
 
         if (TypeUtils::IsPrimitiveType(m_wrappedProperty.get().getType()))
         {
-            m_wrappedProperty.get().setValue(other.m_wrappedProperty.get().getValue());
+            m_wrappedProperty.get().setValueFrom(other.m_wrappedProperty.get());
         }
         else
         {
@@ -52,6 +52,8 @@ namespace ramses::internal
     private:
         std::reference_wrapper<PropertyImpl> m_wrappedProperty;
         std::vector<WrappedLuaProperty> m_wrappedChildProperties;
+        // Struct field names in child order, scanned on field access without touching the child properties
+        std::vector<std::string_view> m_childNames;
 
         template <typename T>
         [[nodiscard]] sol::object extractVectorComponent(sol::this_state solState, const sol::object& index) const;
@@ -298,4 +298,123 @@ namespace ramses::internal
         setTickerAndUpdate(1000000);
         expectNodeValues(1.f, 0.f);
     }
+
+    TEST_F(ALogicEngine_Animations, UpdatesAnimationsWithWorkerThreadsSameAsWithoutWorkerThreads)
+    {
+        const auto dataArray = m_logicEngine.createDataArray(std::vector<float>{ 0.f, 1.f }, "dataarray2");
+        AnimationNodeConfig config;
+        config.addChannel({ "channel", dataArray, dataArray, ramses::EInterpolationType::Linear });
+
+        // control script -> many independent animations -> helper script per animation
+        const auto controlScriptSrc = R"(
+            function interface(IN,OUT)
+                IN.progress = Type:Float()
+                OUT.progress = Type:Float()
+            end
+            function run(IN,OUT)
+                OUT.progress = IN.progress
+            end
+            )";
+        const auto controlScript = m_logicEngine.createLuaScript(controlScriptSrc);
+
+        constexpr size_t animCount = 100u;
+        std::vector<AnimationNode*> animations;
+        std::vector<LuaScript*> helperScripts;
+        for (size_t i = 0u; i < animCount; ++i)
+        {
+            animations.push_back(m_logicEngine.createAnimationNode(config));
+            helperScripts.push_back(m_logicEngine.createLuaScript(ScriptScalarToVecSrc));
+            // every other animation is controlled by script, the others directly via input
+            if (i % 2 == 0)
+                EXPECT_TRUE(m_logicEngine.link(*controlScript->getOutputs()->getChild("progress"), *animations.back()->getInputs()->getChild("progress")));
+            EXPECT_TRUE(m_logicEngine.link(*animations.back()->getOutputs()->getChild("channel"), *helperScripts.back()->getInputs()->getChild("scalar")));
+        }
+
+        const auto expectHelperValues = [&](float expectedControlled, float expectedNotControlled) {
+            for (size_t i = 0u; i < animCount; ++i)
+            {
+                const float expected = (i % 2 == 0 ? expectedControlled : expectedNotControlled);
+                EXPECT_FLOAT_EQ(expected, *animations[i]->getOutputs()->getChild("channel")->get<float>());
+                EXPECT_FLOAT_EQ(expected, (*helperScripts[i]->getOutputs()->getChild("vec")->get<vec3f>())[0]);
+            }
+        };
+
+        const auto setProgressAndUpdate = [&](float controlled, float notControlled) {
+            controlScript->getInputs()->getChild("progress")->set(controlled);
+            for (size_t i = 1u; i < animCount; i += 2)
+                animations[i]->getInputs()->getChild("progress")->set(notControlled);
+            EXPECT_TRUE(m_logicEngine.update());
+        };
+
+        setProgressAndUpdate(0.1f, 0.2f);
+        expectHelperValues(0.1f, 0.2f);
+
+        m_logicEngine.setUpdateWorkerThreadCount(3u);
+        setProgressAndUpdate(0.3f, 0.4f);
+        expectHelperValues(0.3f, 0.4f);
+
+        // only controlled animations change
+        setProgressAndUpdate(0.5f, 0.4f);
+        expectHelperValues(0.5f, 0.4f);
+
+        // nothing changed
+        EXPECT_TRUE(m_logicEngine.update());
+        expectHelperValues(0.5f, 0.4f);
+
+        m_logicEngine.setUpdateWorkerThreadCount(0u);
+        setProgressAndUpdate(0.7f, 0.8f);
+        expectHelperValues(0.7f, 0.8f);
+    }
+
+    TEST_F(ALogicEngine_Animations, UpdatesWeaklyLinkedAnimationsWithWorkerThreadsInSameOrderAsWithoutWorkerThreads)
+    {
+        EXPECT_TRUE(m_logicEngine.linkWeak(*m_animation1->getOutputs()->getChild("channel"), *m_animation2->getInputs()->getChild("progress")));
+
+        // animation 2 sees value of animation 1 from this update only if it is updated after animation 1
+        m_animation1->getInputs()->getChild("progress")->set(0.3f);
+        EXPECT_TRUE(m_logicEngine.update());
+        const float serialValue = *m_animation2->getOutputs()->getChild("channel")->get<float>();
+        const bool updatedInSameUpdate = (serialValue == 0.3f);
+
+        m_logicEngine.setUpdateWorkerThreadCount(3u);
+        m_animation1->getInputs()->getChild("progress")->set(0.6f);
+        EXPECT_TRUE(m_logicEngine.update());
+        EXPECT_FLOAT_EQ(0.6f, *m_animation1->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(updatedInSameUpdate ? 0.6f : 0.3f, *m_animation2->getOutputs()->getChild("channel")->get<float>());
+    }
+
+    TEST_F(ALogicEngine_Animations, FailsUpdateWithWorkerThreadsAfterSameNodesAsWithoutWorkerThreads)
+    {
+        const auto failingScriptSrc = R"(
+            function interface(IN,OUT)
+                IN.fail = Type:Bool()
+            end
+            function run(IN,OUT)
+                if IN.fail then
+                    error("fails on purpose")
+                end
+            end
+            )";
+
+        // animation -> script is independent of failing script, update with worker threads must fail after updating the same nodes as serial update
+        const auto scriptScalarToVec = m_logicEngine.createLuaScript(ScriptScalarToVecSrc);
+        const auto failingScript = m_logicEngine.createLuaScript(failingScriptSrc, {}, "failingScript");
+        EXPECT_TRUE(m_logicEngine.link(*m_animation1->getOutputs()->getChild("channel"), *scriptScalarToVec->getInputs()->getChild("scalar")));
+        failingScript->getInputs()->getChild("fail")->set(true);
+
+        m_animation1->getInputs()->getChild("progress")->set(0.3f);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(failingScript, m_logicEngine.getErrors()[0].object);
+        const bool animationUpdatedBeforeFailure = (*m_animation1->getOutputs()->getChild("channel")->get<float>() == 0.3f);
+        const bool scriptUpdatedBeforeFailure = ((*scriptScalarToVec->getOutputs()->getChild("vec")->get<vec3f>())[0] == 0.3f);
+
+        m_logicEngine.setUpdateWorkerThreadCount(3u);
+        m_animation1->getInputs()->getChild("progress")->set(0.6f);
+        EXPECT_FALSE(m_logicEngine.update());
+        ASSERT_EQ(1u, m_logicEngine.getErrors().size());
+        EXPECT_EQ(failingScript, m_logicEngine.getErrors()[0].object);
+        EXPECT_FLOAT_EQ(animationUpdatedBeforeFailure ? 0.6f : 0.f, *m_animation1->getOutputs()->getChild("channel")->get<float>());
+        EXPECT_FLOAT_EQ(scriptUpdatedBeforeFailure ? 0.6f : 0.f, (*scriptScalarToVec->getOutputs()->getChild("vec")->get<vec3f>())[0]);
+    }
 }
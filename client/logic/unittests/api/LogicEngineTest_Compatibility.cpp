@@ -384,9 +384,9 @@ namespace ramses::internal
             // higher feature level always contains content supported by lower level
             switch (logicEngine.getFeatureLevel())
             {
-            //case ramses::EFeatureLevel_02:
-            //    expectFeatureLevel02Content(logicEngine, scene);
-            //    [[fallthrough]];
+            case ramses::EFeatureLevel_02:
+                expectFeatureLevel02Content(logicEngine, scene);
+                [[fallthrough]];
             case ramses::EFeatureLevel_01:
                 checkBaseContents(logicEngine, scene);
                 break;
@@ -398,9 +398,9 @@ namespace ramses::internal
             {
             case ramses::EFeatureLevel_01:
                 expectFeatureLevel02ContentNotPresent(logicEngine);
-            //    [[fallthrough]];
-            //case EFeatureLevel_02:
-            //    break;
+                break;
+            case ramses::EFeatureLevel_02:
+                break;
             }
         }
 
@@ -425,11 +425,15 @@ namespace ramses::internal
             {
             case ramses::EFeatureLevel_01:
                 return &m_ramses.loadSceneFromFile("res/testScene_01.ramses");
+            case ramses::EFeatureLevel_02:
+                // no binary scene exported with feature level 02 yet
+                break;
             }
             return nullptr;
         }
 
-        RamsesTestSetup m_ramses;
+        // binary files were exported with feature level 01, which can only be loaded by client using the same feature level
+        RamsesTestSetup m_ramses{ ramses::EFeatureLevel_01 };
     };
 
     TEST_F(ALogicEngine_Binary_Compatibility, CanLoadAndUpdateABinaryFileExportedWithLastCompatibleVersionOfEngine_FeatureLevel01)
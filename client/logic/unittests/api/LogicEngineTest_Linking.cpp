@@ -675,6 +675,48 @@ namespace ramses
         EXPECT_EQ(5, *input2->get<int32_t>());
     }
 
+    TEST_F(ALogicEngine_Linking, PropagatesOutputToNewTargetAfterRelinkingBetweenUpdates)
+    {
+        const auto  luaScriptSource1 = R"(
+            function interface(IN,OUT)
+                IN.intInput = Type:Int32()
+                OUT.intSource = Type:Int32()
+            end
+            function run(IN,OUT)
+                OUT.intSource = IN.intInput
+            end
+        )";
+
+        const auto  luaScriptSource2 = R"(
+            function interface(IN,OUT)
+                IN.intTarget1 = Type:Int32()
+                IN.intTarget2 = Type:Int32()
+            end
+            function run(IN,OUT)
+            end
+        )";
+
+        auto sourceScript = m_logicEngine.createLuaScript(luaScriptSource1);
+        auto targetScript = m_logicEngine.createLuaScript(luaScriptSource2);
+
+        auto output = sourceScript->getOutputs()->getChild("intSource");
+        auto input1 = targetScript->getInputs()->getChild("intTarget1");
+        auto input2 = targetScript->getInputs()->getChild("intTarget2");
+
+        EXPECT_TRUE(m_logicEngine.link(*output, *input1));
+        sourceScript->getInputs()->getChild("intInput")->set(5);
+        m_logicEngine.update();
+        EXPECT_EQ(5, *input1->get<int32_t>());
+        EXPECT_EQ(0, *input2->get<int32_t>());
+
+        EXPECT_TRUE(m_logicEngine.unlink(*output, *input1));
+        EXPECT_TRUE(m_logicEngine.link(*output, *input2));
+        sourceScript->getInputs()->getChild("intInput")->set(7);
+        m_logicEngine.update();
+        EXPECT_EQ(5, *input1->get<int32_t>());
+        EXPECT_EQ(7, *input2->get<int32_t>());
+    }
+
     TEST_F(ALogicEngine_Linking, DoesNotOverwriteTargetValue_WhenUnlinked_WithoutLinkActivated)
     {
         const auto  luaScriptSource1 = R"(
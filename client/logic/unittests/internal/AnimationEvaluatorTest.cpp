@@ -0,0 +1,124 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include "internals/AnimationEvaluator.h"
+#include "internals/ApiObjects.h"
+#include "ramses-logic/DataArray.h"
+#include <algorithm>
+
+namespace ramses::internal
+{
+    class AnAnimationEvaluator : public ::testing::Test
+    {
+    protected:
+        void addChannel(EInterpolationType interpolationType, const DataArray* keyframes, const DataArray* tangentsIn = nullptr, const DataArray* tangentsOut = nullptr)
+        {
+            m_evaluator.addChannel(AnimationChannel{ "channel", m_timestamps, keyframes, interpolationType, tangentsIn, tangentsOut });
+        }
+
+        ApiObjects m_apiObjects{ EFeatureLevel_Latest };
+        AnimationEvaluator m_evaluator;
+        const DataArray* m_timestamps = m_apiObjects.createDataArray(std::vector<float>{ 0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f, 9.f }, "ts");
+        const DataArray* m_floatKeyframes = m_apiObjects.createDataArray(std::vector<float>{ 0.f, 10.f, 20.f, 30.f, 40.f, 50.f, 60.f, 70.f, 80.f, 90.f }, "floats");
+    };
+
+    TEST_F(AnAnimationEvaluator, StoresChannelInfo)
+    {
+        addChannel(EInterpolationType::Linear, m_floatKeyframes);
+        addChannel(EInterpolationType::Step, m_apiObjects.createDataArray(std::vector<vec3i>(10u, vec3i{ 1, 2, 3 }), "ints"));
+        addChannel(EInterpolationType::Linear, m_apiObjects.createDataArray(std::vector<std::vector<float>>(10u, std::vector<float>(5u, 1.f)), "arrays"));
+
+        ASSERT_EQ(3u, m_evaluator.getChannelCount());
+        EXPECT_EQ(EPropertyType::Float, m_evaluator.getValueType(0u));
+        EXPECT_EQ(EPropertyType::Vec3i, m_evaluator.getValueType(1u));
+        EXPECT_EQ(EPropertyType::Array, m_evaluator.getValueType(2u));
+        EXPECT_EQ(1u, m_evaluator.getComponentCount(0u));
+        EXPECT_EQ(3u, m_evaluator.getComponentCount(1u));
+        EXPECT_EQ(5u, m_evaluator.getComponentCount(2u));
+        EXPECT_EQ(10u, m_evaluator.getKeyframeCount(2u));
+    }
+
+    TEST_F(AnAnimationEvaluator, EvaluatesSameValuesForMonotonicPlaybackAndRandomJumps)
+    {
+        addChannel(EInterpolationType::Linear, m_floatKeyframes);
+
+        // forward with small and large steps, backward jumps, out of range
+        const std::vector<float> times{ -1.f, 0.f, 0.5f, 1.f, 1.1f, 1.2f, 3.5f, 8.9f, 9.f, 100.f, 2.5f, 2.4f, 0.1f, -5.f, 9.f, 4.5f, 0.f };
+        for (const float time : times)
+        {
+            m_evaluator.evaluate(time);
+            const float expected = std::clamp(time, 0.f, 9.f) * 10.f;
+            EXPECT_FLOAT_EQ(expected, m_evaluator.getFloatResult(0u)[0]) << time;
+        }
+    }
+
+    TEST_F(AnAnimationEvaluator, EvaluatesMultiComponentChannelsIndependently)
+    {
+        std::vector<vec4f> vec4Keyframes;
+        std::vector<std::vector<float>> arrayKeyframes;
+        for (int i = 0; i < 10; ++i)
+        {
+            const auto v = static_cast<float>(i);
+            vec4Keyframes.push_back({ v, 2.f * v, 3.f * v, 4.f * v });
+            arrayKeyframes.push_back({ v, -v, 10.f * v, 0.f, v, v });
+        }
+        addChannel(EInterpolationType::Linear, m_apiObjects.createDataArray(vec4Keyframes, "vec4"));
+        addChannel(EInterpolationType::Step, m_floatKeyframes);
+        addChannel(EInterpolationType::Linear, m_apiObjects.createDataArray(arrayKeyframes, "arrays"));
+
+        m_evaluator.evaluate(2.5f);
+        const float* vec4Result = m_evaluator.getFloatResult(0u);
+        EXPECT_FLOAT_EQ(2.5f, vec4Result[0]);
+        EXPECT_FLOAT_EQ(5.f, vec4Result[1]);
+        EXPECT_FLOAT_EQ(7.5f, vec4Result[2]);
+        EXPECT_FLOAT_EQ(10.f, vec4Result[3]);
+        EXPECT_FLOAT_EQ(20.f, m_evaluator.getFloatResult(1u)[0]);
+        const float* arrayResult = m_evaluator.getFloatResult(2u);
+        const std::vector<float> expectedArray{ 2.5f, -2.5f, 25.f, 0.f, 2.5f, 2.5f };
+        for (size_t i = 0u; i < expectedArray.size(); ++i)
+            EXPECT_FLOAT_EQ(expectedArray[i], arrayResult[i]);
+    }
+
+    TEST_F(AnAnimationEvaluator, RoundsIntegralChannelsLikeScalarInterpolation)
+    {
+        addChannel(EInterpolationType::Linear, m_apiObjects.createDataArray(std::vector<int32_t>{ 0, -1, -2, -3, -4, -5, -6, -7, -8, -9 }, "ints"));
+
+        m_evaluator.evaluate(0.5f);
+        // lower keyframe + rounded difference, i.e. 0 + lround(-0.5)
+        EXPECT_EQ(-1, m_evaluator.getIntResult(0u)[0]);
+        m_evaluator.evaluate(1.5f);
+        EXPECT_EQ(-2, m_evaluator.getIntResult(0u)[0]);
+    }
+
+    TEST_F(AnAnimationEvaluator, EvaluatesCubicQuaternionsNormalized)
+    {
+        const DataArray* quaternions = m_apiObjects.createDataArray(std::vector<vec4f>(10u, vec4f{ 1.f, 1.f, 1.f, 1.f }), "quats");
+        const DataArray* tangents = m_apiObjects.createDataArray(std::vector<vec4f>(10u, vec4f{ 0.f, 0.f, 0.f, 0.f }), "tangents");
+        addChannel(EInterpolationType::Cubic_Quaternions, quaternions, tangents, tangents);
+
+        m_evaluator.evaluate(4.3f);
+        for (size_t i = 0u; i < 4u; ++i)
+            EXPECT_FLOAT_EQ(0.5f, m_evaluator.getFloatResult(0u)[i]);
+    }
+
+    TEST_F(AnAnimationEvaluator, UsesModifiedChannelData)
+    {
+        addChannel(EInterpolationType::Linear, m_floatKeyframes);
+        m_evaluator.evaluate(2.f);
+        EXPECT_FLOAT_EQ(20.f, m_evaluator.getFloatResult(0u)[0]);
+
+        m_evaluator.setKeyframe(0u, 2u, 200.f);
+        m_evaluator.setTimestamp(0u, 3u, 4.f);
+        m_evaluator.evaluate(2.f);
+        EXPECT_FLOAT_EQ(200.f, m_evaluator.getFloatResult(0u)[0]);
+        m_evaluator.evaluate(3.f);
+        EXPECT_FLOAT_EQ(115.f, m_evaluator.getFloatResult(0u)[0]);
+    }
+}
@@ -517,6 +517,55 @@ namespace ramses::internal
         EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
     }
 
+    TEST_F(ADirectedAcyclicGraph, ReportsCycleUntilItIsResolvedByRemovingEdge)
+    {
+        addTestNodesToGraph(3);
+
+        // N1 -> N2 -> N3 -> N1
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N1);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+
+        // N3 -> N1 -> N2
+        m_graph.removeEdge(N2, N3);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N3, &N1, &N2));
+
+        // order is maintained incrementally again after cycle was resolved
+        m_graph.addEdge(N2, N3);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+        m_graph.removeEdge(N3, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N2, &N3));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, ReportsCycleUntilItIsResolvedByRemovingNode)
+    {
+        addTestNodesToGraph(3);
+
+        // N1 -> N2 -> N3 -> N2
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N2, N3);
+        m_graph.addEdge(N3, N2);
+        EXPECT_FALSE(m_graph.getTopologicallySortedNodes().has_value());
+
+        m_graph.removeNode(N3);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N2));
+    }
+
+    TEST_F(ADirectedAcyclicGraph, AddingEdgeAgainstCurrentOrder_OnlyReordersAffectedNodes)
+    {
+        addTestNodesToGraph(6);
+
+        // N1 -> N2    N3    N4 -> N5    N6
+        m_graph.addEdge(N1, N2);
+        m_graph.addEdge(N4, N5);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N1, &N2, &N3, &N4, &N5, &N6));
+
+        // N4 -> N5 -> N1 -> N2, nodes not connected to the new edge keep their position
+        m_graph.addEdge(N5, N1);
+        EXPECT_THAT(getSortedTestNodes(), ::testing::ElementsAre(&N4, &N5, &N3, &N1, &N2, &N6));
+    }
+
     TEST_F(ADirectedAcyclicGraph, RemovesMultiLinksBetweenTwoNodes_OneByOne)
     {
         addTestNodesToGraph(2);
@@ -106,9 +106,9 @@ namespace ramses
     class RamsesTestSetup
     {
     public:
-        RamsesTestSetup()
+        explicit RamsesTestSetup(ramses::EFeatureLevel featureLevel = ramses::EFeatureLevel_Latest)
         {
-            ramses::RamsesFrameworkConfig frameworkConfig{ramses::EFeatureLevel_Latest};
+            ramses::RamsesFrameworkConfig frameworkConfig{featureLevel};
             frameworkConfig.setLogLevel(ramses::ELogLevel::Off);
             m_ramsesFramework = std::make_unique<ramses::RamsesFramework>(frameworkConfig);
             m_ramsesClient = m_ramsesFramework->createClient("test client");
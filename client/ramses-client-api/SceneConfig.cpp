@@ -55,4 +55,11 @@ namespace ramses
         LOG_HL_CLIENT_API1(status, publicationMode);
         return status;
     }
+
+    status_t SceneConfig::setSceneActionCoalescingEnabled(bool enable)
+    {
+        const status_t status = m_impl.get().setSceneActionCoalescingEnabled(enable);
+        LOG_HL_CLIENT_API1(status, enable);
+        return status;
+    }
 }
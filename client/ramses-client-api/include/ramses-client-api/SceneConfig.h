@@ -47,6 +47,22 @@ namespace ramses
         */
         RAMSES_API status_t setPublicationMode(EScenePublicationMode publicationMode);
 
+        /**
+        * @brief Enable coalescing of redundant scene changes before they are flushed.
+        *
+        * When enabled, changes which are overwritten again before the next #ramses::Scene::flush
+        * (e.g. setting the translation of the same node multiple times) are only sent once with their final value,
+        * objects which are created and destroyed again between two flushes are not sent at all.
+        * This reduces the amount of data sent to and applied by the renderer for scenes which
+        * change the same values repeatedly between flushes, at the cost of an additional pass over
+        * all changes when flushing. Disabled by default.
+        *
+        * @param[in] enable Enable or disable coalescing of scene changes
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        RAMSES_API status_t setSceneActionCoalescingEnabled(bool enable);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
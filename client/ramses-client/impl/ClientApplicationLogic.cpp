@@ -42,11 +42,11 @@ namespace ramses_internal
         m_scenegraphProviderComponent = nullptr;
     }
 
-    void ClientApplicationLogic::createScene(ClientScene& scene, bool enableLocalOnlyOptimization)
+    void ClientApplicationLogic::createScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneActionCoalescing)
     {
         PlatformGuard guard(m_frameworkLock);
         LOG_TRACE(CONTEXT_CLIENT, "ClientApplicationLogic::createScene:  '" << scene.getName() << "' with id '" << scene.getSceneId().getValue() << "'");
-        m_scenegraphProviderComponent->handleCreateScene(scene, enableLocalOnlyOptimization, *this);
+        m_scenegraphProviderComponent->handleCreateScene(scene, enableLocalOnlyOptimization, enableSceneActionCoalescing, *this);
     }
 
     void ClientApplicationLogic::publishScene(SceneId sceneId, EScenePublicationMode publicationMode)
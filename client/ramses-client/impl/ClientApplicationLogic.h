@@ -46,7 +46,7 @@ namespace ramses_internal
         void deinit();
 
         // Scene handling
-        void createScene(ClientScene& scene, bool enableLocalOnlyOptimization);
+        void createScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneActionCoalescing);
         void publishScene(SceneId sceneId, EScenePublicationMode publicationMode);
         void unpublishScene(SceneId sceneId);
         [[nodiscard]] bool isScenePublished(SceneId sceneId) const;
@@ -27,11 +27,13 @@
 #include "Scene/ScenePersistation.h"
 #include "Scene/ClientScene.h"
 #include "Components/ResourcePersistation.h"
+#include "TaskFramework/ParallelForExecutor.h"
 #include "Components/ManagedResource.h"
 #include "Components/ResourceTableOfContents.h"
 #include "Components/FileInputStreamContainer.h"
 #include "Components/MemoryInputStreamContainer.h"
 #include "Components/OffsetFileInputStreamContainer.h"
+#include "Components/MemoryMappedFileInputStreamContainer.h"
 #include "Resource/IResource.h"
 #include "ClientCommands/PrintSceneList.h"
 #include "ClientCommands/FlushSceneVersion.h"
@@ -215,7 +217,11 @@ namespace ramses
         managedResources.erase(std::unique(managedResources.begin(), managedResources.end()), managedResources.end());
 
         // write LL-TOC and LL resources
-        ramses_internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress);
+        ramses_internal::PlatformGuard guard(m_resourceCompressionLock);
+        if (compress && !m_resourceCompressionExecutor)
+            m_resourceCompressionExecutor = ramses_internal::ResourcePersistation::CreateCompressionExecutor();
+        ramses_internal::ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResources, compress,
+            getFramework().getFeatureLevel(), m_resourceCompressionExecutor.get());
     }
 
     ramses_internal::ManagedResource RamsesClientImpl::getResource(ramses_internal::ResourceContentHash hash) const
@@ -267,7 +273,11 @@ namespace ramses
 
         // now the scene is registered, so it's possible to load the low level content into the scene
         LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "    Reading low level scene from stream");
-        ramses_internal::ScenePersistation::ReadSceneFromStream(inputStream, *internalScene);
+        if (!ramses_internal::ScenePersistation::ReadSceneFromStream(inputStream, *internalScene))
+        {
+            LOG_ERROR(ramses_internal::CONTEXT_CLIENT, "    Failed to read low level scene from stream");
+            return nullptr;
+        }
 
         LOG_TRACE(ramses_internal::CONTEXT_CLIENT, "    Deserializing high level scene objects from stream");
         DeserializationContext deserializationContext;
@@ -355,7 +365,7 @@ namespace ramses
         return loadSceneSynchonousCommon({
                 "loadSceneFromFile",
                 std::string{fileName},
-                std::make_shared<ramses_internal::FileInputStreamContainer>(fileName),
+                createFileInputStreamContainer(fileName),
                 true,
                 localOnly,
                 sceneId_t(),
@@ -477,6 +487,20 @@ namespace ramses
         return true;
     }
 
+    ramses_internal::InputStreamContainerSPtr RamsesClientImpl::createFileInputStreamContainer(std::string_view fileName) const
+    {
+        if (!m_framework.isMemoryMappedSceneFileLoadingEnabled())
+            return std::make_shared<ramses_internal::FileInputStreamContainer>(fileName);
+
+        // mapped file lets resources reference file content instead of copying it to heap,
+        // fall back to reading file if it cannot be mapped
+        auto mappedFile = std::make_shared<const ramses_internal::MemoryMappedFile>(fileName);
+        if (mappedFile->isValid())
+            return std::make_shared<ramses_internal::MemoryMappedFileInputStreamContainer>(std::move(mappedFile));
+
+        return std::make_shared<ramses_internal::FileInputStreamContainer>(fileName);
+    }
+
     bool RamsesClientImpl::GetFeatureLevelFromFile(std::string_view fileName, EFeatureLevel& detectedFeatureLevel)
     {
         ramses_internal::FileInputStreamContainer streamContainer{ fileName };
@@ -539,7 +563,7 @@ namespace ramses
             new LoadSceneRunnable(*this, SceneCreationConfig{
                     "loadSceneFromFileAsync",
                     stdFilename,
-                    std::make_shared<ramses_internal::FileInputStreamContainer>(stdFilename),
+                    createFileInputStreamContainer(stdFilename),
                     true,
                     localOnly,
                     sceneId_t()
@@ -729,6 +753,11 @@ namespace ramses
         return m_framework;
     }
 
+    const RamsesFrameworkImpl& RamsesClientImpl::getFramework() const
+    {
+        return m_framework;
+    }
+
     status_t RamsesClientImpl::validate() const
     {
         status_t status = RamsesObjectImpl::validate();
@@ -44,6 +44,7 @@
 
 namespace ramses_internal
 {
+    class ParallelForExecutor;
     class IInputStream;
     class PrintSceneList;
     class FlushSceneVersion;
@@ -118,6 +119,7 @@ namespace ramses
         Scene* getScene(sceneId_t sceneId);
 
         RamsesFrameworkImpl& getFramework();
+        [[nodiscard]] const RamsesFrameworkImpl& getFramework() const;
         static RamsesClientImpl& createImpl(std::string_view name, RamsesFrameworkImpl& components);
 
         status_t validate() const override;
@@ -199,6 +201,7 @@ namespace ramses
         status_t validateScenes() const;
 
         static bool GetFeatureLevelFromStream(ramses_internal::IInputStreamContainer& streamContainer, const std::string& desc, EFeatureLevel& detectedFeatureLevel);
+        ramses_internal::InputStreamContainerSPtr createFileInputStreamContainer(std::string_view fileName) const;
 
         RamsesClient* m_hlClient = nullptr;
         ramses_internal::ClientApplicationLogic m_appLogic;
@@ -215,6 +218,10 @@ namespace ramses
         RamsesFrameworkImpl& m_framework;
         mutable ramses_internal::PlatformLock m_clientLock;
 
+        // created on first compressed save and reused by all following ones, lock guards its exclusive use
+        mutable ramses_internal::PlatformLock m_resourceCompressionLock;
+        mutable std::unique_ptr<ramses_internal::ParallelForExecutor> m_resourceCompressionExecutor;
+
         ramses_internal::TaskForwardingQueue m_loadFromFileTaskQueue;
         ramses_internal::EnqueueOnlyOneAtATimeQueue m_deleteSceneQueue;
 
@@ -20,4 +20,15 @@ namespace ramses
     {
         return m_publicationMode;
     }
+
+    status_t SceneConfigImpl::setSceneActionCoalescingEnabled(bool enable)
+    {
+        m_sceneActionCoalescingEnabled = enable;
+        return StatusOK;
+    }
+
+    bool SceneConfigImpl::isSceneActionCoalescingEnabled() const
+    {
+        return m_sceneActionCoalescingEnabled;
+    }
 }
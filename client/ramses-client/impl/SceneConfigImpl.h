@@ -22,8 +22,12 @@ namespace ramses
         status_t setPublicationMode(EScenePublicationMode publicationMode);
         EScenePublicationMode getPublicationMode() const;
 
+        status_t setSceneActionCoalescingEnabled(bool enable);
+        [[nodiscard]] bool isSceneActionCoalescingEnabled() const;
+
     private:
         EScenePublicationMode m_publicationMode = EScenePublicationMode::LocalAndRemote;
+        bool m_sceneActionCoalescingEnabled = false;
     };
 }
 
@@ -111,10 +111,11 @@ namespace ramses
         , m_hlClient(ramsesClient)
     {
         LOG_INFO(ramses_internal::CONTEXT_CLIENT, "Scene::Scene: sceneId " << scene.getSceneId()  <<
-                 ", publicationMode " << (sceneConfig.getPublicationMode() == EScenePublicationMode::LocalAndRemote ? "LocalAndRemote" : "LocalOnly"));
+                 ", publicationMode " << (sceneConfig.getPublicationMode() == EScenePublicationMode::LocalAndRemote ? "LocalAndRemote" : "LocalOnly") <<
+                 ", actionCoalescing " << sceneConfig.isSceneActionCoalescingEnabled());
         getClientImpl().getFramework().getPeriodicLogger().registerStatisticCollectionScene(m_scene.getSceneId(), m_scene.getStatisticCollection());
         const bool enableLocalOnlyOptimization = sceneConfig.getPublicationMode() == EScenePublicationMode::LocalOnly;
-        getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization);
+        getClientImpl().getClientApplication().createScene(scene, enableLocalOnlyOptimization, sceneConfig.isSceneActionCoalescingEnabled());
     }
 
     SceneImpl::~SceneImpl()
@@ -1773,7 +1774,10 @@ namespace ramses
     status_t SceneImpl::writeSceneObjectsToStream(ramses_internal::IOutputStream& outputStream) const
     {
         ramses_internal::ScenePersistation::WriteSceneMetadataToStream(outputStream, getIScene());
-        ramses_internal::ScenePersistation::WriteSceneToStream(outputStream, getIScene());
+        if (getClientImpl().getFramework().isSceneSnapshotFileFormatEnabled())
+            ramses_internal::ScenePersistation::WriteSceneSnapshotToStream(outputStream, getIScene());
+        else
+            ramses_internal::ScenePersistation::WriteSceneToStream(outputStream, getIScene());
 
         SerializationContext serializationContext;
         return serialize(outputStream, serializationContext);
@@ -0,0 +1,91 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/ShapingCache.h"
+#include "PlatformAbstraction/Hash.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses
+{
+    bool ShapingCache::Key::operator==(const Key& other) const
+    {
+        return str == other.str && std::equal(fontOffsets.cbegin(), fontOffsets.cend(), other.fontOffsets.cbegin(), other.fontOffsets.cend(),
+            [](const FontInstanceOffset& a, const FontInstanceOffset& b) { return a.fontInstance == b.fontInstance && a.beginOffset == b.beginOffset; });
+    }
+
+    size_t ShapingCache::KeyHasher::operator()(const Key& key) const
+    {
+        size_t seed = std::hash<std::u32string>()(key.str);
+        for (const auto& fontOffset : key.fontOffsets)
+            ramses_internal::HashCombine(seed, fontOffset.fontInstance.getValue(), fontOffset.beginOffset);
+        return seed;
+    }
+
+    const GlyphMetricsVector* ShapingCache::get(const std::u32string& str, const FontInstanceOffsets& fontOffsets)
+    {
+        if (m_entries.empty())
+            return nullptr;
+
+        const auto it = m_entries.find(Key{ str, fontOffsets });
+        if (it == m_entries.end())
+            return nullptr;
+
+        m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
+        return &it->second.glyphs;
+    }
+
+    void ShapingCache::put(const std::u32string& str, const FontInstanceOffsets& fontOffsets, const GlyphMetricsVector& glyphs)
+    {
+        if (m_capacity == 0u)
+            return;
+
+        const auto insertResult = m_entries.insert({ Key{ str, fontOffsets }, Entry{ glyphs, {} } });
+        auto& entry = insertResult.first->second;
+        if (insertResult.second)
+        {
+            m_lru.push_front(&insertResult.first->first);
+            entry.lruIt = m_lru.begin();
+            evictToCapacity();
+        }
+        else
+        {
+            entry.glyphs = glyphs;
+            m_lru.splice(m_lru.begin(), m_lru, entry.lruIt);
+        }
+    }
+
+    void ShapingCache::setCapacity(size_t capacity)
+    {
+        m_capacity = capacity;
+        evictToCapacity();
+    }
+
+    size_t ShapingCache::getCapacity() const
+    {
+        return m_capacity;
+    }
+
+    size_t ShapingCache::size() const
+    {
+        return m_entries.size();
+    }
+
+    void ShapingCache::evictToCapacity()
+    {
+        while (m_entries.size() > m_capacity)
+        {
+            assert(!m_lru.empty());
+            // find before erase, key is owned by the erased entry
+            const auto it = m_entries.find(*m_lru.back());
+            assert(it != m_entries.end());
+            m_lru.pop_back();
+            m_entries.erase(it);
+        }
+    }
+}
@@ -0,0 +1,64 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXT_SHAPINGCACHE_H
+#define RAMSES_TEXT_SHAPINGCACHE_H
+
+#include "ramses-text-api/GlyphMetrics.h"
+#include "ramses-text-api/FontInstanceOffsets.h"
+
+#include <string>
+#include <list>
+#include <unordered_map>
+
+namespace ramses
+{
+    // LRU cache of positioned glyphs created for a string with given font instances (result of shaping).
+    // Capacity is number of cached strings, capacity 0 disables caching.
+    class ShapingCache
+    {
+    public:
+        [[nodiscard]] const GlyphMetricsVector* get(const std::u32string& str, const FontInstanceOffsets& fontOffsets);
+        void put(const std::u32string& str, const FontInstanceOffsets& fontOffsets, const GlyphMetricsVector& glyphs);
+
+        void setCapacity(size_t capacity);
+        [[nodiscard]] size_t getCapacity() const;
+        [[nodiscard]] size_t size() const;
+
+    private:
+        struct Key
+        {
+            std::u32string str;
+            FontInstanceOffsets fontOffsets;
+
+            bool operator==(const Key& other) const;
+        };
+
+        struct KeyHasher
+        {
+            size_t operator()(const Key& key) const;
+        };
+
+        // most recently used at front, points to keys stored in map
+        using LruList = std::list<const Key*>;
+
+        struct Entry
+        {
+            GlyphMetricsVector glyphs;
+            LruList::iterator lruIt;
+        };
+
+        void evictToCapacity();
+
+        std::unordered_map<Key, Entry, KeyHasher> m_entries;
+        LruList m_lru;
+        size_t m_capacity = 0u;
+    };
+}
+
+#endif
@@ -32,13 +32,18 @@ namespace ramses
         : m_scene(scene)
         , m_fontAccessor(fontAccessor)
         , m_textureAtlas(scene, { atlasTextureWidth, atlasTextureHeight })
+        , m_geometryPool(scene)
     {
     }
 
     GlyphMetricsVector TextCacheImpl::getPositionedGlyphs(const std::u32string& str, const FontInstanceOffsets& fontOffsets)
     {
+        if (const GlyphMetricsVector* cachedGlyphs = m_shapingCache.get(str, fontOffsets))
+            return *cachedGlyphs;
+
         GlyphMetricsVector positionedGlyphs;
         positionedGlyphs.reserve(str.size());
+        bool allFontInstancesFound = true;
 
         for (auto fontIt = fontOffsets.cbegin(); fontIt != fontOffsets.cend(); ++fontIt)
         {
@@ -51,9 +56,16 @@ namespace ramses
             if (fontInstance != nullptr)
                 fontInstance->loadAndAppendGlyphMetrics(substrBeginIt, substrEndIt, positionedGlyphs);
             else
+            {
                 LOG_ERROR(CONTEXT_TEXT, "TextCache::getPositionedGlyphs: Could not find font instance " << fontIt->fontInstance);
+                allFontInstancesFound = false;
+            }
         }
 
+        // incomplete result must not be cached, font instance might become available later
+        if (allFontInstancesFound)
+            m_shapingCache.put(str, fontOffsets, positionedGlyphs);
+
         return positionedGlyphs;
     }
 
@@ -113,6 +125,25 @@ namespace ramses
             return {};
         }
 
+        if (m_sharedTextGeometry)
+        {
+            TextLine textLine;
+            TextGeometryPool::Allocation allocation;
+            if (m_geometryPool.createTextLineMesh(geometry, effect, m_textureAtlas.getTextureSampler(geometry.atlasPage), textLine, allocation))
+            {
+                auto textLineId = m_textIdCounter;
+                m_textIdCounter.getReference()++;
+
+                textLine.atlasPage = geometry.atlasPage;
+                textLine.glyphs = glyphs;
+                m_textLines[textLineId] = std::move(textLine);
+                m_sharedTextLines[textLineId] = allocation;
+
+                return textLineId;
+            }
+            // line too long for pool or pool objects failed, fall back to own objects for this line
+        }
+
         GeometryBinding* geometryBinding = m_scene.createGeometryBinding(effect);
         Appearance* appearance = m_scene.createAppearance(effect);
         if (geometryBinding == nullptr || appearance == nullptr)
@@ -177,18 +208,37 @@ namespace ramses
         }
 
         TextLine& textLine = m_textLines[textId];
-        auto geometry = textLine.meshNode->getGeometryBinding();
-        auto appearance = textLine.meshNode->getAppearance();
-        m_scene.destroy(*textLine.meshNode);
-        m_scene.destroy(*geometry);
-        m_scene.destroy(*appearance);
-        m_scene.destroy(*textLine.positions);
-        m_scene.destroy(*textLine.textureCoordinates);
-        m_scene.destroy(*textLine.indices);
+        const auto sharedIt = m_sharedTextLines.find(textId);
+        if (sharedIt != m_sharedTextLines.end())
+        {
+            m_geometryPool.destroyTextLineMesh(textLine, sharedIt->second);
+            m_sharedTextLines.erase(sharedIt);
+        }
+        else
+        {
+            auto geometry = textLine.meshNode->getGeometryBinding();
+            auto appearance = textLine.meshNode->getAppearance();
+            m_scene.destroy(*textLine.meshNode);
+            m_scene.destroy(*geometry);
+            m_scene.destroy(*appearance);
+            m_scene.destroy(*textLine.positions);
+            m_scene.destroy(*textLine.textureCoordinates);
+            m_scene.destroy(*textLine.indices);
+        }
 
         m_textureAtlas.unmapGlyphsFromPage(textLine.glyphs, textLine.atlasPage);
 
         m_textLines.erase(textId);
         return true;
     }
+
+    void TextCacheImpl::enableSharedTextGeometry(bool enable)
+    {
+        m_sharedTextGeometry = enable;
+    }
+
+    void TextCacheImpl::setShapingCacheCapacity(size_t maxEntries)
+    {
+        m_shapingCache.setCapacity(maxEntries);
+    }
 }
@@ -10,6 +10,8 @@
 #define RAMSES_TEXTCACHEIMPL_H
 
 #include "ramses-text/GlyphTextureAtlas.h"
+#include "ramses-text/TextGeometryPool.h"
+#include "ramses-text/ShapingCache.h"
 #include "ramses-text-api/TextLine.h"
 #include "ramses-text-api/FontInstanceOffsets.h"
 #include <unordered_map>
@@ -36,6 +38,9 @@ namespace ramses
         TextLine*               getTextLine(TextLineId textId);
         bool                    deleteTextLine(TextLineId textId);
 
+        void                    enableSharedTextGeometry(bool enable);
+        void                    setShapingCacheCapacity(size_t maxEntries);
+
         TextCacheImpl(const TextCacheImpl&) = delete;
         TextCacheImpl& operator=(const TextCacheImpl&) = delete;
         TextCacheImpl(TextCacheImpl&&) = delete;
@@ -45,9 +50,14 @@ namespace ramses
         Scene& m_scene;
         IFontAccessor& m_fontAccessor;
         GlyphTextureAtlas m_textureAtlas;
+        TextGeometryPool m_geometryPool;
+        ShapingCache m_shapingCache;
+        bool m_sharedTextGeometry = false;
 
         using Texts = std::unordered_map<TextLineId, TextLine>;
         Texts m_textLines;
+        // text lines rendered from shared geometry pool
+        std::unordered_map<TextLineId, TextGeometryPool::Allocation> m_sharedTextLines;
 
         TextLineId m_textIdCounter{ 0u };
     };
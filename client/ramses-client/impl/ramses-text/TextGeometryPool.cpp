@@ -0,0 +1,199 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/TextGeometryPool.h"
+#include "ramses-text-api/TextLine.h"
+
+#include "ramses-client-api/Scene.h"
+#include "ramses-client-api/MeshNode.h"
+#include "ramses-client-api/Appearance.h"
+#include "ramses-client-api/GeometryBinding.h"
+#include "ramses-client-api/ArrayBuffer.h"
+#include "ramses-client-api/UniformInput.h"
+#include "ramses-client-api/Effect.h"
+
+#include "Utils/LogMacros.h"
+#include <cassert>
+#include <iterator>
+
+namespace ramses
+{
+    TextGeometryPool::TextGeometryPool(Scene& scene)
+        : m_scene(scene)
+    {
+    }
+
+    bool TextGeometryPool::createTextLineMesh(const GlyphGeometry& geometry, const Effect& effect, const TextureSampler& atlasPageSampler, TextLine& textLine, Allocation& allocation)
+    {
+        assert(geometry.positions.size() % 4u == 0u);
+        const uint32_t quadCount = static_cast<uint32_t>(geometry.positions.size() / 4u);
+        if (quadCount == 0u || quadCount > QuadsPerBlock)
+            return false;
+
+        const PoolKey key{ effect.getSceneObjectId().getValue(), geometry.atlasPage };
+        Pool& pool = m_pools[key];
+        if (pool.appearance == nullptr && !createPool(effect, atlasPageSampler, pool))
+        {
+            m_pools.erase(key);
+            return false;
+        }
+
+        size_t blockIdx = 0u;
+        uint32_t quadOffset = 0u;
+        while (blockIdx < pool.blocks.size() && !AllocateQuads(pool.blocks[blockIdx], quadCount, quadOffset))
+            ++blockIdx;
+        if (blockIdx == pool.blocks.size())
+        {
+            if (!createBlock(effect, pool))
+                return false;
+            const bool allocated = AllocateQuads(pool.blocks.back(), quadCount, quadOffset);
+            assert(allocated);
+            UNUSED(allocated);
+        }
+
+        MeshNode* meshNode = m_scene.createMeshNode();
+        if (meshNode == nullptr)
+        {
+            ReleaseQuads(pool.blocks[blockIdx], quadOffset, quadCount);
+            return false;
+        }
+
+        const Block& block = pool.blocks[blockIdx];
+        const uint32_t numVertices = quadCount * 4u;
+        const uint32_t numIndices = static_cast<uint32_t>(geometry.indices.size());
+        assert(numIndices == quadCount * 6u);
+
+        // indices of text line geometry start at 0, start vertex moves them to the line's vertex range
+        block.positions->updateData(quadOffset * 4u, numVertices, geometry.positions.data());
+        block.textureCoordinates->updateData(quadOffset * 4u, numVertices, geometry.texcoords.data());
+        block.indices->updateData(quadOffset * 6u, numIndices, geometry.indices.data());
+
+        meshNode->setAppearance(*pool.appearance);
+        meshNode->setGeometryBinding(*block.geometryBinding);
+        meshNode->setStartIndex(quadOffset * 6u);
+        meshNode->setStartVertex(quadOffset * 4u);
+        meshNode->setIndexCount(numIndices);
+
+        textLine.meshNode = meshNode;
+        textLine.indices = block.indices;
+        textLine.positions = block.positions;
+        textLine.textureCoordinates = block.textureCoordinates;
+
+        allocation.effectId = key.first;
+        allocation.atlasPage = key.second;
+        allocation.block = blockIdx;
+        allocation.quadOffset = quadOffset;
+        allocation.quadCount = quadCount;
+
+        return true;
+    }
+
+    void TextGeometryPool::destroyTextLineMesh(TextLine& textLine, const Allocation& allocation)
+    {
+        // shared objects are kept for following text lines, only the quads are returned to the block
+        m_scene.destroy(*textLine.meshNode);
+        textLine.meshNode = nullptr;
+
+        const auto poolIt = m_pools.find(PoolKey{ allocation.effectId, allocation.atlasPage });
+        assert(poolIt != m_pools.end());
+        assert(allocation.block < poolIt->second.blocks.size());
+        ReleaseQuads(poolIt->second.blocks[allocation.block], allocation.quadOffset, allocation.quadCount);
+    }
+
+    bool TextGeometryPool::createPool(const Effect& effect, const TextureSampler& atlasPageSampler, Pool& pool)
+    {
+        UniformInput texInput;
+        effect.findUniformInput(EEffectUniformSemantic::TextTexture, texInput);
+        effect.findAttributeInput(EEffectAttributeSemantic::TextPositions, pool.positionsInput);
+        effect.findAttributeInput(EEffectAttributeSemantic::TextTextureCoordinates, pool.textureCoordinatesInput);
+        assert(texInput.isValid() && pool.positionsInput.isValid() && pool.textureCoordinatesInput.isValid());
+
+        pool.appearance = m_scene.createAppearance(effect);
+        if (pool.appearance == nullptr)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextGeometryPool: failed to create shared appearance, check Ramses logs for more details");
+            return false;
+        }
+        pool.appearance->setInputTexture(texInput, atlasPageSampler);
+
+        return true;
+    }
+
+    bool TextGeometryPool::createBlock(const Effect& effect, Pool& pool)
+    {
+        Block block;
+        block.indices = m_scene.createArrayBuffer(EDataType::UInt16, QuadsPerBlock * 6u);
+        block.positions = m_scene.createArrayBuffer(EDataType::Vector2F, QuadsPerBlock * 4u);
+        block.textureCoordinates = m_scene.createArrayBuffer(EDataType::Vector2F, QuadsPerBlock * 4u);
+        block.geometryBinding = m_scene.createGeometryBinding(effect);
+        if (block.indices == nullptr || block.positions == nullptr || block.textureCoordinates == nullptr || block.geometryBinding == nullptr)
+        {
+            LOG_ERROR(CONTEXT_TEXT, "TextGeometryPool: failed to create shared geometry, check Ramses logs for more details");
+            if (block.indices != nullptr)
+                m_scene.destroy(*block.indices);
+            if (block.positions != nullptr)
+                m_scene.destroy(*block.positions);
+            if (block.textureCoordinates != nullptr)
+                m_scene.destroy(*block.textureCoordinates);
+            if (block.geometryBinding != nullptr)
+                m_scene.destroy(*block.geometryBinding);
+            return false;
+        }
+
+        block.geometryBinding->setIndices(*block.indices);
+        block.geometryBinding->setInputBuffer(pool.positionsInput, *block.positions);
+        block.geometryBinding->setInputBuffer(pool.textureCoordinatesInput, *block.textureCoordinates);
+        block.freeRanges.emplace(0u, QuadsPerBlock);
+
+        pool.blocks.push_back(std::move(block));
+        return true;
+    }
+
+    bool TextGeometryPool::AllocateQuads(Block& block, uint32_t quadCount, uint32_t& quadOffset)
+    {
+        // first fit, keeps lines packed at block start
+        for (auto it = block.freeRanges.begin(); it != block.freeRanges.end(); ++it)
+        {
+            if (it->second >= quadCount)
+            {
+                quadOffset = it->first;
+                const uint32_t remainingCount = it->second - quadCount;
+                block.freeRanges.erase(it);
+                if (remainingCount > 0u)
+                    block.freeRanges.emplace(quadOffset + quadCount, remainingCount);
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void TextGeometryPool::ReleaseQuads(Block& block, uint32_t quadOffset, uint32_t quadCount)
+    {
+        auto it = block.freeRanges.emplace(quadOffset, quadCount).first;
+
+        // merge with following free range
+        const auto next = std::next(it);
+        if (next != block.freeRanges.end() && it->first + it->second == next->first)
+        {
+            it->second += next->second;
+            block.freeRanges.erase(next);
+        }
+
+        // merge with preceding free range
+        if (it != block.freeRanges.begin())
+        {
+            const auto prev = std::prev(it);
+            if (prev->first + prev->second == it->first)
+            {
+                prev->second += it->second;
+                block.freeRanges.erase(it);
+            }
+        }
+    }
+}
@@ -0,0 +1,86 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_TEXT_TEXTGEOMETRYPOOL_H
+#define RAMSES_TEXT_TEXTGEOMETRYPOOL_H
+
+#include "ramses-text/GlyphGeometry.h"
+#include "ramses-client-api/AttributeInput.h"
+
+#include <map>
+#include <vector>
+#include <utility>
+
+namespace ramses
+{
+    class Scene;
+    class Effect;
+    class Appearance;
+    class GeometryBinding;
+    class ArrayBuffer;
+    class TextureSampler;
+    struct TextLine;
+
+    // Sub-allocates glyph quads of text lines from a few large array buffers shared by many text lines.
+    // All text lines using same effect and atlas page share one appearance, all text lines placed in same
+    // buffer block share one geometry binding. Each text line only gets its own mesh node, which renders
+    // its range of quads using start index and start vertex.
+    class TextGeometryPool
+    {
+    public:
+        explicit TextGeometryPool(Scene& scene);
+
+        struct Allocation
+        {
+            uint64_t effectId = 0u;
+            size_t atlasPage = 0u;
+            size_t block = 0u;
+            uint32_t quadOffset = 0u;
+            uint32_t quadCount = 0u;
+        };
+
+        // Creates mesh node for given text line geometry and fills it into text line.
+        // Fails if geometry does not fit into a pool block or if scene objects could not be created.
+        bool createTextLineMesh(const GlyphGeometry& geometry, const Effect& effect, const TextureSampler& atlasPageSampler, TextLine& textLine, Allocation& allocation);
+        void destroyTextLineMesh(TextLine& textLine, const Allocation& allocation);
+
+        static constexpr uint32_t QuadsPerBlock = 4096u;
+
+    private:
+        struct Block
+        {
+            ArrayBuffer* indices = nullptr;
+            ArrayBuffer* positions = nullptr;
+            ArrayBuffer* textureCoordinates = nullptr;
+            GeometryBinding* geometryBinding = nullptr;
+            // free quad ranges, offset -> count
+            std::map<uint32_t, uint32_t> freeRanges;
+        };
+
+        struct Pool
+        {
+            Appearance* appearance = nullptr;
+            AttributeInput positionsInput;
+            AttributeInput textureCoordinatesInput;
+            std::vector<Block> blocks;
+        };
+
+        // effect scene object id and atlas page
+        using PoolKey = std::pair<uint64_t, size_t>;
+
+        bool createPool(const Effect& effect, const TextureSampler& atlasPageSampler, Pool& pool);
+        bool createBlock(const Effect& effect, Pool& pool);
+        static bool AllocateQuads(Block& block, uint32_t quadCount, uint32_t& quadOffset);
+        static void ReleaseQuads(Block& block, uint32_t quadOffset, uint32_t quadCount);
+
+        Scene& m_scene;
+        std::map<PoolKey, Pool> m_pools;
+    };
+}
+
+#endif
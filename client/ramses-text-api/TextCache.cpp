@@ -51,6 +51,16 @@ namespace ramses
         return impl->deleteTextLine(textId);
     }
 
+    void TextCache::enableSharedTextGeometry(bool enable)
+    {
+        impl->enableSharedTextGeometry(enable);
+    }
+
+    void TextCache::setShapingCacheCapacity(size_t maxEntries)
+    {
+        impl->setShapingCacheCapacity(maxEntries);
+    }
+
     bool TextCache::ContainsRenderableGlyphs(const GlyphMetricsVector& glyphMetrics)
     {
         return !std::all_of(glyphMetrics.begin(), glyphMetrics.end(), [](const GlyphMetrics& glyphMetric) {
@@ -176,6 +176,37 @@ namespace ramses
         */
         bool deleteTextLine(TextLineId textId);
 
+        /**
+        * @brief Enable or disable sharing of scene objects between text lines created afterwards.
+        *
+        * By default every text line gets its own MeshNode, Appearance, GeometryBinding and vertex/index ArrayBuffers.
+        * With shared text geometry enabled, text lines created using same effect and placed in same texture atlas page
+        * share one Appearance, and their quads are sub-allocated from large ArrayBuffers shared by many text lines,
+        * each text line only gets its own MeshNode (referencing its range of quads using start index and start vertex).
+        * This reduces number of scene objects and state changes when rendering many text lines.
+        *
+        * Note that as a consequence setting a uniform (e.g. color) in Appearance of such text line affects all text lines sharing
+        * that Appearance and that ArrayBuffers in TextLine refer to shared buffers which must not be modified.
+        * Text lines which do not fit into shared buffers are created with own scene objects as if sharing was disabled.
+        * Already existing text lines are not affected by this call. Sharing is disabled by default.
+        *
+        * @param[in] enable True to share scene objects for text lines created afterwards, false to create own objects for each text line
+        */
+        void enableSharedTextGeometry(bool enable);
+
+        /**
+        * @brief Set maximum number of strings for which result of getPositionedGlyphs() is cached.
+        *
+        * Positioning glyphs (shaping) is expensive, with cache enabled repeated calls of getPositionedGlyphs() with same string
+        * and font instances return cached glyph metrics. Least recently used entries are evicted when cache is full.
+        * Cache is keyed by font instance ids, if a font instance id is reused for a different font instance
+        * (e.g. by custom IFontAccessor) the cache has to be cleared by setting capacity to 0.
+        * Capacity 0 disables caching and clears the cache, this is the default.
+        *
+        * @param[in] maxEntries Maximum number of cached strings
+        */
+        void setShapingCacheCapacity(size_t maxEntries);
+
         /**
         * @brief Check if provided GlyphMetricsVector contains at least one renderable glyph
         * If this functions returns false, the provided input cannot be used as input for the
@@ -47,8 +47,8 @@ protected:
 
     void createDummyScene()
     {
-        EXPECT_CALL(scenegraphProviderComponent, handleCreateScene(Ref(dummyScene), false, Ref(logic)));
-        logic.createScene(dummyScene, false);
+        EXPECT_CALL(scenegraphProviderComponent, handleCreateScene(Ref(dummyScene), false, false, Ref(logic)));
+        logic.createScene(dummyScene, false, false);
     }
 };
 
@@ -208,7 +208,7 @@ protected:
 TEST_F(AClientApplicationLogicWithRealComponents, keepsResourcesAliveForNewSubscriberForShadowCopyScene)
 {
     ClientScene clientScene{ SceneInfo(sceneId) };
-    logic.createScene(clientScene, false);
+    logic.createScene(clientScene, false, false);
     logic.publishScene(sceneId, EScenePublicationMode_LocalAndRemote);
     auto res = new TextureResource(EResourceType_Texture2D, TextureMetaInfo(1u, 1u, 1u, ETextureFormat::R8, false, {}, { 1u }), ResourceCacheFlag_DoNotCache, {});
     res->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
@@ -236,7 +236,7 @@ TEST_F(AClientApplicationLogicWithRealComponents, keepsResourcesAliveForNewSubsc
 TEST_F(AClientApplicationLogicWithRealComponents, keepsAlsoOldResourcesAliveForNewSubscriberForShadowCopyScene)
 {
     ClientScene clientScene{ SceneInfo(sceneId) };
-    logic.createScene(clientScene, false);
+    logic.createScene(clientScene, false, false);
     logic.publishScene(sceneId, EScenePublicationMode_LocalAndRemote);
     auto res = new TextureResource(EResourceType_Texture2D, TextureMetaInfo(1u, 1u, 1u, ETextureFormat::R8, false, {}, { 1u }), ResourceCacheFlag_DoNotCache, {});
     res->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
@@ -52,6 +52,7 @@
 #include "MeshNodeImpl.h"
 #include "ArrayBufferImpl.h"
 #include "Texture2DBufferImpl.h"
+#include "ArrayResourceImpl.h"
 
 #include "Utils/File.h"
 #include "SceneAPI/IScene.h"
@@ -70,6 +71,7 @@
 #include <fstream>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <cstring>
 
 namespace ramses
 {
@@ -81,6 +83,27 @@ namespace ramses
         EXPECT_NE(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram", false));
     }
 
+    TEST_F(ASceneLoadedFromFile, canWriteAndReadSceneFromFileWithMemoryMappedLoading)
+    {
+        const std::array<uint32_t, 5> data{ 1u, 2u, 3u, 4u, 5u };
+        m_scene.createArrayResource(static_cast<uint32_t>(data.size()), data.data(), ramses::ResourceCacheFlag_DoNotCache, "indices");
+        EXPECT_EQ(StatusOK, m_scene.saveToFile("someTemporaryFile.ram", false));
+
+        RamsesFrameworkConfig config{ EFeatureLevel_Latest };
+        config.setMemoryMappedSceneFileLoadingEnabled(true);
+        RamsesFramework framework{ config };
+        RamsesClient& client = *framework.createClient("client");
+        Scene* scene = client.loadSceneFromFile("someTemporaryFile.ram", false);
+        ASSERT_NE(nullptr, scene);
+
+        const auto* indices = RamsesUtils::TryConvert<ArrayResource>(*scene->findObjectByName("indices"));
+        ASSERT_NE(nullptr, indices);
+        const ramses_internal::ManagedResource res = client.m_impl.getClientApplication().getResource(indices->m_impl.getLowlevelResourceHash());
+        ASSERT_TRUE(res);
+        ASSERT_EQ(sizeof(data), res->getDecompressedDataSize());
+        EXPECT_EQ(0, std::memcmp(data.data(), res->getResourceData().data(), sizeof(data)));
+    }
+
     TEST_F(ASceneLoadedFromFile, canWriteAndReadSceneFromMemoryWithExplicitDeleter)
     {
         EXPECT_EQ(StatusOK, m_scene.saveToFile("someTemporaryFile.ram", false));
@@ -1351,6 +1374,12 @@ namespace ramses
     }
 
     TEST_F(ASceneLoadedFromFile, cannotLoadSceneWithMismatchingFeatureLevel)
+    {
+        saveSceneWithFeatureLevelToFile(EFeatureLevel_01, "someTemporaryFile.ram");
+        EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram"));
+    }
+
+    TEST_F(ASceneLoadedFromFile, cannotLoadSceneWithUnknownFeatureLevel)
     {
         saveSceneWithFeatureLevelToFile(EFeatureLevel(99), "someTemporaryFile.ram");
         EXPECT_EQ(nullptr, m_clientForLoading.loadSceneFromFile("someTemporaryFile.ram"));
@@ -0,0 +1,94 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "ramses-text/ShapingCache.h"
+#include "gtest/gtest.h"
+
+namespace ramses
+{
+    class AShapingCache : public testing::Test
+    {
+    protected:
+        AShapingCache()
+        {
+            m_cache.setCapacity(2u);
+        }
+
+        static GlyphMetricsVector CreateGlyphs(uint32_t identifier)
+        {
+            return { GlyphMetrics{ GlyphKey(GlyphId(identifier), FontInstanceId(1u)), 10u, 10u, 0, 0, 10 } };
+        }
+
+        const FontInstanceOffsets m_fontOffsets{ { FontInstanceId(1u), 0u } };
+        ShapingCache m_cache;
+    };
+
+    TEST(ShapingCache, isDisabledByDefault)
+    {
+        ShapingCache cache;
+        EXPECT_EQ(0u, cache.getCapacity());
+        cache.put(U"a", { { FontInstanceId(1u), 0u } }, {});
+        EXPECT_EQ(0u, cache.size());
+        EXPECT_EQ(nullptr, cache.get(U"a", { { FontInstanceId(1u), 0u } }));
+    }
+
+    TEST_F(AShapingCache, returnsStoredGlyphs)
+    {
+        m_cache.put(U"a", m_fontOffsets, CreateGlyphs(1u));
+        const auto glyphs = m_cache.get(U"a", m_fontOffsets);
+        ASSERT_NE(nullptr, glyphs);
+        ASSERT_EQ(1u, glyphs->size());
+        EXPECT_EQ(GlyphId(1u), glyphs->front().key.identifier);
+    }
+
+    TEST_F(AShapingCache, distinguishesStringsAndFontOffsets)
+    {
+        m_cache.put(U"a", m_fontOffsets, CreateGlyphs(1u));
+        EXPECT_EQ(nullptr, m_cache.get(U"b", m_fontOffsets));
+        EXPECT_EQ(nullptr, m_cache.get(U"a", { { FontInstanceId(2u), 0u } }));
+        EXPECT_EQ(nullptr, m_cache.get(U"a", { { FontInstanceId(1u), 1u } }));
+        EXPECT_EQ(nullptr, m_cache.get(U"a", { { FontInstanceId(1u), 0u }, { FontInstanceId(2u), 1u } }));
+    }
+
+    TEST_F(AShapingCache, evictsLeastRecentlyUsedEntry)
+    {
+        m_cache.put(U"a", m_fontOffsets, CreateGlyphs(1u));
+        m_cache.put(U"b", m_fontOffsets, CreateGlyphs(2u));
+        // touch 'a' so that 'b' becomes least recently used
+        EXPECT_NE(nullptr, m_cache.get(U"a", m_fontOffsets));
+        m_cache.put(U"c", m_fontOffsets, CreateGlyphs(3u));
+
+        EXPECT_EQ(2u, m_cache.size());
+        EXPECT_NE(nullptr, m_cache.get(U"a", m_fontOffsets));
+        EXPECT_EQ(nullptr, m_cache.get(U"b", m_fontOffsets));
+        EXPECT_NE(nullptr, m_cache.get(U"c", m_fontOffsets));
+    }
+
+    TEST_F(AShapingCache, overwritesExistingEntry)
+    {
+        m_cache.put(U"a", m_fontOffsets, CreateGlyphs(1u));
+        m_cache.put(U"a", m_fontOffsets, CreateGlyphs(2u));
+        EXPECT_EQ(1u, m_cache.size());
+        const auto glyphs = m_cache.get(U"a", m_fontOffsets);
+        ASSERT_NE(nullptr, glyphs);
+        EXPECT_EQ(GlyphId(2u), glyphs->front().key.identifier);
+    }
+
+    TEST_F(AShapingCache, evictsEntriesWhenCapacityIsReduced)
+    {
+        m_cache.put(U"a", m_fontOffsets, CreateGlyphs(1u));
+        m_cache.put(U"b", m_fontOffsets, CreateGlyphs(2u));
+        m_cache.setCapacity(1u);
+        EXPECT_EQ(1u, m_cache.size());
+        EXPECT_NE(nullptr, m_cache.get(U"b", m_fontOffsets));
+
+        m_cache.setCapacity(0u);
+        EXPECT_EQ(0u, m_cache.size());
+        EXPECT_EQ(nullptr, m_cache.get(U"b", m_fontOffsets));
+    }
+}
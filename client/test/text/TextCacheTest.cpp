@@ -635,4 +635,113 @@ namespace ramses
         const auto rlo = m_textCache.getPositionedGlyphs( U"\u202etest\u202c", LatinFontInstance12);
         EXPECT_EQ(noMarkers, rlo);
     }
+
+    TEST_F(ATextCache, createsTextLinesSharingAppearanceAndGeometryIfEnabled)
+    {
+        m_textCache.enableSharedTextGeometry(true);
+        const auto positionedGlyphs1 = m_textCache.getPositionedGlyphs(U" test ", LatinFontInstance12);
+        const auto positionedGlyphs2 = m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12);
+
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId1 = m_textCache.createTextLine(positionedGlyphs1, *textEffect);
+        const TextLineId textLineId2 = m_textCache.createTextLine(positionedGlyphs2, *textEffect);
+        const TextLine* textLine1 = m_textCache.getTextLine(textLineId1);
+        const TextLine* textLine2 = m_textCache.getTextLine(textLineId2);
+        ASSERT_TRUE(textLine1 != nullptr);
+        ASSERT_TRUE(textLine2 != nullptr);
+        ASSERT_EQ(textLine1->atlasPage, textLine2->atlasPage);
+
+        const MeshNode* meshNode1 = textLine1->meshNode;
+        const MeshNode* meshNode2 = textLine2->meshNode;
+        ASSERT_TRUE(meshNode1 != nullptr);
+        ASSERT_TRUE(meshNode2 != nullptr);
+        EXPECT_NE(meshNode1, meshNode2);
+        EXPECT_EQ(meshNode1->getAppearance(), meshNode2->getAppearance());
+        EXPECT_EQ(meshNode1->getGeometryBinding(), meshNode2->getGeometryBinding());
+        EXPECT_EQ(textLine1->indices, textLine2->indices);
+        EXPECT_EQ(textLine1->positions, textLine2->positions);
+        EXPECT_EQ(textLine1->textureCoordinates, textLine2->textureCoordinates);
+
+        // 4 quads of first line followed by 4 quads of second line
+        EXPECT_EQ(0u, meshNode1->getStartIndex());
+        EXPECT_EQ(0u, meshNode1->getStartVertex());
+        EXPECT_EQ(24u, meshNode1->getIndexCount());
+        EXPECT_EQ(24u, meshNode2->getStartIndex());
+        EXPECT_EQ(16u, meshNode2->getStartVertex());
+        EXPECT_EQ(24u, meshNode2->getIndexCount());
+    }
+
+    TEST_F(ATextCache, reusesQuadsOfDeletedSharedTextLine)
+    {
+        m_textCache.enableSharedTextGeometry(true);
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12);
+
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId1 = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        const TextLineId textLineId2 = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        ASSERT_TRUE(textLineId1.isValid());
+        ASSERT_TRUE(textLineId2.isValid());
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId1));
+
+        const TextLineId textLineId3 = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        const TextLine* textLine2 = m_textCache.getTextLine(textLineId2);
+        const TextLine* textLine3 = m_textCache.getTextLine(textLineId3);
+        ASSERT_TRUE(textLine2 != nullptr);
+        ASSERT_TRUE(textLine3 != nullptr);
+        EXPECT_EQ(0u, textLine3->meshNode->getStartIndex());
+        EXPECT_EQ(0u, textLine3->meshNode->getStartVertex());
+        EXPECT_EQ(textLine2->meshNode->getGeometryBinding(), textLine3->meshNode->getGeometryBinding());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId2));
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId3));
+    }
+
+    TEST_F(ATextCache, createsOwnObjectsForTextLinesCreatedBeforeSharingWasEnabled)
+    {
+        const auto positionedGlyphs = m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12);
+
+        Effect* textEffect = createTestEffect(m_scene);
+        ASSERT_TRUE(textEffect != nullptr);
+
+        const TextLineId textLineId1 = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        m_textCache.enableSharedTextGeometry(true);
+        const TextLineId textLineId2 = m_textCache.createTextLine(positionedGlyphs, *textEffect);
+        const TextLine* textLine1 = m_textCache.getTextLine(textLineId1);
+        const TextLine* textLine2 = m_textCache.getTextLine(textLineId2);
+        ASSERT_TRUE(textLine1 != nullptr);
+        ASSERT_TRUE(textLine2 != nullptr);
+        EXPECT_NE(textLine1->meshNode->getAppearance(), textLine2->meshNode->getAppearance());
+        EXPECT_NE(textLine1->indices, textLine2->indices);
+        EXPECT_EQ(24u, textLine1->indices->getUsedNumberOfElements());
+
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId1));
+        EXPECT_TRUE(m_textCache.deleteTextLine(textLineId2));
+    }
+
+    TEST_F(ATextCache, returnsSamePositionedGlyphsFromShapingCache)
+    {
+        const auto uncachedGlyphs = m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12);
+
+        m_textCache.setShapingCacheCapacity(1u);
+        EXPECT_EQ(uncachedGlyphs, m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12));
+        EXPECT_EQ(uncachedGlyphs, m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12));
+
+        // evicts previous string
+        const auto otherGlyphs = m_textCache.getPositionedGlyphs(U"abc", LatinFontInstance20);
+        EXPECT_EQ(otherGlyphs, m_textCache.getPositionedGlyphs(U"abc", LatinFontInstance20));
+        EXPECT_EQ(uncachedGlyphs, m_textCache.getPositionedGlyphs(U"test", LatinFontInstance12));
+    }
+
+    TEST_F(ATextCache, doesNotCachePositionedGlyphsIfFontInstanceIsMissing)
+    {
+        m_textCache.setShapingCacheCapacity(10u);
+        const FontInstanceOffsets fontOffsets{ { LatinFontInstance12, 0u }, { FontInstanceId(999u), 2u } };
+        const auto glyphs = m_textCache.getPositionedGlyphs(U"test", fontOffsets);
+        EXPECT_EQ(2u, glyphs.size());
+        EXPECT_EQ(glyphs, m_textCache.getPositionedGlyphs(U"test", fontOffsets));
+    }
 }
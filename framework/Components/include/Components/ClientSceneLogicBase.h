@@ -39,6 +39,9 @@ namespace ramses_internal
 
         [[nodiscard]] const char* getSceneStateString() const;
 
+        void setSceneActionCoalescingEnabled(bool enabled);
+        [[nodiscard]] bool isSceneActionCoalescingEnabled() const;
+
     protected:
         enum class ResourceChangeState {
             MissingResource,
@@ -52,6 +55,7 @@ namespace ramses_internal
         ResourceChangeState verifyAndGetResourceChanges(SceneUpdate& sceneUpdate, bool hasNewActions);
         void updateResourceStatistics();
         void fillStatisticsCollection();
+        void coalesceSceneActions(SceneActionCollection& actions) const;
 
         ISceneGraphSender&     m_scenegraphSender;
         IResourceProviderComponent& m_resourceComponent;
@@ -65,6 +69,7 @@ namespace ramses_internal
         EScenePublicationMode m_scenePublicationMode;
 
         uint64_t m_flushCounter = 0u;
+        bool m_sceneActionCoalescingEnabled = false;
         ResourceContentHashVector m_lastFlushResourcesInUse;
 
         ResourceChanges m_resourceChangesSinceLastFlush; // keep container memory allocated
@@ -27,7 +27,7 @@ namespace ramses_internal
     {
     public:
         virtual ~ISceneGraphProviderComponent() {}
-        virtual void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventInterface) = 0;
+        virtual void handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneActionCoalescing, ISceneProviderEventConsumer& eventInterface) = 0;
         virtual void handlePublishScene(SceneId sceneId, EScenePublicationMode publicationMode) = 0;
         virtual void handleUnpublishScene(SceneId sceneId) = 0;
         virtual bool handleFlush(SceneId sceneId, const FlushTimeInformation& flushTimeInfo, SceneVersionTag versionTag) = 0;
@@ -0,0 +1,37 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMEWORK_MEMORYMAPPEDFILEINPUTSTREAMCONTAINER_H
+#define RAMSES_FRAMEWORK_MEMORYMAPPEDFILEINPUTSTREAMCONTAINER_H
+
+#include "Components/InputStreamContainer.h"
+#include "Utils/BinaryMemoryMappedFileInputStream.h"
+#include "Utils/MemoryMappedFile.h"
+
+#include <memory>
+
+namespace ramses_internal
+{
+    class MemoryMappedFileInputStreamContainer : public IInputStreamContainer
+    {
+    public:
+        explicit MemoryMappedFileInputStreamContainer(std::shared_ptr<const MemoryMappedFile> mappedFile)
+            : m_stream(std::move(mappedFile))
+        {}
+
+        IInputStream& getStream() override
+        {
+            return m_stream;
+        }
+
+    private:
+        BinaryMemoryMappedFileInputStream m_stream;
+    };
+}
+
+#endif
@@ -12,6 +12,7 @@
 #include "Collections/Vector.h"
 #include "ManagedResource.h"
 #include "Collections/Pair.h"
+#include "ramses-framework-api/EFeatureLevel.h"
 #include <memory>
 
 namespace ramses_internal
@@ -20,15 +21,24 @@ namespace ramses_internal
     class IInputStream;
     class BinaryFileOutputStream;
     struct ResourceFileEntry;
+    class ParallelForExecutor;
 
     class ResourcePersistation
     {
     public:
-        static void WriteNamedResourcesWithTOCToStream(BinaryFileOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress);
+        // Resources are compressed in format of given feature level, using compression executor (if provided) to compress in parallel.
+        // Executor can be reused for multiple writes (see CreateCompressionExecutor) but must not be used by multiple writes at the same time.
+        static void WriteNamedResourcesWithTOCToStream(BinaryFileOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress,
+            ramses::EFeatureLevel featureLevel, ParallelForExecutor* compressionExecutor = nullptr);
         static void WriteOneResourceToStream(IOutputStream& outStream, const ManagedResource& resource);
 
         static std::unique_ptr<IResource> ReadOneResourceFromStream(IInputStream& inStream, const ResourceContentHash& hash);
         static std::unique_ptr<IResource> RetrieveResourceFromStream(IInputStream& inStream, const ResourceFileEntry& entry);
+
+        static std::unique_ptr<ParallelForExecutor> CreateCompressionExecutor();
+
+    private:
+        static void CompressResources(const ManagedResourceVector& resources, ramses::EFeatureLevel featureLevel, ParallelForExecutor* executor);
     };
 }
 
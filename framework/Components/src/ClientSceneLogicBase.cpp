@@ -12,6 +12,7 @@
 #include "Scene/SceneDescriber.h"
 #include "Scene/SceneActionApplier.h"
 #include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneActionCoalescer.h"
 #include "SceneUtils/ResourceUtils.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "Utils/LogMacros.h"
@@ -197,6 +198,26 @@ namespace ramses_internal
         }
     }
 
+    void ClientSceneLogicBase::setSceneActionCoalescingEnabled(bool enabled)
+    {
+        m_sceneActionCoalescingEnabled = enabled;
+    }
+
+    bool ClientSceneLogicBase::isSceneActionCoalescingEnabled() const
+    {
+        return m_sceneActionCoalescingEnabled;
+    }
+
+    void ClientSceneLogicBase::coalesceSceneActions(SceneActionCollection& actions) const
+    {
+        if (!m_sceneActionCoalescingEnabled || actions.empty())
+            return;
+
+        const uint32_t numActionsBefore = actions.numberOfActions();
+        actions = SceneActionCoalescer::CoalesceActions(actions);
+        LOG_TRACE(CONTEXT_CLIENT, "ClientSceneLogicBase::coalesceSceneActions: sceneId " << m_sceneId << ", numActions " << numActionsBefore << " -> " << actions.numberOfActions());
+    }
+
     void ClientSceneLogicBase::updateResourceStatistics()
     {
         // reset locally gathered resource statistics
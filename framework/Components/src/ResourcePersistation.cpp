@@ -18,8 +18,11 @@
 #include "Components/ResourceTableOfContents.h"
 #include "Resource/ResourceInfo.h"
 #include "Resource/IResource.h"
+#include "Resource/LZ4CompressionUtils.h"
+#include "TaskFramework/ParallelForExecutor.h"
 #include "Components/SingleResourceSerialization.h"
 #include "Utils/LogMacros.h"
+#include <thread>
 
 namespace ramses_internal
 {
@@ -33,7 +36,8 @@ namespace ramses_internal
         return SingleResourceSerialization::DeserializeResource(inStream, hash);
     }
 
-    void ResourcePersistation::WriteNamedResourcesWithTOCToStream(BinaryFileOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress)
+    void ResourcePersistation::WriteNamedResourcesWithTOCToStream(BinaryFileOutputStream& outStream, const ManagedResourceVector& resourcesForFile, bool compress,
+        ramses::EFeatureLevel featureLevel, ParallelForExecutor* compressionExecutor)
     {
         // achieve maximum resource file loading speed by reading in increasing file position order
         // so store TOC first followed by all resources, as the toc is read before the resources
@@ -50,10 +54,8 @@ namespace ramses_internal
         uint32_t currentPosAfterWrite = 0;
 
         // possible compress all resources before writing
-        for (const auto& res : resourcesForFile)
-        {
-            res->compress(compress ? IResource::CompressionLevel::Offline : IResource::CompressionLevel::None);
-        }
+        if (compress)
+            CompressResources(resourcesForFile, featureLevel, compressionExecutor);
 
         for (const auto& res : resourcesForFile)
         {
@@ -91,6 +93,40 @@ namespace ramses_internal
         }
     }
 
+    std::unique_ptr<ParallelForExecutor> ResourcePersistation::CreateCompressionExecutor()
+    {
+        const uint32_t hardwareThreadCount = std::thread::hardware_concurrency();
+        return std::make_unique<ParallelForExecutor>(hardwareThreadCount > 1u ? hardwareThreadCount - 1u : 0u);
+    }
+
+    void ResourcePersistation::CompressResources(const ManagedResourceVector& resources, ramses::EFeatureLevel featureLevel, ParallelForExecutor* executor)
+    {
+        if (!executor)
+        {
+            for (const auto& res : resources)
+                res->compress(IResource::CompressionLevel::Offline, featureLevel);
+            return;
+        }
+
+        // large resources are compressed one after another with their chunks compressed in parallel,
+        // all other resources are compressed concurrently
+        std::vector<const IResource*> resourcesToCompressConcurrently;
+        resourcesToCompressConcurrently.reserve(resources.size());
+        for (const auto& res : resources)
+        {
+            if (featureLevel >= ramses::EFeatureLevel_02 && res->getDecompressedDataSize() > LZ4CompressionUtils::ChunkSize)
+                res->compress(IResource::CompressionLevel::Offline, featureLevel, executor);
+            else
+                resourcesToCompressConcurrently.push_back(res.get());
+        }
+
+        executor->execute(resourcesToCompressConcurrently.size(), 1u, [&](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+                resourcesToCompressConcurrently[i]->compress(IResource::CompressionLevel::Offline, featureLevel);
+        });
+    }
+
     std::unique_ptr<IResource> ResourcePersistation::RetrieveResourceFromStream(IInputStream& inStream, const ResourceFileEntry& fileEntry)
     {
         LOG_DEBUG_P(CONTEXT_FRAMEWORK, "ResourcePersistation::RetrieveResourceFromStream: Hash {}, Size {}, Offset {}",
@@ -136,7 +136,7 @@ namespace ramses_internal
                 {
                     for (auto& resource : sceneUpdate.resources)
                     {
-                        resource->compress(IResource::CompressionLevel::Realtime);
+                        resource->compress(IResource::CompressionLevel::Realtime, m_featureLevel);
                     }
                     alreadyCompressed = true;
                 }
@@ -284,7 +284,7 @@ namespace ramses_internal
         }
     }
 
-    void SceneGraphComponent::handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, ISceneProviderEventConsumer& eventConsumer)
+    void SceneGraphComponent::handleCreateScene(ClientScene& scene, bool enableLocalOnlyOptimization, bool enableSceneActionCoalescing, ISceneProviderEventConsumer& eventConsumer)
     {
         const SceneId sceneId = scene.getSceneId();
         assert(!m_clientSceneLogicMap.contains(sceneId));
@@ -299,6 +299,7 @@ namespace ramses_internal
             LOG_INFO(CONTEXT_CLIENT, "SceneGraphComponent::handleCreateScene: creating scene " << scene.getSceneId() << " (shadow copy)");
             sceneLogic = new ClientSceneLogicShadowCopy(*this, scene, m_resourceComponent, m_myID);
         }
+        sceneLogic->setSceneActionCoalescingEnabled(enableSceneActionCoalescing);
         m_sceneEventConsumers.put(sceneId, &eventConsumer);
         m_clientSceneLogicMap.put(sceneId, sceneLogic);
     }
@@ -13,9 +13,38 @@
 #include "Resource/EResourceCompressionStatus.h"
 #include "Utils/VoidOutputStream.h"
 #include "Collections/IInputStream.h"
+#include "Utils/BinaryMemoryMappedFileInputStream.h"
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // largest alignment required by element types of resource data (float, uint32_t)
+        constexpr size_t InPlaceResourceDataAlignment = 4u;
+
+        template <typename BlobT>
+        BlobT ReadResourceBlob(IInputStream& input, size_t size, bool requiresAlignment)
+        {
+            // memory mapped file content is referenced instead of copied, mapping is kept alive by the blob
+            auto* mappedInput = dynamic_cast<BinaryMemoryMappedFileInputStream*>(&input);
+            size_t pos = 0u;
+            if (mappedInput && size > 0u && mappedInput->getPos(pos) == EStatus::Ok)
+            {
+                // mapping starts page aligned, so alignment of data is given by its position in file
+                if (!requiresAlignment || (pos % InPlaceResourceDataAlignment) == 0u)
+                {
+                    Byte* data = mappedInput->readInPlace(size);
+                    if (data)
+                        return BlobT(size, data, mappedInput->getMappedFile());
+                }
+            }
+
+            BlobT blob(size);
+            input.read(blob.data(), blob.size());
+            return blob;
+        }
+    }
+
     uint32_t SingleResourceSerialization::SizeOfSerializedResource(const IResource& resource)
     {
         VoidOutputStream stream;
@@ -55,15 +84,14 @@ namespace ramses_internal
         if (header.compressionStatus == EResourceCompressionStatus_Compressed)
         {
             // read compressed data from stream
-            CompressedResourceBlob compressedData(header.compressedSize);
-            input.read(compressedData.data(), compressedData.size());
+            // compressed data is only read bytewise by decompression
+            CompressedResourceBlob compressedData = ReadResourceBlob<CompressedResourceBlob>(input, header.compressedSize, false);
             header.resource->setCompressedResourceData(std::move(compressedData), IResource::CompressionLevel::Offline, header.decompressedSize, hash);
         }
         else
         {
             // read uncompressed data from stream
-            ResourceBlob uncompressedData(header.decompressedSize);
-            input.read(uncompressedData.data(), uncompressedData.size());
+            ResourceBlob uncompressedData = ReadResourceBlob<ResourceBlob>(input, header.decompressedSize, true);
             header.resource->setResourceData(std::move(uncompressedData), hash);
         }
 
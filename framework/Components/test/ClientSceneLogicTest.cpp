@@ -376,6 +376,41 @@ TYPED_TEST(AClientSceneLogic_All, flushesPendingActionsIfSceneDistributedAndHasP
     this->expectSceneUnpublish();
 }
 
+TYPED_TEST(AClientSceneLogic_All, sceneActionCoalescingIsDisabledByDefault)
+{
+    EXPECT_FALSE(this->m_sceneLogic.isSceneActionCoalescingEnabled());
+    this->m_sceneLogic.setSceneActionCoalescingEnabled(true);
+    EXPECT_TRUE(this->m_sceneLogic.isSceneActionCoalescingEnabled());
+}
+
+TYPED_TEST(AClientSceneLogic_All, sendsOnlyLastValueOfRepeatedSetterIfCoalescingEnabled)
+{
+    this->m_sceneLogic.setSceneActionCoalescingEnabled(true);
+    this->publishAndAddSubscriberWithoutPendingActions();
+
+    const NodeHandle node = this->m_scene.allocateNode();
+    const TransformHandle transform = this->m_scene.allocateTransform(node);
+    const TransformHandle tempTransform = this->m_scene.allocateTransform(node);
+    for (uint32_t i = 0u; i < 5u; ++i)
+    {
+        this->m_scene.setTranslation(transform, glm::vec3(static_cast<float>(i)));
+        this->m_scene.setTranslation(tempTransform, glm::vec3(static_cast<float>(i)));
+    }
+    this->m_scene.releaseTransform(tempTransform);
+
+    EXPECT_CALL(this->m_sceneGraphProviderComponent, sendSceneUpdate_rvr(std::vector<Guid>{ this->m_rendererID }, _, this->m_sceneId, _, _)).WillOnce([&](const auto&, const auto& update, auto, auto, auto&)
+        {
+            ASSERT_EQ(3u, update.actions.numberOfActions());
+            EXPECT_EQ(ESceneActionId::AllocateNode, update.actions[0].type());
+            EXPECT_EQ(ESceneActionId::AllocateTransform, update.actions[1].type());
+            EXPECT_EQ(ESceneActionId::SetTranslation, update.actions[2].type());
+        });
+    this->flush();
+    EXPECT_TRUE(this->m_scene.getSceneActionCollection().empty());
+
+    this->expectSceneUnpublish();
+}
+
 TEST_F(AClientSceneLogic_Direct, everyFlushGeneratesSceneActionSentToSubscriber)
 {
     this->publishAndAddSubscriberWithoutPendingActions();
@@ -20,6 +20,7 @@
 #include "Components/FileInputStreamContainer.h"
 #include "InputStreamMock.h"
 #include "InputStreamContainerMock.h"
+#include "TaskFramework/ParallelForExecutor.h"
 
 namespace ramses_internal
 {
@@ -63,7 +64,8 @@ namespace ramses_internal
             return hashes;
         }
 
-        ResourceContentHashVector writeMultipleTestResourceFile(uint32_t num, size_t extraSize = 0, bool compress = false)
+        ResourceContentHashVector writeMultipleTestResourceFile(uint32_t num, size_t extraSize = 0, bool compress = false,
+            ramses::EFeatureLevel featureLevel = ramses::EFeatureLevel_Latest, ParallelForExecutor* compressionExecutor = nullptr)
         {
             ResourceComponent& localResourceComponent = getResourceComponent();
 
@@ -81,7 +83,7 @@ namespace ramses_internal
             {
                 File resourceFile(resourceFileName);
                 BinaryFileOutputStream resourceOutputStream(resourceFile);
-                ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResourceVec, compress);
+                ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, managedResourceVec, compress, featureLevel, compressionExecutor);
             }
 
             ramses_internal::ResourceTableOfContents resourceFileToc;
@@ -314,7 +316,7 @@ namespace ramses_internal
             ManagedResourceVector resources;
             resources.push_back(resource1);
 
-            ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, resources, false);
+            ResourcePersistation::WriteNamedResourcesWithTOCToStream(resourceOutputStream, resources, false, ramses::EFeatureLevel_Latest);
 
             delete resource;
         }
@@ -496,6 +498,45 @@ namespace ramses_internal
         EXPECT_TRUE(resolved[1]->getHash() == hashes[1]);
     }
 
+    TEST_F(AResourceComponentTest, canResolveLargeCompressedResourcesFromFile)
+    {
+        // resources larger than compression chunk size are compressed in parallel chunks
+        const size_t extraVertices = 100000u;
+        const auto executor = ResourcePersistation::CreateCompressionExecutor();
+        ResourceContentHashVector hashes = writeMultipleTestResourceFile(3, extraVertices, true, ramses::EFeatureLevel_02, executor.get());
+
+        ManagedResourceVector resolved = localResourceComponent.resolveResources(hashes);
+
+        ASSERT_EQ(3u, resolved.size());
+        for (size_t i = 0u; i < resolved.size(); ++i)
+        {
+            EXPECT_TRUE(resolved[i]->getHash() == hashes[i]);
+            EXPECT_TRUE(resolved[i]->isCompressedAvailable());
+            resolved[i]->decompress();
+            EXPECT_EQ((3u + extraVertices) * 3u * sizeof(float), resolved[i]->getResourceData().size());
+        }
+    }
+
+    TEST_F(AResourceComponentTest, canResolveLargeCompressedResourcesFromFileWrittenWithFeatureLevel01)
+    {
+        // feature level 01 does not support chunked compression, resources are compressed as single block
+        const size_t extraVertices = 100000u;
+        const auto executor = ResourcePersistation::CreateCompressionExecutor();
+        ResourceContentHashVector hashes = writeMultipleTestResourceFile(3, extraVertices, true, ramses::EFeatureLevel_01, executor.get());
+
+        ManagedResourceVector resolved = localResourceComponent.resolveResources(hashes);
+
+        ASSERT_EQ(3u, resolved.size());
+        for (size_t i = 0u; i < resolved.size(); ++i)
+        {
+            EXPECT_TRUE(resolved[i]->getHash() == hashes[i]);
+            EXPECT_TRUE(resolved[i]->isCompressedAvailable());
+            EXPECT_NE(0u, resolved[i]->getCompressedResourceData().data()[0]);
+            resolved[i]->decompress();
+            EXPECT_EQ((3u + extraVertices) * 3u * sizeof(float), resolved[i]->getResourceData().size());
+        }
+    }
+
     TEST_F(AResourceComponentTest, returnsEmptyResourceVectorOnEmptyInput)
     {
         ResourceContentHashVector hashes;
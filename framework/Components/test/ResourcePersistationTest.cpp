@@ -246,7 +246,7 @@ namespace ramses_internal
 
         File tempFile("onDemandResourceFile");
         BinaryFileOutputStream out(tempFile);
-        ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, resources, false);
+        ResourcePersistation::WriteNamedResourcesWithTOCToStream(out, resources, false, ramses::EFeatureLevel_Latest);
         tempFile.close();
 
         ResourceTableOfContents loadedTOC;
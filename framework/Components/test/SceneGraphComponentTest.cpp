@@ -198,7 +198,7 @@ TEST_F(ASceneGraphComponent, locallySubscribedScenesGetUnsubscibedWhenLocalConsu
     SceneInfo sceneInfo(SceneInfo(sceneId, "foo"));
     ClientScene scene(sceneInfo);
 
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     EXPECT_CALL(consumer, handleNewSceneAvailable(sceneInfo, _));
     EXPECT_CALL(communicationSystem, broadcastNewScenesAvailable(SceneInfoVector{ sceneInfo }, ramses::EFeatureLevel_Latest));
     sceneGraphComponent.handlePublishScene(SceneId(1), EScenePublicationMode_LocalAndRemote);
@@ -524,7 +524,7 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
     ClientScene scene(sceneInfo);
 
     sceneGraphComponent.setSceneRendererHandler(&consumer);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
 
     // subscribe local and remote
     EXPECT_CALL(consumer, handleNewSceneAvailable(sceneInfo, _));
@@ -587,10 +587,10 @@ TEST_F(ASceneGraphComponent, disconnectDoesNotAffectLocalScenesAtAllButUnpublish
         event2.sceneid = SceneId{ 10000 };
         SceneInfo sceneInfo1(SceneInfo(SceneId{ 123 }, "foo"));
         ClientScene scene1(sceneInfo1);
-        sceneGraphComponent.handleCreateScene(scene1, false, eventConsumer);
+        sceneGraphComponent.handleCreateScene(scene1, false, false, eventConsumer);
         SceneInfo sceneInfo2(SceneInfo(SceneId{ 10000 }, "bar"));
         ClientScene scene2(sceneInfo2);
-        sceneGraphComponent.handleCreateScene(scene2, false, scene2Consumer);
+        sceneGraphComponent.handleCreateScene(scene2, false, false, scene2Consumer);
 
         InSequence seq;
         EXPECT_CALL(eventConsumer, handleResourceAvailabilityEvent(_, _)).Times(1);
@@ -649,7 +649,7 @@ TEST_F(ASceneGraphComponent, sendSceneReferenceEventForLocalParticipantCallsHand
     SceneReferenceEvent event(SceneId{ 123 });
     SceneInfo sceneInfo(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene(sceneInfo);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     event.type = SceneReferenceEventType::SceneFlushed;
     event.referencedScene = SceneId{ 456 };
     event.tag = SceneVersionTag{ 1000 };
@@ -668,7 +668,7 @@ TEST_F(ASceneGraphComponent, sendResourceAvailabilityEventForLocalParticipantCal
     SceneReferenceEvent event(SceneId { 123 });
     SceneInfo sceneInfo(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene(sceneInfo);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     event.type = SceneReferenceEventType::SceneFlushed;
     event.referencedScene = SceneId{ 456 };
     event.tag = SceneVersionTag{ 1000 };
@@ -699,7 +699,7 @@ TEST_F(ASceneGraphComponent, unpacksRendererEventToSceneReferenceEventAndForward
     SceneReferenceEvent event(SceneId{ 123 });
     SceneInfo sceneInfo(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene(sceneInfo);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     event.type = SceneReferenceEventType::SceneFlushed;
     event.referencedScene = SceneId{ 456 };
     event.tag = SceneVersionTag{ 1000 };
@@ -721,7 +721,7 @@ TEST_F(ASceneGraphComponent, unpacksRendererEventToResourceAvailabilityEventAndF
     event.sceneid = SceneId { 123 };
     SceneInfo sceneInfo(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene(sceneInfo);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
     event.availableResources.push_back(ResourceContentHash(1,2));
     EXPECT_CALL(eventConsumer, handleResourceAvailabilityEvent(_, localParticipantID)).WillOnce([&event](ResourceAvailabilityEvent const& e, const Guid&)
     {
@@ -758,10 +758,10 @@ TEST_F(ASceneGraphComponent, forwardsEventsToCorrectHandler)
     SceneReferenceEvent event2(SceneId{ 10000 });
     SceneInfo sceneInfo1(SceneInfo(SceneId{ 123 }, "foo"));
     ClientScene scene1(sceneInfo1);
-    sceneGraphComponent.handleCreateScene(scene1, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene1, false, false, eventConsumer);
     SceneInfo sceneInfo2(SceneInfo(SceneId{ 10000 }, "bar"));
     ClientScene scene2(sceneInfo2);
-    sceneGraphComponent.handleCreateScene(scene2, false, scene2Consumer);
+    sceneGraphComponent.handleCreateScene(scene2, false, false, scene2Consumer);
 
     InSequence seq;
     EXPECT_CALL(eventConsumer, handleSceneReferenceEvent(_, _)).Times(1);
@@ -1224,7 +1224,7 @@ TEST_F(ASceneGraphComponent, returnsFalseForFlushOnWrongResolvedResourceNumber_S
     ClientScene scene(sceneInfo);
 
     sceneGraphComponent.setSceneRendererHandler(&consumer);
-    sceneGraphComponent.handleCreateScene(scene, false, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, false, false, eventConsumer);
 
     auto res = new TextureResource(EResourceType_Texture2D, TextureMetaInfo(1u, 1u, 1u, ETextureFormat::R8, false, {}, { 1u }), ResourceCacheFlag_DoNotCache, {});
     res->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
@@ -1250,7 +1250,7 @@ TEST_F(ASceneGraphComponent, returnsFalseForFlushOnWrongResolvedResourceNumber_D
     ClientScene scene(sceneInfo);
 
     sceneGraphComponent.setSceneRendererHandler(&consumer);
-    sceneGraphComponent.handleCreateScene(scene, true, eventConsumer);
+    sceneGraphComponent.handleCreateScene(scene, true, false, eventConsumer);
 
     auto res = new TextureResource(EResourceType_Texture2D, TextureMetaInfo(1u, 1u, 1u, ETextureFormat::R8, false, {}, { 1u }), ResourceCacheFlag_DoNotCache, {});
     res->setResourceData(ResourceBlob{ 1 }, { 1u, 1u });
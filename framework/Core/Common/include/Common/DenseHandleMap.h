@@ -0,0 +1,382 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DENSEHANDLEMAP_H
+#define RAMSES_DENSEHANDLEMAP_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/PlatformError.h"
+#include "PlatformAbstraction/Macros.h"
+#include <vector>
+#include <optional>
+#include <utility>
+#include <cassert>
+
+namespace ramses_internal
+{
+    /**
+     * Map keyed by TypedMemoryHandle with same interface as HashMap.
+     *
+     * Handles are allocated densely from zero by memory pools, so the handle itself is used as index into
+     * a flat array of entries and lookup is a single bounds check plus array access without hashing.
+     * Memory used grows with largest handle stored, not with number of elements, so use only for handles
+     * coming from a memory pool. Iteration is in order of handles.
+     */
+    template <class HANDLE, class T>
+    class DenseHandleMap final
+    {
+    public:
+        class Pair final
+        {
+        public:
+            Pair(const HANDLE& key_, const T& value_)
+                : key(key_)
+                , value(value_)
+            {
+            }
+
+            const HANDLE key;
+            T value;
+        };
+
+    private:
+        using Entry = std::optional<Pair>;
+
+    public:
+        class ConstIterator final
+        {
+        public:
+            friend class DenseHandleMap;
+            friend class Iterator;
+
+            ConstIterator(Entry* current, Entry* end)
+                : m_current(current)
+                , m_end(end)
+            {
+            }
+
+            const Pair& operator*() const
+            {
+                return **m_current;
+            }
+
+            const Pair* operator->() const
+            {
+                return &**m_current;
+            }
+
+            bool operator==(const ConstIterator& iter) const
+            {
+                return m_current == iter.m_current;
+            }
+
+            bool operator!=(const ConstIterator& iter) const
+            {
+                return m_current != iter.m_current;
+            }
+
+            ConstIterator& operator++()
+            {
+                ++m_current;
+                skipFreeEntries();
+                return *this;
+            }
+
+            const ConstIterator operator++(int32_t)
+            {
+                ConstIterator oldValue(*this);
+                ++(*this);
+                return oldValue;
+            }
+
+        private:
+            void skipFreeEntries()
+            {
+                while (m_current != m_end && !m_current->has_value())
+                    ++m_current;
+            }
+
+            Entry* m_current;
+            Entry* m_end;
+        };
+
+        class Iterator final
+        {
+        public:
+            friend class DenseHandleMap;
+
+            Iterator(Entry* current, Entry* end)
+                : m_iter(current, end)
+            {
+            }
+
+            Iterator(const ConstIterator& iter)  // NOLINT(google-explicit-constructor) const to non-const iterator should be implicit
+                : m_iter(iter)
+            {
+            }
+
+            Pair& operator*()
+            {
+                return **m_iter.m_current;
+            }
+
+            const Pair& operator*() const
+            {
+                return *m_iter;
+            }
+
+            Pair* operator->()
+            {
+                return &**m_iter.m_current;
+            }
+
+            const Pair* operator->() const
+            {
+                return m_iter.operator->();
+            }
+
+            bool operator==(const Iterator& iter) const
+            {
+                return m_iter == iter.m_iter;
+            }
+
+            bool operator!=(const Iterator& iter) const
+            {
+                return m_iter != iter.m_iter;
+            }
+
+            Iterator& operator++()
+            {
+                ++m_iter;
+                return *this;
+            }
+
+            const Iterator operator++(int32_t)
+            {
+                Iterator oldValue(*this);
+                ++(*this);
+                return oldValue;
+            }
+
+        private:
+            ConstIterator m_iter;
+        };
+
+        DenseHandleMap() = default;
+
+        /**
+         * Constructor.
+         * Allocates entries for handles 0 to minimumCapacity - 1.
+         */
+        explicit DenseHandleMap(size_t minimumCapacity)
+        {
+            reserve(minimumCapacity);
+        }
+
+        DenseHandleMap(const DenseHandleMap& other) = default;
+        DenseHandleMap(DenseHandleMap&& other) noexcept = default;
+        DenseHandleMap& operator=(const DenseHandleMap& other)
+        {
+            // entries cannot be copy assigned because of const key, copy construct instead
+            if (&other != this)
+            {
+                DenseHandleMap copy(other);
+                swap(copy);
+            }
+            return *this;
+        }
+        DenseHandleMap& operator=(DenseHandleMap&& other) noexcept = default;
+        ~DenseHandleMap() = default;
+
+        /**
+         * @param key Key value
+         * @return value Value referenced by key. If no value is stored for given key, a default constructed object is added and returned
+         */
+        T& operator[](const HANDLE& key)
+        {
+            if (T* value = get(key))
+                return *value;
+            return put(key, T())->value;
+        }
+
+        /**
+         * Adds key/value pair, overwrites value if key already exists.
+         * @return iterator pointing to the inserted or overwritten pair
+         */
+        Iterator put(const HANDLE& key, const T& value)
+        {
+            assert(key.isValid());
+            const size_t index = key.asMemoryHandle();
+            if (index >= m_entries.size())
+                m_entries.resize(index + 1u);
+
+            Entry& entry = m_entries[index];
+            if (entry)
+            {
+                entry->value = value;
+            }
+            else
+            {
+                entry.emplace(key, value);
+                ++m_size;
+            }
+            return Iterator(&entry, endEntry());
+        }
+
+        EStatus get(const HANDLE& key, T& value) const
+        {
+            if (const T* storedValue = get(key))
+            {
+                value = *storedValue;
+                return EStatus::Ok;
+            }
+            return EStatus::NotExist;
+        }
+
+        RNODISCARD T* get(const HANDLE& key) const
+        {
+            const Entry* entry = findEntry(key);
+            return entry ? const_cast<T*>(&(*entry)->value) : nullptr;
+        }
+
+        RNODISCARD Iterator find(const HANDLE& key)
+        {
+            Entry* entry = findEntry(key);
+            return entry ? Iterator(entry, endEntry()) : end();
+        }
+
+        RNODISCARD ConstIterator find(const HANDLE& key) const
+        {
+            Entry* entry = findEntry(key);
+            return entry ? ConstIterator(entry, endEntry()) : end();
+        }
+
+        RNODISCARD bool contains(const HANDLE& key) const
+        {
+            return findEntry(key) != nullptr;
+        }
+
+        /**
+         * @param value_old if not null, gets a copy of the removed value
+         * @return true if key was found and removed
+         */
+        bool remove(const HANDLE& key, T* value_old = nullptr)
+        {
+            Entry* entry = findEntry(key);
+            if (!entry)
+                return false;
+            removeEntry(*entry, value_old);
+            return true;
+        }
+
+        /**
+         * @return iterator pointing to the element following the removed one
+         */
+        Iterator remove(Iterator iter, T* value_old = nullptr)
+        {
+            removeEntry(*iter.m_iter.m_current, value_old);
+            ++iter;
+            return iter;
+        }
+
+        RNODISCARD size_t size() const
+        {
+            return m_size;
+        }
+
+        /**
+         * Removes all elements, keeps allocated capacity.
+         */
+        void clear()
+        {
+            m_entries.clear();
+            m_size = 0u;
+        }
+
+        RNODISCARD Iterator begin()
+        {
+            return static_cast<const DenseHandleMap&>(*this).begin();
+        }
+
+        RNODISCARD ConstIterator begin() const
+        {
+            ConstIterator iter(beginEntry(), endEntry());
+            iter.skipFreeEntries();
+            return iter;
+        }
+
+        RNODISCARD Iterator end()
+        {
+            return Iterator(endEntry(), endEntry());
+        }
+
+        RNODISCARD ConstIterator end() const
+        {
+            return ConstIterator(endEntry(), endEntry());
+        }
+
+        /**
+         * Makes sure handles up to requestedCapacity - 1 can be stored without reallocation.
+         */
+        void reserve(size_t requestedCapacity)
+        {
+            m_entries.reserve(requestedCapacity);
+        }
+
+        RNODISCARD size_t capacity() const
+        {
+            return m_entries.capacity();
+        }
+
+        void swap(DenseHandleMap& other)
+        {
+            using std::swap;
+            swap(m_entries, other.m_entries);
+            swap(m_size, other.m_size);
+        }
+
+    private:
+        Entry* findEntry(const HANDLE& key) const
+        {
+            const size_t index = key.asMemoryHandle();
+            if (index >= m_entries.size() || !m_entries[index])
+                return nullptr;
+            return const_cast<Entry*>(&m_entries[index]);
+        }
+
+        void removeEntry(Entry& entry, T* value_old)
+        {
+            assert(entry.has_value());
+            if (value_old)
+                *value_old = entry->value;
+            entry.reset();
+            --m_size;
+        }
+
+        Entry* beginEntry() const
+        {
+            return const_cast<Entry*>(m_entries.data());
+        }
+
+        Entry* endEntry() const
+        {
+            return beginEntry() + m_entries.size();
+        }
+
+        std::vector<Entry> m_entries;
+        size_t m_size = 0u;
+    };
+
+    template <class HANDLE, class T>
+    inline void swap(DenseHandleMap<HANDLE, T>& first, DenseHandleMap<HANDLE, T>& second)
+    {
+        first.swap(second);
+    }
+}
+
+#endif
@@ -0,0 +1,180 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Common/DenseHandleMap.h"
+#include "Common/TypedMemoryHandle.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    struct DenseHandleMapTestTag {};
+    using TestHandle = TypedMemoryHandle<DenseHandleMapTestTag>;
+
+    class ADenseHandleMap : public ::testing::Test
+    {
+    public:
+        DenseHandleMap<TestHandle, uint32_t> map;
+    };
+
+    TEST_F(ADenseHandleMap, isEmptyInitially)
+    {
+        EXPECT_EQ(0u, map.size());
+        EXPECT_EQ(map.end(), map.begin());
+        EXPECT_FALSE(map.contains(TestHandle(0u)));
+        EXPECT_EQ(nullptr, map.get(TestHandle(0u)));
+        EXPECT_EQ(map.end(), map.find(TestHandle(3u)));
+    }
+
+    TEST_F(ADenseHandleMap, putsAndGetsValues)
+    {
+        map.put(TestHandle(0u), 10u);
+        map.put(TestHandle(5u), 50u);
+        EXPECT_EQ(2u, map.size());
+
+        uint32_t value = 0u;
+        EXPECT_EQ(EStatus::Ok, map.get(TestHandle(5u), value));
+        EXPECT_EQ(50u, value);
+        ASSERT_NE(nullptr, map.get(TestHandle(0u)));
+        EXPECT_EQ(10u, *map.get(TestHandle(0u)));
+        EXPECT_EQ(EStatus::NotExist, map.get(TestHandle(3u), value));
+        EXPECT_FALSE(map.contains(TestHandle(3u)));
+        EXPECT_FALSE(map.contains(TestHandle(6u)));
+    }
+
+    TEST_F(ADenseHandleMap, overwritesValueOfExistingHandle)
+    {
+        map.put(TestHandle(2u), 10u);
+        const auto it = map.put(TestHandle(2u), 11u);
+        EXPECT_EQ(1u, map.size());
+        EXPECT_EQ(TestHandle(2u), it->key);
+        EXPECT_EQ(11u, it->value);
+        map[TestHandle(2u)] += 1u;
+        EXPECT_EQ(12u, *map.get(TestHandle(2u)));
+    }
+
+    TEST_F(ADenseHandleMap, subscriptOperatorInsertsDefaultValue)
+    {
+        EXPECT_EQ(0u, map[TestHandle(4u)]);
+        EXPECT_EQ(1u, map.size());
+        EXPECT_TRUE(map.contains(TestHandle(4u)));
+    }
+
+    TEST_F(ADenseHandleMap, removesByHandle)
+    {
+        map.put(TestHandle(1u), 10u);
+        map.put(TestHandle(2u), 20u);
+
+        uint32_t oldValue = 0u;
+        EXPECT_TRUE(map.remove(TestHandle(1u), &oldValue));
+        EXPECT_EQ(10u, oldValue);
+        EXPECT_FALSE(map.remove(TestHandle(1u)));
+        EXPECT_FALSE(map.remove(TestHandle(100u)));
+        EXPECT_FALSE(map.contains(TestHandle(1u)));
+        EXPECT_TRUE(map.contains(TestHandle(2u)));
+        EXPECT_EQ(1u, map.size());
+    }
+
+    TEST_F(ADenseHandleMap, iteratesInOrderOfHandlesSkippingUnusedHandles)
+    {
+        map.put(TestHandle(7u), 70u);
+        map.put(TestHandle(1u), 10u);
+        map.put(TestHandle(4u), 40u);
+
+        std::vector<TestHandle> handles;
+        for (const auto& p : map)
+        {
+            EXPECT_EQ(p.key.asMemoryHandle() * 10u, p.value);
+            handles.push_back(p.key);
+        }
+        EXPECT_EQ((std::vector<TestHandle>{ TestHandle(1u), TestHandle(4u), TestHandle(7u) }), handles);
+    }
+
+    TEST_F(ADenseHandleMap, removesWhileIterating)
+    {
+        for (uint32_t i = 0u; i < 10u; ++i)
+            map.put(TestHandle(i), i);
+
+        for (auto it = map.begin(); it != map.end();)
+        {
+            if (it->value % 2u == 0u)
+                it = map.remove(it);
+            else
+                ++it;
+        }
+
+        EXPECT_EQ(5u, map.size());
+        for (uint32_t i = 0u; i < 10u; ++i)
+            EXPECT_EQ(i % 2u == 1u, map.contains(TestHandle(i)));
+    }
+
+    TEST_F(ADenseHandleMap, convertsConstIteratorToIterator)
+    {
+        map.put(TestHandle(1u), 10u);
+        const DenseHandleMap<TestHandle, uint32_t>& constMap = map;
+        DenseHandleMap<TestHandle, uint32_t>::Iterator it = constMap.find(TestHandle(1u));
+        EXPECT_EQ(map.find(TestHandle(1u)), it);
+    }
+
+    TEST_F(ADenseHandleMap, reservesCapacityForHandles)
+    {
+        DenseHandleMap<TestHandle, uint32_t> reservedMap(100u);
+        EXPECT_GE(reservedMap.capacity(), 100u);
+        EXPECT_EQ(0u, reservedMap.size());
+    }
+
+    TEST_F(ADenseHandleMap, clearRemovesAllElements)
+    {
+        map.put(TestHandle(1u), 10u);
+        map.put(TestHandle(3u), 30u);
+        map.clear();
+        EXPECT_EQ(0u, map.size());
+        EXPECT_EQ(map.end(), map.begin());
+        EXPECT_FALSE(map.contains(TestHandle(1u)));
+    }
+
+    TEST_F(ADenseHandleMap, canBeCopiedAndMoved)
+    {
+        map.put(TestHandle(1u), 10u);
+        map.put(TestHandle(2u), 20u);
+
+        DenseHandleMap<TestHandle, uint32_t> copy(map);
+        copy.remove(TestHandle(1u));
+        EXPECT_TRUE(map.contains(TestHandle(1u)));
+        EXPECT_EQ(1u, copy.size());
+
+        DenseHandleMap<TestHandle, uint32_t> assigned;
+        assigned.put(TestHandle(3u), 30u);
+        assigned = map;
+        EXPECT_EQ(2u, assigned.size());
+        EXPECT_FALSE(assigned.contains(TestHandle(3u)));
+
+        DenseHandleMap<TestHandle, uint32_t> moved(std::move(copy));
+        EXPECT_EQ(1u, moved.size());
+        EXPECT_EQ(20u, *moved.get(TestHandle(2u)));
+
+        assigned = std::move(moved);
+        EXPECT_EQ(1u, assigned.size());
+        EXPECT_EQ(20u, *assigned.get(TestHandle(2u)));
+    }
+
+    TEST_F(ADenseHandleMap, swapsContent)
+    {
+        DenseHandleMap<TestHandle, uint32_t> other;
+        map.put(TestHandle(1u), 10u);
+        other.put(TestHandle(2u), 20u);
+        other.put(TestHandle(3u), 30u);
+
+        using std::swap;
+        swap(map, other);
+        EXPECT_EQ(2u, map.size());
+        EXPECT_EQ(1u, other.size());
+        EXPECT_TRUE(map.contains(TestHandle(3u)));
+        EXPECT_TRUE(other.contains(TestHandle(1u)));
+    }
+}
@@ -0,0 +1,60 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BOUNDINGBOX_H
+#define RAMSES_BOUNDINGBOX_H
+
+#include "DataTypesImpl.h"
+#include <limits>
+
+namespace ramses_internal
+{
+    // Axis aligned bounding box, default constructed box is empty (invalid) and becomes valid once extended
+    class BoundingBox
+    {
+    public:
+        BoundingBox() = default;
+        BoundingBox(const glm::vec3& minCorner, const glm::vec3& maxCorner);
+
+        void extend(const glm::vec3& point);
+        void extend(const BoundingBox& other);
+
+        [[nodiscard]] bool isValid() const;
+        [[nodiscard]] const glm::vec3& getMin() const;
+        [[nodiscard]] const glm::vec3& getMax() const;
+
+        // box containing this box transformed by given (affine) matrix
+        [[nodiscard]] BoundingBox transformed(const glm::mat4& matrix) const;
+        // tests ray starting at origin, returns distance along ray direction (in units of its length) where ray enters box, zero if origin is inside
+        [[nodiscard]] bool intersectsRay(const glm::vec3& rayOrigin, const glm::vec3& rayDir, float& entryDistance) const;
+
+        [[nodiscard]] bool operator==(const BoundingBox& other) const;
+        [[nodiscard]] bool operator!=(const BoundingBox& other) const;
+
+    private:
+        glm::vec3 m_min{ std::numeric_limits<float>::max() };
+        glm::vec3 m_max{ std::numeric_limits<float>::lowest() };
+    };
+
+    inline bool BoundingBox::isValid() const
+    {
+        return m_min.x <= m_max.x && m_min.y <= m_max.y && m_min.z <= m_max.z;
+    }
+
+    inline const glm::vec3& BoundingBox::getMin() const
+    {
+        return m_min;
+    }
+
+    inline const glm::vec3& BoundingBox::getMax() const
+    {
+        return m_max;
+    }
+}
+
+#endif
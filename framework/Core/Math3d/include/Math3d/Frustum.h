@@ -0,0 +1,35 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRUSTUM_H
+#define RAMSES_FRUSTUM_H
+
+#include "DataTypesImpl.h"
+#include <array>
+
+namespace ramses_internal
+{
+    class BoundingBox;
+
+    // Frustum planes extracted from a (model-)view-projection matrix (Gribb/Hartmann),
+    // the planes live in the space the matrix transforms from. When created from a full MVP matrix
+    // boxes can be tested in model space directly without transforming them.
+    class Frustum
+    {
+    public:
+        explicit Frustum(const glm::mat4& viewProjectionMatrix);
+
+        // Conservative test, returns false only if box is guaranteed to be completely outside
+        [[nodiscard]] bool intersects(const BoundingBox& box) const;
+
+    private:
+        std::array<glm::vec4, 6> m_planes;
+    };
+}
+
+#endif
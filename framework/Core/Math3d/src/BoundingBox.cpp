@@ -0,0 +1,94 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Math3d/BoundingBox.h"
+#include <algorithm>
+#include <cmath>
+
+namespace ramses_internal
+{
+    BoundingBox::BoundingBox(const glm::vec3& minCorner, const glm::vec3& maxCorner)
+        : m_min(minCorner)
+        , m_max(maxCorner)
+    {
+    }
+
+    void BoundingBox::extend(const glm::vec3& point)
+    {
+        m_min = glm::min(m_min, point);
+        m_max = glm::max(m_max, point);
+    }
+
+    void BoundingBox::extend(const BoundingBox& other)
+    {
+        if (other.isValid())
+        {
+            m_min = glm::min(m_min, other.m_min);
+            m_max = glm::max(m_max, other.m_max);
+        }
+    }
+
+    BoundingBox BoundingBox::transformed(const glm::mat4& matrix) const
+    {
+        BoundingBox result;
+        if (isValid())
+        {
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                const glm::vec4 point{ (corner & 1) ? m_max.x : m_min.x, (corner & 2) ? m_max.y : m_min.y, (corner & 4) ? m_max.z : m_min.z, 1.f };
+                result.extend(glm::vec3(matrix * point));
+            }
+        }
+
+        return result;
+    }
+
+    bool BoundingBox::intersectsRay(const glm::vec3& rayOrigin, const glm::vec3& rayDir, float& entryDistance) const
+    {
+        if (!isValid())
+            return false;
+
+        // slab test, ray only in its direction starting at origin
+        float nearDistance = 0.f;
+        float farDistance = std::numeric_limits<float>::max();
+        for (glm::length_t axis = 0; axis < 3; ++axis)
+        {
+            if (std::abs(rayDir[axis]) <= std::numeric_limits<float>::min())
+            {
+                // ray parallel to slab
+                if (rayOrigin[axis] < m_min[axis] || rayOrigin[axis] > m_max[axis])
+                    return false;
+                continue;
+            }
+
+            const float invDir = 1.f / rayDir[axis];
+            float t0 = (m_min[axis] - rayOrigin[axis]) * invDir;
+            float t1 = (m_max[axis] - rayOrigin[axis]) * invDir;
+            if (t0 > t1)
+                std::swap(t0, t1);
+
+            nearDistance = std::max(nearDistance, t0);
+            farDistance = std::min(farDistance, t1);
+            if (nearDistance > farDistance)
+                return false;
+        }
+
+        entryDistance = nearDistance;
+        return true;
+    }
+
+    bool BoundingBox::operator==(const BoundingBox& other) const
+    {
+        return m_min == other.m_min && m_max == other.m_max;
+    }
+
+    bool BoundingBox::operator!=(const BoundingBox& other) const
+    {
+        return !operator==(other);
+    }
+}
@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Math3d/Frustum.h"
+#include "Math3d/BoundingBox.h"
+
+namespace ramses_internal
+{
+    Frustum::Frustum(const glm::mat4& viewProjectionMatrix)
+    {
+        const glm::mat4 m = glm::transpose(viewProjectionMatrix);
+        m_planes[0] = m[3] + m[0]; // left
+        m_planes[1] = m[3] - m[0]; // right
+        m_planes[2] = m[3] + m[1]; // bottom
+        m_planes[3] = m[3] - m[1]; // top
+        m_planes[4] = m[3] + m[2]; // near
+        m_planes[5] = m[3] - m[2]; // far
+    }
+
+    bool Frustum::intersects(const BoundingBox& box) const
+    {
+        if (!box.isValid())
+            return false;
+
+        const glm::vec3& minCorner = box.getMin();
+        const glm::vec3& maxCorner = box.getMax();
+        for (const auto& plane : m_planes)
+        {
+            // take the box corner furthest along plane normal, if it is behind the plane the whole box is
+            const glm::vec3 positiveVertex{
+                plane.x >= 0.f ? maxCorner.x : minCorner.x,
+                plane.y >= 0.f ? maxCorner.y : minCorner.y,
+                plane.z >= 0.f ? maxCorner.z : minCorner.z };
+            if (glm::dot(glm::vec3(plane), positiveVertex) + plane.w < 0.f)
+                return false;
+        }
+
+        return true;
+    }
+}
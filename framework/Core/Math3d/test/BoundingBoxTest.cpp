@@ -0,0 +1,121 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "Math3d/BoundingBox.h"
+#include "gtest/gtest.h"
+#include "glm/gtx/transform.hpp"
+#include <cmath>
+
+namespace ramses_internal
+{
+    TEST(ABoundingBox, isInvalidWhenDefaultConstructed)
+    {
+        const BoundingBox box;
+        EXPECT_FALSE(box.isValid());
+    }
+
+    TEST(ABoundingBox, becomesValidWhenExtendedByPoint)
+    {
+        BoundingBox box;
+        box.extend(glm::vec3{ 1.f, 2.f, 3.f });
+        EXPECT_TRUE(box.isValid());
+        EXPECT_EQ(glm::vec3(1.f, 2.f, 3.f), box.getMin());
+        EXPECT_EQ(glm::vec3(1.f, 2.f, 3.f), box.getMax());
+    }
+
+    TEST(ABoundingBox, extendsToContainAllPoints)
+    {
+        BoundingBox box;
+        box.extend(glm::vec3{ 1.f, -2.f, 3.f });
+        box.extend(glm::vec3{ -1.f, 2.f, 0.f });
+        EXPECT_EQ(glm::vec3(-1.f, -2.f, 0.f), box.getMin());
+        EXPECT_EQ(glm::vec3(1.f, 2.f, 3.f), box.getMax());
+    }
+
+    TEST(ABoundingBox, extendsByOtherBox)
+    {
+        BoundingBox box{ { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f } };
+        box.extend(BoundingBox{ { -1.f, 0.5f, 0.5f }, { 0.5f, 2.f, 0.5f } });
+        EXPECT_EQ(BoundingBox({ -1.f, 0.f, 0.f }, { 1.f, 2.f, 1.f }), box);
+    }
+
+    TEST(ABoundingBox, ignoresInvalidBoxWhenExtending)
+    {
+        BoundingBox box{ { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f } };
+        box.extend(BoundingBox{});
+        EXPECT_EQ(BoundingBox({ 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f }), box);
+    }
+
+    TEST(ABoundingBox, canBeCompared)
+    {
+        const BoundingBox box1{ { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f } };
+        const BoundingBox box2{ { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f } };
+        const BoundingBox box3{ { 0.f, 0.f, 0.f }, { 1.f, 2.f, 1.f } };
+        EXPECT_TRUE(box1 == box2);
+        EXPECT_TRUE(box1 != box3);
+        EXPECT_TRUE(BoundingBox{} == BoundingBox{});
+    }
+
+    TEST(ABoundingBox, containsAllCornersWhenTransformed)
+    {
+        const BoundingBox box{ { -1.f, -1.f, -1.f }, { 1.f, 1.f, 1.f } };
+        const glm::mat4 matrix = glm::translate(glm::vec3(10.f, 0.f, 0.f)) * glm::rotate(glm::radians(45.f), glm::vec3(0.f, 0.f, 1.f)) * glm::scale(glm::vec3(2.f, 1.f, 1.f));
+        const BoundingBox result = box.transformed(matrix);
+
+        const float halfDiagonal = std::sqrt(2.f) * 1.5f;
+        EXPECT_NEAR(10.f - halfDiagonal, result.getMin().x, 1e-5f);
+        EXPECT_NEAR(10.f + halfDiagonal, result.getMax().x, 1e-5f);
+        EXPECT_NEAR(-halfDiagonal, result.getMin().y, 1e-5f);
+        EXPECT_NEAR(halfDiagonal, result.getMax().y, 1e-5f);
+        EXPECT_FLOAT_EQ(-1.f, result.getMin().z);
+        EXPECT_FLOAT_EQ(1.f, result.getMax().z);
+
+        EXPECT_FALSE(BoundingBox{}.transformed(matrix).isValid());
+    }
+
+    TEST(ABoundingBox, intersectsRayPointingToIt)
+    {
+        const BoundingBox box{ { -1.f, -1.f, -1.f }, { 1.f, 1.f, 1.f } };
+        float distance = 0.f;
+        EXPECT_TRUE(box.intersectsRay({ 0.f, 0.f, 10.f }, { 0.f, 0.f, -1.f }, distance));
+        EXPECT_FLOAT_EQ(9.f, distance);
+        EXPECT_TRUE(box.intersectsRay({ 5.f, 5.f, 5.f }, glm::normalize(glm::vec3{ -1.f, -1.f, -1.f }), distance));
+        EXPECT_FLOAT_EQ(std::sqrt(3.f) * 4.f, distance);
+        // parallel to slabs, touching face
+        EXPECT_TRUE(box.intersectsRay({ -5.f, 1.f, 0.f }, { 1.f, 0.f, 0.f }, distance));
+        EXPECT_FLOAT_EQ(4.f, distance);
+    }
+
+    TEST(ABoundingBox, intersectsRayStartingInside)
+    {
+        const BoundingBox box{ { -1.f, -1.f, -1.f }, { 1.f, 1.f, 1.f } };
+        float distance = 1.f;
+        EXPECT_TRUE(box.intersectsRay({ 0.f, 0.5f, 0.f }, { 1.f, 0.f, 0.f }, distance));
+        EXPECT_FLOAT_EQ(0.f, distance);
+    }
+
+    TEST(ABoundingBox, doesNotIntersectRayMissingIt)
+    {
+        const BoundingBox box{ { -1.f, -1.f, 0.f }, { 1.f, 1.f, 0.f } };
+        float distance = 0.f;
+        EXPECT_FALSE(box.intersectsRay({ 0.f, 0.f, 10.f }, { 0.f, 0.f, 1.f }, distance));
+        EXPECT_FALSE(box.intersectsRay({ 0.f, 2.f, 10.f }, { 0.f, 0.f, -1.f }, distance));
+        EXPECT_FALSE(box.intersectsRay({ 0.f, 0.f, 1.f }, { 1.f, 0.f, 0.f }, distance));
+        EXPECT_FALSE(box.intersectsRay({ 5.f, 0.f, 5.f }, glm::normalize(glm::vec3{ -1.f, 0.f, 0.1f }), distance));
+        EXPECT_FALSE(BoundingBox{}.intersectsRay({ 0.f, 0.f, 10.f }, { 0.f, 0.f, -1.f }, distance));
+    }
+
+    TEST(ABoundingBox, intersectsRayWhenFlat)
+    {
+        const BoundingBox box{ { -1.f, -1.f, 0.f }, { 1.f, 1.f, 0.f } };
+        float distance = 0.f;
+        EXPECT_TRUE(box.intersectsRay({ 0.5f, 0.f, 10.f }, { 0.f, 0.f, -1.f }, distance));
+        EXPECT_FLOAT_EQ(10.f, distance);
+    }
+}
@@ -0,0 +1,68 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "Math3d/Frustum.h"
+#include "Math3d/BoundingBox.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include "gtest/gtest.h"
+#include "glm/gtx/transform.hpp"
+
+namespace ramses_internal
+{
+    class AFrustum : public ::testing::Test
+    {
+    protected:
+        // camera at origin looking down -z
+        const glm::mat4 m_perspective = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Perspective(90.f, 1.f, 1.f, 100.f));
+        const glm::mat4 m_orthographic = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Frustum(ECameraProjectionType::Orthographic, -10.f, 10.f, -10.f, 10.f, 1.f, 100.f));
+
+        static BoundingBox UnitBoxAt(const glm::vec3& center)
+        {
+            return BoundingBox{ center - glm::vec3(0.5f), center + glm::vec3(0.5f) };
+        }
+    };
+
+    TEST_F(AFrustum, intersectsBoxInsideFrustum)
+    {
+        EXPECT_TRUE(Frustum(m_perspective).intersects(UnitBoxAt({ 0.f, 0.f, -10.f })));
+        EXPECT_TRUE(Frustum(m_orthographic).intersects(UnitBoxAt({ 5.f, -5.f, -50.f })));
+    }
+
+    TEST_F(AFrustum, intersectsBoxPartiallyInsideFrustum)
+    {
+        EXPECT_TRUE(Frustum(m_perspective).intersects(UnitBoxAt({ 10.2f, 0.f, -10.f })));
+        EXPECT_TRUE(Frustum(m_orthographic).intersects(UnitBoxAt({ 0.f, 0.f, -100.2f })));
+    }
+
+    TEST_F(AFrustum, doesNotIntersectBoxOutsideOfAnyPlane)
+    {
+        const Frustum frustum(m_perspective);
+        EXPECT_FALSE(frustum.intersects(UnitBoxAt({ 12.f, 0.f, -10.f })));
+        EXPECT_FALSE(frustum.intersects(UnitBoxAt({ -12.f, 0.f, -10.f })));
+        EXPECT_FALSE(frustum.intersects(UnitBoxAt({ 0.f, 12.f, -10.f })));
+        EXPECT_FALSE(frustum.intersects(UnitBoxAt({ 0.f, -12.f, -10.f })));
+        EXPECT_FALSE(frustum.intersects(UnitBoxAt({ 0.f, 0.f, 5.f })));
+        EXPECT_FALSE(frustum.intersects(UnitBoxAt({ 0.f, 0.f, -200.f })));
+    }
+
+    TEST_F(AFrustum, testsBoxInModelSpaceWhenCreatedFromModelViewProjection)
+    {
+        const glm::mat4 view = glm::translate(glm::vec3(0.f, 0.f, -10.f));
+        const glm::mat4 modelOutside = glm::translate(glm::vec3(50.f, 0.f, 0.f));
+        const glm::mat4 modelInside = glm::translate(glm::vec3(1.f, 0.f, 0.f));
+
+        EXPECT_FALSE(Frustum(m_perspective * view * modelOutside).intersects(UnitBoxAt({ 0.f, 0.f, 0.f })));
+        EXPECT_TRUE(Frustum(m_perspective * view * modelInside).intersects(UnitBoxAt({ 0.f, 0.f, 0.f })));
+    }
+
+    TEST_F(AFrustum, doesNotIntersectInvalidBox)
+    {
+        EXPECT_FALSE(Frustum(m_perspective).intersects(BoundingBox{}));
+    }
+}
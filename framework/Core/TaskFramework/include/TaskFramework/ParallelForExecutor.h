@@ -0,0 +1,69 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PARALLELFOREXECUTOR_H
+#define RAMSES_PARALLELFOREXECUTOR_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+
+namespace ramses_internal
+{
+    /**
+     * Executes a function for disjoint ranges of [0, count) on a fixed set of worker threads and the calling thread.
+     * Meant for short, frequently repeated data parallel work (e.g. per frame updates), workers are kept alive
+     * and only woken up for execution. Calls to execute must not overlap.
+     */
+    class ParallelForExecutor
+    {
+    public:
+        using RangeFunction = std::function<void(size_t begin, size_t end)>;
+
+        explicit ParallelForExecutor(uint32_t workerThreadCount);
+        ~ParallelForExecutor();
+
+        ParallelForExecutor(const ParallelForExecutor&) = delete;
+        ParallelForExecutor& operator=(const ParallelForExecutor&) = delete;
+
+        [[nodiscard]] uint32_t getWorkerThreadCount() const;
+
+        /**
+         * Calls function for consecutive ranges covering [0, count) and blocks until all of them were processed.
+         * Ranges are at least minRangeSize elements big (except the last one), if count does not exceed
+         * minRangeSize the function is called once on the calling thread without waking up any worker.
+         */
+        void execute(size_t count, size_t minRangeSize, const RangeFunction& function);
+
+    private:
+        class Worker;
+
+        void workerLoop();
+        void executeRanges();
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+
+        std::mutex              m_lock;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_workDone;
+        uint64_t                m_generation = 0u;
+        uint32_t                m_activeWorkers = 0u;
+        bool                    m_stop = false;
+
+        const RangeFunction*    m_function = nullptr;
+        size_t                  m_count = 0u;
+        size_t                  m_rangeSize = 0u;
+        std::atomic<size_t>     m_nextRangeBegin{ 0u };
+    };
+}
+
+#endif
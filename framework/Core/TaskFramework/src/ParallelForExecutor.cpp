@@ -0,0 +1,127 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "TaskFramework/ParallelForExecutor.h"
+#include "PlatformAbstraction/PlatformThread.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    class ParallelForExecutor::Worker final : public Runnable
+    {
+    public:
+        explicit Worker(ParallelForExecutor& executor)
+            : m_executor(executor)
+            , m_thread("R_ParallelFor")
+        {
+            m_thread.start(*this);
+        }
+
+        ~Worker() override
+        {
+            m_thread.join();
+        }
+
+        void run() override
+        {
+            m_executor.workerLoop();
+        }
+
+    private:
+        ParallelForExecutor& m_executor;
+        PlatformThread m_thread;
+    };
+
+    ParallelForExecutor::ParallelForExecutor(uint32_t workerThreadCount)
+    {
+        m_workers.reserve(workerThreadCount);
+        for (uint32_t i = 0u; i < workerThreadCount; ++i)
+            m_workers.push_back(std::make_unique<Worker>(*this));
+    }
+
+    ParallelForExecutor::~ParallelForExecutor()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_stop = true;
+        }
+        m_workAvailable.notify_all();
+        m_workers.clear();
+    }
+
+    uint32_t ParallelForExecutor::getWorkerThreadCount() const
+    {
+        return static_cast<uint32_t>(m_workers.size());
+    }
+
+    void ParallelForExecutor::execute(size_t count, size_t minRangeSize, const RangeFunction& function)
+    {
+        if (count == 0u)
+            return;
+
+        // split into a few ranges per thread so that threads finishing early can take over remaining work
+        const size_t threadCount = m_workers.size() + 1u;
+        const size_t rangeSize = std::max<size_t>({ minRangeSize, (count + 4u * threadCount - 1u) / (4u * threadCount), 1u });
+        if (m_workers.empty() || count <= rangeSize)
+        {
+            function(0u, count);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            assert(m_activeWorkers == 0u && m_function == nullptr);
+            m_function = &function;
+            m_count = count;
+            m_rangeSize = rangeSize;
+            m_nextRangeBegin = 0u;
+            m_activeWorkers = static_cast<uint32_t>(m_workers.size());
+            ++m_generation;
+        }
+        m_workAvailable.notify_all();
+
+        executeRanges();
+
+        std::unique_lock<std::mutex> lock(m_lock);
+        m_workDone.wait(lock, [this] { return m_activeWorkers == 0u; });
+        m_function = nullptr;
+    }
+
+    void ParallelForExecutor::executeRanges()
+    {
+        for (size_t begin = m_nextRangeBegin.fetch_add(m_rangeSize); begin < m_count; begin = m_nextRangeBegin.fetch_add(m_rangeSize))
+            (*m_function)(begin, std::min(begin + m_rangeSize, m_count));
+    }
+
+    void ParallelForExecutor::workerLoop()
+    {
+        uint64_t executedGeneration = 0u;
+        for (;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_lock);
+                m_workAvailable.wait(lock, [&] { return m_stop || m_generation != executedGeneration; });
+                if (m_stop)
+                    return;
+                executedGeneration = m_generation;
+            }
+
+            executeRanges();
+
+            bool lastWorker = false;
+            {
+                std::lock_guard<std::mutex> guard(m_lock);
+                assert(m_activeWorkers > 0u);
+                lastWorker = (--m_activeWorkers == 0u);
+            }
+            if (lastWorker)
+                m_workDone.notify_one();
+        }
+    }
+}
@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "gmock/gmock.h"
+#include "TaskFramework/ParallelForExecutor.h"
+#include <thread>
+#include <mutex>
+#include <numeric>
+
+namespace ramses_internal
+{
+    class AParallelForExecutor : public ::testing::TestWithParam<uint32_t>
+    {
+    protected:
+        ParallelForExecutor executor{ GetParam() };
+    };
+
+    INSTANTIATE_TEST_SUITE_P(AParallelForExecutorTests, AParallelForExecutor, ::testing::Values(0u, 1u, 4u));
+
+    TEST_P(AParallelForExecutor, reportsWorkerThreadCount)
+    {
+        EXPECT_EQ(GetParam(), executor.getWorkerThreadCount());
+    }
+
+    TEST_P(AParallelForExecutor, doesNotCallFunctionForEmptyRange)
+    {
+        bool called = false;
+        executor.execute(0u, 1u, [&](size_t, size_t) { called = true; });
+        EXPECT_FALSE(called);
+    }
+
+    TEST_P(AParallelForExecutor, callsFunctionOnceOnCallingThreadIfCountDoesNotExceedMinRangeSize)
+    {
+        std::vector<std::pair<size_t, size_t>> ranges;
+        std::thread::id callingThread;
+        executor.execute(10u, 10u, [&](size_t begin, size_t end) {
+            ranges.emplace_back(begin, end);
+            callingThread = std::this_thread::get_id();
+        });
+        ASSERT_EQ(1u, ranges.size());
+        EXPECT_EQ(0u, ranges[0].first);
+        EXPECT_EQ(10u, ranges[0].second);
+        EXPECT_EQ(std::this_thread::get_id(), callingThread);
+    }
+
+    TEST_P(AParallelForExecutor, processesEveryElementExactlyOnce)
+    {
+        for (size_t count : { 1u, 7u, 100u, 1000u, 12345u })
+        {
+            std::vector<uint32_t> processed(count, 0u);
+            executor.execute(count, 1u, [&](size_t begin, size_t end) {
+                EXPECT_LT(begin, end);
+                for (size_t i = begin; i < end; ++i)
+                    ++processed[i];
+            });
+            EXPECT_THAT(processed, ::testing::Each(1u));
+        }
+    }
+
+    TEST_P(AParallelForExecutor, canBeExecutedRepeatedly)
+    {
+        std::vector<uint32_t> processed(1000u, 0u);
+        for (uint32_t i = 0u; i < 100u; ++i)
+        {
+            executor.execute(processed.size(), 8u, [&](size_t begin, size_t end) {
+                for (size_t j = begin; j < end; ++j)
+                    ++processed[j];
+            });
+        }
+        EXPECT_THAT(processed, ::testing::Each(100u));
+    }
+
+    TEST_P(AParallelForExecutor, respectsMinRangeSize)
+    {
+        std::mutex lock;
+        std::vector<size_t> rangeSizes;
+        executor.execute(1000u, 100u, [&](size_t begin, size_t end) {
+            std::lock_guard<std::mutex> guard(lock);
+            rangeSizes.push_back(end - begin);
+        });
+        EXPECT_THAT(rangeSizes, ::testing::Each(::testing::Ge(100u)));
+        EXPECT_EQ(1000u, std::accumulate(rangeSizes.cbegin(), rangeSizes.cend(), size_t{ 0u }));
+    }
+}
@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMEWORK_BINARYMEMORYMAPPEDFILEINPUTSTREAM_H
+#define RAMSES_FRAMEWORK_BINARYMEMORYMAPPEDFILEINPUTSTREAM_H
+
+#include "Collections/IInputStream.h"
+#include "Utils/MemoryMappedFile.h"
+#include <memory>
+
+namespace ramses_internal
+{
+    /*
+     * Input stream reading from a memory mapped file. Besides copying data like any other input stream
+     * it allows to access data in place (readInPlace), the returned data stays valid as long as
+     * the mapped file is alive, which can be shared with the stream (getMappedFile).
+     */
+    class BinaryMemoryMappedFileInputStream : public IInputStream
+    {
+    public:
+        explicit BinaryMemoryMappedFileInputStream(std::shared_ptr<const MemoryMappedFile> mappedFile);
+
+        IInputStream& read(void* buffer, size_t size) override;
+        [[nodiscard]] Byte* readInPlace(size_t size);
+
+        EStatus seek(Int numberOfBytesToSeek, Seek origin) override;
+        EStatus getPos(size_t& position) const override;
+
+        [[nodiscard]] EStatus getState() const override;
+
+        [[nodiscard]] const std::shared_ptr<const MemoryMappedFile>& getMappedFile() const;
+
+    private:
+        std::shared_ptr<const MemoryMappedFile> m_mappedFile;
+        EStatus m_state;
+        size_t m_pos = 0u;
+    };
+}
+
+#endif
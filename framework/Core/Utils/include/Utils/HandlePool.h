@@ -12,6 +12,7 @@
 #include "Common/TypedMemoryHandle.h"
 #include "Collections/Vector.h"
 #include <limits>
+#include <algorithm>
 #include <cassert>
 
 namespace ramses_internal
@@ -33,6 +34,10 @@ namespace ramses_internal
         [[nodiscard]] uint32_t                          size() const;
         void                            resize(uint32_t size);
 
+        // Acquired state of all handles (non zero if acquired), restore replaces the state of all handles at once
+        [[nodiscard]] const std::vector<uint8_t>&       getAcquiredFlags() const;
+        void                            restore(std::vector<uint8_t>&& acquiredFlags);
+
         static HANDLE                   InvalidMemoryHandle();
 
     protected:
@@ -140,6 +145,20 @@ namespace ramses_internal
         m_handlePool.resize(size);
     }
 
+    template <typename HANDLE>
+    const std::vector<uint8_t>& HandlePool<HANDLE>::getAcquiredFlags() const
+    {
+        return m_handlePool;
+    }
+
+    template <typename HANDLE>
+    void HandlePool<HANDLE>::restore(std::vector<uint8_t>&& acquiredFlags)
+    {
+        m_handlePool = std::move(acquiredFlags);
+        m_nextAvailableHint = 0u;
+        m_numberOfAcquired = static_cast<uint32_t>(std::count_if(m_handlePool.cbegin(), m_handlePool.cend(), [](uint8_t flag) { return flag != 0; }));
+    }
+
     template <typename HANDLE>
     HANDLE HandlePool<HANDLE>::InvalidMemoryHandle()
     {
@@ -0,0 +1,45 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FRAMEWORK_MEMORYMAPPEDFILE_H
+#define RAMSES_FRAMEWORK_MEMORYMAPPEDFILE_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+
+#include <string_view>
+
+namespace ramses_internal
+{
+    /*
+     * Maps the whole content of a file into memory for reading. Pages are only loaded from the file
+     * when accessed and can be dropped again by the OS when memory is needed.
+     *
+     * The mapping is private (copy-on-write): writing to the mapped data never modifies the file,
+     * only the written pages get copied. This allows to use the mapped data in place of heap allocated buffers.
+     * The file must not be truncated while it is mapped.
+     */
+    class MemoryMappedFile final
+    {
+    public:
+        explicit MemoryMappedFile(std::string_view filename);
+        ~MemoryMappedFile();
+
+        MemoryMappedFile(const MemoryMappedFile&) = delete;
+        MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+        [[nodiscard]] bool isValid() const;
+        [[nodiscard]] Byte* data() const;
+        [[nodiscard]] size_t size() const;
+
+    private:
+        Byte* m_data = nullptr;
+        size_t m_size = 0u;
+    };
+}
+
+#endif
@@ -43,6 +43,11 @@ namespace ramses_internal
 
         void                            preallocateSize(uint32_t size);
 
+        // Bulk access to the whole pool including unallocated objects, restore replaces all objects and their allocation state at once
+        [[nodiscard]] const std::vector<OBJECTTYPE>&  getObjects() const;
+        [[nodiscard]] const std::vector<uint8_t>&     getAllocationFlags() const;
+        void                            restore(std::vector<OBJECTTYPE>&& objects, std::vector<uint8_t>&& allocationFlags);
+
         static HANDLE                   InvalidMemoryHandle();
 
         iterator                        begin();
@@ -69,6 +74,26 @@ namespace ramses_internal
         }
     }
 
+    template <typename OBJECTTYPE, typename HANDLE>
+    const std::vector<OBJECTTYPE>& MemoryPool<OBJECTTYPE, HANDLE>::getObjects() const
+    {
+        return m_memoryPool;
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    const std::vector<uint8_t>& MemoryPool<OBJECTTYPE, HANDLE>::getAllocationFlags() const
+    {
+        return m_handlePool.getAcquiredFlags();
+    }
+
+    template <typename OBJECTTYPE, typename HANDLE>
+    void MemoryPool<OBJECTTYPE, HANDLE>::restore(std::vector<OBJECTTYPE>&& objects, std::vector<uint8_t>&& allocationFlags)
+    {
+        assert(objects.size() == allocationFlags.size());
+        m_memoryPool = std::move(objects);
+        m_handlePool.restore(std::move(allocationFlags));
+    }
+
     template <typename OBJECTTYPE, typename HANDLE>
     MemoryPool<OBJECTTYPE, HANDLE>::MemoryPool(uint32_t size /*= 0*/)
         : m_memoryPool(size)
@@ -0,0 +1,149 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_UTILS_TRACERECORDER_H
+#define RAMSES_UTILS_TRACERECORDER_H
+
+#include "PlatformAbstraction/PlatformTime.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ramses_internal
+{
+    // Records timed events into per-thread ring buffers and exports them in Chrome trace event format
+    // (JSON, can be opened in chrome://tracing or ui.perfetto.dev).
+    //
+    // Recording is lock-free, every thread writes only into its own ring buffer, the oldest events are overwritten
+    // when buffer is full. Only first event or name of a thread registers its buffer with recorder under lock,
+    // events of a thread are allocated with its first recorded event, so naming threads costs no memory while recording is disabled.
+    // Buffer of an exited thread is reused (and its events discarded) by next newly recording thread.
+    // Names, categories and argument names must be string literals or otherwise outlive the recorder,
+    // only pointers are stored.
+    class TraceRecorder
+    {
+    public:
+        struct Event
+        {
+            const char* category = nullptr;
+            const char* name = nullptr;
+            const char* argName = nullptr;
+            uint64_t arg = 0u;
+            uint64_t start = 0u;
+            uint64_t duration = 0u;
+            bool instant = false;
+        };
+
+        static constexpr size_t DefaultEventsPerThread = 16384u;
+
+        explicit TraceRecorder(size_t eventsPerThread = DefaultEventsPerThread);
+        ~TraceRecorder();
+
+        TraceRecorder(const TraceRecorder&) = delete;
+        TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+        void enable(bool enabled);
+        [[nodiscard]] bool isEnabled() const;
+
+        // Drops all events recorded so far
+        void clear();
+
+        // Name of calling thread shown in exported trace
+        void setThreadName(const std::string& name);
+
+        // Timestamps are in microseconds of PlatformTime::GetMicrosecondsMonotonic
+        void recordComplete(const char* category, const char* name, uint64_t start, uint64_t duration, const char* argName = nullptr, uint64_t arg = 0u);
+        void recordInstant(const char* category, const char* name, const char* argName = nullptr, uint64_t arg = 0u);
+
+        // Events of all threads ordered by start time. Events recorded concurrently with this call might be missing.
+        [[nodiscard]] std::vector<std::pair<uint32_t, Event>> collectEvents() const;
+
+        [[nodiscard]] std::string exportChromeTrace() const;
+        bool writeChromeTrace(const std::string& filePath) const;
+
+        static uint64_t Now();
+
+        // For testing only
+        [[nodiscard]] size_t getAllocatedEventSlotCount() const;
+
+    private:
+        class ThreadBuffer;
+        ThreadBuffer& getThreadBuffer();
+        void record(const Event& event);
+
+        const uint64_t m_id;
+        const size_t m_eventsPerThread;
+        std::atomic<bool> m_enabled{ false };
+        std::atomic<uint64_t> m_clearTime{ 0u };
+
+        mutable std::mutex m_buffersLock;
+        std::vector<std::shared_ptr<ThreadBuffer>> m_buffers;
+    };
+
+    TraceRecorder& GetTraceRecorder();
+
+    class ScopedTraceEvent
+    {
+    public:
+        ScopedTraceEvent(const char* category, const char* name, const char* argName = nullptr, uint64_t arg = 0u)
+            : m_category(category)
+            , m_name(name)
+            , m_argName(argName)
+            , m_arg(arg)
+            , m_start(GetTraceRecorder().isEnabled() ? TraceRecorder::Now() : 0u)
+        {
+        }
+
+        ~ScopedTraceEvent()
+        {
+            if (m_start != 0u)
+                GetTraceRecorder().recordComplete(m_category, m_name, m_start, TraceRecorder::Now() - m_start, m_argName, m_arg);
+        }
+
+        ScopedTraceEvent(const ScopedTraceEvent&) = delete;
+        ScopedTraceEvent& operator=(const ScopedTraceEvent&) = delete;
+
+    private:
+        const char* m_category;
+        const char* m_name;
+        const char* m_argName;
+        uint64_t m_arg;
+        uint64_t m_start;
+    };
+
+    inline bool TraceRecorder::isEnabled() const
+    {
+        return m_enabled.load(std::memory_order_relaxed);
+    }
+
+    inline uint64_t TraceRecorder::Now()
+    {
+        return PlatformTime::GetMicrosecondsMonotonic();
+    }
+}
+
+#define RAMSES_TRACE_CONCAT_INNER(a, b) a##b
+#define RAMSES_TRACE_CONCAT(a, b) RAMSES_TRACE_CONCAT_INNER(a, b)
+
+#define RAMSES_TRACE_SCOPE(category, name) \
+    ::ramses_internal::ScopedTraceEvent RAMSES_TRACE_CONCAT(ramsesTraceScope, __LINE__)((category), (name))
+
+#define RAMSES_TRACE_SCOPE_ARG(category, name, argName, arg) \
+    ::ramses_internal::ScopedTraceEvent RAMSES_TRACE_CONCAT(ramsesTraceScope, __LINE__)((category), (name), (argName), static_cast<uint64_t>(arg))
+
+#define RAMSES_TRACE_INSTANT(category, name, argName, arg)                                                      \
+    do {                                                                                                        \
+        if (::ramses_internal::GetTraceRecorder().isEnabled())                                                  \
+            ::ramses_internal::GetTraceRecorder().recordInstant((category), (name), (argName), static_cast<uint64_t>(arg)); \
+    } while (0)
+
+#endif
@@ -0,0 +1,93 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/BinaryMemoryMappedFileInputStream.h"
+#include <cstring>
+
+namespace ramses_internal
+{
+    BinaryMemoryMappedFileInputStream::BinaryMemoryMappedFileInputStream(std::shared_ptr<const MemoryMappedFile> mappedFile)
+        : m_mappedFile(std::move(mappedFile))
+        , m_state(m_mappedFile && m_mappedFile->isValid() ? EStatus::Ok : EStatus::Error)
+    {
+    }
+
+    IInputStream& BinaryMemoryMappedFileInputStream::read(void* buffer, size_t size)
+    {
+        if (EStatus::Ok != m_state)
+            return *this;
+        if (buffer == nullptr)
+        {
+            m_state = EStatus::Error;
+            return *this;
+        }
+
+        const Byte* data = readInPlace(size);
+        if (data && size > 0u)
+            std::memcpy(buffer, data, size);
+
+        return *this;
+    }
+
+    Byte* BinaryMemoryMappedFileInputStream::readInPlace(size_t size)
+    {
+        if (EStatus::Ok != m_state)
+            return nullptr;
+        if (size > m_mappedFile->size() - m_pos)
+        {
+            m_state = EStatus::Eof;
+            return nullptr;
+        }
+
+        Byte* data = m_mappedFile->data() + m_pos;
+        m_pos += size;
+
+        return data;
+    }
+
+    EStatus BinaryMemoryMappedFileInputStream::seek(Int numberOfBytesToSeek, Seek origin)
+    {
+        if (m_state != EStatus::Ok)
+            return EStatus::Error;
+
+        Int newPos = 0;
+        switch (origin)
+        {
+        case Seek::FromBeginning:
+            newPos = numberOfBytesToSeek;
+            break;
+        case Seek::Relative:
+            newPos = static_cast<Int>(m_pos) + numberOfBytesToSeek;
+            break;
+        }
+        if (newPos < 0 || newPos > static_cast<Int>(m_mappedFile->size()))
+            return EStatus::Error;
+
+        m_pos = static_cast<size_t>(newPos);
+
+        return EStatus::Ok;
+    }
+
+    EStatus BinaryMemoryMappedFileInputStream::getPos(size_t& position) const
+    {
+        if (m_state != EStatus::Ok)
+            return EStatus::Error;
+        position = m_pos;
+        return EStatus::Ok;
+    }
+
+    EStatus BinaryMemoryMappedFileInputStream::getState() const
+    {
+        return m_state;
+    }
+
+    const std::shared_ptr<const MemoryMappedFile>& BinaryMemoryMappedFileInputStream::getMappedFile() const
+    {
+        return m_mappedFile;
+    }
+}
@@ -0,0 +1,109 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/MemoryMappedFile.h"
+#include <string>
+
+namespace ramses_internal
+{
+    bool MemoryMappedFile::isValid() const
+    {
+        return m_data != nullptr;
+    }
+
+    Byte* MemoryMappedFile::data() const
+    {
+        return m_data;
+    }
+
+    size_t MemoryMappedFile::size() const
+    {
+        return m_size;
+    }
+}
+
+#ifdef _WIN32
+
+#include "PlatformAbstraction/MinimalWindowsH.h"
+
+namespace ramses_internal
+{
+    MemoryMappedFile::MemoryMappedFile(std::string_view filename)
+    {
+        HANDLE fileHandle = CreateFileA(std::string{filename}.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+            return;
+
+        LARGE_INTEGER fileSize;
+        if (GetFileSizeEx(fileHandle, &fileSize) != TRUE || fileSize.QuadPart == 0)
+        {
+            CloseHandle(fileHandle);
+            return;
+        }
+
+        // mapped view keeps the mapping and file alive, handles can be closed right away
+        HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(fileHandle);
+        if (mappingHandle == nullptr)
+            return;
+
+        void* mappedData = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+        CloseHandle(mappingHandle);
+        if (mappedData == nullptr)
+            return;
+
+        m_data = static_cast<Byte*>(mappedData);
+        m_size = static_cast<size_t>(fileSize.QuadPart);
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+            UnmapViewOfFile(m_data);
+    }
+}
+
+#else // posix
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace ramses_internal
+{
+    MemoryMappedFile::MemoryMappedFile(std::string_view filename)
+    {
+        const int fd = open(std::string{filename}.c_str(), O_RDONLY);
+        if (fd == -1)
+            return;
+
+        struct stat fileStat = {};
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+        {
+            close(fd);
+            return;
+        }
+
+        // mapping keeps the file alive, file descriptor can be closed right away
+        const auto fileSize = static_cast<size_t>(fileStat.st_size);
+        void* mappedData = mmap(nullptr, fileSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mappedData == MAP_FAILED)
+            return;
+
+        m_data = static_cast<Byte*>(mappedData);
+        m_size = fileSize;
+    }
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        if (m_data)
+            munmap(m_data, m_size);
+    }
+}
+#endif
@@ -0,0 +1,331 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/TraceRecorder.h"
+#include "Utils/File.h"
+#include "Utils/LogMacros.h"
+#include "fmt/format.h"
+
+#include <algorithm>
+#include <iterator>
+#include <cassert>
+
+namespace ramses_internal
+{
+    // Ring buffer written by single thread, all fields are atomic so that export can read it concurrently.
+    // Export detects slots overwritten while reading using the write counter (same principle as seqlock).
+    class TraceRecorder::ThreadBuffer
+    {
+    public:
+        // slots are allocated only when thread records first event, one extra slot for event being written, which is never exported
+        explicit ThreadBuffer(size_t capacity)
+            : m_capacity(capacity + 1u)
+        {
+        }
+
+        // called by owning thread under recorder lock, so that export does not read slots while they are allocated
+        void allocate()
+        {
+            m_slots = std::vector<Slot>(m_capacity);
+        }
+
+        [[nodiscard]] bool isAllocated() const
+        {
+            return !m_slots.empty();
+        }
+
+        [[nodiscard]] size_t getSlotCount() const
+        {
+            return m_slots.size();
+        }
+
+        void write(const Event& event)
+        {
+            const uint64_t idx = m_written.load(std::memory_order_relaxed);
+            Slot& slot = m_slots[idx % m_slots.size()];
+            slot.category.store(event.category, std::memory_order_relaxed);
+            slot.name.store(event.name, std::memory_order_relaxed);
+            slot.argName.store(event.argName, std::memory_order_relaxed);
+            slot.arg.store(event.arg, std::memory_order_relaxed);
+            slot.start.store(event.start, std::memory_order_relaxed);
+            slot.duration.store(event.duration, std::memory_order_relaxed);
+            slot.instant.store(event.instant, std::memory_order_relaxed);
+            m_written.store(idx + 1u, std::memory_order_release);
+        }
+
+        void read(std::vector<std::pair<uint32_t, Event>>& events, uint64_t minStartTime) const
+        {
+            if (m_slots.empty())
+                return;
+
+            const uint64_t capacity = m_slots.size();
+            const uint64_t writtenBefore = m_written.load(std::memory_order_acquire);
+            const uint64_t first = writtenBefore > capacity ? writtenBefore - capacity : 0u;
+
+            std::vector<std::pair<uint64_t, Event>> readEvents;
+            readEvents.reserve(static_cast<size_t>(writtenBefore - first));
+            for (uint64_t idx = first; idx < writtenBefore; ++idx)
+            {
+                const Slot& slot = m_slots[idx % capacity];
+                Event event;
+                event.category = slot.category.load(std::memory_order_relaxed);
+                event.name = slot.name.load(std::memory_order_relaxed);
+                event.argName = slot.argName.load(std::memory_order_relaxed);
+                event.arg = slot.arg.load(std::memory_order_relaxed);
+                event.start = slot.start.load(std::memory_order_relaxed);
+                event.duration = slot.duration.load(std::memory_order_relaxed);
+                event.instant = slot.instant.load(std::memory_order_relaxed);
+                readEvents.emplace_back(idx, event);
+            }
+
+            // events possibly overwritten by writer while being read are dropped,
+            // slot of next event to be written (but not yet published) is considered overwritten too
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const uint64_t writtenAfter = m_written.load(std::memory_order_relaxed);
+            const uint64_t firstValid = writtenAfter >= capacity ? writtenAfter - capacity + 1u : 0u;
+
+            for (const auto& readEvent : readEvents)
+            {
+                if (readEvent.first >= firstValid && readEvent.second.start >= minStartTime)
+                    events.emplace_back(threadIndex, readEvent.second);
+            }
+        }
+
+        void reset()
+        {
+            m_written.store(0u, std::memory_order_relaxed);
+        }
+
+        uint32_t threadIndex = 0u;
+        std::string threadName;
+        std::atomic<bool> threadAlive{ true };
+
+    private:
+        struct Slot
+        {
+            std::atomic<const char*> category{ nullptr };
+            std::atomic<const char*> name{ nullptr };
+            std::atomic<const char*> argName{ nullptr };
+            std::atomic<uint64_t> arg{ 0u };
+            std::atomic<uint64_t> start{ 0u };
+            std::atomic<uint64_t> duration{ 0u };
+            std::atomic<bool> instant{ false };
+        };
+
+        const size_t m_capacity;
+        std::vector<Slot> m_slots;
+        std::atomic<uint64_t> m_written{ 0u };
+    };
+
+    namespace
+    {
+        std::atomic<uint64_t> NextRecorderId{ 1u };
+
+        void AppendEscaped(fmt::memory_buffer& out, const char* str)
+        {
+            for (const char* c = str; *c != '\0'; ++c)
+            {
+                if (*c == '"' || *c == '\\')
+                    out.push_back('\\');
+                if (static_cast<unsigned char>(*c) >= 0x20u)
+                    out.push_back(*c);
+            }
+        }
+    }
+
+    TraceRecorder::TraceRecorder(size_t eventsPerThread)
+        : m_id(NextRecorderId++)
+        , m_eventsPerThread(std::max<size_t>(eventsPerThread, 1u))
+    {
+    }
+
+    TraceRecorder::~TraceRecorder() = default;
+
+    void TraceRecorder::enable(bool enabled)
+    {
+        m_enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    void TraceRecorder::clear()
+    {
+        // buffers are owned by their threads for writing, events are filtered out by time instead of resetting buffers
+        m_clearTime.store(Now() + 1u, std::memory_order_relaxed);
+    }
+
+    TraceRecorder::ThreadBuffer& TraceRecorder::getThreadBuffer()
+    {
+        // marks buffer as unused when thread exits, so that it can be reused by another thread
+        struct ThreadBufferOwner
+        {
+            uint64_t recorderId;
+            std::shared_ptr<ThreadBuffer> buffer;
+
+            ThreadBufferOwner(uint64_t id, std::shared_ptr<ThreadBuffer> buf)
+                : recorderId(id)
+                , buffer(std::move(buf))
+            {
+            }
+            ThreadBufferOwner(ThreadBufferOwner&&) noexcept = default;
+            ThreadBufferOwner& operator=(ThreadBufferOwner&&) noexcept = default;
+            ~ThreadBufferOwner()
+            {
+                if (buffer)
+                    buffer->threadAlive.store(false);
+            }
+        };
+        // Some platforms require explicit compile flag to enable TLS,
+        // isolate TLS in this compilation unit so that this flag
+        // needs to be enabled only for this single file.
+        thread_local std::vector<ThreadBufferOwner> threadBuffers;
+
+        for (const auto& owner : threadBuffers)
+        {
+            if (owner.recorderId == m_id)
+                return *owner.buffer;
+        }
+
+        std::lock_guard<std::mutex> lock{ m_buffersLock };
+        std::shared_ptr<ThreadBuffer> buffer;
+        auto it = std::find_if(m_buffers.cbegin(), m_buffers.cend(), [](const auto& buf) { return !buf->threadAlive.load(); });
+        if (it != m_buffers.cend())
+        {
+            buffer = *it;
+            buffer->reset();
+            buffer->threadName.clear();
+            buffer->threadAlive.store(true);
+        }
+        else
+        {
+            buffer = std::make_shared<ThreadBuffer>(m_eventsPerThread);
+            buffer->threadIndex = static_cast<uint32_t>(m_buffers.size() + 1u);
+            m_buffers.push_back(buffer);
+        }
+        threadBuffers.emplace_back(m_id, buffer);
+
+        return *buffer;
+    }
+
+    void TraceRecorder::setThreadName(const std::string& name)
+    {
+        ThreadBuffer& buffer = getThreadBuffer();
+        std::lock_guard<std::mutex> lock{ m_buffersLock };
+        buffer.threadName = name;
+    }
+
+    void TraceRecorder::record(const Event& event)
+    {
+        if (!isEnabled())
+            return;
+
+        ThreadBuffer& buffer = getThreadBuffer();
+        if (!buffer.isAllocated())
+        {
+            std::lock_guard<std::mutex> lock{ m_buffersLock };
+            buffer.allocate();
+        }
+        buffer.write(event);
+    }
+
+    size_t TraceRecorder::getAllocatedEventSlotCount() const
+    {
+        std::lock_guard<std::mutex> lock{ m_buffersLock };
+        size_t slotCount = 0u;
+        for (const auto& buffer : m_buffers)
+            slotCount += buffer->getSlotCount();
+        return slotCount;
+    }
+
+    void TraceRecorder::recordComplete(const char* category, const char* name, uint64_t start, uint64_t duration, const char* argName, uint64_t arg)
+    {
+        assert(category != nullptr && name != nullptr);
+        record({ category, name, argName, arg, start, duration, false });
+    }
+
+    void TraceRecorder::recordInstant(const char* category, const char* name, const char* argName, uint64_t arg)
+    {
+        assert(category != nullptr && name != nullptr);
+        record({ category, name, argName, arg, Now(), 0u, true });
+    }
+
+    std::vector<std::pair<uint32_t, TraceRecorder::Event>> TraceRecorder::collectEvents() const
+    {
+        std::vector<std::pair<uint32_t, Event>> events;
+        const uint64_t minStartTime = m_clearTime.load(std::memory_order_relaxed);
+        {
+            std::lock_guard<std::mutex> lock{ m_buffersLock };
+            for (const auto& buffer : m_buffers)
+                buffer->read(events, minStartTime);
+        }
+
+        std::stable_sort(events.begin(), events.end(), [](const auto& a, const auto& b) { return a.second.start < b.second.start; });
+        return events;
+    }
+
+    std::string TraceRecorder::exportChromeTrace() const
+    {
+        const auto events = collectEvents();
+
+        fmt::memory_buffer out;
+        fmt::format_to(std::back_inserter(out), "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+        bool first = true;
+        {
+            std::lock_guard<std::mutex> lock{ m_buffersLock };
+            for (const auto& buffer : m_buffers)
+            {
+                const std::string threadName = buffer->threadName.empty() ? fmt::format("Thread {}", buffer->threadIndex) : buffer->threadName;
+                fmt::format_to(std::back_inserter(out), "{}\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"", first ? "" : ",", buffer->threadIndex);
+                AppendEscaped(out, threadName.c_str());
+                fmt::format_to(std::back_inserter(out), "\"}}}}");
+                first = false;
+            }
+        }
+
+        for (const auto& threadEvent : events)
+        {
+            const Event& event = threadEvent.second;
+            fmt::format_to(std::back_inserter(out), "{}\n{{\"name\":\"", first ? "" : ",");
+            AppendEscaped(out, event.name);
+            fmt::format_to(std::back_inserter(out), "\",\"cat\":\"");
+            AppendEscaped(out, event.category);
+            if (event.instant)
+                fmt::format_to(std::back_inserter(out), "\",\"ph\":\"i\",\"s\":\"t\",\"ts\":{},\"pid\":1,\"tid\":{}", event.start, threadEvent.first);
+            else
+                fmt::format_to(std::back_inserter(out), "\",\"ph\":\"X\",\"ts\":{},\"dur\":{},\"pid\":1,\"tid\":{}", event.start, event.duration, threadEvent.first);
+            if (event.argName != nullptr)
+            {
+                fmt::format_to(std::back_inserter(out), ",\"args\":{{\"");
+                AppendEscaped(out, event.argName);
+                fmt::format_to(std::back_inserter(out), "\":{}}}", event.arg);
+            }
+            out.push_back('}');
+            first = false;
+        }
+        fmt::format_to(std::back_inserter(out), "\n]}}\n");
+
+        return fmt::to_string(out);
+    }
+
+    bool TraceRecorder::writeChromeTrace(const std::string& filePath) const
+    {
+        const std::string trace = exportChromeTrace();
+        File file(filePath);
+        if (!file.open(File::Mode::WriteOverWriteOld) || !file.write(trace.data(), trace.size()))
+        {
+            LOG_ERROR_P(CONTEXT_FRAMEWORK, "TraceRecorder: failed to write trace to file '{}'", filePath);
+            return false;
+        }
+        file.close();
+        return true;
+    }
+
+    TraceRecorder& GetTraceRecorder()
+    {
+        static TraceRecorder recorder;
+        return recorder;
+    }
+}
@@ -0,0 +1,179 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/BinaryMemoryMappedFileInputStream.h"
+#include "Utils/MemoryMappedFile.h"
+#include "Utils/File.h"
+#include "gtest/gtest.h"
+
+namespace ramses_internal
+{
+    class ABinaryMemoryMappedFileInputStream : public ::testing::Test
+    {
+    public:
+        void TearDown() override
+        {
+            File(testFileName).remove();
+        }
+
+        void writeFile(std::initializer_list<Byte> data)
+        {
+            File f(testFileName);
+            ASSERT_TRUE(f.open(File::Mode::WriteNewBinary));
+            ASSERT_TRUE(f.write(data.begin(), data.size()));
+        }
+
+        std::shared_ptr<const MemoryMappedFile> mapFile()
+        {
+            return std::make_shared<const MemoryMappedFile>(testFileName);
+        }
+
+        static std::vector<Byte> ReadData(BinaryMemoryMappedFileInputStream& is, size_t size)
+        {
+            std::vector<Byte> data(size);
+            is.read(data.data(), size);
+            return data;
+        }
+
+        const char* testFileName = "testfile.bin";
+    };
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, mapsWholeFile)
+    {
+        writeFile({3, 2, 1});
+        const auto mappedFile = mapFile();
+        ASSERT_TRUE(mappedFile->isValid());
+        ASSERT_EQ(3u, mappedFile->size());
+        EXPECT_EQ(3u, mappedFile->data()[0]);
+        EXPECT_EQ(2u, mappedFile->data()[1]);
+        EXPECT_EQ(1u, mappedFile->data()[2]);
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, mappingNonExistingFileFails)
+    {
+        const auto mappedFile = mapFile();
+        EXPECT_FALSE(mappedFile->isValid());
+        EXPECT_EQ(nullptr, mappedFile->data());
+        EXPECT_EQ(0u, mappedFile->size());
+
+        BinaryMemoryMappedFileInputStream is(mappedFile);
+        EXPECT_EQ(EStatus::Error, is.getState());
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, mappingEmptyFileFails)
+    {
+        writeFile({});
+        EXPECT_FALSE(mapFile()->isValid());
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, writingToMappedDataDoesNotModifyFile)
+    {
+        writeFile({3, 2, 1});
+        {
+            const auto mappedFile = mapFile();
+            ASSERT_TRUE(mappedFile->isValid());
+            mappedFile->data()[1] = 7u;
+            EXPECT_EQ(7u, mappedFile->data()[1]);
+        }
+
+        BinaryMemoryMappedFileInputStream is(mapFile());
+        EXPECT_EQ(std::vector<Byte>({3, 2, 1}), ReadData(is, 3));
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, readFileInOneBlock)
+    {
+        writeFile({3, 2, 1});
+        BinaryMemoryMappedFileInputStream is(mapFile());
+        EXPECT_EQ(std::vector<Byte>({3, 2, 1}), ReadData(is, 3));
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, readFileInChunks)
+    {
+        writeFile({3, 2, 1});
+        BinaryMemoryMappedFileInputStream is(mapFile());
+        EXPECT_EQ(std::vector<Byte>({3}), ReadData(is, 1));
+        EXPECT_EQ(std::vector<Byte>({2}), ReadData(is, 1));
+        EXPECT_EQ(std::vector<Byte>({1}), ReadData(is, 1));
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, readOverEofFails)
+    {
+        writeFile({3, 2, 1});
+        BinaryMemoryMappedFileInputStream is(mapFile());
+        ReadData(is, 4);
+        EXPECT_EQ(EStatus::Eof, is.getState());
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, readInPlaceReturnsPointerIntoMappedFile)
+    {
+        writeFile({0, 3, 2, 1});
+        const auto mappedFile = mapFile();
+        BinaryMemoryMappedFileInputStream is(mappedFile);
+        EXPECT_EQ(mappedFile, is.getMappedFile());
+
+        EXPECT_EQ(mappedFile->data(), is.readInPlace(1));
+        const Byte* data = is.readInPlace(3);
+        EXPECT_EQ(mappedFile->data() + 1, data);
+        EXPECT_EQ(3u, data[0]);
+        EXPECT_EQ(1u, data[2]);
+
+        size_t pos = 0;
+        EXPECT_EQ(EStatus::Ok, is.getPos(pos));
+        EXPECT_EQ(4u, pos);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, readInPlaceOverEofFails)
+    {
+        writeFile({3, 2, 1});
+        BinaryMemoryMappedFileInputStream is(mapFile());
+        EXPECT_NE(nullptr, is.readInPlace(2));
+        EXPECT_EQ(nullptr, is.readInPlace(2));
+        EXPECT_EQ(EStatus::Eof, is.getState());
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, canSeekWithinFile)
+    {
+        writeFile({1, 2, 3});
+        BinaryMemoryMappedFileInputStream is(mapFile());
+
+        EXPECT_EQ(EStatus::Ok, is.seek(0, IInputStream::Seek::FromBeginning));
+        EXPECT_EQ(std::vector<Byte>({1}), ReadData(is, 1));
+
+        EXPECT_EQ(EStatus::Ok, is.seek(0, IInputStream::Seek::Relative));
+        EXPECT_EQ(std::vector<Byte>({2}), ReadData(is, 1));
+
+        EXPECT_EQ(EStatus::Ok, is.seek(-1, IInputStream::Seek::Relative));
+        EXPECT_EQ(std::vector<Byte>({2}), ReadData(is, 1));
+
+        EXPECT_EQ(EStatus::Ok, is.seek(2, IInputStream::Seek::FromBeginning));
+        EXPECT_EQ(std::vector<Byte>({3}), ReadData(is, 1));
+
+        size_t pos = 0;
+        EXPECT_EQ(EStatus::Ok, is.getPos(pos));
+        EXPECT_EQ(3u, pos);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+
+    TEST_F(ABinaryMemoryMappedFileInputStream, seekOutsideFileFails)
+    {
+        writeFile({1, 2, 3});
+        BinaryMemoryMappedFileInputStream is(mapFile());
+
+        EXPECT_EQ(EStatus::Error, is.seek(-1, IInputStream::Seek::Relative));
+        EXPECT_EQ(EStatus::Error, is.seek(4, IInputStream::Seek::Relative));
+        EXPECT_EQ(EStatus::Error, is.seek(4, IInputStream::Seek::FromBeginning));
+
+        size_t pos = 0;
+        EXPECT_EQ(EStatus::Ok, is.getPos(pos));
+        EXPECT_EQ(0u, pos);
+        EXPECT_EQ(EStatus::Ok, is.getState());
+    }
+}
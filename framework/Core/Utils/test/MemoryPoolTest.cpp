@@ -169,4 +169,24 @@ namespace ramses_internal
         EXPECT_EQ(6u, pool.getTotalCount());
         EXPECT_EQ(2u, pool.getActualCount());
     }
+
+    TYPED_TEST(AMemoryPool, canBeRestoredFromObjectsAndAllocationFlags)
+    {
+        TypeParam pool;
+        pool.allocate(1);
+        *pool.getMemory(1) = 5;
+
+        TypeParam restoredPool;
+        restoredPool.preallocateSize(7);
+        restoredPool.restore(std::vector<int>(pool.getObjects()), std::vector<uint8_t>(pool.getAllocationFlags()));
+        EXPECT_EQ(2u, restoredPool.getTotalCount());
+        EXPECT_EQ(1u, restoredPool.getActualCount());
+        EXPECT_FALSE(restoredPool.isAllocated(0));
+        ASSERT_TRUE(restoredPool.isAllocated(1));
+        EXPECT_EQ(5, *restoredPool.getMemory(1));
+
+        EXPECT_EQ(0u, restoredPool.allocate());
+        EXPECT_EQ(2u, restoredPool.allocate());
+        EXPECT_EQ(3u, restoredPool.getActualCount());
+    }
 }
@@ -0,0 +1,181 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Utils/TraceRecorder.h"
+#include "gtest/gtest.h"
+#include <thread>
+
+namespace ramses_internal
+{
+    class ATraceRecorder : public ::testing::Test
+    {
+    public:
+        ATraceRecorder()
+        {
+            recorder.enable(true);
+        }
+
+    protected:
+        TraceRecorder recorder{ 8u };
+    };
+
+    TEST_F(ATraceRecorder, isDisabledByDefault)
+    {
+        TraceRecorder otherRecorder;
+        EXPECT_FALSE(otherRecorder.isEnabled());
+        otherRecorder.recordInstant("cat", "event");
+        EXPECT_TRUE(otherRecorder.collectEvents().empty());
+    }
+
+    TEST_F(ATraceRecorder, recordsNothingWhenDisabled)
+    {
+        recorder.enable(false);
+        recorder.recordComplete("cat", "event", 1u, 2u);
+        recorder.recordInstant("cat", "event");
+        EXPECT_TRUE(recorder.collectEvents().empty());
+    }
+
+    TEST_F(ATraceRecorder, recordsCompleteAndInstantEvents)
+    {
+        const uint64_t now = TraceRecorder::Now();
+        recorder.recordComplete("cat", "complete", now, 10u, "arg", 42u);
+        recorder.recordInstant("cat2", "instant");
+
+        const auto events = recorder.collectEvents();
+        ASSERT_EQ(2u, events.size());
+        EXPECT_EQ(events[0].first, events[1].first);
+
+        const auto& complete = events[0].second;
+        EXPECT_STREQ("cat", complete.category);
+        EXPECT_STREQ("complete", complete.name);
+        EXPECT_STREQ("arg", complete.argName);
+        EXPECT_EQ(42u, complete.arg);
+        EXPECT_EQ(now, complete.start);
+        EXPECT_EQ(10u, complete.duration);
+        EXPECT_FALSE(complete.instant);
+
+        const auto& instant = events[1].second;
+        EXPECT_STREQ("cat2", instant.category);
+        EXPECT_STREQ("instant", instant.name);
+        EXPECT_EQ(nullptr, instant.argName);
+        EXPECT_GE(instant.start, now);
+        EXPECT_TRUE(instant.instant);
+    }
+
+    TEST_F(ATraceRecorder, keepsOnlyNewestEventsWhenBufferFull)
+    {
+        const uint64_t now = TraceRecorder::Now();
+        for (uint64_t i = 0u; i < 20u; ++i)
+            recorder.recordComplete("cat", "event", now + i, 1u, "i", i);
+
+        const auto events = recorder.collectEvents();
+        ASSERT_EQ(8u, events.size());
+        for (size_t i = 0u; i < events.size(); ++i)
+            EXPECT_EQ(12u + i, events[i].second.arg);
+    }
+
+    TEST_F(ATraceRecorder, dropsEventsRecordedBeforeClear)
+    {
+        recorder.recordComplete("cat", "old", TraceRecorder::Now(), 1u);
+        recorder.clear();
+        EXPECT_TRUE(recorder.collectEvents().empty());
+
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+        recorder.recordInstant("cat", "new");
+        const auto events = recorder.collectEvents();
+        ASSERT_EQ(1u, events.size());
+        EXPECT_STREQ("new", events[0].second.name);
+    }
+
+    TEST_F(ATraceRecorder, recordsEventsOfEachThreadSeparately)
+    {
+        recorder.recordInstant("cat", "main");
+        std::thread thread([&]() {
+            recorder.setThreadName("worker");
+            recorder.recordInstant("cat", "worker");
+        });
+        thread.join();
+
+        const auto events = recorder.collectEvents();
+        ASSERT_EQ(2u, events.size());
+        EXPECT_NE(events[0].first, events[1].first);
+
+        const std::string trace = recorder.exportChromeTrace();
+        EXPECT_NE(std::string::npos, trace.find("\"name\":\"worker\""));
+    }
+
+    TEST_F(ATraceRecorder, allocatesEventsOfThreadOnlyWithFirstRecordedEvent)
+    {
+        TraceRecorder otherRecorder{ 8u };
+        otherRecorder.setThreadName("named");
+        otherRecorder.recordInstant("cat", "disabled");
+        EXPECT_EQ(0u, otherRecorder.getAllocatedEventSlotCount());
+        EXPECT_NE(std::string::npos, otherRecorder.exportChromeTrace().find("\"name\":\"named\""));
+
+        otherRecorder.enable(true);
+        otherRecorder.recordInstant("cat", "enabled");
+        EXPECT_EQ(9u, otherRecorder.getAllocatedEventSlotCount());
+        const auto events = otherRecorder.collectEvents();
+        ASSERT_EQ(1u, events.size());
+        EXPECT_STREQ("enabled", events[0].second.name);
+    }
+
+    TEST_F(ATraceRecorder, reusesBufferOfExitedThread)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            std::thread thread([&]() { recorder.recordInstant("cat", "worker"); });
+            thread.join();
+        }
+        recorder.recordInstant("cat", "main");
+
+        // events of exited threads are discarded when buffer is taken over
+        const auto events = recorder.collectEvents();
+        ASSERT_EQ(1u, events.size());
+        EXPECT_STREQ("main", events[0].second.name);
+        EXPECT_EQ(1u, events[0].first);
+    }
+
+    TEST_F(ATraceRecorder, exportsChromeTraceFormat)
+    {
+        recorder.setThreadName("main \"thread\"");
+        recorder.recordComplete("renderer", "Draw", 100u, 50u, "scene", 3u);
+        recorder.recordInstant("renderer", "Flush");
+
+        const std::string trace = recorder.exportChromeTrace();
+        EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+        EXPECT_NE(std::string::npos, trace.find("\"name\":\"main \\\"thread\\\"\""));
+        EXPECT_NE(std::string::npos, trace.find("{\"name\":\"Draw\",\"cat\":\"renderer\",\"ph\":\"X\",\"ts\":100,\"dur\":50,"));
+        EXPECT_NE(std::string::npos, trace.find("\"args\":{\"scene\":3}"));
+        EXPECT_NE(std::string::npos, trace.find("{\"name\":\"Flush\",\"cat\":\"renderer\",\"ph\":\"i\",\"s\":\"t\""));
+        EXPECT_EQ(trace.size() - 4u, trace.rfind("\n]}\n"));
+    }
+
+    TEST(ATraceScope, recordsCompleteEventIntoGlobalRecorderOnlyWhenEnabled)
+    {
+        TraceRecorder& recorder = GetTraceRecorder();
+        recorder.clear();
+        std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+        {
+            RAMSES_TRACE_SCOPE("test", "disabledScope");
+        }
+        recorder.enable(true);
+        {
+            RAMSES_TRACE_SCOPE_ARG("test", "enabledScope", "arg", 5);
+        }
+        RAMSES_TRACE_INSTANT("test", "enabledInstant", "arg", 6);
+        recorder.enable(false);
+
+        const auto events = recorder.collectEvents();
+        ASSERT_EQ(2u, events.size());
+        EXPECT_STREQ("enabledScope", events[0].second.name);
+        EXPECT_EQ(5u, events[0].second.arg);
+        EXPECT_STREQ("enabledInstant", events[1].second.name);
+        recorder.clear();
+    }
+}
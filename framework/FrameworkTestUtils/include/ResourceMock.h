@@ -29,8 +29,8 @@ namespace ramses_internal
         MOCK_METHOD(uint32_t, getCompressedDataSize, (), (const, override));
         MOCK_METHOD(bool, isCompressedAvailable, (), (const, override));
         MOCK_METHOD(bool, isDeCompressedAvailable, (), (const, override));
-        MOCK_METHOD(void, compress, (CompressionLevel), (const, override));
-        MOCK_METHOD(void, decompress, (), (const, override));
+        MOCK_METHOD(void, compress, (CompressionLevel, ramses::EFeatureLevel, ParallelForExecutor*), (const, override));
+        MOCK_METHOD(void, decompress, (ParallelForExecutor*), (const, override));
         MOCK_METHOD(void, setResourceData, (ResourceBlob, const ResourceContentHash&), (override));
         MOCK_METHOD(void, setResourceData, (ResourceBlob), (override));
         MOCK_METHOD(void, setCompressedResourceData, (CompressedResourceBlob, CompressionLevel, uint32_t uncompressedSize, const ResourceContentHash&), (override));
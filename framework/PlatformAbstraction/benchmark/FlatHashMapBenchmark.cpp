@@ -0,0 +1,160 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "Collections/HashMap.h"
+#include "Collections/FlatHashMap.h"
+#include "Common/DenseHandleMap.h"
+#include "SceneAPI/Handles.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include <random>
+#include <algorithm>
+#include <vector>
+
+namespace ramses_internal
+{
+    template <typename Key>
+    static std::vector<Key> CreateKeys(size_t count, uint32_t seed);
+
+    // handles as allocated by scene memory pools, densely from 0
+    template <>
+    std::vector<NodeHandle> CreateKeys<NodeHandle>(size_t count, uint32_t seed)
+    {
+        std::vector<NodeHandle> keys;
+        keys.reserve(count);
+        for (size_t i = 0u; i < count; ++i)
+            keys.emplace_back(static_cast<MemoryHandle>(i));
+        std::shuffle(keys.begin(), keys.end(), std::mt19937(seed));
+        return keys;
+    }
+
+    template <>
+    std::vector<ResourceContentHash> CreateKeys<ResourceContentHash>(size_t count, uint32_t seed)
+    {
+        std::mt19937_64 gen(seed);
+        std::vector<ResourceContentHash> keys;
+        keys.reserve(count);
+        for (size_t i = 0u; i < count; ++i)
+            keys.emplace_back(gen(), gen());
+        return keys;
+    }
+
+    template <typename Map, typename Key>
+    static Map CreateMap(const std::vector<Key>& keys)
+    {
+        Map map;
+        uint32_t value = 0u;
+        for (const auto& key : keys)
+            map.put(key, value++);
+        return map;
+    }
+
+    template <typename Map, typename Key>
+    static void BM_Map_Insert(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<Key>(static_cast<size_t>(state.range(0)), 1u);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            Map map;
+            uint32_t value = 0u;
+            for (const auto& key : keys)
+                map.put(key, value++);
+            benchmark::DoNotOptimize(map);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Map, typename Key>
+    static void BM_Map_LookupHit(benchmark::State& state)
+    {
+        const auto keys = CreateKeys<Key>(static_cast<size_t>(state.range(0)), 1u);
+        const Map map = CreateMap<Map>(keys);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            uint32_t sum = 0u;
+            for (const auto& key : keys)
+                sum += *map.get(key);
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Map, typename Key>
+    static void BM_Map_LookupMiss(benchmark::State& state)
+    {
+        const size_t count = static_cast<size_t>(state.range(0));
+        auto keys = CreateKeys<Key>(2u * count, 1u);
+        const std::vector<Key> missingKeys(keys.begin() + static_cast<std::ptrdiff_t>(count), keys.end());
+        keys.resize(count);
+        const Map map = CreateMap<Map>(keys);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            uint32_t found = 0u;
+            for (const auto& key : missingKeys)
+                found += map.contains(key) ? 1u : 0u;
+            benchmark::DoNotOptimize(found);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Map, typename Key>
+    static void BM_Map_Iterate(benchmark::State& state)
+    {
+        const Map map = CreateMap<Map>(CreateKeys<Key>(static_cast<size_t>(state.range(0)), 1u));
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            uint32_t sum = 0u;
+            for (const auto& p : map)
+                sum += p.value;
+            benchmark::DoNotOptimize(sum);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    template <typename Map, typename Key>
+    static void BM_Map_InsertRemove(benchmark::State& state)
+    {
+        // steady state of registries where resources come and go, map size stays constant
+        const auto keys = CreateKeys<Key>(static_cast<size_t>(state.range(0)), 1u);
+        Map map = CreateMap<Map>(keys);
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (const auto& key : keys)
+            {
+                map.remove(key);
+                map.put(key, 0u);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    using NodeHashMap = HashMap<NodeHandle, uint32_t>;
+    using NodeFlatHashMap = FlatHashMap<NodeHandle, uint32_t>;
+    using NodeDenseHandleMap = DenseHandleMap<NodeHandle, uint32_t>;
+    using ResourceHashMap = HashMap<ResourceContentHash, uint32_t>;
+    using ResourceFlatHashMap = FlatHashMap<ResourceContentHash, uint32_t, ResourceContentHashFoldingHasher>;
+
+    // Compares HashMap against its replacements for the two kinds of keys used on renderer hot paths:
+    // scene handles (TransformationCachedScene, RendererSceneResourceRegistry) and resource hashes (ResourceUploadingManager).
+    // ARG: number of elements in map
+#define RAMSES_MAP_BENCHMARK(bm) \
+    BENCHMARK_TEMPLATE(bm, NodeHashMap, NodeHandle)->Arg(100)->Arg(10000); \
+    BENCHMARK_TEMPLATE(bm, NodeFlatHashMap, NodeHandle)->Arg(100)->Arg(10000); \
+    BENCHMARK_TEMPLATE(bm, NodeDenseHandleMap, NodeHandle)->Arg(100)->Arg(10000); \
+    BENCHMARK_TEMPLATE(bm, ResourceHashMap, ResourceContentHash)->Arg(100)->Arg(10000); \
+    BENCHMARK_TEMPLATE(bm, ResourceFlatHashMap, ResourceContentHash)->Arg(100)->Arg(10000)
+
+    RAMSES_MAP_BENCHMARK(BM_Map_Insert);
+    RAMSES_MAP_BENCHMARK(BM_Map_LookupHit);
+    RAMSES_MAP_BENCHMARK(BM_Map_LookupMiss);
+    RAMSES_MAP_BENCHMARK(BM_Map_Iterate);
+    RAMSES_MAP_BENCHMARK(BM_Map_InsertRemove);
+
+#undef RAMSES_MAP_BENCHMARK
+}
@@ -0,0 +1,756 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_COLLECTIONS_FLATHASHMAP_H
+#define RAMSES_COLLECTIONS_FLATHASHMAP_H
+
+#include "PlatformAbstraction/PlatformTypes.h"
+#include "PlatformAbstraction/PlatformError.h"
+#include "PlatformAbstraction/Macros.h"
+#include "Utils/AssertMovable.h"
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <cstring>
+#include <cassert>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define RAMSES_FLATHASHMAP_SSE2
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace ramses_internal
+{
+    namespace flat_hash_map_internal
+    {
+        // Control byte of a slot: empty, deleted or full. Full slots store the lower 7 bits of the key hash,
+        // so probing can reject nearly all non matching slots without touching the key.
+        using Ctrl = int8_t;
+        constexpr Ctrl Empty = -128;   // 0x80
+        constexpr Ctrl Deleted = -2;   // 0xFE
+        constexpr Ctrl Sentinel = -1;  // 0xFF, terminates iteration after last slot
+
+        inline uint32_t CountTrailingZeros(uint32_t value)
+        {
+            assert(value != 0u);
+#if defined(_MSC_VER) && !defined(__clang__)
+            unsigned long index = 0;
+            _BitScanForward(&index, value);
+            return static_cast<uint32_t>(index);
+#else
+            return static_cast<uint32_t>(__builtin_ctz(value));
+#endif
+        }
+
+        // mixes bits of std::hash result, std::hash is identity for integral types on most platforms
+        inline uint64_t MixHash(uint64_t hash)
+        {
+            hash *= 0x9e3779b97f4a7c15ull;
+            return hash ^ (hash >> 32u);
+        }
+
+        // Group of consecutive control bytes which are matched at once.
+        // Every match returns a bit mask with one bit per slot of the group.
+#if defined(RAMSES_FLATHASHMAP_SSE2)
+        class Group
+        {
+        public:
+            static constexpr size_t Width = 16u;
+
+            explicit Group(const Ctrl* ctrl)
+                : m_ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl)))
+            {
+            }
+
+            [[nodiscard]] uint32_t match(Ctrl h2) const
+            {
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), m_ctrl)));
+            }
+
+            [[nodiscard]] uint32_t matchEmpty() const
+            {
+                return match(Empty);
+            }
+
+            [[nodiscard]] uint32_t matchEmptyOrDeleted() const
+            {
+                return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(Sentinel), m_ctrl)));
+            }
+
+        private:
+            __m128i m_ctrl;
+        };
+#else
+        class Group
+        {
+        public:
+            static constexpr size_t Width = 8u;
+
+            explicit Group(const Ctrl* ctrl)
+            {
+                std::memcpy(m_ctrl, ctrl, Width);
+            }
+
+            [[nodiscard]] uint32_t match(Ctrl h2) const
+            {
+                uint32_t mask = 0u;
+                for (uint32_t i = 0u; i < Width; ++i)
+                    mask |= static_cast<uint32_t>(m_ctrl[i] == h2) << i;
+                return mask;
+            }
+
+            [[nodiscard]] uint32_t matchEmpty() const
+            {
+                return match(Empty);
+            }
+
+            [[nodiscard]] uint32_t matchEmptyOrDeleted() const
+            {
+                uint32_t mask = 0u;
+                for (uint32_t i = 0u; i < Width; ++i)
+                    mask |= static_cast<uint32_t>(m_ctrl[i] < Sentinel) << i;
+                return mask;
+            }
+
+        private:
+            Ctrl m_ctrl[Width];
+        };
+#endif
+    }
+
+    /**
+     * Hash map with open addressing, drop-in replacement for HashMap where lookups dominate.
+     *
+     * Key/value pairs are stored in one flat slot array next to an array of control bytes, no allocation
+     * happens per element. Lookup compares control bytes of a whole group of slots at once (SSE2 if available)
+     * and only touches keys whose hash bits match. Iterators and pointers to values stay valid until
+     * the map grows (put/operator[] of new key, reserve) or is cleared, removing does not move other elements.
+     * Hasher result is mixed again by the map, so a cheap hasher without good bit distribution is sufficient.
+     */
+    template <class Key, class T, class Hasher = std::hash<Key>>
+    class FlatHashMap final
+    {
+    public:
+        class Pair final
+        {
+        public:
+            Pair(const Key& key_, const T& value_)
+                : key(key_)
+                , value(value_)
+            {
+            }
+
+            const Key key;
+            T value;
+        };
+
+    private:
+        using Ctrl = flat_hash_map_internal::Ctrl;
+        using Group = flat_hash_map_internal::Group;
+        using Slot = std::aligned_storage_t<sizeof(Pair), alignof(Pair)>;
+
+        static constexpr size_t NotFound = ~size_t(0u);
+
+    public:
+        class ConstIterator final
+        {
+        public:
+            friend class FlatHashMap;
+            friend class Iterator;
+
+            ConstIterator(const Ctrl* ctrl, Slot* slot)
+                : m_ctrl(ctrl)
+                , m_slot(slot)
+            {
+            }
+
+            const Pair& operator*() const
+            {
+                return *std::launder(reinterpret_cast<const Pair*>(m_slot));
+            }
+
+            const Pair* operator->() const
+            {
+                return std::launder(reinterpret_cast<const Pair*>(m_slot));
+            }
+
+            bool operator==(const ConstIterator& iter) const
+            {
+                return m_ctrl == iter.m_ctrl;
+            }
+
+            bool operator!=(const ConstIterator& iter) const
+            {
+                return m_ctrl != iter.m_ctrl;
+            }
+
+            ConstIterator& operator++()
+            {
+                ++m_ctrl;
+                ++m_slot;
+                skipFreeSlots();
+                return *this;
+            }
+
+            const ConstIterator operator++(int32_t)
+            {
+                ConstIterator oldValue(*this);
+                ++(*this);
+                return oldValue;
+            }
+
+        private:
+            void skipFreeSlots()
+            {
+                // sentinel after last slot stops the loop
+                while (*m_ctrl < flat_hash_map_internal::Sentinel)
+                {
+                    ++m_ctrl;
+                    ++m_slot;
+                }
+            }
+
+            const Ctrl* m_ctrl;
+            Slot* m_slot;
+        };
+
+        class Iterator final
+        {
+        public:
+            friend class FlatHashMap;
+
+            Iterator(const Ctrl* ctrl, Slot* slot)
+                : m_iter(ctrl, slot)
+            {
+            }
+
+            Iterator(const ConstIterator& iter)  // NOLINT(google-explicit-constructor) const to non-const iterator should be implicit
+                : m_iter(iter)
+            {
+            }
+
+            Pair& operator*()
+            {
+                return *std::launder(reinterpret_cast<Pair*>(m_iter.m_slot));
+            }
+
+            const Pair& operator*() const
+            {
+                return *m_iter;
+            }
+
+            Pair* operator->()
+            {
+                return std::launder(reinterpret_cast<Pair*>(m_iter.m_slot));
+            }
+
+            const Pair* operator->() const
+            {
+                return m_iter.operator->();
+            }
+
+            bool operator==(const Iterator& iter) const
+            {
+                return m_iter == iter.m_iter;
+            }
+
+            bool operator!=(const Iterator& iter) const
+            {
+                return m_iter != iter.m_iter;
+            }
+
+            Iterator& operator++()
+            {
+                ++m_iter;
+                return *this;
+            }
+
+            const Iterator operator++(int32_t)
+            {
+                Iterator oldValue(*this);
+                ++(*this);
+                return oldValue;
+            }
+
+        private:
+            ConstIterator m_iter;
+        };
+
+        FlatHashMap() = default;
+
+        /**
+         * Constructor.
+         * Allocates enough capacity to insert minimumCapacity elements without rehash.
+         */
+        explicit FlatHashMap(size_t minimumCapacity);
+
+        FlatHashMap(const FlatHashMap& other);
+        FlatHashMap(FlatHashMap&& other) noexcept;
+        ~FlatHashMap();
+
+        FlatHashMap& operator=(const FlatHashMap& other);
+        FlatHashMap& operator=(FlatHashMap&& other) noexcept;
+
+        /**
+         * @param key Key value
+         * @return value Value referenced by key. If no value is stored for given key, a default constructed object is added and returned
+         */
+        T& operator[](const Key& key);
+
+        /**
+         * Adds key/value pair, overwrites value if key already exists.
+         * @return iterator pointing to the inserted or overwritten pair
+         */
+        Iterator put(const Key& key, const T& value);
+
+        EStatus get(const Key& key, T& value) const;
+        RNODISCARD T* get(const Key& key) const;
+
+        RNODISCARD Iterator find(const Key& key);
+        RNODISCARD ConstIterator find(const Key& key) const;
+        RNODISCARD bool contains(const Key& key) const;
+
+        /**
+         * @param value_old if not null, gets a copy of the removed value
+         * @return true if key was found and removed
+         */
+        bool remove(const Key& key, T* value_old = nullptr);
+
+        /**
+         * @return iterator pointing to the element following the removed one
+         */
+        Iterator remove(Iterator iter, T* value_old = nullptr);
+
+        RNODISCARD size_t size() const;
+
+        /**
+         * Removes all elements, keeps allocated capacity.
+         */
+        void clear();
+
+        RNODISCARD Iterator begin();
+        RNODISCARD ConstIterator begin() const;
+        RNODISCARD Iterator end();
+        RNODISCARD ConstIterator end() const;
+
+        /**
+         * Makes sure requestedCapacity elements can be stored without rehash.
+         */
+        void reserve(size_t requestedCapacity);
+
+        /**
+         * @return number of elements which can be stored without rehash
+         */
+        RNODISCARD size_t capacity() const;
+
+        void swap(FlatHashMap& other);
+
+    private:
+        [[nodiscard]] static size_t MaxLoad(size_t slotCount);
+        [[nodiscard]] static size_t SlotCountForElementCount(size_t count);
+        [[nodiscard]] static uint64_t CalcHash(const Key& key);
+        [[nodiscard]] static Ctrl H2(uint64_t hash);
+
+        [[nodiscard]] Pair& pairAt(size_t index) const;
+        [[nodiscard]] size_t findIndex(const Key& key, uint64_t hash) const;
+        [[nodiscard]] size_t findFreeIndex(uint64_t hash) const;
+        size_t insertNew(const Key& key, const T& value, uint64_t hash);
+        void removeAt(size_t index, T* value_old);
+        void setCtrl(size_t index, Ctrl ctrl);
+        void rehash(size_t slotCount);
+        void destructAll();
+
+        std::unique_ptr<Ctrl[]> m_ctrl;
+        std::unique_ptr<Slot[]> m_slots;
+        size_t m_slotCount = 0u;
+        size_t m_size = 0u;
+        // number of empty slots which can still be filled before rehash, deleted slots do not count
+        size_t m_growthLeft = 0u;
+    };
+
+    template <class Key, class T, class Hasher>
+    inline void swap(FlatHashMap<Key, T, Hasher>& first, FlatHashMap<Key, T, Hasher>& second)
+    {
+        first.swap(second);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline FlatHashMap<Key, T, Hasher>::FlatHashMap(size_t minimumCapacity)
+    {
+        reserve(minimumCapacity);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline FlatHashMap<Key, T, Hasher>::FlatHashMap(const FlatHashMap& other)
+    {
+        reserve(other.size());
+        for (const auto& p : other)
+            insertNew(p.key, p.value, CalcHash(p.key));
+    }
+
+    template <class Key, class T, class Hasher>
+    inline FlatHashMap<Key, T, Hasher>::FlatHashMap(FlatHashMap&& other) noexcept
+    {
+        ASSERT_MOVABLE(FlatHashMap)
+        swap(other);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline FlatHashMap<Key, T, Hasher>::~FlatHashMap()
+    {
+        destructAll();
+    }
+
+    template <class Key, class T, class Hasher>
+    inline FlatHashMap<Key, T, Hasher>& FlatHashMap<Key, T, Hasher>::operator=(const FlatHashMap& other)
+    {
+        if (&other == this)
+            return *this;
+
+        clear();
+        reserve(other.size());
+        for (const auto& p : other)
+            insertNew(p.key, p.value, CalcHash(p.key));
+        return *this;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline FlatHashMap<Key, T, Hasher>& FlatHashMap<Key, T, Hasher>::operator=(FlatHashMap&& other) noexcept
+    {
+        if (&other == this)
+            return *this;
+
+        swap(other);
+        other.clear();
+        return *this;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline T& FlatHashMap<Key, T, Hasher>::operator[](const Key& key)
+    {
+        const uint64_t hash = CalcHash(key);
+        size_t index = findIndex(key, hash);
+        if (index == NotFound)
+            index = insertNew(key, T(), hash);
+        return pairAt(index).value;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::Iterator FlatHashMap<Key, T, Hasher>::put(const Key& key, const T& value)
+    {
+        const uint64_t hash = CalcHash(key);
+        size_t index = findIndex(key, hash);
+        if (index != NotFound)
+            pairAt(index).value = value;
+        else
+            index = insertNew(key, value, hash);
+        return Iterator(m_ctrl.get() + index, m_slots.get() + index);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline EStatus FlatHashMap<Key, T, Hasher>::get(const Key& key, T& value) const
+    {
+        const size_t index = findIndex(key, CalcHash(key));
+        if (index == NotFound)
+            return EStatus::NotExist;
+        value = pairAt(index).value;
+        return EStatus::Ok;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline T* FlatHashMap<Key, T, Hasher>::get(const Key& key) const
+    {
+        const size_t index = findIndex(key, CalcHash(key));
+        if (index == NotFound)
+            return nullptr;
+        return &pairAt(index).value;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::Iterator FlatHashMap<Key, T, Hasher>::find(const Key& key)
+    {
+        const size_t index = findIndex(key, CalcHash(key));
+        if (index == NotFound)
+            return end();
+        return Iterator(m_ctrl.get() + index, m_slots.get() + index);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::ConstIterator FlatHashMap<Key, T, Hasher>::find(const Key& key) const
+    {
+        const size_t index = findIndex(key, CalcHash(key));
+        if (index == NotFound)
+            return end();
+        return ConstIterator(m_ctrl.get() + index, m_slots.get() + index);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline bool FlatHashMap<Key, T, Hasher>::contains(const Key& key) const
+    {
+        return findIndex(key, CalcHash(key)) != NotFound;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline bool FlatHashMap<Key, T, Hasher>::remove(const Key& key, T* value_old)
+    {
+        const size_t index = findIndex(key, CalcHash(key));
+        if (index == NotFound)
+            return false;
+        removeAt(index, value_old);
+        return true;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::Iterator FlatHashMap<Key, T, Hasher>::remove(Iterator iter, T* value_old)
+    {
+        const size_t index = static_cast<size_t>(iter.m_iter.m_ctrl - m_ctrl.get());
+        assert(index < m_slotCount);
+        removeAt(index, value_old);
+        ++iter;
+        return iter;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline size_t FlatHashMap<Key, T, Hasher>::size() const
+    {
+        return m_size;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline void FlatHashMap<Key, T, Hasher>::clear()
+    {
+        destructAll();
+        if (m_slotCount > 0u)
+            std::memset(m_ctrl.get(), static_cast<uint8_t>(flat_hash_map_internal::Empty), m_slotCount);
+        m_size = 0u;
+        m_growthLeft = MaxLoad(m_slotCount);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::Iterator FlatHashMap<Key, T, Hasher>::begin()
+    {
+        return static_cast<const FlatHashMap&>(*this).begin();
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::ConstIterator FlatHashMap<Key, T, Hasher>::begin() const
+    {
+        if (m_size == 0u)
+            return end();
+        ConstIterator iter(m_ctrl.get(), m_slots.get());
+        iter.skipFreeSlots();
+        return iter;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::Iterator FlatHashMap<Key, T, Hasher>::end()
+    {
+        return Iterator(m_ctrl.get() + m_slotCount, m_slots.get() + m_slotCount);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::ConstIterator FlatHashMap<Key, T, Hasher>::end() const
+    {
+        return ConstIterator(m_ctrl.get() + m_slotCount, m_slots.get() + m_slotCount);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline void FlatHashMap<Key, T, Hasher>::reserve(size_t requestedCapacity)
+    {
+        if (requestedCapacity > MaxLoad(m_slotCount))
+            rehash(SlotCountForElementCount(requestedCapacity));
+    }
+
+    template <class Key, class T, class Hasher>
+    inline size_t FlatHashMap<Key, T, Hasher>::capacity() const
+    {
+        return MaxLoad(m_slotCount);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline void FlatHashMap<Key, T, Hasher>::swap(FlatHashMap& other)
+    {
+        using std::swap;
+        swap(m_ctrl, other.m_ctrl);
+        swap(m_slots, other.m_slots);
+        swap(m_slotCount, other.m_slotCount);
+        swap(m_size, other.m_size);
+        swap(m_growthLeft, other.m_growthLeft);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline size_t FlatHashMap<Key, T, Hasher>::MaxLoad(size_t slotCount)
+    {
+        // max load factor 7/8, there is always at least one empty slot which terminates probing
+        return slotCount - slotCount / 8u;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline size_t FlatHashMap<Key, T, Hasher>::SlotCountForElementCount(size_t count)
+    {
+        size_t slotCount = Group::Width;
+        while (MaxLoad(slotCount) < count)
+            slotCount *= 2u;
+        return slotCount;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline uint64_t FlatHashMap<Key, T, Hasher>::CalcHash(const Key& key)
+    {
+        return flat_hash_map_internal::MixHash(static_cast<uint64_t>(Hasher()(key)));
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::Ctrl FlatHashMap<Key, T, Hasher>::H2(uint64_t hash)
+    {
+        return static_cast<Ctrl>(hash & 0x7fu);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline typename FlatHashMap<Key, T, Hasher>::Pair& FlatHashMap<Key, T, Hasher>::pairAt(size_t index) const
+    {
+        return *std::launder(reinterpret_cast<Pair*>(&m_slots[index]));
+    }
+
+    template <class Key, class T, class Hasher>
+    inline size_t FlatHashMap<Key, T, Hasher>::findIndex(const Key& key, uint64_t hash) const
+    {
+        if (m_size == 0u)
+            return NotFound;
+
+        // groups are probed in triangular sequence which visits every group once for power of two group count
+        const size_t groupMask = m_slotCount / Group::Width - 1u;
+        const Ctrl h2 = H2(hash);
+        size_t group = static_cast<size_t>(hash >> 7u) & groupMask;
+        for (size_t step = 1u; ; ++step)
+        {
+            const size_t groupStart = group * Group::Width;
+            const Group g(m_ctrl.get() + groupStart);
+            for (uint32_t mask = g.match(h2); mask != 0u; mask &= mask - 1u)
+            {
+                const size_t index = groupStart + flat_hash_map_internal::CountTrailingZeros(mask);
+                if (pairAt(index).key == key)
+                    return index;
+            }
+            if (g.matchEmpty() != 0u)
+                return NotFound;
+            group = (group + step) & groupMask;
+        }
+    }
+
+    template <class Key, class T, class Hasher>
+    inline size_t FlatHashMap<Key, T, Hasher>::findFreeIndex(uint64_t hash) const
+    {
+        const size_t groupMask = m_slotCount / Group::Width - 1u;
+        size_t group = static_cast<size_t>(hash >> 7u) & groupMask;
+        for (size_t step = 1u; ; ++step)
+        {
+            const size_t groupStart = group * Group::Width;
+            const uint32_t mask = Group(m_ctrl.get() + groupStart).matchEmptyOrDeleted();
+            if (mask != 0u)
+                return groupStart + flat_hash_map_internal::CountTrailingZeros(mask);
+            group = (group + step) & groupMask;
+        }
+    }
+
+    template <class Key, class T, class Hasher>
+    inline size_t FlatHashMap<Key, T, Hasher>::insertNew(const Key& key, const T& value, uint64_t hash)
+    {
+        if (m_growthLeft == 0u)
+        {
+            // many deleted slots: rebuild in place, otherwise grow
+            if (m_slotCount > 0u && m_size < MaxLoad(m_slotCount) / 2u)
+                rehash(m_slotCount);
+            else
+                rehash(m_slotCount == 0u ? Group::Width : m_slotCount * 2u);
+        }
+
+        const size_t index = findFreeIndex(hash);
+        if (m_ctrl[index] == flat_hash_map_internal::Empty)
+            --m_growthLeft;
+        new (&m_slots[index]) Pair(key, value);
+        setCtrl(index, H2(hash));
+        ++m_size;
+        return index;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline void FlatHashMap<Key, T, Hasher>::removeAt(size_t index, T* value_old)
+    {
+        Pair& pair = pairAt(index);
+        if (value_old)
+            *value_old = pair.value;
+        pair.~Pair();
+        --m_size;
+
+        // Slot can become empty again only if its group never was full, otherwise probe sequences of other keys
+        // might pass this group and must not be terminated here.
+        const size_t groupStart = index / Group::Width * Group::Width;
+        if (Group(m_ctrl.get() + groupStart).matchEmpty() != 0u)
+        {
+            setCtrl(index, flat_hash_map_internal::Empty);
+            ++m_growthLeft;
+        }
+        else
+        {
+            setCtrl(index, flat_hash_map_internal::Deleted);
+        }
+    }
+
+    template <class Key, class T, class Hasher>
+    inline void FlatHashMap<Key, T, Hasher>::setCtrl(size_t index, Ctrl ctrl)
+    {
+        m_ctrl[index] = ctrl;
+    }
+
+    template <class Key, class T, class Hasher>
+    inline void FlatHashMap<Key, T, Hasher>::rehash(size_t slotCount)
+    {
+        assert(slotCount % Group::Width == 0u && MaxLoad(slotCount) >= m_size);
+
+        FlatHashMap newMap;
+        newMap.m_ctrl.reset(new Ctrl[slotCount + 1u]);
+        newMap.m_slots.reset(new Slot[slotCount]);
+        std::memset(newMap.m_ctrl.get(), static_cast<uint8_t>(flat_hash_map_internal::Empty), slotCount);
+        newMap.m_ctrl[slotCount] = flat_hash_map_internal::Sentinel;
+        newMap.m_slotCount = slotCount;
+        newMap.m_growthLeft = MaxLoad(slotCount);
+
+        for (size_t i = 0u; i < m_slotCount; ++i)
+        {
+            if (m_ctrl[i] >= 0)
+            {
+                const Pair& pair = pairAt(i);
+                newMap.insertNew(pair.key, pair.value, CalcHash(pair.key));
+            }
+        }
+
+        swap(newMap);
+    }
+
+    template <class Key, class T, class Hasher>
+    inline void FlatHashMap<Key, T, Hasher>::destructAll()
+    {
+        if (m_size == 0u)
+            return;
+
+        for (size_t i = 0u; i < m_slotCount; ++i)
+        {
+            if (m_ctrl[i] >= 0)
+                pairAt(i).~Pair();
+        }
+    }
+}
+
+#endif
@@ -26,6 +26,9 @@ namespace ramses_internal
     public:
         explicit HeapArray(size_t size = 0, const T* data = nullptr);
         HeapArray(size_t size, HeapArray&& other);
+        // references data owned by externalDataOwner instead of allocating and copying it,
+        // externalDataOwner is kept alive as long as the array references the data
+        HeapArray(size_t size, T* externalData, std::shared_ptr<const void> externalDataOwner);
 
         HeapArray(const HeapArray&) = delete;
         HeapArray& operator=(const HeapArray&) = delete;
@@ -43,18 +46,21 @@ namespace ramses_internal
     private:
         size_t m_size;
         // NOLINTNEXTLINE(modernize-avoid-c-arrays)
-        std::unique_ptr<T[]> m_data;
+        std::unique_ptr<T[]> m_ownedData;
+        std::shared_ptr<const void> m_externalDataOwner;
+        T* m_data;
     };
 
     template <typename T, typename UniqueIdT>
     inline
     HeapArray<T, UniqueIdT>::HeapArray(size_t size, const T* data)
         : m_size(size)
-        , m_data(m_size > 0 ? new T[m_size] : nullptr)
+        , m_ownedData(m_size > 0 ? new T[m_size] : nullptr)
+        , m_data(m_ownedData.get())
     {
         if (m_data && data)
         {
-            PlatformMemory::Copy(m_data.get(), data, size * sizeof(T));
+            PlatformMemory::Copy(m_data, data, size * sizeof(T));
         }
     }
 
@@ -62,20 +68,35 @@ namespace ramses_internal
     inline
     HeapArray<T, UniqueIdT>::HeapArray(size_t size, HeapArray&& other)
         : m_size(size)
-        , m_data(std::move(other.m_data))
+        , m_ownedData(std::move(other.m_ownedData))
+        , m_externalDataOwner(std::move(other.m_externalDataOwner))
+        , m_data(other.m_data)
     {
         ASSERT_MOVABLE(HeapArray)
 
         other.m_size = 0;
+        other.m_data = nullptr;
+    }
+
+    template <typename T, typename UniqueIdT>
+    inline
+    HeapArray<T, UniqueIdT>::HeapArray(size_t size, T* externalData, std::shared_ptr<const void> externalDataOwner)
+        : m_size(size)
+        , m_externalDataOwner(std::move(externalDataOwner))
+        , m_data(externalData)
+    {
     }
 
     template <typename T, typename UniqueIdT>
     inline
     HeapArray<T, UniqueIdT>::HeapArray(HeapArray&& o) noexcept
         : m_size(o.m_size)
-        , m_data(std::move(o.m_data))
+        , m_ownedData(std::move(o.m_ownedData))
+        , m_externalDataOwner(std::move(o.m_externalDataOwner))
+        , m_data(o.m_data)
     {
         o.m_size = 0;
+        o.m_data = nullptr;
     }
 
     template <typename T, typename UniqueIdT>
@@ -85,8 +106,11 @@ namespace ramses_internal
         if (&o != this)
         {
             m_size = o.m_size;
-            m_data = std::move(o.m_data);
+            m_ownedData = std::move(o.m_ownedData);
+            m_externalDataOwner = std::move(o.m_externalDataOwner);
+            m_data = o.m_data;
             o.m_size = 0;
+            o.m_data = nullptr;
         }
         return *this;
     }
@@ -102,21 +126,21 @@ namespace ramses_internal
     inline
     T* HeapArray<T, UniqueIdT>::data()
     {
-        return m_data.get();
+        return m_data;
     }
 
     template <typename T, typename UniqueIdT>
     inline
     const T* HeapArray<T, UniqueIdT>::data() const
     {
-        return m_data.get();
+        return m_data;
     }
 
     template <typename T, typename UniqueIdT>
     inline
     absl::Span<const T> HeapArray<T, UniqueIdT>::span() const
     {
-        return {m_data.get(), m_size};
+        return {m_data, m_size};
     }
 
     template <typename T, typename UniqueIdT>
@@ -125,7 +149,7 @@ namespace ramses_internal
     {
         if (m_data)
         {
-            PlatformMemory::Set(m_data.get(), 0, m_size * sizeof(T));
+            PlatformMemory::Set(m_data, 0, m_size * sizeof(T));
         }
     }
 }
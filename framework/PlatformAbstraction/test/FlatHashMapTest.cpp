@@ -0,0 +1,338 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Collections/FlatHashMap.h"
+#include "Collections/HashMap.h"
+#include "ComplexTestType.h"
+#include "gtest/gtest.h"
+#include <string>
+#include <random>
+
+namespace ramses_internal
+{
+    using RCKey = ComplexTestType<struct FlatKeyTag>;
+    using RCValue = ComplexTestType<struct FlatValueTag>;
+
+    struct CollidingHasher
+    {
+        size_t operator()(uint32_t key) const
+        {
+            return key % 2u;
+        }
+    };
+
+    class AFlatHashMap : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            RCKey::Reset();
+            RCValue::Reset();
+        }
+
+        static void ExpectRefCnt(int32_t refCnt)
+        {
+            EXPECT_EQ(refCnt, RCKey::RefCnt());
+            EXPECT_EQ(refCnt, RCValue::RefCnt());
+        }
+
+        FlatHashMap<uint32_t, uint32_t> map;
+    };
+
+    TEST_F(AFlatHashMap, isEmptyWithoutAllocatedCapacityInitially)
+    {
+        EXPECT_EQ(0u, map.size());
+        EXPECT_EQ(0u, map.capacity());
+        EXPECT_EQ(map.end(), map.begin());
+        EXPECT_FALSE(map.contains(1u));
+        EXPECT_EQ(nullptr, map.get(1u));
+        EXPECT_EQ(map.end(), map.find(1u));
+    }
+
+    TEST_F(AFlatHashMap, putsAndGetsValues)
+    {
+        map.put(1u, 10u);
+        map.put(2u, 20u);
+        EXPECT_EQ(2u, map.size());
+
+        uint32_t value = 0u;
+        EXPECT_EQ(EStatus::Ok, map.get(1u, value));
+        EXPECT_EQ(10u, value);
+        ASSERT_NE(nullptr, map.get(2u));
+        EXPECT_EQ(20u, *map.get(2u));
+        EXPECT_EQ(EStatus::NotExist, map.get(3u, value));
+        EXPECT_EQ(10u, value);
+    }
+
+    TEST_F(AFlatHashMap, overwritesValueOfExistingKey)
+    {
+        map.put(1u, 10u);
+        const auto it = map.put(1u, 11u);
+        EXPECT_EQ(1u, map.size());
+        EXPECT_EQ(1u, it->key);
+        EXPECT_EQ(11u, it->value);
+        EXPECT_EQ(11u, map[1u]);
+    }
+
+    TEST_F(AFlatHashMap, subscriptOperatorInsertsDefaultValue)
+    {
+        EXPECT_EQ(0u, map[5u]);
+        map[6u] = 7u;
+        EXPECT_EQ(2u, map.size());
+        EXPECT_EQ(7u, *map.get(6u));
+    }
+
+    TEST_F(AFlatHashMap, removesByKey)
+    {
+        map.put(1u, 10u);
+        map.put(2u, 20u);
+
+        uint32_t oldValue = 0u;
+        EXPECT_TRUE(map.remove(1u, &oldValue));
+        EXPECT_EQ(10u, oldValue);
+        EXPECT_FALSE(map.remove(1u));
+        EXPECT_FALSE(map.contains(1u));
+        EXPECT_TRUE(map.contains(2u));
+        EXPECT_EQ(1u, map.size());
+    }
+
+    TEST_F(AFlatHashMap, removesWhileIterating)
+    {
+        for (uint32_t i = 0u; i < 100u; ++i)
+            map.put(i, i);
+
+        for (auto it = map.begin(); it != map.end();)
+        {
+            if (it->key % 2u == 0u)
+                it = map.remove(it);
+            else
+                ++it;
+        }
+
+        EXPECT_EQ(50u, map.size());
+        for (uint32_t i = 0u; i < 100u; ++i)
+            EXPECT_EQ(i % 2u == 1u, map.contains(i));
+    }
+
+    TEST_F(AFlatHashMap, iteratesAllElementsOnce)
+    {
+        for (uint32_t i = 0u; i < 1000u; ++i)
+            map.put(i, i * 2u);
+
+        const FlatHashMap<uint32_t, uint32_t>& constMap = map;
+        uint32_t count = 0u;
+        uint64_t keySum = 0u;
+        for (const auto& p : constMap)
+        {
+            EXPECT_EQ(p.key * 2u, p.value);
+            keySum += p.key;
+            ++count;
+        }
+        EXPECT_EQ(1000u, count);
+        EXPECT_EQ(999u * 1000u / 2u, keySum);
+    }
+
+    TEST_F(AFlatHashMap, canModifyValueThroughIterator)
+    {
+        map.put(1u, 10u);
+        map.begin()->value = 11u;
+        (*map.find(1u)).value += 1u;
+        EXPECT_EQ(12u, *map.get(1u));
+    }
+
+    TEST_F(AFlatHashMap, convertsConstIteratorToIterator)
+    {
+        map.put(1u, 10u);
+        const FlatHashMap<uint32_t, uint32_t>& constMap = map;
+        FlatHashMap<uint32_t, uint32_t>::Iterator it = constMap.find(1u);
+        EXPECT_EQ(map.find(1u), it);
+    }
+
+    TEST_F(AFlatHashMap, keepsElementsWhenGrowing)
+    {
+        for (uint32_t i = 0u; i < 10000u; ++i)
+            map.put(i * 7919u, i);
+
+        EXPECT_EQ(10000u, map.size());
+        EXPECT_GE(map.capacity(), 10000u);
+        for (uint32_t i = 0u; i < 10000u; ++i)
+        {
+            ASSERT_NE(nullptr, map.get(i * 7919u));
+            EXPECT_EQ(i, *map.get(i * 7919u));
+        }
+        EXPECT_FALSE(map.contains(1u));
+    }
+
+    TEST_F(AFlatHashMap, doesNotGrowWhenReservedToCapacity)
+    {
+        map.reserve(1000u);
+        const size_t capacity = map.capacity();
+        EXPECT_GE(capacity, 1000u);
+        for (uint32_t i = 0u; i < 1000u; ++i)
+            map.put(i, i);
+        EXPECT_EQ(capacity, map.capacity());
+
+        FlatHashMap<uint32_t, uint32_t> otherMap(1000u);
+        EXPECT_EQ(capacity, otherMap.capacity());
+    }
+
+    TEST_F(AFlatHashMap, doesNotGrowWhenRepeatedlyInsertingAndRemoving)
+    {
+        map.reserve(100u);
+        const size_t capacity = map.capacity();
+        for (uint32_t i = 0u; i < 100000u; ++i)
+        {
+            map.put(i, i);
+            if (i >= 50u)
+            {
+                EXPECT_TRUE(map.remove(i - 50u));
+            }
+        }
+
+        EXPECT_EQ(50u, map.size());
+        EXPECT_EQ(capacity, map.capacity());
+        for (uint32_t i = 100000u - 50u; i < 100000u; ++i)
+            EXPECT_TRUE(map.contains(i));
+    }
+
+    TEST_F(AFlatHashMap, staysConsistentWithHashMapUnderRandomOperations)
+    {
+        HashMap<uint32_t, uint32_t> referenceMap;
+        std::mt19937 gen(42u);
+        std::uniform_int_distribution<uint32_t> keyDist(0u, 2000u);
+        for (uint32_t i = 0u; i < 50000u; ++i)
+        {
+            const uint32_t key = keyDist(gen);
+            if (gen() % 3u == 0u)
+            {
+                EXPECT_EQ(referenceMap.remove(key), map.remove(key));
+            }
+            else
+            {
+                referenceMap.put(key, i);
+                map.put(key, i);
+            }
+        }
+
+        ASSERT_EQ(referenceMap.size(), map.size());
+        for (const auto& p : referenceMap)
+        {
+            ASSERT_TRUE(map.contains(p.key));
+            EXPECT_EQ(p.value, *map.get(p.key));
+        }
+    }
+
+    TEST_F(AFlatHashMap, findsKeysWithCollidingHashes)
+    {
+        FlatHashMap<uint32_t, uint32_t, CollidingHasher> collidingMap;
+        for (uint32_t i = 0u; i < 200u; ++i)
+            collidingMap.put(i, i);
+        for (uint32_t i = 0u; i < 200u; i += 3u)
+            EXPECT_TRUE(collidingMap.remove(i));
+        for (uint32_t i = 200u; i < 300u; ++i)
+            collidingMap.put(i, i);
+
+        for (uint32_t i = 0u; i < 300u; ++i)
+        {
+            const bool expectContained = (i >= 200u || i % 3u != 0u);
+            ASSERT_EQ(expectContained, collidingMap.contains(i));
+            if (expectContained)
+            {
+                EXPECT_EQ(i, *collidingMap.get(i));
+            }
+        }
+    }
+
+    TEST_F(AFlatHashMap, clearRemovesAllElementsAndKeepsCapacity)
+    {
+        for (uint32_t i = 0u; i < 100u; ++i)
+            map.put(i, i);
+        const size_t capacity = map.capacity();
+        map.clear();
+        EXPECT_EQ(0u, map.size());
+        EXPECT_EQ(capacity, map.capacity());
+        EXPECT_EQ(map.end(), map.begin());
+        EXPECT_FALSE(map.contains(1u));
+
+        map.put(1u, 1u);
+        EXPECT_TRUE(map.contains(1u));
+    }
+
+    TEST_F(AFlatHashMap, canBeCopiedAndMoved)
+    {
+        map.put(1u, 10u);
+        map.put(2u, 20u);
+
+        FlatHashMap<uint32_t, uint32_t> copy(map);
+        copy.remove(1u);
+        EXPECT_TRUE(map.contains(1u));
+        EXPECT_EQ(1u, copy.size());
+
+        FlatHashMap<uint32_t, uint32_t> assigned;
+        assigned.put(3u, 30u);
+        assigned = map;
+        EXPECT_EQ(2u, assigned.size());
+        EXPECT_FALSE(assigned.contains(3u));
+
+        FlatHashMap<uint32_t, uint32_t> moved(std::move(copy));
+        EXPECT_EQ(1u, moved.size());
+        EXPECT_EQ(20u, *moved.get(2u));
+
+        assigned = std::move(moved);
+        EXPECT_EQ(1u, assigned.size());
+        EXPECT_EQ(20u, *assigned.get(2u));
+    }
+
+    TEST_F(AFlatHashMap, swapsContent)
+    {
+        FlatHashMap<uint32_t, uint32_t> other;
+        map.put(1u, 10u);
+        other.put(2u, 20u);
+        other.put(3u, 30u);
+
+        using std::swap;
+        swap(map, other);
+        EXPECT_EQ(2u, map.size());
+        EXPECT_EQ(1u, other.size());
+        EXPECT_TRUE(map.contains(3u));
+        EXPECT_TRUE(other.contains(1u));
+    }
+
+    TEST_F(AFlatHashMap, supportsStringKeys)
+    {
+        FlatHashMap<std::string, int32_t> stringMap;
+        stringMap.put("foo", 1);
+        stringMap["bar"] = 2;
+        EXPECT_EQ(1, *stringMap.get("foo"));
+        EXPECT_EQ(2, *stringMap.get("bar"));
+        EXPECT_FALSE(stringMap.contains("baz"));
+    }
+
+    TEST_F(AFlatHashMap, constructsAndDestructsElementsBalanced)
+    {
+        {
+            FlatHashMap<RCKey, RCValue> rcMap;
+            for (size_t i = 0u; i < 100u; ++i)
+                rcMap.put(RCKey(i), RCValue(i));
+            ExpectRefCnt(100);
+
+            rcMap.put(RCKey(1u), RCValue(2u));
+            ExpectRefCnt(100);
+
+            EXPECT_TRUE(rcMap.remove(RCKey(1u)));
+            ExpectRefCnt(99);
+
+            FlatHashMap<RCKey, RCValue> copy(rcMap);
+            ExpectRefCnt(2 * 99);
+
+            rcMap.clear();
+            ExpectRefCnt(99);
+        }
+        ExpectRefCnt(0);
+    }
+}
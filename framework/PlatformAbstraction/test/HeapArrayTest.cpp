@@ -8,6 +8,8 @@
 
 #include "Collections/HeapArray.h"
 #include "gtest/gtest.h"
+#include <memory>
+#include <vector>
 
 
 namespace ramses_internal
@@ -100,6 +102,24 @@ namespace ramses_internal
         EXPECT_EQ(2u, b.size());
     }
 
+    TYPED_TEST(AHeapArray, CanReferenceExternalDataAndKeepsItsOwnerAlive)
+    {
+        auto owner = std::make_shared<std::vector<TypeParam>>(std::initializer_list<TypeParam>{1, 2, 3, 4});
+        std::weak_ptr<std::vector<TypeParam>> weakOwner = owner;
+        TypeParam* externalData = owner->data();
+
+        HeapArray<TypeParam> a(4, externalData, std::move(owner));
+        EXPECT_EQ(externalData, a.data());
+        ASSERT_EQ(4u, a.size());
+
+        HeapArray<TypeParam> b(std::move(a));
+        EXPECT_EQ(externalData, b.data());
+        EXPECT_FALSE(weakOwner.expired());
+
+        b = HeapArray<TypeParam>();
+        EXPECT_TRUE(weakOwner.expired());
+    }
+
     TYPED_TEST(AHeapArray, canGetAsSpan)
     {
         TypeParam data[4] = {1, 2, 3, 4};
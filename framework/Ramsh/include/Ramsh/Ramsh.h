@@ -25,6 +25,7 @@ namespace ramses_internal
     class RamshCommandSetContextLogLevel;
     class RamshCommandSetContextLogLevelFilter;
     class RamshCommandPrintLogLevels;
+    class RamshCommandTrace;
 
     class Ramsh
     {
@@ -51,6 +52,7 @@ namespace ramses_internal
         std::shared_ptr<RamshCommandSetContextLogLevel> m_pCmdSetContextLogLevel;
         std::shared_ptr<RamshCommandSetContextLogLevelFilter> m_pCmdSetContextLogLevelFilter;
         std::shared_ptr<RamshCommandPrintLogLevels> m_pCmdPrintLogLevels;
+        std::shared_ptr<RamshCommandTrace> m_pCmdTrace;
     };
 }
 
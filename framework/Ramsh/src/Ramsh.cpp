@@ -18,6 +18,7 @@
 #include "Ramsh/RamshCommandSetContextLogLevel.h"
 #include "Ramsh/RamshCommandSetContextLogLevelFilter.h"
 #include "Ramsh/RamshCommandPrintLogLevels.h"
+#include "Ramsh/RamshCommandTrace.h"
 #include <mutex>
 
 namespace ramses_internal
@@ -44,6 +45,9 @@ namespace ramses_internal
 
         m_pCmdPrintLogLevels = std::make_shared<RamshCommandPrintLogLevels>(*this);
         add(m_pCmdPrintLogLevels);
+
+        m_pCmdTrace = std::make_shared<RamshCommandTrace>();
+        add(m_pCmdTrace);
     }
 
     Ramsh::~Ramsh() = default;
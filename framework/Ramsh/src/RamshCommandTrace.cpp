@@ -0,0 +1,52 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Ramsh/RamshCommandTrace.h"
+#include "Utils/TraceRecorder.h"
+#include "Utils/LogMacros.h"
+
+namespace ramses_internal
+{
+    RamshCommandTrace::RamshCommandTrace()
+    {
+        registerKeyword("trace");
+        description = "Command to record timeline of renderer and logic engine updates. Usage: trace {on | off | clear | dump <file>}, dump writes Chrome trace format (chrome://tracing, ui.perfetto.dev)";
+    }
+
+    bool RamshCommandTrace::executeInput(const std::vector<std::string>& input)
+    {
+        TraceRecorder& recorder = GetTraceRecorder();
+        if (input.size() == 2u && input[1] == "on")
+        {
+            recorder.enable(true);
+            LOG_INFO(CONTEXT_RAMSH, "Trace recording enabled");
+            return true;
+        }
+        if (input.size() == 2u && input[1] == "off")
+        {
+            recorder.enable(false);
+            LOG_INFO(CONTEXT_RAMSH, "Trace recording disabled");
+            return true;
+        }
+        if (input.size() == 2u && input[1] == "clear")
+        {
+            recorder.clear();
+            LOG_INFO(CONTEXT_RAMSH, "Trace recording cleared");
+            return true;
+        }
+        if (input.size() == 3u && input[1] == "dump")
+        {
+            if (!recorder.writeChromeTrace(input[2]))
+                return false;
+            LOG_INFO_P(CONTEXT_RAMSH, "Trace written to file '{}'", input[2]);
+            return true;
+        }
+
+        return false;
+    }
+}
@@ -11,12 +11,14 @@
 
 #include "SceneAPI/ResourceContentHash.h"
 #include "Resource/ResourceTypes.h"
+#include "ramses-framework-api/EFeatureLevel.h"
 
 #include <string>
 
 namespace ramses_internal
 {
     class IOutputStream;
+    class ParallelForExecutor;
 
     class IResource
     {
@@ -47,8 +49,9 @@ namespace ramses_internal
         virtual void setCompressedResourceData(CompressedResourceBlob compressedData, CompressionLevel compressionLevel, uint32_t uncompressedSize, const ResourceContentHash& hash) = 0;
         [[nodiscard]] virtual EResourceType getTypeID() const = 0;
         [[nodiscard]] virtual const ResourceContentHash& getHash() const = 0;
-        virtual void compress(CompressionLevel level) const = 0;
-        virtual void decompress() const = 0;
+        // executor is used to (de)compress chunks of large resources in parallel, chunks are only used if feature level supports them
+        virtual void compress(CompressionLevel level, ramses::EFeatureLevel featureLevel = ramses::EFeatureLevel_01, ParallelForExecutor* executor = nullptr) const = 0;
+        virtual void decompress(ParallelForExecutor* executor = nullptr) const = 0;
         [[nodiscard]] virtual bool isCompressedAvailable() const = 0;
         [[nodiscard]] virtual bool isDeCompressedAvailable() const = 0;
         [[nodiscard]] virtual ResourceCacheFlag getCacheFlag() const = 0;
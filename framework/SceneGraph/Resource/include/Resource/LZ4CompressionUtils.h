@@ -11,9 +11,12 @@
 
 #include "Collections/HeapArray.h"
 #include "Resource/ResourceTypes.h"
+#include "ramses-framework-api/EFeatureLevel.h"
 
 namespace ramses_internal
 {
+    class ParallelForExecutor;
+
     namespace LZ4CompressionUtils
     {
         enum class CompressionLevel : int
@@ -22,8 +25,14 @@ namespace ramses_internal
             High
         };
 
-        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level);
-        ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize);
+        // Data up to this size is compressed as a single LZ4 block. Larger data is split into chunks of this size
+        // which are compressed independently, so that they can be compressed and decompressed in parallel.
+        // Chunked data cannot be decompressed by Ramses supporting only EFeatureLevel_01, it is therefore produced
+        // only for feature level EFeatureLevel_02 and higher. Decompression supports both formats.
+        constexpr uint32_t ChunkSize = 1024u * 1024u;
+
+        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level, ramses::EFeatureLevel featureLevel = ramses::EFeatureLevel_01, ParallelForExecutor* executor = nullptr);
+        ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize, ParallelForExecutor* executor = nullptr);
     }
 }
 #endif
@@ -97,9 +97,9 @@ namespace ramses_internal
             return m_hash;
         }
 
-        void compress(CompressionLevel level) const final override;
+        void compress(CompressionLevel level, ramses::EFeatureLevel featureLevel = ramses::EFeatureLevel_01, ParallelForExecutor* executor = nullptr) const final override;
 
-        void decompress() const final override;
+        void decompress(ParallelForExecutor* executor = nullptr) const final override;
 
         bool isCompressedAvailable() const final override
         {
@@ -7,43 +7,180 @@
 //  -------------------------------------------------------------------------
 
 #include "Resource/LZ4CompressionUtils.h"
+#include "TaskFramework/ParallelForExecutor.h"
 #include "lz4.h"
 #include "lz4hc.h"
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <cstring>
+#include <vector>
 
 namespace ramses_internal
 {
     namespace LZ4CompressionUtils
     {
-        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level)
+        namespace
         {
-            const int plainSize = static_cast<int>(plainBuffer.size());
-            if (!plainSize)
-                return CompressedResourceBlob();
+            // Chunked format: [marker (1 byte)] [chunk size (4 bytes)] [chunk count (4 bytes)]
+            //                 [compressed size of each chunk (4 bytes each)] [compressed chunks]
+            // A LZ4 block of non empty data can never start with a zero token (no literals and a match
+            // without any preceding data), so a leading zero byte distinguishes chunked from single block data.
+            constexpr Byte ChunkedFormatMarker = 0u;
+            constexpr size_t ChunkedHeaderSize = sizeof(Byte) + 2u * sizeof(uint32_t);
 
-            CompressedResourceBlob compressedBuffer(LZ4_compressBound(plainSize));
-            int realCompressedSize = 0;
+            uint32_t ReadUInt32(const Byte* data)
+            {
+                uint32_t value = 0u;
+                std::memcpy(&value, data, sizeof(value));
+                return value;
+            }
 
-            if (level == CompressionLevel::Fast)
+            void WriteUInt32(Byte* data, uint32_t value)
             {
-                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                realCompressedSize = LZ4_compress_default(reinterpret_cast<const char*>(plainBuffer.data()),
-                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                    reinterpret_cast<char*>(compressedBuffer.data()),
-                    plainSize,
-                    static_cast<int>(compressedBuffer.size()));
+                std::memcpy(data, &value, sizeof(value));
             }
-            else
+
+            int CompressBlock(const Byte* plainData, int plainSize, Byte* compressedData, int compressedCapacity, CompressionLevel level)
             {
+                if (level == CompressionLevel::Fast)
+                {
+                    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                    return LZ4_compress_default(reinterpret_cast<const char*>(plainData),
+                        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                        reinterpret_cast<char*>(compressedData),
+                        plainSize,
+                        compressedCapacity);
+                }
+
                 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                realCompressedSize = LZ4_compress_HC(reinterpret_cast<const char*>(plainBuffer.data()),
+                return LZ4_compress_HC(reinterpret_cast<const char*>(plainData),
                     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                    reinterpret_cast<char*>(compressedBuffer.data()),
+                    reinterpret_cast<char*>(compressedData),
                     plainSize,
-                    static_cast<int>(compressedBuffer.size()),
+                    compressedCapacity,
                     // using higher compression causes too excessive times to be able to use
                     LZ4HC_CLEVEL_DEFAULT);
             }
 
+            bool DecompressBlock(const Byte* compressedData, int compressedSize, Byte* plainData, int plainSize)
+            {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                const int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData),
+                                                                  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
+                                                                  reinterpret_cast<char*>(plainData),
+                                                                  compressedSize,
+                                                                  plainSize);
+                return bytesDecompressed == plainSize;
+            }
+
+            void ExecuteForChunks(size_t chunkCount, ParallelForExecutor* executor, const std::function<void(size_t, size_t)>& function)
+            {
+                if (executor)
+                    executor->execute(chunkCount, 1u, function);
+                else
+                    function(0u, chunkCount);
+            }
+
+            CompressedResourceBlob CompressChunked(const ResourceBlob& plainBuffer, CompressionLevel level, ParallelForExecutor* executor)
+            {
+                const size_t plainSize = plainBuffer.size();
+                const uint32_t chunkCount = static_cast<uint32_t>((plainSize + ChunkSize - 1u) / ChunkSize);
+                const size_t headerSize = ChunkedHeaderSize + chunkCount * sizeof(uint32_t);
+                const size_t chunkCapacity = static_cast<size_t>(LZ4_compressBound(static_cast<int>(ChunkSize)));
+
+                // every chunk is compressed into its own slot, slots are compacted afterwards
+                CompressedResourceBlob compressedBuffer(headerSize + chunkCount * chunkCapacity);
+                std::vector<int> compressedChunkSizes(chunkCount, 0);
+                ExecuteForChunks(chunkCount, executor, [&](size_t begin, size_t end)
+                {
+                    for (size_t chunk = begin; chunk < end; ++chunk)
+                    {
+                        const size_t chunkOffset = chunk * ChunkSize;
+                        const size_t chunkPlainSize = std::min<size_t>(ChunkSize, plainSize - chunkOffset);
+                        compressedChunkSizes[chunk] = CompressBlock(plainBuffer.data() + chunkOffset, static_cast<int>(chunkPlainSize),
+                            compressedBuffer.data() + headerSize + chunk * chunkCapacity, static_cast<int>(chunkCapacity), level);
+                    }
+                });
+
+                Byte* header = compressedBuffer.data();
+                header[0] = ChunkedFormatMarker;
+                WriteUInt32(header + sizeof(Byte), ChunkSize);
+                WriteUInt32(header + sizeof(Byte) + sizeof(uint32_t), chunkCount);
+
+                size_t compressedSize = headerSize;
+                for (uint32_t chunk = 0u; chunk < chunkCount; ++chunk)
+                {
+                    const int chunkCompressedSize = compressedChunkSizes[chunk];
+                    if (chunkCompressedSize <= 0)
+                        return CompressedResourceBlob();
+
+                    WriteUInt32(header + ChunkedHeaderSize + chunk * sizeof(uint32_t), static_cast<uint32_t>(chunkCompressedSize));
+                    std::memmove(compressedBuffer.data() + compressedSize, compressedBuffer.data() + headerSize + chunk * chunkCapacity, static_cast<size_t>(chunkCompressedSize));
+                    compressedSize += static_cast<size_t>(chunkCompressedSize);
+                }
+
+                // compressedBuffer size might be too large, create properly sized result
+                return CompressedResourceBlob(compressedSize, std::move(compressedBuffer));
+            }
+
+            ResourceBlob DecompressChunked(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize, ParallelForExecutor* executor)
+            {
+                if (compressedData.size() < ChunkedHeaderSize)
+                    return ResourceBlob();
+
+                const Byte* header = compressedData.data();
+                const uint32_t chunkSize = ReadUInt32(header + sizeof(Byte));
+                const uint32_t chunkCount = ReadUInt32(header + sizeof(Byte) + sizeof(uint32_t));
+                if (chunkSize == 0u || chunkCount != (static_cast<size_t>(uncompressedSize) + chunkSize - 1u) / chunkSize)
+                    return ResourceBlob();
+
+                const size_t headerSize = ChunkedHeaderSize + static_cast<size_t>(chunkCount) * sizeof(uint32_t);
+                if (compressedData.size() < headerSize)
+                    return ResourceBlob();
+
+                std::vector<size_t> chunkOffsets(chunkCount + 1u);
+                chunkOffsets[0] = headerSize;
+                for (uint32_t chunk = 0u; chunk < chunkCount; ++chunk)
+                    chunkOffsets[chunk + 1u] = chunkOffsets[chunk] + ReadUInt32(header + ChunkedHeaderSize + chunk * sizeof(uint32_t));
+                if (chunkOffsets.back() != compressedData.size())
+                    return ResourceBlob();
+
+                ResourceBlob plainBuffer(uncompressedSize);
+                std::atomic<bool> failed{ false };
+                ExecuteForChunks(chunkCount, executor, [&](size_t begin, size_t end)
+                {
+                    for (size_t chunk = begin; chunk < end; ++chunk)
+                    {
+                        const size_t chunkOffset = chunk * chunkSize;
+                        const size_t chunkPlainSize = std::min<size_t>(chunkSize, uncompressedSize - chunkOffset);
+                        if (!DecompressBlock(compressedData.data() + chunkOffsets[chunk], static_cast<int>(chunkOffsets[chunk + 1u] - chunkOffsets[chunk]),
+                            plainBuffer.data() + chunkOffset, static_cast<int>(chunkPlainSize)))
+                        {
+                            failed = true;
+                        }
+                    }
+                });
+
+                if (failed)
+                    return ResourceBlob();
+
+                return plainBuffer;
+            }
+        }
+
+        CompressedResourceBlob compress(const ResourceBlob& plainBuffer, CompressionLevel level, ramses::EFeatureLevel featureLevel, ParallelForExecutor* executor)
+        {
+            const size_t plainSize = plainBuffer.size();
+            if (!plainSize)
+                return CompressedResourceBlob();
+
+            if (plainSize > ChunkSize && featureLevel >= ramses::EFeatureLevel_02)
+                return CompressChunked(plainBuffer, level, executor);
+
+            CompressedResourceBlob compressedBuffer(LZ4_compressBound(static_cast<int>(plainSize)));
+            const int realCompressedSize = CompressBlock(plainBuffer.data(), static_cast<int>(plainSize), compressedBuffer.data(), static_cast<int>(compressedBuffer.size()), level);
+
             if (realCompressedSize <= 0)
                 return CompressedResourceBlob();
 
@@ -51,20 +188,16 @@ namespace ramses_internal
             return CompressedResourceBlob(realCompressedSize, std::move(compressedBuffer));
         }
 
-        ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize)
+        ResourceBlob decompress(const CompressedResourceBlob& compressedData, uint32_t uncompressedSize, ParallelForExecutor* executor)
         {
             if (!compressedData.size() || !uncompressedSize)
                 return ResourceBlob();
 
+            if (compressedData.data()[0] == ChunkedFormatMarker)
+                return DecompressChunked(compressedData, uncompressedSize, executor);
+
             ResourceBlob plainBuffer(uncompressedSize);
-            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-            int bytesDecompressed = LZ4_decompress_safe(reinterpret_cast<const char*>(compressedData.data()),
-                                                        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast) external API expects char* to binary data
-                                                        reinterpret_cast<char*>(plainBuffer.data()),
-                                                        static_cast<int>(compressedData.size()),
-                                                        static_cast<int>(plainBuffer.size()));
-
-            if (bytesDecompressed != static_cast<int>(plainBuffer.size()))
+            if (!DecompressBlock(compressedData.data(), static_cast<int>(compressedData.size()), plainBuffer.data(), static_cast<int>(plainBuffer.size())))
                 return ResourceBlob();
 
             return plainBuffer;
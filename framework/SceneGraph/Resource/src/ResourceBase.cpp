@@ -45,7 +45,7 @@ namespace ramses_internal
         }
     }
 
-    void ResourceBase::compress(CompressionLevel level) const
+    void ResourceBase::compress(CompressionLevel level, ramses::EFeatureLevel featureLevel, ParallelForExecutor* executor) const
     {
         std::unique_lock<std::mutex> l(m_compressionLock);
         if (level > m_currentCompression &&
@@ -56,12 +56,12 @@ namespace ramses_internal
             const auto lz4Level = (level == CompressionLevel::Realtime) ?
                 LZ4CompressionUtils::CompressionLevel::Fast :
                 LZ4CompressionUtils::CompressionLevel::High;
-            m_compressedData = LZ4CompressionUtils::compress(m_data, lz4Level);
+            m_compressedData = LZ4CompressionUtils::compress(m_data, lz4Level, featureLevel, executor);
             m_currentCompression = level;
         }
     }
 
-    void ResourceBase::decompress() const
+    void ResourceBase::decompress(ParallelForExecutor* executor) const
     {
         std::unique_lock<std::mutex> l(m_compressionLock);
         if (!m_data.data())
@@ -69,7 +69,7 @@ namespace ramses_internal
             assert(m_compressedData.data());
             assert(m_compressedData.size());
 
-            m_data = LZ4CompressionUtils::decompress(m_compressedData, m_uncompressedSize);
+            m_data = LZ4CompressionUtils::decompress(m_compressedData, m_uncompressedSize, executor);
         }
     }
 }
@@ -7,28 +7,37 @@
 //  -------------------------------------------------------------------------
 
 #include "Resource/LZ4CompressionUtils.h"
+#include "TaskFramework/ParallelForExecutor.h"
 #include "Collections/Vector.h"
 #include "gtest/gtest.h"
 #include <numeric>
 
 namespace ramses_internal
 {
-    void checkCompressionDecompression(const std::vector<uint8_t>& input)
+    void checkCompressionDecompression(const std::vector<uint8_t>& input, ramses::EFeatureLevel featureLevel = ramses::EFeatureLevel_01, ParallelForExecutor* executor = nullptr)
     {
         for (auto level : { LZ4CompressionUtils::CompressionLevel::Fast,
                             LZ4CompressionUtils::CompressionLevel::High })
         {
             ResourceBlob inBlob(input.size(), input.data());
-            CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(inBlob, level);
+            CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(inBlob, level, featureLevel, executor);
             EXPECT_GT(compBlob.size(), 0u);
             ASSERT_TRUE(compBlob.data() != nullptr);
 
-            ResourceBlob outBlob = LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size()));
+            ResourceBlob outBlob = LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size()), executor);
             ASSERT_EQ(inBlob.size(), outBlob.size());
             EXPECT_EQ(input, outBlob.span());
         }
     }
 
+    std::vector<uint8_t> createMultiChunkData()
+    {
+        std::vector<uint8_t> data(3u * LZ4CompressionUtils::ChunkSize + 123u);
+        for (size_t i = 0u; i < data.size(); ++i)
+            data[i] = static_cast<uint8_t>((i / 7u) ^ (i % 13u));
+        return data;
+    }
+
     TEST(LZ4CompressionUtilsTest, TestEmptyCompressionFast)
     {
         CompressedResourceBlob res = LZ4CompressionUtils::compress(ResourceBlob(), LZ4CompressionUtils::CompressionLevel::Fast);
@@ -69,4 +78,69 @@ namespace ramses_internal
         std::iota(big.begin(), big.end(), static_cast<uint8_t>(5));
         checkCompressionDecompression(big);
     }
+
+    TEST(LZ4CompressionUtilsTest, TestMultiChunkData)
+    {
+        checkCompressionDecompression(createMultiChunkData(), ramses::EFeatureLevel_02);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestMultiChunkDataWithExecutor)
+    {
+        ParallelForExecutor executor(3u);
+        checkCompressionDecompression(createMultiChunkData(), ramses::EFeatureLevel_02, &executor);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestMultiChunkDataWithFeatureLevel01)
+    {
+        ParallelForExecutor executor(3u);
+        checkCompressionDecompression(createMultiChunkData(), ramses::EFeatureLevel_01, &executor);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestDataLargerThanChunkSizeIsCompressedChunkedOnlyFromFeatureLevel02)
+    {
+        const std::vector<uint8_t> input = createMultiChunkData();
+        const CompressedResourceBlob compBlob01 = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, ramses::EFeatureLevel_01);
+        ASSERT_GT(compBlob01.size(), 0u);
+        EXPECT_NE(0u, compBlob01.data()[0]);
+
+        const CompressedResourceBlob compBlob02 = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, ramses::EFeatureLevel_02);
+        ASSERT_GT(compBlob02.size(), 0u);
+        EXPECT_EQ(0u, compBlob02.data()[0]);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestMultiChunkDataCompressedWithExecutorCanBeDecompressedWithout)
+    {
+        const std::vector<uint8_t> input = createMultiChunkData();
+        ParallelForExecutor executor(3u);
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, ramses::EFeatureLevel_02, &executor);
+        const ResourceBlob outBlob = LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size()));
+        EXPECT_EQ(input, outBlob.span());
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestDataUpToChunkSizeIsCompressedAsSingleBlock)
+    {
+        const std::vector<uint8_t> input(LZ4CompressionUtils::ChunkSize, 7u);
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast);
+        ASSERT_GT(compBlob.size(), 0u);
+        // single LZ4 block never starts with zero token, chunked format does
+        EXPECT_NE(0u, compBlob.data()[0]);
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestMultiChunkDecompressionFailsWithWrongUncompressedSize)
+    {
+        const std::vector<uint8_t> input = createMultiChunkData();
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, ramses::EFeatureLevel_02);
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size() + LZ4CompressionUtils::ChunkSize)).size());
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(compBlob, static_cast<uint32_t>(input.size() - 1u)).size());
+    }
+
+    TEST(LZ4CompressionUtilsTest, TestMultiChunkDecompressionFailsWithTruncatedData)
+    {
+        const std::vector<uint8_t> input = createMultiChunkData();
+        const CompressedResourceBlob compBlob = LZ4CompressionUtils::compress(ResourceBlob(input.size(), input.data()), LZ4CompressionUtils::CompressionLevel::Fast, ramses::EFeatureLevel_02);
+        const CompressedResourceBlob truncatedBlob(compBlob.size() - 1u, compBlob.data());
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(truncatedBlob, static_cast<uint32_t>(input.size())).size());
+        const CompressedResourceBlob headerOnlyBlob(5u, compBlob.data());
+        EXPECT_EQ(0u, LZ4CompressionUtils::decompress(headerOnlyBlob, static_cast<uint32_t>(input.size())).size());
+    }
 }
@@ -167,6 +167,9 @@ namespace ramses_internal
         [[nodiscard]] const SceneReferenceActionVector& getSceneReferenceActions() const;
         void resetSceneReferenceActions();
 
+    protected:
+        void                        onRestoredFromSnapshot() override;
+
     private:
         SceneActionCollection m_collection;
         SceneActionCollectionCreator m_creator;
@@ -14,6 +14,8 @@
 
 namespace ramses_internal
 {
+    // Data instance does not own its data, the memory is provided by owning scene (see DataInstanceArena)
+    // and must stay valid as long as the data instance is used.
     class DataInstance
     {
     public:
@@ -21,9 +23,10 @@ namespace ramses_internal
         {
         }
 
-        DataInstance(DataLayoutHandle dataLayoutHandle, uint32_t size)
+        DataInstance(DataLayoutHandle dataLayoutHandle, Byte* data, uint32_t size)
             : m_dataLayoutHandle(dataLayoutHandle)
-            , m_data(size)
+            , m_data(data)
+            , m_dataSize(size)
         {
         }
 
@@ -43,7 +46,7 @@ namespace ramses_internal
         void setTypedData(uint32_t fieldOffset, uint32_t elementCount, const DATATYPE* value)
         {
             const uint32_t fieldSizeInByte = sizeof(DATATYPE) * elementCount;
-            assert(fieldOffset + fieldSizeInByte <= m_data.size());
+            assert(fieldOffset + fieldSizeInByte <= m_dataSize);
             void* dest = &m_data[fieldOffset];
             if (dest != value)
             {
@@ -56,9 +59,20 @@ namespace ramses_internal
             return m_dataLayoutHandle;
         }
 
+        [[nodiscard]] Byte* getData() const
+        {
+            return m_data;
+        }
+
+        [[nodiscard]] uint32_t getDataSize() const
+        {
+            return m_dataSize;
+        }
+
     private:
         DataLayoutHandle m_dataLayoutHandle;
-        std::vector<Byte> m_data;
+        Byte* m_data = nullptr;
+        uint32_t m_dataSize = 0u;
     };
 
     ASSERT_MOVABLE(DataInstance)
@@ -0,0 +1,67 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DATAINSTANCEARENA_H
+#define RAMSES_DATAINSTANCEARENA_H
+
+#include "SceneAPI/Handles.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <vector>
+#include <memory>
+#include <cstddef>
+
+namespace ramses_internal
+{
+    // Owns the payload memory of all data instances of a scene.
+    // Payloads are placed into slabs, one slab per data layout, so data instances of same layout lie next to each other in memory.
+    // A slab grows by chunks of increasing capacity, i.e. the number of heap allocations grows only logarithmically with number of data instances.
+    // Released payloads are reused by next allocation of same layout, memory is given back only when layout is released or arena destroyed.
+    class DataInstanceArena
+    {
+    public:
+        DataInstanceArena() = default;
+        DataInstanceArena(const DataInstanceArena&) = delete;
+        DataInstanceArena& operator=(const DataInstanceArena&) = delete;
+        DataInstanceArena(DataInstanceArena&&) noexcept = default;
+        DataInstanceArena& operator=(DataInstanceArena&&) noexcept = default;
+
+        // returns zero initialized memory of given size which stays valid until released, nullptr for zero size
+        Byte* allocate(DataLayoutHandle layout, uint32_t size);
+        void release(DataLayoutHandle layout, uint32_t size, Byte* payload);
+        // frees memory of all slabs of layout which have no payload in use anymore
+        void releaseLayout(DataLayoutHandle layout);
+
+        [[nodiscard]] uint32_t getPayloadCount(DataLayoutHandle layout) const;
+        [[nodiscard]] uint32_t getChunkCount() const;
+
+        static constexpr uint32_t PayloadAlignment = alignof(std::max_align_t);
+        static constexpr uint32_t MinChunkPayloadCount = 16u;
+        static constexpr uint32_t MaxChunkSizeInBytes = 1024u * 1024u;
+
+    private:
+        struct Slab
+        {
+            uint32_t payloadSize = 0u;
+            uint32_t usedPayloadCount = 0u;
+            uint32_t capacity = 0u;
+            uint32_t lastChunkCapacity = 0u;
+            uint32_t usedSlotsInLastChunk = 0u;
+            std::vector<std::unique_ptr<Byte[]>> chunks;
+            std::vector<Byte*> releasedPayloads;
+        };
+
+        [[nodiscard]] static uint32_t GetAlignedPayloadSize(uint32_t size);
+        Slab& getOrCreateSlab(DataLayoutHandle layout, uint32_t payloadSize);
+        static Byte* AllocateFromSlab(Slab& slab);
+
+        // slabs indexed by layout handle, a layout handle can be reused for layout of different size while payloads of previous layout are still in use
+        std::vector<std::vector<Slab>> m_slabsPerLayout;
+    };
+}
+
+#endif
@@ -24,6 +24,10 @@ namespace ramses_internal
         void                        releaseDataLayout(DataLayoutHandle handle) override;
 
         [[nodiscard]] uint32_t                              getNumDataLayoutReferences(DataLayoutHandle handle) const;
+        void                                                setNumDataLayoutReferences(DataLayoutHandle handle, uint32_t numReferences);
+
+    protected:
+        void                        onRestoredFromSnapshot() override;
 
     private:
         struct DataLayoutCacheEntry
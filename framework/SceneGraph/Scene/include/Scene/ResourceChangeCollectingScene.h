@@ -56,6 +56,9 @@ namespace ramses_internal
         void                        releaseTextureBuffer(TextureBufferHandle handle) override;
         void                        updateTextureBuffer(TextureBufferHandle handle, uint32_t mipLevel, uint32_t x, uint32_t y, uint32_t width, uint32_t height, const Byte* data) override;
 
+    protected:
+        void                        onRestoredFromSnapshot() override;
+
     private:
 
         SceneResourceActionVector   m_sceneResourceActions;
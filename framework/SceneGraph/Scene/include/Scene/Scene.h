@@ -29,12 +29,17 @@
 #include "Scene/TopologyTransform.h"
 #include "Scene/DataLayout.h"
 #include "Scene/DataInstance.h"
+#include "Scene/DataInstanceArena.h"
 
 #include "Utils/MemoryPool.h"
 #include "Utils/MemoryPoolExplicit.h"
 
+#include "absl/types/span.h"
+
 namespace ramses_internal
 {
+    class SceneSnapshot;
+
     template <template<typename, typename> class MEMORYPOOL>
     class SceneT;
 
@@ -128,6 +133,8 @@ namespace ramses_internal
         [[nodiscard]] uint32_t                      getChildCount                   (NodeHandle parent) const final override;
         [[nodiscard]] NodeHandle                  getChild                        (NodeHandle parent, uint32_t childNumber) const final override;
         [[nodiscard]] const NodeMemoryPool&                   getNodes                        () const;
+        // children of parent in their order, view is invalidated by any change of scene topology
+        [[nodiscard]] absl::Span<const NodeHandle>           getChildren                     (NodeHandle parent) const;
 
         // Transformation
         TransformHandle             allocateTransform               (NodeHandle nodeHandle, TransformHandle handle = TransformHandle::Invalid()) override;
@@ -336,19 +343,33 @@ namespace ramses_internal
         RenderGroup&                    getRenderGroupInternal          (RenderGroupHandle handle);
         [[nodiscard]] const TopologyTransform&        getTransform                    (TransformHandle handle) const;
 
+        // Called after all memory pools were restored at once from a snapshot,
+        // derived scenes rebuild their state which is otherwise maintained by the individual allocations and setters
+        virtual void                    onRestoredFromSnapshot          () {}
+
     private:
+        friend class SceneSnapshot;
+
         template <typename TYPE>
         const TYPE* getInstanceDataInternal(DataInstanceHandle dataInstanceHandle, DataFieldHandle fieldId) const;
         template <typename TYPE>
         void setInstanceDataInternal(DataInstanceHandle dataInstanceHandle, DataFieldHandle fieldId, uint32_t elementCount, const TYPE* newValue);
 
+        void reserveNodeChildren(NodeHandle nodeHandle, uint32_t capacity);
+        void compactNodeChildren();
+
         NodeMemoryPool              m_nodes;
+        // children of all nodes, every node has a range of it with capacity to add children without relocation,
+        // ranges of released nodes and relocated children are reclaimed by compaction once they make up half of the storage
+        NodeHandleVector            m_nodeChildren;
+        uint32_t                    m_unusedNodeChildrenCount = 0u;
         CameraMemoryPool            m_cameras;
         RenderableMemoryPool        m_renderables;
         RenderStateMemoryPool       m_states;
         TransformMemoryPool         m_transforms;
         DataLayoutMemoryPool        m_dataLayoutMemory;
         DataInstanceMemoryPool      m_dataInstanceMemory;
+        DataInstanceArena           m_dataInstancePayloads;
         RenderGroupMemoryPool       m_renderGroups;
         RenderPassMemoryPool        m_renderPasses;
         BlitPassMemoryPool          m_blitPasses;
@@ -0,0 +1,33 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENEACTIONCOALESCER_H
+#define RAMSES_SCENEACTIONCOALESCER_H
+
+#include "SceneActionCollection.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    // Removes scene actions which do not contribute to the scene state reached after applying the whole collection:
+    // - setters which fully overwrite a value (same object, field and element count) only keep their last occurrence
+    // - objects which are allocated and released again within the collection are dropped together with their setters,
+    //   this is only done for object types which cannot be referenced by any other scene action (transforms, pickable objects, blit passes)
+    // The relative order of the remaining actions is preserved.
+    class SceneActionCoalescer
+    {
+    public:
+        static SceneActionCollection CoalesceActions(const SceneActionCollection& actions);
+
+    private:
+        static void MarkOverwrittenSetters(const SceneActionCollection& actions, std::vector<bool>& dropAction);
+        static void MarkCancelledAllocations(const SceneActionCollection& actions, std::vector<bool>& dropAction);
+    };
+}
+
+#endif
@@ -25,10 +25,18 @@ namespace ramses_internal
         static void WriteSceneMetadataToStream(IOutputStream& outStream, const IScene& scene);
         static void WriteSceneToStream(IOutputStream& outStream, const ClientScene& scene);
         static void WriteSceneToFile(std::string_view filename, const ClientScene& scene);
+        static void WriteSceneSnapshotToStream(IOutputStream& outStream, const ClientScene& scene);
 
         static void ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo);
-        static void ReadSceneFromStream(IInputStream& inStream, IScene& scene);
+        static bool ReadSceneFromStream(IInputStream& inStream, IScene& scene);
         static void ReadSceneFromFile(std::string_view filename, IScene& scene);
+
+        // accepts scene actions as well as snapshot format, which can only be read into client scene,
+        // scene is left unchanged if snapshot cannot be read completely
+        static bool ReadSceneFromStream(IInputStream& inStream, ClientScene& scene);
+
+    private:
+        static bool ReadSceneActionsFromStream(IInputStream& inStream, IScene& scene);
     };
 }
 
@@ -0,0 +1,38 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SCENESNAPSHOT_H
+#define RAMSES_SCENESNAPSHOT_H
+
+#include <cstdint>
+
+namespace ramses_internal
+{
+    class ClientScene;
+    class IOutputStream;
+    class IInputStream;
+
+    // Binary scene format which stores the memory pools of a scene directly instead of scene actions recreating it.
+    // Every pool is written as one block: block id, element size, pool size, allocation state of all handles and all elements.
+    // Objects refer to each other by handles only, so the blocks do not depend on memory addresses and pools of trivially
+    // copyable elements are written and read back with a single copy. Other elements are serialized field by field.
+    // The element size of trivially copyable pools is part of the block, a snapshot is only readable by the same format version
+    // and element layout, i.e. it is meant for fast loading on the target it was created for.
+    class SceneSnapshot
+    {
+    public:
+        static void WriteToStream(IOutputStream& outStream, const ClientScene& scene);
+        // scene must be empty, derived scene state (transformation cache, collected actions and resource changes) is rebuilt after reading,
+        // whole snapshot is decoded and validated before the scene is modified, scene stays empty if reading fails
+        static bool ReadFromStream(IInputStream& inStream, ClientScene& scene);
+
+        static constexpr uint32_t FormatVersion = 3u;
+    };
+}
+
+#endif
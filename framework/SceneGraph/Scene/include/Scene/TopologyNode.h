@@ -15,10 +15,14 @@
 
 namespace ramses_internal
 {
+    // Children of all nodes are stored packed in a single array owned by the scene,
+    // node refers to its children by range within that array (see SceneT::getChildren).
     struct TopologyNode
     {
-        NodeHandleVector children;
         NodeHandle       parent;
+        uint32_t         childrenOffset = 0u;
+        uint32_t         childrenCount = 0u;
+        uint32_t         childrenCapacity = 0u;
     };
 
     ASSERT_MOVABLE(TopologyNode)
@@ -13,10 +13,13 @@
 #include "Scene/MatrixCacheEntry.h"
 #include "Utils/MemoryPool.h"
 #include "Utils/MemoryPoolExplicit.h"
+#include "Common/DenseHandleMap.h"
 #include "PlatformAbstraction/PlatformTypes.h"
 
 namespace ramses_internal
 {
+    class ParallelForExecutor;
+
     template <template<typename, typename> class MEMORYPOOL>
     class TransformationCachedSceneT;
 
@@ -48,7 +51,15 @@ namespace ramses_internal
         glm::mat4                       updateMatrixCache(ETransformationMatrixType matrixType, NodeHandle node) const;
         bool                            isMatrixCacheDirty(ETransformationMatrixType matrixType, NodeHandle node) const;
 
+        // Batch version of updateMatrixCache for many nodes, matrices are then available via getCachedMatrix.
+        // Dirty nodes are collected only once and grouped by their depth below the closest clean ancestor,
+        // all nodes of one depth level are independent and are computed in parallel if executor is provided.
+        void                            updateMatrixCacheForNodes(ETransformationMatrixType matrixType, const NodeHandleVector& nodes, ParallelForExecutor* executor = nullptr) const;
+        const glm::mat4&                getCachedMatrix(ETransformationMatrixType matrixType, NodeHandle node) const;
+
     protected:
+        void                        onRestoredFromSnapshot() override;
+
         MatrixCacheEntry&           getMatrixCacheEntry(NodeHandle nodeHandle) const;
         bool                        markDirty(NodeHandle node) const;
 
@@ -66,16 +77,27 @@ namespace ramses_internal
         void                        computeWorldMatrixForNode(NodeHandle node, glm::mat4& chainMatrix) const;
         void                        computeObjectMatrixForNode(NodeHandle node, glm::mat4& chainMatrix) const;
         void                        propagateDirty(NodeHandle node) const;
+        void                        collectDirtyNodesByLevel(ETransformationMatrixType matrixType, const NodeHandleVector& nodes) const;
+        void                        updateMatrixCacheForLevelNodes(ETransformationMatrixType matrixType, size_t begin, size_t end) const;
 
         // Cache
         using MatrixCachePool = MEMORYPOOL<MatrixCacheEntry, NodeHandle>;
         mutable MatrixCachePool m_matrixCachePool;
 
-        HashMap<NodeHandle, TransformHandle> m_nodeToTransformMap;
+        DenseHandleMap<NodeHandle, TransformHandle> m_nodeToTransformMap;
 
         // to avoid memory allocations the pool for dirty nodes is member variable
         // even though it is used in the scope of matrix cache update only
         mutable NodeHandleVector m_dirtyNodes;
+
+        // scratch data of updateMatrixCacheForNodes, dirty nodes stored level by level (breadth first)
+        // with offsets where each level starts, node levels are only valid for nodes marked with current visit stamp
+        mutable NodeHandleVector      m_levelizedDirtyNodes;
+        mutable std::vector<size_t>   m_levelOffsets;
+        mutable std::vector<size_t>   m_levelInsertPositions;
+        mutable std::vector<uint32_t> m_nodeLevels;
+        mutable std::vector<uint32_t> m_nodeVisitStamps;
+        mutable uint32_t              m_visitStamp = 0u;
     };
 }
 
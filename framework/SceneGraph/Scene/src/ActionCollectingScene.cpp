@@ -7,6 +7,7 @@
 //  -------------------------------------------------------------------------
 
 #include "Scene/ActionCollectingScene.h"
+#include "Scene/SceneDescriber.h"
 
 namespace ramses_internal
 {
@@ -23,6 +24,13 @@ namespace ramses_internal
         m_creator.preallocateSceneSize(sizeInfo);
     }
 
+    void ActionCollectingScene::onRestoredFromSnapshot()
+    {
+        ResourceChangeCollectingScene::onRestoredFromSnapshot();
+        // restored content was not created through scene API, describe it so that it is sent with next flush
+        SceneDescriber::describeScene<IScene>(*this, m_creator);
+    }
+
     void ActionCollectingScene::setDataResource(DataInstanceHandle containerHandle, DataFieldHandle field, const ResourceContentHash& hash, DataBufferHandle dataBuffer, uint32_t instancingDivisor, uint16_t offsetWithinElementInBytes, uint16_t stride)
     {
         ResourceChangeCollectingScene::setDataResource(containerHandle, field, hash, dataBuffer, instancingDivisor, offsetWithinElementInBytes, stride);
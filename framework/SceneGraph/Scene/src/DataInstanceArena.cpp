@@ -0,0 +1,119 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/DataInstanceArena.h"
+#include "PlatformAbstraction/PlatformMemory.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    Byte* DataInstanceArena::allocate(DataLayoutHandle layout, uint32_t size)
+    {
+        if (size == 0u)
+            return nullptr;
+
+        Slab& slab = getOrCreateSlab(layout, GetAlignedPayloadSize(size));
+        Byte* payload = AllocateFromSlab(slab);
+        PlatformMemory::Set(payload, 0, size);
+        return payload;
+    }
+
+    void DataInstanceArena::release(DataLayoutHandle layout, uint32_t size, Byte* payload)
+    {
+        if (size == 0u)
+            return;
+
+        assert(layout.asMemoryHandle() < m_slabsPerLayout.size());
+        const uint32_t payloadSize = GetAlignedPayloadSize(size);
+        auto& slabs = m_slabsPerLayout[layout.asMemoryHandle()];
+        const auto slabIt = std::find_if(slabs.begin(), slabs.end(), [payloadSize](const Slab& slab) { return slab.payloadSize == payloadSize; });
+        assert(slabIt != slabs.end());
+        assert(slabIt->usedPayloadCount > 0u);
+
+        --slabIt->usedPayloadCount;
+        slabIt->releasedPayloads.push_back(payload);
+    }
+
+    void DataInstanceArena::releaseLayout(DataLayoutHandle layout)
+    {
+        if (layout.asMemoryHandle() >= m_slabsPerLayout.size())
+            return;
+
+        auto& slabs = m_slabsPerLayout[layout.asMemoryHandle()];
+        slabs.erase(std::remove_if(slabs.begin(), slabs.end(), [](const Slab& slab) { return slab.usedPayloadCount == 0u; }), slabs.end());
+    }
+
+    uint32_t DataInstanceArena::getPayloadCount(DataLayoutHandle layout) const
+    {
+        if (layout.asMemoryHandle() >= m_slabsPerLayout.size())
+            return 0u;
+
+        uint32_t count = 0u;
+        for (const auto& slab : m_slabsPerLayout[layout.asMemoryHandle()])
+            count += slab.usedPayloadCount;
+        return count;
+    }
+
+    uint32_t DataInstanceArena::getChunkCount() const
+    {
+        size_t count = 0u;
+        for (const auto& slabs : m_slabsPerLayout)
+        {
+            for (const auto& slab : slabs)
+                count += slab.chunks.size();
+        }
+        return static_cast<uint32_t>(count);
+    }
+
+    uint32_t DataInstanceArena::GetAlignedPayloadSize(uint32_t size)
+    {
+        return (size + PayloadAlignment - 1u) / PayloadAlignment * PayloadAlignment;
+    }
+
+    DataInstanceArena::Slab& DataInstanceArena::getOrCreateSlab(DataLayoutHandle layout, uint32_t payloadSize)
+    {
+        if (layout.asMemoryHandle() >= m_slabsPerLayout.size())
+            m_slabsPerLayout.resize(layout.asMemoryHandle() + 1u);
+
+        auto& slabs = m_slabsPerLayout[layout.asMemoryHandle()];
+        const auto slabIt = std::find_if(slabs.begin(), slabs.end(), [payloadSize](const Slab& slab) { return slab.payloadSize == payloadSize; });
+        if (slabIt != slabs.end())
+            return *slabIt;
+
+        slabs.emplace_back();
+        slabs.back().payloadSize = payloadSize;
+        return slabs.back();
+    }
+
+    Byte* DataInstanceArena::AllocateFromSlab(Slab& slab)
+    {
+        ++slab.usedPayloadCount;
+        if (!slab.releasedPayloads.empty())
+        {
+            Byte* payload = slab.releasedPayloads.back();
+            slab.releasedPayloads.pop_back();
+            return payload;
+        }
+
+        if (slab.usedSlotsInLastChunk == slab.lastChunkCapacity)
+        {
+            // double capacity with every chunk, but keep single chunk reasonably small for large payloads
+            const uint32_t maxChunkPayloadCount = std::max(1u, MaxChunkSizeInBytes / slab.payloadSize);
+            const uint32_t chunkPayloadCount = std::min(std::max(MinChunkPayloadCount, slab.capacity), maxChunkPayloadCount);
+            slab.chunks.push_back(std::make_unique<Byte[]>(static_cast<size_t>(chunkPayloadCount) * slab.payloadSize));
+            slab.capacity += chunkPayloadCount;
+            slab.lastChunkCapacity = chunkPayloadCount;
+            slab.usedSlotsInLastChunk = 0u;
+        }
+
+        Byte* payload = slab.chunks.back().get() + static_cast<size_t>(slab.usedSlotsInLastChunk) * slab.payloadSize;
+        ++slab.usedSlotsInLastChunk;
+        return payload;
+    }
+}
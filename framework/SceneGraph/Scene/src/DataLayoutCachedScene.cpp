@@ -90,6 +90,34 @@ namespace ramses_internal
         return DataLayoutHandle::Invalid();
     }
 
+    void DataLayoutCachedScene::setNumDataLayoutReferences(DataLayoutHandle handle, uint32_t numReferences)
+    {
+        assert(numReferences > 0u);
+        const auto it = std::find_if(m_dataLayoutCache.begin(), m_dataLayoutCache.end(), [handle](const DataLayoutCacheGroup& a) { return a.contains(handle); });
+        assert(it != m_dataLayoutCache.end());
+        it->get(handle)->m_usageCount = numReferences;
+    }
+
+    void DataLayoutCachedScene::onRestoredFromSnapshot()
+    {
+        ActionCollectingScene::onRestoredFromSnapshot();
+
+        // every restored data layout is referenced once unless its references are restored as well
+        for (const auto& layout : getDataLayouts())
+        {
+            const DataFieldInfoVector& dataFields = layout.second->getDataFields();
+            const size_t fieldCount = dataFields.size();
+            if (m_dataLayoutCache.size() <= fieldCount)
+                m_dataLayoutCache.resize(fieldCount + 1u);
+
+            DataLayoutCacheEntry entry;
+            entry.m_dataFields = dataFields;
+            entry.m_usageCount = 1u;
+            entry.m_effectHash = layout.second->getEffectHash();
+            m_dataLayoutCache[fieldCount].put(layout.first, entry);
+        }
+    }
+
     uint32_t DataLayoutCachedScene::getNumDataLayoutReferences(DataLayoutHandle handle) const
     {
         const auto it = std::find_if(m_dataLayoutCache.cbegin(), m_dataLayoutCache.cend(), [handle](const DataLayoutCacheGroup& a) { return a.contains(handle); });
@@ -33,6 +33,30 @@ namespace ramses_internal
     }
 
 
+    void ResourceChangeCollectingScene::onRestoredFromSnapshot()
+    {
+        TransformationCachedScene::onRestoredFromSnapshot();
+
+        m_resourcesChanged = true;
+        for (const auto& blitPass : getBlitPasses())
+            m_sceneResourceActions.push_back({ blitPass.first.asMemoryHandle(), ESceneResourceAction_CreateBlitPass });
+        for (const auto& dataBuffer : getDataBuffers())
+        {
+            m_sceneResourceActions.push_back({ dataBuffer.first.asMemoryHandle(), ESceneResourceAction_CreateDataBuffer });
+            if (dataBuffer.second->usedSize > 0u)
+                m_sceneResourceActions.push_back({ dataBuffer.first.asMemoryHandle(), ESceneResourceAction_UpdateDataBuffer });
+        }
+        for (const auto& textureBuffer : getTextureBuffers())
+        {
+            m_sceneResourceActions.push_back({ textureBuffer.first.asMemoryHandle(), ESceneResourceAction_CreateTextureBuffer });
+            m_sceneResourceActions.push_back({ textureBuffer.first.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer });
+        }
+        for (const auto& renderBuffer : getRenderBuffers())
+            m_sceneResourceActions.push_back({ renderBuffer.first.asMemoryHandle(), ESceneResourceAction_CreateRenderBuffer });
+        for (const auto& renderTarget : getRenderTargets())
+            m_sceneResourceActions.push_back({ renderTarget.first.asMemoryHandle(), ESceneResourceAction_CreateRenderTarget });
+    }
+
     void ResourceChangeCollectingScene::releaseRenderable(RenderableHandle renderableHandle)
     {
         m_resourcesChanged = true;
@@ -14,9 +14,19 @@
 #include "SceneAPI/SceneSizeInformation.h"
 #include "SceneAPI/RenderGroupUtils.h"
 #include "PlatformAbstraction/PlatformMath.h"
+#include "absl/algorithm/container.h"
+#include <algorithm>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        // capacity of children range of node when first child is added
+        constexpr uint32_t MinNodeChildrenCapacity = 4u;
+        // small storage is not compacted, relocating few children ranges is cheaper than frequent compaction
+        constexpr uint32_t MinUnusedNodeChildrenToCompact = 1024u;
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     SceneT<MEMORYPOOL>::SceneT(const SceneInfo& sceneInfo)
         : m_name(sceneInfo.friendlyName)
@@ -872,9 +882,9 @@ namespace ramses_internal
         const DataLayout& layout = *m_dataLayoutMemory.getMemory(layoutHandle);
         const DataInstanceHandle containerHandle = m_dataInstanceMemory.allocate(instanceHandle);
 
-        uint32_t dataInstanceSize = layout.getTotalSize();
+        const uint32_t dataInstanceSize = layout.getTotalSize();
         DataInstance* instance = m_dataInstanceMemory.getMemory(containerHandle);
-        *instance = DataInstance(layoutHandle, dataInstanceSize);
+        *instance = DataInstance(layoutHandle, m_dataInstancePayloads.allocate(layoutHandle, dataInstanceSize), dataInstanceSize);
 
         // initialize data instance fields
         // TODO violin this can be generalized further, e.g. via templated static inplace contructor
@@ -921,7 +931,9 @@ namespace ramses_internal
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::releaseDataInstance(DataInstanceHandle containerHandle)
     {
-        assert(isDataLayoutAllocated(m_dataInstanceMemory.getMemory(containerHandle)->getLayoutHandle()));
+        const DataInstance& instance = *m_dataInstanceMemory.getMemory(containerHandle);
+        assert(isDataLayoutAllocated(instance.getLayoutHandle()));
+        m_dataInstancePayloads.release(instance.getLayoutHandle(), instance.getDataSize(), instance.getData());
         m_dataInstanceMemory.release(containerHandle);
     }
 
@@ -929,6 +941,7 @@ namespace ramses_internal
     void SceneT<MEMORYPOOL>::releaseDataLayout(DataLayoutHandle layoutHandle)
     {
         m_dataLayoutMemory.release(layoutHandle);
+        m_dataInstancePayloads.releaseLayout(layoutHandle);
     }
 
 
@@ -965,9 +978,14 @@ namespace ramses_internal
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::addChildToNode(NodeHandle parent, NodeHandle child)
     {
+        assert(!absl::c_linear_search(getChildren(parent), child));
+        const TopologyNode& node = *m_nodes.getMemory(parent);
+        if (node.childrenCount == node.childrenCapacity)
+            reserveNodeChildren(parent, std::max(MinNodeChildrenCapacity, 2u * node.childrenCapacity));
+
         TopologyNode& parentNode = *m_nodes.getMemory(parent);
-        assert(!contains_c(parentNode.children, child));
-        parentNode.children.push_back(child);
+        m_nodeChildren[parentNode.childrenOffset + parentNode.childrenCount] = child;
+        ++parentNode.childrenCount;
         m_nodes.getMemory(child)->parent = parent;
     }
 
@@ -975,30 +993,79 @@ namespace ramses_internal
     void SceneT<MEMORYPOOL>::removeChildFromNode(NodeHandle parent, NodeHandle child)
     {
         TopologyNode& parentNode = *m_nodes.getMemory(parent);
-        const auto childIt = find_c(parentNode.children, child);
-        assert(childIt != parentNode.children.end());
-        parentNode.children.erase(childIt);
+        const auto childrenBegin = m_nodeChildren.begin() + parentNode.childrenOffset;
+        const auto childrenEnd = childrenBegin + parentNode.childrenCount;
+        const auto childIt = std::find(childrenBegin, childrenEnd, child);
+        assert(childIt != childrenEnd);
+        std::copy(childIt + 1, childrenEnd, childIt);
+        --parentNode.childrenCount;
         m_nodes.getMemory(child)->parent = NodeHandle::Invalid();
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     uint32_t SceneT<MEMORYPOOL>::getChildCount(NodeHandle parent) const
     {
-        return static_cast<uint32_t>(m_nodes.getMemory(parent)->children.size());
+        return m_nodes.getMemory(parent)->childrenCount;
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     NodeHandle SceneT<MEMORYPOOL>::getChild(NodeHandle parent, uint32_t childNumber) const
     {
         const TopologyNode& parentNode = *m_nodes.getMemory(parent);
-        assert(childNumber < parentNode.children.size());
-        return parentNode.children[childNumber];
+        assert(childNumber < parentNode.childrenCount);
+        return m_nodeChildren[parentNode.childrenOffset + childNumber];
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    absl::Span<const NodeHandle> SceneT<MEMORYPOOL>::getChildren(NodeHandle parent) const
+    {
+        const TopologyNode& parentNode = *m_nodes.getMemory(parent);
+        return absl::Span<const NodeHandle>(m_nodeChildren.data() + parentNode.childrenOffset, parentNode.childrenCount);
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::reserveNodeChildren(NodeHandle nodeHandle, uint32_t capacity)
+    {
+        if (m_unusedNodeChildrenCount >= MinUnusedNodeChildrenToCompact && m_unusedNodeChildrenCount >= m_nodeChildren.size() / 2u)
+            compactNodeChildren();
+
+        // children are moved to new range at the end of storage, old range stays unused until next compaction
+        TopologyNode& node = *m_nodes.getMemory(nodeHandle);
+        assert(capacity >= node.childrenCount);
+        const auto newOffset = static_cast<uint32_t>(m_nodeChildren.size());
+        m_nodeChildren.resize(m_nodeChildren.size() + capacity);
+        std::copy_n(m_nodeChildren.begin() + node.childrenOffset, node.childrenCount, m_nodeChildren.begin() + newOffset);
+
+        m_unusedNodeChildrenCount += node.childrenCapacity;
+        node.childrenOffset = newOffset;
+        node.childrenCapacity = capacity;
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void SceneT<MEMORYPOOL>::compactNodeChildren()
+    {
+        // children ranges are packed in order of node handles without spare capacity
+        NodeHandleVector compactedChildren;
+        compactedChildren.reserve(m_nodeChildren.size() - m_unusedNodeChildrenCount);
+        for (const auto& node : m_nodes)
+        {
+            TopologyNode& topologyNode = *node.second;
+            const auto childrenBegin = m_nodeChildren.cbegin() + topologyNode.childrenOffset;
+            topologyNode.childrenOffset = static_cast<uint32_t>(compactedChildren.size());
+            topologyNode.childrenCapacity = topologyNode.childrenCount;
+            compactedChildren.insert(compactedChildren.end(), childrenBegin, childrenBegin + topologyNode.childrenCount);
+        }
+
+        m_nodeChildren.swap(compactedChildren);
+        m_unusedNodeChildrenCount = 0u;
     }
 
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::preallocateSceneSize(const SceneSizeInformation& sizeInfo)
     {
         m_nodes.preallocateSize(sizeInfo.nodeCount);
+        // every node is child of at most one parent
+        m_nodeChildren.reserve(sizeInfo.nodeCount);
         m_cameras.preallocateSize(sizeInfo.cameraCount);
         m_renderables.preallocateSize(sizeInfo.renderableCount);
         m_states.preallocateSize(sizeInfo.renderStateCount);
@@ -1098,7 +1165,8 @@ namespace ramses_internal
     NodeHandle SceneT<MEMORYPOOL>::allocateNode(uint32_t childrenCount, NodeHandle handle)
     {
         const NodeHandle actualHandle = m_nodes.allocate(handle);
-        m_nodes.getMemory(actualHandle)->children.reserve(childrenCount);
+        if (childrenCount > 0u)
+            reserveNodeChildren(actualHandle, childrenCount);
         return actualHandle;
     }
 
@@ -1114,6 +1182,7 @@ namespace ramses_internal
     template <template<typename, typename> class MEMORYPOOL>
     void SceneT<MEMORYPOOL>::releaseNode(NodeHandle nodeHandle)
     {
+        m_unusedNodeChildrenCount += m_nodes.getMemory(nodeHandle)->childrenCapacity;
         m_nodes.release(nodeHandle);
     }
 
@@ -0,0 +1,287 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/SceneActionCoalescer.h"
+#include "SceneAPI/Handles.h"
+#include "SceneAPI/SceneTypes.h"
+#include <array>
+#include <unordered_map>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        constexpr uint32_t MaxSetterKeyWords = 3u;
+
+        // Number of leading 32 bit words of a setter action which identify the value it sets (object handle, field, element count),
+        // all remaining data is the value itself and fully overwrites the previous one. Zero for all other actions.
+        uint32_t GetSetterKeyWordCount(ESceneActionId type)
+        {
+            switch (type)
+            {
+            case ESceneActionId::SetTranslation:
+            case ESceneActionId::SetRotation:
+            case ESceneActionId::SetScaling:
+            case ESceneActionId::SetRenderableStartIndex:
+            case ESceneActionId::SetRenderableIndexCount:
+            case ESceneActionId::SetRenderableVisibility:
+            case ESceneActionId::SetRenderableInstanceCount:
+            case ESceneActionId::SetRenderableStartVertex:
+            case ESceneActionId::SetRenderableState:
+            case ESceneActionId::SetStateStencilOps:
+            case ESceneActionId::SetStateStencilFunc:
+            case ESceneActionId::SetStateDepthWrite:
+            case ESceneActionId::SetStateDepthFunc:
+            case ESceneActionId::SetStateScissorTest:
+            case ESceneActionId::SetStateCullMode:
+            case ESceneActionId::SetStateDrawMode:
+            case ESceneActionId::SetStateBlendOperations:
+            case ESceneActionId::SetStateBlendFactors:
+            case ESceneActionId::SetStateBlendColor:
+            case ESceneActionId::SetStateColorWriteMask:
+            case ESceneActionId::SetRenderPassClearColor:
+            case ESceneActionId::SetRenderPassClearFlag:
+            case ESceneActionId::SetRenderPassCamera:
+            case ESceneActionId::SetRenderPassRenderTarget:
+            case ESceneActionId::SetRenderPassRenderOrder:
+            case ESceneActionId::SetRenderPassEnabled:
+            case ESceneActionId::SetBlitPassRenderOrder:
+            case ESceneActionId::SetBlitPassEnabled:
+            case ESceneActionId::SetBlitPassRegions:
+            case ESceneActionId::SetPickableObjectId:
+            case ESceneActionId::SetPickableObjectCamera:
+            case ESceneActionId::SetPickableObjectEnabled:
+            case ESceneActionId::SetDataSlotTexture:
+            case ESceneActionId::SetSceneReferenceRenderOrder:
+                return 1u;
+            case ESceneActionId::SetRenderableDataInstance:
+            case ESceneActionId::SetDataResource:
+            case ESceneActionId::SetDataTextureSamplerHandle:
+            case ESceneActionId::SetDataReference:
+                return 2u;
+            case ESceneActionId::SetDataIntegerArray:
+            case ESceneActionId::SetDataFloatArray:
+            case ESceneActionId::SetDataVector2fArray:
+            case ESceneActionId::SetDataVector3fArray:
+            case ESceneActionId::SetDataVector4fArray:
+            case ESceneActionId::SetDataVector2iArray:
+            case ESceneActionId::SetDataVector3iArray:
+            case ESceneActionId::SetDataVector4iArray:
+            case ESceneActionId::SetDataMatrix22fArray:
+            case ESceneActionId::SetDataMatrix33fArray:
+            case ESceneActionId::SetDataMatrix44fArray:
+                return 3u;
+            default:
+                return 0u;
+            }
+        }
+
+        struct SetterKey
+        {
+            ESceneActionId type;
+            std::array<uint32_t, MaxSetterKeyWords> words;
+
+            bool operator==(const SetterKey& other) const
+            {
+                return type == other.type && words == other.words;
+            }
+        };
+
+        struct SetterKeyHash
+        {
+            size_t operator()(const SetterKey& key) const
+            {
+                size_t hash = static_cast<size_t>(key.type);
+                for (const auto word : key.words)
+                    hash = hash * 31u + word;
+                return hash;
+            }
+        };
+
+        // Object types whose handle is used only by their own allocate, release and setter actions,
+        // the allocate action id identifies the object type
+        ESceneActionId GetObjectTypeOfSetter(ESceneActionId type)
+        {
+            switch (type)
+            {
+            case ESceneActionId::SetTranslation:
+            case ESceneActionId::SetRotation:
+            case ESceneActionId::SetScaling:
+                return ESceneActionId::AllocateTransform;
+            case ESceneActionId::SetPickableObjectId:
+            case ESceneActionId::SetPickableObjectCamera:
+            case ESceneActionId::SetPickableObjectEnabled:
+                return ESceneActionId::AllocatePickableObject;
+            case ESceneActionId::SetBlitPassRenderOrder:
+            case ESceneActionId::SetBlitPassEnabled:
+            case ESceneActionId::SetBlitPassRegions:
+                return ESceneActionId::AllocateBlitPass;
+            default:
+                return ESceneActionId::Incomplete;
+            }
+        }
+
+        ESceneActionId GetObjectTypeOfRelease(ESceneActionId type)
+        {
+            switch (type)
+            {
+            case ESceneActionId::ReleaseTransform:
+                return ESceneActionId::AllocateTransform;
+            case ESceneActionId::ReleasePickableObject:
+                return ESceneActionId::AllocatePickableObject;
+            case ESceneActionId::ReleaseBlitPass:
+                return ESceneActionId::AllocateBlitPass;
+            default:
+                return ESceneActionId::Incomplete;
+            }
+        }
+
+        MemoryHandle ReadAllocatedHandle(SceneActionCollection::SceneActionReader action)
+        {
+            switch (action.type())
+            {
+            case ESceneActionId::AllocateTransform:
+            {
+                NodeHandle nodeHandle;
+                TransformHandle transformHandle;
+                action.read(nodeHandle);
+                action.read(transformHandle);
+                return transformHandle.asMemoryHandle();
+            }
+            case ESceneActionId::AllocatePickableObject:
+            {
+                DataBufferHandle geometryHandle;
+                NodeHandle nodeHandle;
+                PickableObjectId id;
+                PickableObjectHandle pickableHandle;
+                action.read(geometryHandle);
+                action.read(nodeHandle);
+                action.read(id);
+                action.read(pickableHandle);
+                return pickableHandle.asMemoryHandle();
+            }
+            case ESceneActionId::AllocateBlitPass:
+            {
+                RenderBufferHandle sourceRenderBufferHandle;
+                RenderBufferHandle destinationRenderBufferHandle;
+                BlitPassHandle passHandle;
+                action.read(sourceRenderBufferHandle);
+                action.read(destinationRenderBufferHandle);
+                action.read(passHandle);
+                return passHandle.asMemoryHandle();
+            }
+            default:
+                return InvalidMemoryHandle;
+            }
+        }
+
+        MemoryHandle ReadFirstHandle(SceneActionCollection::SceneActionReader action)
+        {
+            MemoryHandle handle = InvalidMemoryHandle;
+            action.read(handle);
+            return handle;
+        }
+
+        uint64_t GetObjectKey(ESceneActionId objectType, MemoryHandle handle)
+        {
+            return (static_cast<uint64_t>(objectType) << 32u) | handle;
+        }
+    }
+
+    SceneActionCollection SceneActionCoalescer::CoalesceActions(const SceneActionCollection& actions)
+    {
+        const uint32_t numActions = actions.numberOfActions();
+        std::vector<bool> dropAction(numActions, false);
+        MarkOverwrittenSetters(actions, dropAction);
+        MarkCancelledAllocations(actions, dropAction);
+
+        SceneActionCollection result(actions.collectionData().size(), numActions);
+        for (uint32_t i = 0u; i < numActions; ++i)
+        {
+            if (dropAction[i])
+                continue;
+
+            const auto action = actions[i];
+            result.addRawSceneActionInformation(action.type(), static_cast<uint32_t>(result.collectionData().size()));
+            result.appendRawData(action.data(), action.size());
+        }
+
+        return result;
+    }
+
+    void SceneActionCoalescer::MarkOverwrittenSetters(const SceneActionCollection& actions, std::vector<bool>& dropAction)
+    {
+        std::unordered_map<SetterKey, uint32_t, SetterKeyHash> lastSetterIndex;
+        for (uint32_t i = 0u; i < actions.numberOfActions(); ++i)
+        {
+            auto action = actions[i];
+            const uint32_t keyWordCount = GetSetterKeyWordCount(action.type());
+            if (keyWordCount == 0u)
+                continue;
+
+            SetterKey key{ action.type(), {} };
+            for (uint32_t word = 0u; word < keyWordCount; ++word)
+                action.read(key.words[word]);
+
+            const auto it = lastSetterIndex.find(key);
+            if (it != lastSetterIndex.end())
+            {
+                dropAction[it->second] = true;
+                it->second = i;
+            }
+            else
+                lastSetterIndex.emplace(key, i);
+        }
+    }
+
+    void SceneActionCoalescer::MarkCancelledAllocations(const SceneActionCollection& actions, std::vector<bool>& dropAction)
+    {
+        struct AllocatedObject
+        {
+            uint32_t allocateIndex;
+            std::vector<uint32_t> setterIndices;
+        };
+        std::unordered_map<uint64_t, AllocatedObject> allocatedObjects;
+
+        for (uint32_t i = 0u; i < actions.numberOfActions(); ++i)
+        {
+            const auto action = actions[i];
+            const ESceneActionId type = action.type();
+
+            const MemoryHandle allocatedHandle = ReadAllocatedHandle(action);
+            if (allocatedHandle != InvalidMemoryHandle)
+            {
+                allocatedObjects[GetObjectKey(type, allocatedHandle)] = { i, {} };
+                continue;
+            }
+
+            const ESceneActionId setterObjectType = GetObjectTypeOfSetter(type);
+            if (setterObjectType != ESceneActionId::Incomplete)
+            {
+                const auto it = allocatedObjects.find(GetObjectKey(setterObjectType, ReadFirstHandle(action)));
+                if (it != allocatedObjects.end())
+                    it->second.setterIndices.push_back(i);
+                continue;
+            }
+
+            const ESceneActionId releasedObjectType = GetObjectTypeOfRelease(type);
+            if (releasedObjectType != ESceneActionId::Incomplete)
+            {
+                const auto it = allocatedObjects.find(GetObjectKey(releasedObjectType, ReadFirstHandle(action)));
+                if (it != allocatedObjects.end())
+                {
+                    dropAction[it->second.allocateIndex] = true;
+                    for (const auto setterIndex : it->second.setterIndices)
+                        dropAction[setterIndex] = true;
+                    dropAction[i] = true;
+                    allocatedObjects.erase(it);
+                }
+            }
+        }
+    }
+}
@@ -10,6 +10,7 @@
 #include "SceneAPI/SceneCreationInformation.h"
 #include "Scene/SceneActionApplier.h"
 #include "Scene/SceneDescriber.h"
+#include "Scene/SceneSnapshot.h"
 #include "Scene/SceneActionCollectionCreator.h"
 #include "Utils/File.h"
 #include "Utils/BinaryFileOutputStream.h"
@@ -22,6 +23,7 @@
 namespace ramses_internal
 {
     static const uint32_t gSceneMarker = 0x534d4152;  // {'R', 'A', 'M', 'S'}
+    static const uint32_t gSceneSnapshotMarker = 0x504d4152;  // {'R', 'A', 'M', 'P'}
 
     void ScenePersistation::ReadSceneMetadataFromStream(IInputStream& inStream, SceneCreationInformation& createInfo)
     {
@@ -96,6 +98,12 @@ namespace ramses_internal
         }
     }
 
+    void ScenePersistation::WriteSceneSnapshotToStream(IOutputStream& outStream, const ClientScene& scene)
+    {
+        outStream << static_cast<uint32_t>(gSceneSnapshotMarker);
+        SceneSnapshot::WriteToStream(outStream, scene);
+    }
+
     void ScenePersistation::WriteSceneToFile(std::string_view filename, const ClientScene& scene)
     {
         File f(filename);
@@ -111,16 +119,43 @@ namespace ramses_internal
         }
     }
 
-    void ScenePersistation::ReadSceneFromStream(IInputStream& inStream, IScene& scene)
+    bool ScenePersistation::ReadSceneFromStream(IInputStream& inStream, IScene& scene)
+    {
+        uint32_t sceneMarker = 0;
+        inStream >> sceneMarker;
+        if (sceneMarker != gSceneMarker)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
+            return false;
+        }
+
+        return ReadSceneActionsFromStream(inStream, scene);
+    }
+
+    bool ScenePersistation::ReadSceneFromStream(IInputStream& inStream, ClientScene& scene)
     {
         uint32_t sceneMarker = 0;
         inStream >> sceneMarker;
+        if (sceneMarker == gSceneSnapshotMarker)
+        {
+            if (!SceneSnapshot::ReadFromStream(inStream, scene))
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene snapshot from file");
+                return false;
+            }
+            return true;
+        }
         if (sceneMarker != gSceneMarker)
         {
             LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not load scene from file, its not marked as a scene");
-            return;
+            return false;
         }
 
+        return ReadSceneActionsFromStream(inStream, scene);
+    }
+
+    bool ScenePersistation::ReadSceneActionsFromStream(IInputStream& inStream, IScene& scene)
+    {
         uint32_t numberOfSceneActionsToRead = 0;
         inStream >> numberOfSceneActionsToRead;
         uint32_t sizeOfAllSceneActions = 0;
@@ -131,7 +166,8 @@ namespace ramses_internal
         // read data
         std::vector<Byte>& rawActionData = actions.getRawDataForDirectWriting();
         rawActionData.resize(sizeOfAllSceneActions);
-        inStream.read(rawActionData.data(), rawActionData.size());
+        if (!rawActionData.empty())
+            inStream.read(rawActionData.data(), rawActionData.size());
 
         std::array<uint32_t, NumOfSceneActionTypes> objectCounts = {};
 
@@ -145,6 +181,11 @@ namespace ramses_internal
             actions.addRawSceneActionInformation(static_cast<ESceneActionId>(actionType), offsetInCollection);
             ++objectCounts[actionType];
         }
+        if (inStream.getState() != EStatus::Ok)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "ScenePersistation::ReadSceneFromStream:  could not read scene actions from file");
+            return false;
+        }
 
         LOG_DEBUG_F(ramses_internal::CONTEXT_PROFILING, ([&](ramses_internal::StringOutputStream& sos) {
                     sos << "ScenePersistation::ReadSceneFromStream: SceneAction type counts for SceneID " << scene.getSceneId() << " (total: " << numberOfSceneActionsToRead << ")\n";
@@ -158,6 +199,7 @@ namespace ramses_internal
                 }));
 
         SceneActionApplier::ApplyActionsOnScene(scene, actions);
+        return true;
     }
 
     void ScenePersistation::ReadSceneFromFile(std::string_view filename, IScene& scene)
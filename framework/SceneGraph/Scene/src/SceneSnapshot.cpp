@@ -0,0 +1,778 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Scene/SceneSnapshot.h"
+#include "Scene/ClientScene.h"
+#include "Collections/IOutputStream.h"
+#include "Collections/IInputStream.h"
+#include "Utils/LogMacros.h"
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+#include <cassert>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        enum class ESnapshotBlock : uint32_t
+        {
+            Nodes = 0,
+            Cameras,
+            Renderables,
+            RenderStates,
+            Transforms,
+            DataLayouts,
+            DataInstances,
+            RenderGroups,
+            RenderPasses,
+            BlitPasses,
+            PickableObjects,
+            RenderTargets,
+            RenderBuffers,
+            TextureSamplers,
+            DataBuffers,
+            TextureBuffers,
+            DataSlots,
+            SceneReferences,
+            DataLayoutReferences,
+            NodeChildren
+        };
+
+        template <typename T>
+        struct DecodedPool
+        {
+            std::vector<T> objects;
+            std::vector<uint8_t> allocationFlags;
+        };
+
+        // state shared by decoding of all blocks, nothing is moved to the scene before the whole snapshot was decoded and validated
+        struct SnapshotReadContext
+        {
+            DataInstanceArena payloads;
+            // data instances are validated against the layouts decoded before them
+            const DecodedPool<DataLayout>* dataLayouts = nullptr;
+            bool isValid = true;
+        };
+
+        // all elements are serialized field by field, so that snapshot content does not depend on struct layout of the compiler
+        // and never contains uninitialized padding; only arrays of arithmetic values are written as raw memory
+        template <typename T>
+        void WriteValue(IOutputStream& outStream, const T& value)
+        {
+            outStream << value;
+        }
+
+        template <typename T>
+        void ReadValue(IInputStream& inStream, T& value)
+        {
+            inStream >> value;
+        }
+
+        // non-strongly typed enums have no defined size, they are stored as 32 bit values
+        template <typename E>
+        void WriteEnum(IOutputStream& outStream, E value)
+        {
+            static_assert(std::is_enum_v<E>, "only enums can be written as 32 bit values");
+            outStream << static_cast<uint32_t>(value);
+        }
+
+        template <typename E>
+        void ReadEnum(IInputStream& inStream, E& value)
+        {
+            static_assert(std::is_enum_v<E>, "only enums can be read from 32 bit values");
+            uint32_t rawValue = 0u;
+            inStream >> rawValue;
+            value = static_cast<E>(rawValue);
+        }
+
+        template <typename BaseType, BaseType DefaultValue, typename UniqueId>
+        void WriteValue(IOutputStream& outStream, const StronglyTypedValue<BaseType, DefaultValue, UniqueId>& value)
+        {
+            outStream << value.getValue();
+        }
+
+        template <typename BaseType, BaseType DefaultValue, typename UniqueId>
+        void ReadValue(IInputStream& inStream, StronglyTypedValue<BaseType, DefaultValue, UniqueId>& value)
+        {
+            inStream >> value.getReference();
+        }
+
+        template <glm::length_t L>
+        void WriteValue(IOutputStream& outStream, const glm::vec<L, float>& value)
+        {
+            for (glm::length_t i = 0; i < L; ++i)
+                outStream << value[i];
+        }
+
+        template <glm::length_t L>
+        void ReadValue(IInputStream& inStream, glm::vec<L, float>& value)
+        {
+            for (glm::length_t i = 0; i < L; ++i)
+                inStream >> value[i];
+        }
+
+        void WriteValue(IOutputStream& outStream, const Quad& quad)
+        {
+            outStream << quad.x << quad.y << quad.width << quad.height;
+        }
+
+        void ReadValue(IInputStream& inStream, Quad& quad)
+        {
+            inStream >> quad.x >> quad.y >> quad.width >> quad.height;
+        }
+
+        void WriteValue(IOutputStream& outStream, const PixelRectangle& rectangle)
+        {
+            outStream << rectangle.x << rectangle.y << rectangle.width << rectangle.height;
+        }
+
+        void ReadValue(IInputStream& inStream, PixelRectangle& rectangle)
+        {
+            inStream >> rectangle.x >> rectangle.y >> rectangle.width >> rectangle.height;
+        }
+
+        void WriteValue(IOutputStream& outStream, const DataFieldInfo& field)
+        {
+            outStream << field.dataType << field.elementCount << field.semantics;
+        }
+
+        void ReadValue(IInputStream& inStream, DataFieldInfo& field)
+        {
+            inStream >> field.dataType >> field.elementCount >> field.semantics;
+        }
+
+        void WriteValue(IOutputStream& outStream, const RenderableOrderEntry& entry)
+        {
+            outStream << entry.renderable << entry.order;
+        }
+
+        void ReadValue(IInputStream& inStream, RenderableOrderEntry& entry)
+        {
+            inStream >> entry.renderable >> entry.order;
+        }
+
+        void WriteValue(IOutputStream& outStream, const RenderGroupOrderEntry& entry)
+        {
+            outStream << entry.renderGroup << entry.order;
+        }
+
+        void ReadValue(IInputStream& inStream, RenderGroupOrderEntry& entry)
+        {
+            inStream >> entry.renderGroup >> entry.order;
+        }
+
+        template <typename T>
+        void WriteVector(IOutputStream& outStream, const std::vector<T>& values)
+        {
+            outStream << static_cast<uint32_t>(values.size());
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                if (!values.empty())
+                    outStream.write(values.data(), values.size() * sizeof(T));
+            }
+            else
+            {
+                for (const auto& value : values)
+                    WriteValue(outStream, value);
+            }
+        }
+
+        template <typename T>
+        void ReadVector(IInputStream& inStream, std::vector<T>& values)
+        {
+            uint32_t size = 0u;
+            inStream >> size;
+            if (inStream.getState() != EStatus::Ok)
+                return;
+            values.resize(size);
+            if constexpr (std::is_arithmetic_v<T>)
+            {
+                if (size > 0u)
+                    inStream.read(values.data(), size * sizeof(T));
+            }
+            else
+            {
+                for (auto& value : values)
+                    ReadValue(inStream, value);
+            }
+        }
+
+        void WriteElement(IOutputStream& outStream, const TopologyNode& node, const Scene& /*scene*/)
+        {
+            outStream << node.parent << node.childrenOffset << node.childrenCount << node.childrenCapacity;
+        }
+
+        void ReadElement(IInputStream& inStream, TopologyNode& node, SnapshotReadContext& /*context*/)
+        {
+            inStream >> node.parent >> node.childrenOffset >> node.childrenCount >> node.childrenCapacity;
+        }
+
+        void WriteElement(IOutputStream& outStream, const Camera& camera, const Scene& /*scene*/)
+        {
+            outStream << camera.projectionType << camera.node << camera.dataInstance;
+        }
+
+        void ReadElement(IInputStream& inStream, Camera& camera, SnapshotReadContext& /*context*/)
+        {
+            inStream >> camera.projectionType >> camera.node >> camera.dataInstance;
+        }
+
+        void WriteElement(IOutputStream& outStream, const Renderable& renderable, const Scene& /*scene*/)
+        {
+            outStream << renderable.node << renderable.visibilityMode;
+            outStream << renderable.startIndex << renderable.indexCount << renderable.instanceCount << renderable.startVertex;
+            for (const auto& dataInstance : renderable.dataInstances)
+                outStream << dataInstance;
+            outStream << renderable.renderState;
+        }
+
+        void ReadElement(IInputStream& inStream, Renderable& renderable, SnapshotReadContext& /*context*/)
+        {
+            inStream >> renderable.node >> renderable.visibilityMode;
+            inStream >> renderable.startIndex >> renderable.indexCount >> renderable.instanceCount >> renderable.startVertex;
+            for (auto& dataInstance : renderable.dataInstances)
+                inStream >> dataInstance;
+            inStream >> renderable.renderState;
+        }
+
+        void WriteElement(IOutputStream& outStream, const RenderState& state, const Scene& /*scene*/)
+        {
+            outStream << state.scissorRegion.x << state.scissorRegion.y << state.scissorRegion.width << state.scissorRegion.height;
+            WriteValue(outStream, state.blendColor);
+            outStream << state.blendFactorSrcColor << state.blendFactorDstColor << state.blendFactorSrcAlpha << state.blendFactorDstAlpha;
+            outStream << state.blendOperationColor << state.blendOperationAlpha;
+            outStream << state.colorWriteMask << state.cullMode << state.drawMode;
+            outStream << state.depthFunc << state.depthWrite << state.scissorTest;
+            outStream << state.stencilFunc << state.stencilOpFail << state.stencilOpDepthFail << state.stencilOpDepthPass;
+            outStream << state.stencilRefValue << state.stencilMask;
+        }
+
+        void ReadElement(IInputStream& inStream, RenderState& state, SnapshotReadContext& /*context*/)
+        {
+            inStream >> state.scissorRegion.x >> state.scissorRegion.y >> state.scissorRegion.width >> state.scissorRegion.height;
+            ReadValue(inStream, state.blendColor);
+            inStream >> state.blendFactorSrcColor >> state.blendFactorDstColor >> state.blendFactorSrcAlpha >> state.blendFactorDstAlpha;
+            inStream >> state.blendOperationColor >> state.blendOperationAlpha;
+            inStream >> state.colorWriteMask >> state.cullMode >> state.drawMode;
+            inStream >> state.depthFunc >> state.depthWrite >> state.scissorTest;
+            inStream >> state.stencilFunc >> state.stencilOpFail >> state.stencilOpDepthFail >> state.stencilOpDepthPass;
+            inStream >> state.stencilRefValue >> state.stencilMask;
+        }
+
+        void WriteElement(IOutputStream& outStream, const TopologyTransform& transform, const Scene& /*scene*/)
+        {
+            WriteValue(outStream, transform.translation);
+            WriteValue(outStream, transform.rotation);
+            WriteValue(outStream, transform.scaling);
+            outStream << transform.rotationType << transform.node;
+        }
+
+        void ReadElement(IInputStream& inStream, TopologyTransform& transform, SnapshotReadContext& /*context*/)
+        {
+            ReadValue(inStream, transform.translation);
+            ReadValue(inStream, transform.rotation);
+            ReadValue(inStream, transform.scaling);
+            inStream >> transform.rotationType >> transform.node;
+        }
+
+        void WriteElement(IOutputStream& outStream, const DataLayout& layout, const Scene& /*scene*/)
+        {
+            WriteVector(outStream, layout.getDataFields());
+            outStream << layout.getEffectHash();
+        }
+
+        void ReadElement(IInputStream& inStream, DataLayout& layout, SnapshotReadContext& /*context*/)
+        {
+            DataFieldInfoVector dataFields;
+            ReadVector(inStream, dataFields);
+            ResourceContentHash effectHash;
+            inStream >> effectHash;
+            layout.setDataFields(dataFields);
+            layout.setEffectHash(effectHash);
+        }
+
+        void WriteElement(IOutputStream& outStream, const DataInstance& dataInstance, const Scene& scene)
+        {
+            const uint32_t dataSize = scene.getDataLayout(dataInstance.getLayoutHandle()).getTotalSize();
+            outStream << dataInstance.getLayoutHandle();
+            outStream << dataSize;
+            if (dataSize > 0u)
+                outStream.write(dataInstance.getTypedDataPointer<Byte>(0u), dataSize);
+        }
+
+        void ReadElement(IInputStream& inStream, DataInstance& dataInstance, SnapshotReadContext& context)
+        {
+            DataLayoutHandle layoutHandle;
+            inStream >> layoutHandle;
+            uint32_t dataSize = 0u;
+            inStream >> dataSize;
+
+            const DecodedPool<DataLayout>& layouts = *context.dataLayouts;
+            const auto layoutIdx = layoutHandle.asMemoryHandle();
+            if (inStream.getState() != EStatus::Ok || layoutIdx >= layouts.objects.size() || layouts.allocationFlags[layoutIdx] == 0u
+                || layouts.objects[layoutIdx].getTotalSize() != dataSize)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: data instance refers to invalid data layout " << layoutHandle << " or has mismatching size " << dataSize);
+                context.isValid = false;
+                return;
+            }
+
+            dataInstance = DataInstance(layoutHandle, context.payloads.allocate(layoutHandle, dataSize), dataSize);
+            if (dataSize > 0u)
+                inStream.read(dataInstance.getData(), dataSize);
+        }
+
+        void WriteElement(IOutputStream& outStream, const RenderGroup& renderGroup, const Scene& /*scene*/)
+        {
+            WriteVector(outStream, renderGroup.renderables);
+            WriteVector(outStream, renderGroup.renderGroups);
+        }
+
+        void ReadElement(IInputStream& inStream, RenderGroup& renderGroup, SnapshotReadContext& /*context*/)
+        {
+            ReadVector(inStream, renderGroup.renderables);
+            ReadVector(inStream, renderGroup.renderGroups);
+        }
+
+        void WriteElement(IOutputStream& outStream, const RenderPass& renderPass, const Scene& /*scene*/)
+        {
+            outStream << renderPass.isEnabled;
+            outStream << renderPass.camera;
+            outStream << renderPass.renderTarget;
+            outStream << renderPass.renderOrder;
+            WriteValue(outStream, renderPass.clearColor);
+            outStream << renderPass.clearFlags;
+            outStream << renderPass.isRenderOnce;
+            WriteVector(outStream, renderPass.renderGroups);
+        }
+
+        void ReadElement(IInputStream& inStream, RenderPass& renderPass, SnapshotReadContext& /*context*/)
+        {
+            inStream >> renderPass.isEnabled;
+            inStream >> renderPass.camera;
+            inStream >> renderPass.renderTarget;
+            inStream >> renderPass.renderOrder;
+            ReadValue(inStream, renderPass.clearColor);
+            inStream >> renderPass.clearFlags;
+            inStream >> renderPass.isRenderOnce;
+            ReadVector(inStream, renderPass.renderGroups);
+        }
+
+        void WriteElement(IOutputStream& outStream, const RenderTarget& renderTarget, const Scene& /*scene*/)
+        {
+            WriteVector(outStream, renderTarget.renderBuffers);
+        }
+
+        void ReadElement(IInputStream& inStream, RenderTarget& renderTarget, SnapshotReadContext& /*context*/)
+        {
+            ReadVector(inStream, renderTarget.renderBuffers);
+        }
+
+        void WriteElement(IOutputStream& outStream, const GeometryDataBuffer& dataBuffer, const Scene& /*scene*/)
+        {
+            outStream << dataBuffer.bufferType;
+            outStream << dataBuffer.dataType;
+            outStream << dataBuffer.usedSize;
+            WriteVector(outStream, dataBuffer.data);
+        }
+
+        void ReadElement(IInputStream& inStream, GeometryDataBuffer& dataBuffer, SnapshotReadContext& /*context*/)
+        {
+            inStream >> dataBuffer.bufferType;
+            inStream >> dataBuffer.dataType;
+            inStream >> dataBuffer.usedSize;
+            ReadVector(inStream, dataBuffer.data);
+        }
+
+        void WriteElement(IOutputStream& outStream, const TextureBuffer& textureBuffer, const Scene& /*scene*/)
+        {
+            outStream << textureBuffer.textureFormat;
+            outStream << static_cast<uint32_t>(textureBuffer.mipMaps.size());
+            for (const auto& mip : textureBuffer.mipMaps)
+            {
+                outStream << mip.width;
+                outStream << mip.height;
+                WriteValue(outStream, mip.usedRegion);
+                WriteVector(outStream, mip.data);
+            }
+        }
+
+        void ReadElement(IInputStream& inStream, TextureBuffer& textureBuffer, SnapshotReadContext& /*context*/)
+        {
+            inStream >> textureBuffer.textureFormat;
+            uint32_t mipCount = 0u;
+            inStream >> mipCount;
+            textureBuffer.mipMaps.resize(mipCount);
+            for (auto& mip : textureBuffer.mipMaps)
+            {
+                inStream >> mip.width;
+                inStream >> mip.height;
+                ReadValue(inStream, mip.usedRegion);
+                ReadVector(inStream, mip.data);
+            }
+        }
+
+        void WriteElement(IOutputStream& outStream, const BlitPass& blitPass, const Scene& /*scene*/)
+        {
+            outStream << blitPass.isEnabled << blitPass.renderOrder << blitPass.sourceRenderBuffer << blitPass.destinationRenderBuffer;
+            WriteValue(outStream, blitPass.sourceRegion);
+            WriteValue(outStream, blitPass.destinationRegion);
+        }
+
+        void ReadElement(IInputStream& inStream, BlitPass& blitPass, SnapshotReadContext& /*context*/)
+        {
+            inStream >> blitPass.isEnabled >> blitPass.renderOrder >> blitPass.sourceRenderBuffer >> blitPass.destinationRenderBuffer;
+            ReadValue(inStream, blitPass.sourceRegion);
+            ReadValue(inStream, blitPass.destinationRegion);
+        }
+
+        void WriteElement(IOutputStream& outStream, const PickableObject& pickableObject, const Scene& /*scene*/)
+        {
+            outStream << pickableObject.geometryHandle << pickableObject.nodeHandle << pickableObject.cameraHandle;
+            WriteValue(outStream, pickableObject.id);
+            outStream << pickableObject.isEnabled;
+        }
+
+        void ReadElement(IInputStream& inStream, PickableObject& pickableObject, SnapshotReadContext& /*context*/)
+        {
+            inStream >> pickableObject.geometryHandle >> pickableObject.nodeHandle >> pickableObject.cameraHandle;
+            ReadValue(inStream, pickableObject.id);
+            inStream >> pickableObject.isEnabled;
+        }
+
+        void WriteElement(IOutputStream& outStream, const RenderBuffer& renderBuffer, const Scene& /*scene*/)
+        {
+            outStream << renderBuffer.width << renderBuffer.height;
+            WriteEnum(outStream, renderBuffer.type);
+            outStream << renderBuffer.format;
+            WriteEnum(outStream, renderBuffer.accessMode);
+            outStream << renderBuffer.sampleCount;
+        }
+
+        void ReadElement(IInputStream& inStream, RenderBuffer& renderBuffer, SnapshotReadContext& /*context*/)
+        {
+            inStream >> renderBuffer.width >> renderBuffer.height;
+            ReadEnum(inStream, renderBuffer.type);
+            inStream >> renderBuffer.format;
+            ReadEnum(inStream, renderBuffer.accessMode);
+            inStream >> renderBuffer.sampleCount;
+        }
+
+        void WriteElement(IOutputStream& outStream, const TextureSampler& sampler, const Scene& /*scene*/)
+        {
+            const TextureSamplerStates& states = sampler.states;
+            outStream << states.m_addressModeU << states.m_addressModeV << states.m_addressModeR;
+            outStream << states.m_minSamplingMode << states.m_magSamplingMode << states.m_anisotropyLevel;
+            outStream << sampler.contentType << sampler.textureResource << sampler.contentHandle;
+        }
+
+        void ReadElement(IInputStream& inStream, TextureSampler& sampler, SnapshotReadContext& /*context*/)
+        {
+            TextureSamplerStates& states = sampler.states;
+            inStream >> states.m_addressModeU >> states.m_addressModeV >> states.m_addressModeR;
+            inStream >> states.m_minSamplingMode >> states.m_magSamplingMode >> states.m_anisotropyLevel;
+            inStream >> sampler.contentType >> sampler.textureResource >> sampler.contentHandle;
+        }
+
+        void WriteElement(IOutputStream& outStream, const DataSlot& dataSlot, const Scene& /*scene*/)
+        {
+            WriteEnum(outStream, dataSlot.type);
+            WriteValue(outStream, dataSlot.id);
+            outStream << dataSlot.attachedNode << dataSlot.attachedDataReference << dataSlot.attachedTexture << dataSlot.attachedTextureSampler;
+        }
+
+        void ReadElement(IInputStream& inStream, DataSlot& dataSlot, SnapshotReadContext& /*context*/)
+        {
+            ReadEnum(inStream, dataSlot.type);
+            ReadValue(inStream, dataSlot.id);
+            inStream >> dataSlot.attachedNode >> dataSlot.attachedDataReference >> dataSlot.attachedTexture >> dataSlot.attachedTextureSampler;
+        }
+
+        void WriteElement(IOutputStream& outStream, const SceneReference& sceneReference, const Scene& /*scene*/)
+        {
+            WriteValue(outStream, sceneReference.sceneId);
+            outStream << sceneReference.requestedState << sceneReference.renderOrder << sceneReference.flushNotifications;
+        }
+
+        void ReadElement(IInputStream& inStream, SceneReference& sceneReference, SnapshotReadContext& /*context*/)
+        {
+            ReadValue(inStream, sceneReference.sceneId);
+            inStream >> sceneReference.requestedState >> sceneReference.renderOrder >> sceneReference.flushNotifications;
+        }
+
+        template <typename POOL>
+        void WritePool(IOutputStream& outStream, ESnapshotBlock block, const POOL& pool, const Scene& scene)
+        {
+            using ObjectType = typename POOL::object_type;
+            const std::vector<ObjectType>& objects = pool.getObjects();
+            const std::vector<uint8_t>& allocationFlags = pool.getAllocationFlags();
+            assert(objects.size() == allocationFlags.size());
+
+            outStream << static_cast<uint32_t>(block);
+            // element size is only stored for blocks of plain values, pool elements are serialized field by field
+            outStream << 0u;
+            outStream << static_cast<uint32_t>(objects.size());
+            if (objects.empty())
+                return;
+
+            outStream.write(allocationFlags.data(), allocationFlags.size());
+            for (size_t i = 0u; i < objects.size(); ++i)
+            {
+                if (allocationFlags[i] != 0u)
+                    WriteElement(outStream, objects[i], scene);
+            }
+        }
+
+        bool ReadBlockHeader(IInputStream& inStream, ESnapshotBlock expectedBlock, uint32_t expectedElementSize, uint32_t& count)
+        {
+            uint32_t block = 0u;
+            uint32_t elementSize = 0u;
+            inStream >> block;
+            inStream >> elementSize;
+            inStream >> count;
+            if (inStream.getState() != EStatus::Ok)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: failed to read header of block " << static_cast<uint32_t>(expectedBlock));
+                return false;
+            }
+            if (block != static_cast<uint32_t>(expectedBlock) || elementSize != expectedElementSize)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: unexpected block " << block << " with element size " << elementSize
+                    << ", expected block " << static_cast<uint32_t>(expectedBlock) << " with element size " << expectedElementSize);
+                return false;
+            }
+            return true;
+        }
+
+        template <typename T>
+        bool ReadPool(IInputStream& inStream, ESnapshotBlock block, DecodedPool<T>& decoded, SnapshotReadContext& context)
+        {
+            uint32_t count = 0u;
+            if (!ReadBlockHeader(inStream, block, 0u, count))
+                return false;
+
+            decoded.allocationFlags.resize(count);
+            decoded.objects.resize(count);
+            if (count > 0u)
+            {
+                inStream.read(decoded.allocationFlags.data(), count);
+                for (uint32_t i = 0u; i < count && context.isValid && inStream.getState() == EStatus::Ok; ++i)
+                {
+                    if (decoded.allocationFlags[i] != 0u)
+                        ReadElement(inStream, decoded.objects[i], context);
+                }
+            }
+
+            if (inStream.getState() != EStatus::Ok || !context.isValid)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: failed to read content of block " << static_cast<uint32_t>(block));
+                return false;
+            }
+
+            return true;
+        }
+
+        template <typename POOL, typename T>
+        void RestorePool(POOL& pool, DecodedPool<T>& decoded)
+        {
+            pool.restore(std::move(decoded.objects), std::move(decoded.allocationFlags));
+        }
+
+        template <typename POOL>
+        bool IsPoolEmpty(const POOL& pool)
+        {
+            return pool.getActualCount() == 0u;
+        }
+    }
+
+    void SceneSnapshot::WriteToStream(IOutputStream& outStream, const ClientScene& scene)
+    {
+        const Scene& pools = scene;
+        outStream << FormatVersion;
+
+        WritePool(outStream, ESnapshotBlock::Nodes,           pools.getNodes(),           pools);
+        WritePool(outStream, ESnapshotBlock::Cameras,         pools.getCameras(),         pools);
+        WritePool(outStream, ESnapshotBlock::Renderables,     pools.getRenderables(),     pools);
+        WritePool(outStream, ESnapshotBlock::RenderStates,    pools.getRenderStates(),    pools);
+        WritePool(outStream, ESnapshotBlock::Transforms,      pools.getTransforms(),      pools);
+        WritePool(outStream, ESnapshotBlock::DataLayouts,     pools.getDataLayouts(),     pools);
+        WritePool(outStream, ESnapshotBlock::DataInstances,   pools.getDataInstances(),   pools);
+        WritePool(outStream, ESnapshotBlock::RenderGroups,    pools.getRenderGroups(),    pools);
+        WritePool(outStream, ESnapshotBlock::RenderPasses,    pools.getRenderPasses(),    pools);
+        WritePool(outStream, ESnapshotBlock::BlitPasses,      pools.getBlitPasses(),      pools);
+        WritePool(outStream, ESnapshotBlock::PickableObjects, pools.getPickableObjects(), pools);
+        WritePool(outStream, ESnapshotBlock::RenderTargets,   pools.getRenderTargets(),   pools);
+        WritePool(outStream, ESnapshotBlock::RenderBuffers,   pools.getRenderBuffers(),   pools);
+        WritePool(outStream, ESnapshotBlock::TextureSamplers, pools.getTextureSamplers(), pools);
+        WritePool(outStream, ESnapshotBlock::DataBuffers,     pools.getDataBuffers(),     pools);
+        WritePool(outStream, ESnapshotBlock::TextureBuffers,  pools.getTextureBuffers(),  pools);
+        WritePool(outStream, ESnapshotBlock::DataSlots,       pools.getDataSlots(),       pools);
+        WritePool(outStream, ESnapshotBlock::SceneReferences, pools.getSceneReferences(), pools);
+
+        // number of references of every allocated data layout, in order of layout handles
+        outStream << static_cast<uint32_t>(ESnapshotBlock::DataLayoutReferences);
+        outStream << static_cast<uint32_t>(sizeof(uint32_t));
+        outStream << pools.getDataLayouts().getActualCount();
+        for (const auto& layout : pools.getDataLayouts())
+            outStream << scene.getNumDataLayoutReferences(layout.first);
+
+        // packed children storage is written as is, nodes refer to it by offsets
+        static_assert(sizeof(NodeHandle) == sizeof(uint32_t), "node children are stored as plain 32 bit values");
+        outStream << static_cast<uint32_t>(ESnapshotBlock::NodeChildren);
+        outStream << static_cast<uint32_t>(sizeof(NodeHandle));
+        outStream << static_cast<uint32_t>(pools.m_nodeChildren.size());
+        if (!pools.m_nodeChildren.empty())
+            outStream.write(pools.m_nodeChildren.data(), pools.m_nodeChildren.size() * sizeof(NodeHandle));
+    }
+
+    bool SceneSnapshot::ReadFromStream(IInputStream& inStream, ClientScene& scene)
+    {
+        Scene& pools = scene;
+        const bool isSceneEmpty = IsPoolEmpty(pools.m_nodes) && IsPoolEmpty(pools.m_cameras) && IsPoolEmpty(pools.m_renderables) && IsPoolEmpty(pools.m_states)
+            && IsPoolEmpty(pools.m_transforms) && IsPoolEmpty(pools.m_dataLayoutMemory) && IsPoolEmpty(pools.m_dataInstanceMemory) && IsPoolEmpty(pools.m_renderGroups)
+            && IsPoolEmpty(pools.m_renderPasses) && IsPoolEmpty(pools.m_blitPasses) && IsPoolEmpty(pools.m_pickableObjects) && IsPoolEmpty(pools.m_renderTargets)
+            && IsPoolEmpty(pools.m_renderBuffers) && IsPoolEmpty(pools.m_textureSamplers) && IsPoolEmpty(pools.m_dataBuffers) && IsPoolEmpty(pools.m_textureBuffers)
+            && IsPoolEmpty(pools.m_dataSlots) && IsPoolEmpty(pools.m_sceneReferences);
+        if (!isSceneEmpty)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: snapshot can only be read into empty scene " << scene.getSceneId());
+            return false;
+        }
+
+        uint32_t formatVersion = 0u;
+        inStream >> formatVersion;
+        if (formatVersion != FormatVersion)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: unsupported snapshot format version " << formatVersion << ", expected " << FormatVersion);
+            return false;
+        }
+
+        // whole snapshot is decoded and validated first, scene is modified only if all of it could be read
+        SnapshotReadContext context;
+        DecodedPool<TopologyNode> nodes;
+        DecodedPool<Camera> cameras;
+        DecodedPool<Renderable> renderables;
+        DecodedPool<RenderState> states;
+        DecodedPool<TopologyTransform> transforms;
+        DecodedPool<DataLayout> dataLayouts;
+        DecodedPool<DataInstance> dataInstances;
+        DecodedPool<RenderGroup> renderGroups;
+        DecodedPool<RenderPass> renderPasses;
+        DecodedPool<BlitPass> blitPasses;
+        DecodedPool<PickableObject> pickableObjects;
+        DecodedPool<RenderTarget> renderTargets;
+        DecodedPool<RenderBuffer> renderBuffers;
+        DecodedPool<TextureSampler> textureSamplers;
+        DecodedPool<GeometryDataBuffer> dataBuffers;
+        DecodedPool<TextureBuffer> textureBuffers;
+        DecodedPool<DataSlot> dataSlots;
+        DecodedPool<SceneReference> sceneReferences;
+        context.dataLayouts = &dataLayouts;
+
+        const bool poolsRead =
+            ReadPool(inStream, ESnapshotBlock::Nodes,           nodes,           context) &&
+            ReadPool(inStream, ESnapshotBlock::Cameras,         cameras,         context) &&
+            ReadPool(inStream, ESnapshotBlock::Renderables,     renderables,     context) &&
+            ReadPool(inStream, ESnapshotBlock::RenderStates,    states,          context) &&
+            ReadPool(inStream, ESnapshotBlock::Transforms,      transforms,      context) &&
+            ReadPool(inStream, ESnapshotBlock::DataLayouts,     dataLayouts,     context) &&
+            ReadPool(inStream, ESnapshotBlock::DataInstances,   dataInstances,   context) &&
+            ReadPool(inStream, ESnapshotBlock::RenderGroups,    renderGroups,    context) &&
+            ReadPool(inStream, ESnapshotBlock::RenderPasses,    renderPasses,    context) &&
+            ReadPool(inStream, ESnapshotBlock::BlitPasses,      blitPasses,      context) &&
+            ReadPool(inStream, ESnapshotBlock::PickableObjects, pickableObjects, context) &&
+            ReadPool(inStream, ESnapshotBlock::RenderTargets,   renderTargets,   context) &&
+            ReadPool(inStream, ESnapshotBlock::RenderBuffers,   renderBuffers,   context) &&
+            ReadPool(inStream, ESnapshotBlock::TextureSamplers, textureSamplers, context) &&
+            ReadPool(inStream, ESnapshotBlock::DataBuffers,     dataBuffers,     context) &&
+            ReadPool(inStream, ESnapshotBlock::TextureBuffers,  textureBuffers,  context) &&
+            ReadPool(inStream, ESnapshotBlock::DataSlots,       dataSlots,       context) &&
+            ReadPool(inStream, ESnapshotBlock::SceneReferences, sceneReferences, context);
+
+        uint32_t layoutCount = 0u;
+        if (!poolsRead || !ReadBlockHeader(inStream, ESnapshotBlock::DataLayoutReferences, static_cast<uint32_t>(sizeof(uint32_t)), layoutCount))
+            return false;
+
+        const auto allocatedLayoutCount = std::count_if(dataLayouts.allocationFlags.cbegin(), dataLayouts.allocationFlags.cend(), [](uint8_t flag) { return flag != 0u; });
+        if (layoutCount != static_cast<uint32_t>(allocatedLayoutCount))
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: number of data layout references " << layoutCount << " does not match number of data layouts " << allocatedLayoutCount);
+            return false;
+        }
+        std::vector<uint32_t> layoutReferences(layoutCount);
+        if (layoutCount > 0u)
+            inStream.read(layoutReferences.data(), layoutCount * sizeof(uint32_t));
+        if (inStream.getState() != EStatus::Ok)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: failed to read data layout references");
+            return false;
+        }
+
+        uint32_t nodeChildrenCount = 0u;
+        if (!ReadBlockHeader(inStream, ESnapshotBlock::NodeChildren, static_cast<uint32_t>(sizeof(NodeHandle)), nodeChildrenCount))
+            return false;
+
+        NodeHandleVector nodeChildren(nodeChildrenCount);
+        if (nodeChildrenCount > 0u)
+            inStream.read(nodeChildren.data(), nodeChildrenCount * sizeof(NodeHandle));
+        if (inStream.getState() != EStatus::Ok)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: failed to read node children");
+            return false;
+        }
+        uint64_t usedNodeChildrenCount = 0u;
+        for (size_t i = 0u; i < nodes.objects.size(); ++i)
+        {
+            if (nodes.allocationFlags[i] == 0u)
+                continue;
+            const TopologyNode& node = nodes.objects[i];
+            if (uint64_t{ node.childrenOffset } + node.childrenCapacity > nodeChildrenCount || node.childrenCount > node.childrenCapacity)
+            {
+                LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: children of node " << i << " out of range of stored children");
+                return false;
+            }
+            usedNodeChildrenCount += node.childrenCapacity;
+        }
+        if (usedNodeChildrenCount > nodeChildrenCount)
+        {
+            LOG_ERROR(CONTEXT_FRAMEWORK, "SceneSnapshot::ReadFromStream: children ranges of nodes exceed stored children");
+            return false;
+        }
+
+        RestorePool(pools.m_nodes,              nodes);
+        RestorePool(pools.m_cameras,            cameras);
+        RestorePool(pools.m_renderables,        renderables);
+        RestorePool(pools.m_states,             states);
+        RestorePool(pools.m_transforms,         transforms);
+        RestorePool(pools.m_dataLayoutMemory,   dataLayouts);
+        RestorePool(pools.m_dataInstanceMemory, dataInstances);
+        RestorePool(pools.m_renderGroups,       renderGroups);
+        RestorePool(pools.m_renderPasses,       renderPasses);
+        RestorePool(pools.m_blitPasses,         blitPasses);
+        RestorePool(pools.m_pickableObjects,    pickableObjects);
+        RestorePool(pools.m_renderTargets,      renderTargets);
+        RestorePool(pools.m_renderBuffers,      renderBuffers);
+        RestorePool(pools.m_textureSamplers,    textureSamplers);
+        RestorePool(pools.m_dataBuffers,        dataBuffers);
+        RestorePool(pools.m_textureBuffers,     textureBuffers);
+        RestorePool(pools.m_dataSlots,          dataSlots);
+        RestorePool(pools.m_sceneReferences,    sceneReferences);
+        pools.m_dataInstancePayloads = std::move(context.payloads);
+        pools.m_nodeChildren.swap(nodeChildren);
+        pools.m_unusedNodeChildrenCount = nodeChildrenCount - static_cast<uint32_t>(usedNodeChildrenCount);
+
+        pools.onRestoredFromSnapshot();
+
+        auto references = layoutReferences.cbegin();
+        for (const auto& layout : pools.getDataLayouts())
+            scene.setNumDataLayoutReferences(layout.first, *references++);
+
+        return true;
+    }
+}
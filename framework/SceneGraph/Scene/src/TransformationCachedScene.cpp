@@ -10,6 +10,7 @@
 #include "Utils/MemoryPoolExplicit.h"
 #include "Utils/MemoryPool.h"
 #include "Math3d/Rotation.h"
+#include "TaskFramework/ParallelForExecutor.h"
 #include "glm/gtx/transform.hpp"
 
 namespace
@@ -30,7 +31,7 @@ namespace ramses_internal
     {
         SceneT<MEMORYPOOL>::preallocateSceneSize(sizeInfo);
 
-        m_nodeToTransformMap.reserve(sizeInfo.transformCount);
+        m_nodeToTransformMap.reserve(sizeInfo.nodeCount);
         m_matrixCachePool.preallocateSize(sizeInfo.nodeCount);
     }
 
@@ -113,6 +114,28 @@ namespace ramses_internal
         SceneT<MEMORYPOOL>::releaseNode(node);
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::onRestoredFromSnapshot()
+    {
+        SceneT<MEMORYPOOL>::onRestoredFromSnapshot();
+
+        m_matrixCachePool.preallocateSize(this->getNodeCount());
+        for (const auto& node : this->getNodes())
+            m_matrixCachePool.allocate(node.first);
+
+        for (const auto& transform : this->getTransforms())
+        {
+            const TopologyTransform& topologyTransform = *transform.second;
+            m_nodeToTransformMap.put(topologyTransform.node, transform.first);
+            if (topologyTransform.translation != IScene::IdentityTranslation
+                || topologyTransform.rotation != IScene::IdentityRotation
+                || topologyTransform.scaling != IScene::IdentityScaling)
+            {
+                getMatrixCacheEntry(topologyTransform.node).m_isIdentity = false;
+            }
+        }
+    }
+
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::setMatrixCache(ETransformationMatrixType matrixType, MatrixCacheEntry& matrixCache, const glm::mat4& matrix) const
     {
@@ -164,6 +187,104 @@ namespace ramses_internal
         return chainMatrix;
     }
 
+    template <template<typename, typename> class MEMORYPOOL>
+    const glm::mat4& TransformationCachedSceneT<MEMORYPOOL>::getCachedMatrix(ETransformationMatrixType matrixType, NodeHandle node) const
+    {
+        const MatrixCacheEntry& cacheEntry = getMatrixCacheEntry(node);
+        assert(!cacheEntry.m_matrixDirty[matrixType]);
+        return cacheEntry.m_matrix[matrixType];
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::updateMatrixCacheForNodes(ETransformationMatrixType matrixType, const NodeHandleVector& nodes, ParallelForExecutor* executor) const
+    {
+        collectDirtyNodesByLevel(matrixType, nodes);
+
+        // below this number of nodes per level waking up worker threads costs more than it saves
+        constexpr size_t MinNodesPerThread = 256u;
+        for (size_t level = 0u; level + 1u < m_levelOffsets.size(); ++level)
+        {
+            const size_t levelBegin = m_levelOffsets[level];
+            const size_t levelSize = m_levelOffsets[level + 1u] - levelBegin;
+            if (executor)
+            {
+                executor->execute(levelSize, MinNodesPerThread, [&](size_t begin, size_t end) {
+                    updateMatrixCacheForLevelNodes(matrixType, levelBegin + begin, levelBegin + end);
+                });
+            }
+            else
+                updateMatrixCacheForLevelNodes(matrixType, levelBegin, levelBegin + levelSize);
+        }
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::collectDirtyNodesByLevel(ETransformationMatrixType matrixType, const NodeHandleVector& nodes) const
+    {
+        const uint32_t nodeCount = SceneT<MEMORYPOOL>::getNodeCount();
+        m_nodeLevels.resize(nodeCount);
+        m_nodeVisitStamps.resize(nodeCount, 0u);
+        if (++m_visitStamp == 0u)
+        {
+            std::fill(m_nodeVisitStamps.begin(), m_nodeVisitStamps.end(), 0u);
+            m_visitStamp = 1u;
+        }
+
+        // level of a dirty node is its distance to the closest clean ancestor (or root), i.e. its parent
+        // is either clean or on a lower level, every dirty node is visited once even if shared by many nodes
+        m_levelizedDirtyNodes.clear();
+        m_levelOffsets.clear();
+        for (const auto node : nodes)
+        {
+            m_dirtyNodes.clear();
+            uint32_t level = 0u;
+            NodeHandle currentNode = node;
+            while (currentNode.isValid() && getMatrixCacheEntry(currentNode).m_matrixDirty[matrixType])
+            {
+                if (m_nodeVisitStamps[currentNode.asMemoryHandle()] == m_visitStamp)
+                {
+                    level = m_nodeLevels[currentNode.asMemoryHandle()] + 1u;
+                    break;
+                }
+                m_dirtyNodes.push_back(currentNode);
+                currentNode = SceneT<MEMORYPOOL>::getParent(currentNode);
+            }
+
+            for (auto it = m_dirtyNodes.crbegin(); it != m_dirtyNodes.crend(); ++it, ++level)
+            {
+                m_nodeVisitStamps[it->asMemoryHandle()] = m_visitStamp;
+                m_nodeLevels[it->asMemoryHandle()] = level;
+                m_levelizedDirtyNodes.push_back(*it);
+                if (m_levelOffsets.size() <= level + 1u)
+                    m_levelOffsets.resize(level + 2u, 0u);
+                ++m_levelOffsets[level + 1u];
+            }
+        }
+
+        // counting sort of collected nodes by level
+        for (size_t level = 1u; level < m_levelOffsets.size(); ++level)
+            m_levelOffsets[level] += m_levelOffsets[level - 1u];
+        m_dirtyNodes.resize(m_levelizedDirtyNodes.size());
+        m_levelInsertPositions = m_levelOffsets;
+        for (const auto dirtyNode : m_levelizedDirtyNodes)
+            m_dirtyNodes[m_levelInsertPositions[m_nodeLevels[dirtyNode.asMemoryHandle()]]++] = dirtyNode;
+        m_levelizedDirtyNodes.swap(m_dirtyNodes);
+    }
+
+    template <template<typename, typename> class MEMORYPOOL>
+    void TransformationCachedSceneT<MEMORYPOOL>::updateMatrixCacheForLevelNodes(ETransformationMatrixType matrixType, size_t begin, size_t end) const
+    {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const NodeHandle dirtyNode = m_levelizedDirtyNodes[i];
+            const NodeHandle parent = SceneT<MEMORYPOOL>::getParent(dirtyNode);
+            glm::mat4 chainMatrix = parent.isValid() ? getMatrixCacheEntry(parent).m_matrix[matrixType] : Identity;
+
+            MatrixCacheEntry& matrixCache = getMatrixCacheEntry(dirtyNode);
+            if (!matrixCache.m_isIdentity)
+                computeMatrixForNode(matrixType, dirtyNode, chainMatrix);
+            setMatrixCache(matrixType, matrixCache, chainMatrix);
+        }
+    }
 
     template <template<typename, typename> class MEMORYPOOL>
     void TransformationCachedSceneT<MEMORYPOOL>::computeMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, glm::mat4& chainMatrix) const
@@ -207,7 +328,7 @@ namespace ramses_internal
             // If it was already dirty, no need to propagate further
             if (!wasDirty)
             {
-                const NodeHandleVector& children = SceneT<MEMORYPOOL>::getNode(node).children;
+                const auto children = SceneT<MEMORYPOOL>::getChildren(node);
                 m_dirtyPropagationTraversalBuffer.insert(m_dirtyPropagationTraversalBuffer.end(), children.cbegin(), children.cend());
             }
         }
@@ -0,0 +1,101 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "Scene/DataInstanceArena.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+
+namespace ramses_internal
+{
+    class ADataInstanceArena : public ::testing::Test
+    {
+    public:
+        DataInstanceArena arena;
+        const DataLayoutHandle layout{ 1u };
+        const DataLayoutHandle otherLayout{ 3u };
+    };
+
+    TEST_F(ADataInstanceArena, returnsNullForZeroSize)
+    {
+        EXPECT_EQ(nullptr, arena.allocate(layout, 0u));
+        EXPECT_EQ(0u, arena.getPayloadCount(layout));
+        EXPECT_EQ(0u, arena.getChunkCount());
+    }
+
+    TEST_F(ADataInstanceArena, returnsZeroInitializedPayload)
+    {
+        const Byte* payload = arena.allocate(layout, 40u);
+        ASSERT_NE(nullptr, payload);
+        EXPECT_TRUE(std::all_of(payload, payload + 40u, [](Byte b) { return b == 0u; }));
+        EXPECT_EQ(1u, arena.getPayloadCount(layout));
+    }
+
+    TEST_F(ADataInstanceArena, placesPayloadsOfSameLayoutNextToEachOther)
+    {
+        const Byte* payload1 = arena.allocate(layout, 64u);
+        arena.allocate(otherLayout, 64u);
+        const Byte* payload2 = arena.allocate(layout, 64u);
+        EXPECT_EQ(payload1 + 64u, payload2);
+    }
+
+    TEST_F(ADataInstanceArena, alignsPayloads)
+    {
+        const Byte* payload1 = arena.allocate(layout, 3u);
+        const Byte* payload2 = arena.allocate(layout, 3u);
+        EXPECT_EQ(payload1 + DataInstanceArena::PayloadAlignment, payload2);
+    }
+
+    TEST_F(ADataInstanceArena, needsOnlyFewAllocationsForManyPayloads)
+    {
+        for (uint32_t i = 0u; i < 10000u; ++i)
+            arena.allocate(layout, 64u);
+        EXPECT_EQ(10000u, arena.getPayloadCount(layout));
+        EXPECT_GE(12u, arena.getChunkCount());
+    }
+
+    TEST_F(ADataInstanceArena, reusesReleasedPayloadAndInitializesItWithZero)
+    {
+        Byte* payload = arena.allocate(layout, 16u);
+        payload[3] = 7u;
+        arena.release(layout, 16u, payload);
+        EXPECT_EQ(0u, arena.getPayloadCount(layout));
+
+        EXPECT_EQ(payload, arena.allocate(layout, 16u));
+        EXPECT_EQ(0u, payload[3]);
+        EXPECT_EQ(1u, arena.getChunkCount());
+    }
+
+    TEST_F(ADataInstanceArena, freesMemoryOfReleasedLayoutWithoutPayloads)
+    {
+        Byte* payload = arena.allocate(layout, 16u);
+        arena.allocate(otherLayout, 16u);
+        arena.release(layout, 16u, payload);
+
+        arena.releaseLayout(layout);
+        arena.releaseLayout(otherLayout);
+        EXPECT_EQ(1u, arena.getChunkCount());
+        EXPECT_EQ(1u, arena.getPayloadCount(otherLayout));
+    }
+
+    TEST_F(ADataInstanceArena, keepsPayloadsOfReleasedLayoutWhenLayoutHandleIsReusedWithOtherSize)
+    {
+        Byte* payload = arena.allocate(layout, 16u);
+        payload[0] = 7u;
+        arena.releaseLayout(layout);
+
+        Byte* newPayload = arena.allocate(layout, 64u);
+        EXPECT_NE(payload, newPayload);
+        EXPECT_EQ(7u, payload[0]);
+        EXPECT_EQ(2u, arena.getPayloadCount(layout));
+
+        arena.release(layout, 16u, payload);
+        arena.release(layout, 64u, newPayload);
+        EXPECT_EQ(0u, arena.getPayloadCount(layout));
+    }
+}
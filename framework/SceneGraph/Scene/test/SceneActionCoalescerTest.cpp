@@ -0,0 +1,157 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "Scene/SceneActionCoalescer.h"
+#include "Scene/SceneActionCollectionCreator.h"
+#include "Scene/SceneActionApplier.h"
+#include "Scene/Scene.h"
+#include "SceneAPI/ERotationType.h"
+#include <gtest/gtest.h>
+#include <cstring>
+
+namespace ramses_internal
+{
+    class ASceneActionCoalescer : public ::testing::Test
+    {
+    public:
+        ASceneActionCoalescer()
+            : creator(collection)
+        {
+        }
+
+        [[nodiscard]] std::vector<ESceneActionId> coalescedActionTypes() const
+        {
+            const SceneActionCollection coalesced = SceneActionCoalescer::CoalesceActions(collection);
+            std::vector<ESceneActionId> types;
+            for (const auto& action : coalesced)
+                types.push_back(action.type());
+            return types;
+        }
+
+        SceneActionCollection collection;
+        SceneActionCollectionCreator creator;
+    };
+
+    TEST_F(ASceneActionCoalescer, keepsActionsWhichCannotBeCoalesced)
+    {
+        creator.allocateNode(0u, NodeHandle(1u));
+        creator.allocateNode(0u, NodeHandle(2u));
+        creator.addChildToNode(NodeHandle(1u), NodeHandle(2u));
+        creator.setTranslation(TransformHandle(3u), glm::vec3(1.f));
+
+        const SceneActionCollection coalesced = SceneActionCoalescer::CoalesceActions(collection);
+        EXPECT_EQ(collection, coalesced);
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsOnlyLastValueOfSetterAtItsPosition)
+    {
+        creator.setTranslation(TransformHandle(1u), glm::vec3(1.f));
+        creator.allocateNode(0u, NodeHandle(2u));
+        creator.setTranslation(TransformHandle(1u), glm::vec3(2.f));
+        creator.setScaling(TransformHandle(1u), glm::vec3(3.f));
+
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::AllocateNode, ESceneActionId::SetTranslation, ESceneActionId::SetScaling }), coalescedActionTypes());
+
+        const SceneActionCollection coalesced = SceneActionCoalescer::CoalesceActions(collection);
+        EXPECT_EQ(collection[2].size(), coalesced[1].size());
+        EXPECT_EQ(0, std::memcmp(collection[2].data(), coalesced[1].data(), collection[2].size()));
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsSettersOfDifferentObjects)
+    {
+        creator.setTranslation(TransformHandle(1u), glm::vec3(1.f));
+        creator.setTranslation(TransformHandle(2u), glm::vec3(2.f));
+        creator.setRenderableVisibility(RenderableHandle(1u), EVisibilityMode::Off);
+        creator.setRenderableVisibility(RenderableHandle(2u), EVisibilityMode::Visible);
+
+        EXPECT_EQ(4u, SceneActionCoalescer::CoalesceActions(collection).numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, coalescesDataSettersPerFieldAndElementCount)
+    {
+        const float values[] = { 1.f, 2.f };
+        creator.setDataFloatArray(DataInstanceHandle(1u), DataFieldHandle(0u), 2u, values);
+        creator.setDataFloatArray(DataInstanceHandle(1u), DataFieldHandle(1u), 2u, values);
+        creator.setDataFloatArray(DataInstanceHandle(1u), DataFieldHandle(0u), 1u, values);
+        creator.setDataFloatArray(DataInstanceHandle(1u), DataFieldHandle(0u), 2u, values);
+        creator.setDataFloatArray(DataInstanceHandle(1u), DataFieldHandle(1u), 2u, values);
+
+        const SceneActionCollection coalesced = SceneActionCoalescer::CoalesceActions(collection);
+        ASSERT_EQ(3u, coalesced.numberOfActions());
+        EXPECT_EQ(collection[2].offsetInCollection() - collection[1].offsetInCollection(), coalesced[1].offsetInCollection() - coalesced[0].offsetInCollection());
+    }
+
+    TEST_F(ASceneActionCoalescer, dropsTransformAllocatedAndReleasedWithinCollection)
+    {
+        creator.allocateNode(0u, NodeHandle(1u));
+        creator.allocateTransform(NodeHandle(1u), TransformHandle(2u));
+        creator.setTranslation(TransformHandle(2u), glm::vec3(1.f));
+        creator.setRotation(TransformHandle(2u), glm::vec4(1.f), ERotationType::Euler_XYZ);
+        creator.releaseTransform(TransformHandle(2u));
+
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::AllocateNode }), coalescedActionTypes());
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsReleaseOfObjectAllocatedBeforeCollection)
+    {
+        creator.setTranslation(TransformHandle(2u), glm::vec3(1.f));
+        creator.releaseTransform(TransformHandle(2u));
+        creator.allocateTransform(NodeHandle(1u), TransformHandle(2u));
+
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::SetTranslation, ESceneActionId::ReleaseTransform, ESceneActionId::AllocateTransform }), coalescedActionTypes());
+    }
+
+    TEST_F(ASceneActionCoalescer, dropsOnlyAllocationWhichIsReleasedWhenHandleIsReused)
+    {
+        creator.allocateTransform(NodeHandle(1u), TransformHandle(2u));
+        creator.setTranslation(TransformHandle(2u), glm::vec3(1.f));
+        creator.releaseTransform(TransformHandle(2u));
+        creator.allocateTransform(NodeHandle(1u), TransformHandle(2u));
+        creator.setScaling(TransformHandle(2u), glm::vec3(2.f));
+
+        EXPECT_EQ(std::vector<ESceneActionId>({ ESceneActionId::AllocateTransform, ESceneActionId::SetScaling }), coalescedActionTypes());
+    }
+
+    TEST_F(ASceneActionCoalescer, keepsAllocatedAndReleasedObjectsWhichCanBeReferencedByOtherActions)
+    {
+        creator.allocateRenderable(NodeHandle(1u), RenderableHandle(2u));
+        creator.setRenderableVisibility(RenderableHandle(2u), EVisibilityMode::Off);
+        creator.releaseRenderable(RenderableHandle(2u));
+
+        EXPECT_EQ(3u, SceneActionCoalescer::CoalesceActions(collection).numberOfActions());
+    }
+
+    TEST_F(ASceneActionCoalescer, resultsInSameSceneStateWhenApplied)
+    {
+        const NodeHandle node(0u);
+        const TransformHandle transform(0u);
+        const TransformHandle tempTransform(1u);
+        creator.allocateNode(0u, node);
+        creator.allocateTransform(node, transform);
+        creator.allocateTransform(node, tempTransform);
+        for (uint32_t i = 0u; i < 5u; ++i)
+        {
+            creator.setTranslation(transform, glm::vec3(static_cast<float>(i)));
+            creator.setTranslation(tempTransform, glm::vec3(static_cast<float>(i)));
+        }
+        creator.releaseTransform(tempTransform);
+
+        const SceneActionCollection coalesced = SceneActionCoalescer::CoalesceActions(collection);
+        EXPECT_EQ(3u, coalesced.numberOfActions());
+
+        Scene expectedScene;
+        SceneActionApplier::ApplyActionsOnScene(expectedScene, collection);
+        Scene coalescedScene;
+        SceneActionApplier::ApplyActionsOnScene(coalescedScene, coalesced);
+
+        EXPECT_EQ(expectedScene.getTranslation(transform), coalescedScene.getTranslation(transform));
+        EXPECT_EQ(glm::vec3(4.f), coalescedScene.getTranslation(transform));
+        EXPECT_FALSE(coalescedScene.isTransformAllocated(tempTransform));
+    }
+}
@@ -0,0 +1,259 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "framework_common_gmock_header.h"
+#include "gtest/gtest.h"
+#include "Scene/SceneSnapshot.h"
+#include "Scene/ScenePersistation.h"
+#include "Scene/ClientScene.h"
+#include "Scene/SceneActionApplier.h"
+#include "Utils/VectorBinaryOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+#include "Utils/BinaryFileInputStream.h"
+#include "Utils/File.h"
+#include "TestingScene.h"
+#include <algorithm>
+#include <cstring>
+
+using namespace testing;
+
+namespace ramses_internal
+{
+    class ASceneSnapshot : public ::testing::Test
+    {
+    public:
+        void writeSnapshot(const ClientScene& scene)
+        {
+            VectorBinaryOutputStream outStream(data);
+            SceneSnapshot::WriteToStream(outStream, scene);
+        }
+
+        bool readSnapshot(ClientScene& scene)
+        {
+            BinaryInputStream inStream(data.data());
+            return SceneSnapshot::ReadFromStream(inStream, scene);
+        }
+
+        // file stream reports reading beyond end of truncated data, unlike memory stream
+        bool readSnapshotFromFile(ClientScene& scene, size_t size)
+        {
+            File file("snapshotTestFile.bin");
+            EXPECT_TRUE(file.open(File::Mode::WriteNewBinary));
+            EXPECT_TRUE(file.write(data.data(), size));
+            file.close();
+
+            bool success = false;
+            {
+                BinaryFileInputStream inStream(file);
+                success = SceneSnapshot::ReadFromStream(inStream, scene);
+            }
+            file.close();
+            file.remove();
+            return success;
+        }
+
+        static void ExpectSceneEmpty(const ClientScene& scene)
+        {
+            EXPECT_EQ(0u, scene.getNodeCount());
+            EXPECT_EQ(0u, scene.getTransformCount());
+            EXPECT_EQ(0u, scene.getDataLayoutCount());
+            EXPECT_EQ(0u, scene.getDataInstanceCount());
+            EXPECT_EQ(0u, scene.getRenderableCount());
+            EXPECT_EQ(0u, scene.getSceneActionCollection().numberOfActions());
+        }
+
+        static bool ContainsResourceAction(const SceneResourceActionVector& actions, MemoryHandle handle, ESceneResourceAction action)
+        {
+            return std::find_if(actions.cbegin(), actions.cend(), [&](const SceneResourceAction& a) { return a.handle == handle && a.action == action; }) != actions.cend();
+        }
+
+        std::vector<Byte> data;
+        TestingScene<ClientScene> testingScene;
+        ClientScene loadedScene;
+    };
+
+    TEST_F(ASceneSnapshot, restoresEquivalentScene)
+    {
+        writeSnapshot(testingScene.getScene());
+        ASSERT_TRUE(readSnapshot(loadedScene));
+        testingScene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST_F(ASceneSnapshot, restoresAllocationStateOfReleasedHandles)
+    {
+        ClientScene scene;
+        const NodeHandle node1 = scene.allocateNode();
+        const NodeHandle node2 = scene.allocateNode();
+        const NodeHandle node3 = scene.allocateNode();
+        scene.releaseNode(node2);
+        writeSnapshot(scene);
+
+        ASSERT_TRUE(readSnapshot(loadedScene));
+        EXPECT_EQ(3u, loadedScene.getNodeCount());
+        EXPECT_TRUE(loadedScene.isNodeAllocated(node1));
+        EXPECT_FALSE(loadedScene.isNodeAllocated(node2));
+        EXPECT_TRUE(loadedScene.isNodeAllocated(node3));
+        EXPECT_EQ(node2, loadedScene.allocateNode());
+    }
+
+    TEST_F(ASceneSnapshot, rebuildsTransformationCache)
+    {
+        ClientScene scene;
+        const NodeHandle parent = scene.allocateNode();
+        const NodeHandle child = scene.allocateNode();
+        scene.addChildToNode(parent, child);
+        const TransformHandle parentTransform = scene.allocateTransform(parent);
+        scene.setTranslation(parentTransform, glm::vec3(1.f, 2.f, 3.f));
+        writeSnapshot(scene);
+
+        ASSERT_TRUE(readSnapshot(loadedScene));
+        EXPECT_EQ(scene.updateMatrixCache(ETransformationMatrixType_World, child), loadedScene.updateMatrixCache(ETransformationMatrixType_World, child));
+
+        loadedScene.setTranslation(parentTransform, glm::vec3(4.f, 5.f, 6.f));
+        EXPECT_EQ(glm::vec4(4.f, 5.f, 6.f, 1.f), loadedScene.updateMatrixCache(ETransformationMatrixType_World, child)[3]);
+    }
+
+    TEST_F(ASceneSnapshot, restoresDataLayoutReferences)
+    {
+        const DataFieldInfoVector fields{ DataFieldInfo(EDataType::Float) };
+        ClientScene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout(fields, ResourceContentHash(1u, 2u));
+        EXPECT_EQ(layout, scene.allocateDataLayout(fields, ResourceContentHash(1u, 2u)));
+        writeSnapshot(scene);
+
+        ASSERT_TRUE(readSnapshot(loadedScene));
+        EXPECT_EQ(2u, loadedScene.getNumDataLayoutReferences(layout));
+        EXPECT_EQ(layout, loadedScene.allocateDataLayout(fields, ResourceContentHash(1u, 2u)));
+        EXPECT_EQ(3u, loadedScene.getNumDataLayoutReferences(layout));
+    }
+
+    TEST_F(ASceneSnapshot, collectsSceneResourceChangesOfRestoredScene)
+    {
+        writeSnapshot(testingScene.getScene());
+        ASSERT_TRUE(readSnapshot(loadedScene));
+
+        EXPECT_TRUE(loadedScene.haveResourcesChanged());
+        const SceneResourceActionVector& actions = loadedScene.getSceneResourceActions();
+        EXPECT_TRUE(ContainsResourceAction(actions, testingScene.renderTarget.asMemoryHandle(), ESceneResourceAction_CreateRenderTarget));
+        EXPECT_TRUE(ContainsResourceAction(actions, testingScene.renderBuffer.asMemoryHandle(), ESceneResourceAction_CreateRenderBuffer));
+        EXPECT_TRUE(ContainsResourceAction(actions, testingScene.blitPass.asMemoryHandle(), ESceneResourceAction_CreateBlitPass));
+        EXPECT_TRUE(ContainsResourceAction(actions, testingScene.vertexDataBuffer.asMemoryHandle(), ESceneResourceAction_CreateDataBuffer));
+        EXPECT_TRUE(ContainsResourceAction(actions, testingScene.vertexDataBuffer.asMemoryHandle(), ESceneResourceAction_UpdateDataBuffer));
+        EXPECT_TRUE(ContainsResourceAction(actions, testingScene.texture2DBuffer.asMemoryHandle(), ESceneResourceAction_CreateTextureBuffer));
+        EXPECT_TRUE(ContainsResourceAction(actions, testingScene.texture2DBuffer.asMemoryHandle(), ESceneResourceAction_UpdateTextureBuffer));
+    }
+
+    TEST_F(ASceneSnapshot, collectsSceneActionsRecreatingRestoredScene)
+    {
+        writeSnapshot(testingScene.getScene());
+        ASSERT_TRUE(readSnapshot(loadedScene));
+
+        Scene sceneFromActions;
+        SceneActionApplier::ApplyActionsOnScene(sceneFromActions, loadedScene.getSceneActionCollection());
+        testingScene.CheckEquivalentTo<IScene>(sceneFromActions);
+    }
+
+    TEST_F(ASceneSnapshot, failsToReadIntoNonEmptyScene)
+    {
+        writeSnapshot(testingScene.getScene());
+        loadedScene.allocateNode();
+        EXPECT_FALSE(readSnapshot(loadedScene));
+        EXPECT_EQ(1u, loadedScene.getNodeCount());
+    }
+
+    TEST_F(ASceneSnapshot, failsToReadOtherFormatVersion)
+    {
+        writeSnapshot(testingScene.getScene());
+        const uint32_t otherVersion = SceneSnapshot::FormatVersion + 1u;
+        std::memcpy(data.data(), &otherVersion, sizeof(otherVersion));
+        EXPECT_FALSE(readSnapshot(loadedScene));
+        EXPECT_EQ(0u, loadedScene.getNodeCount());
+    }
+
+    TEST_F(ASceneSnapshot, readsCompleteSnapshotFromFile)
+    {
+        writeSnapshot(testingScene.getScene());
+        ASSERT_TRUE(readSnapshotFromFile(loadedScene, data.size()));
+        testingScene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST_F(ASceneSnapshot, failsToReadTruncatedSnapshotAndLeavesSceneUnchanged)
+    {
+        writeSnapshot(testingScene.getScene());
+        const size_t fullSize = data.size();
+        for (const size_t size : { fullSize / 4u, fullSize / 2u, fullSize - 1u })
+        {
+            ClientScene scene;
+            EXPECT_FALSE(readSnapshotFromFile(scene, size));
+            ExpectSceneEmpty(scene);
+        }
+    }
+
+    TEST_F(ASceneSnapshot, failsToReadCorruptSnapshotAndLeavesSceneUnchanged)
+    {
+        ClientScene scene;
+        scene.allocateNode();
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Float) }, ResourceContentHash(1u, 2u));
+        scene.allocateDataInstance(layout);
+        writeSnapshot(scene);
+
+        // corrupt id of last block (node children), all pools before it are complete
+        constexpr size_t NodeChildrenBlockHeaderSize = 3u * sizeof(uint32_t);
+        uint32_t nodeChildrenCount = 0u;
+        std::memcpy(&nodeChildrenCount, data.data() + data.size() - sizeof(uint32_t), sizeof(uint32_t));
+        ASSERT_EQ(0u, nodeChildrenCount);
+        const uint32_t invalidBlock = 99u;
+        std::memcpy(data.data() + data.size() - NodeChildrenBlockHeaderSize, &invalidBlock, sizeof(invalidBlock));
+
+        EXPECT_FALSE(readSnapshot(loadedScene));
+        ExpectSceneEmpty(loadedScene);
+    }
+
+    TEST_F(ASceneSnapshot, failsToReadDataInstanceNotMatchingItsLayout)
+    {
+        ClientScene scene;
+        const DataLayoutHandle layout = scene.allocateDataLayout({ DataFieldInfo(EDataType::Float) }, ResourceContentHash(1u, 2u));
+        const DataInstanceHandle dataInstance = scene.allocateDataInstance(layout);
+        const float value = 1234.5f;
+        scene.setDataSingleFloat(dataInstance, DataFieldHandle(0u), value);
+        writeSnapshot(scene);
+
+        // payload of data instance is preceded by its size
+        const auto valueBytes = reinterpret_cast<const Byte*>(&value);
+        const auto payloadIt = std::search(data.begin(), data.end(), valueBytes, valueBytes + sizeof(value));
+        ASSERT_NE(data.end(), payloadIt);
+        Byte* payloadSize = &*payloadIt - sizeof(uint32_t);
+        const uint32_t invalidPayloadSize = 1000u;
+        std::memcpy(payloadSize, &invalidPayloadSize, sizeof(invalidPayloadSize));
+
+        EXPECT_FALSE(readSnapshot(loadedScene));
+        ExpectSceneEmpty(loadedScene);
+    }
+
+    TEST_F(ASceneSnapshot, isDetectedByScenePersistation)
+    {
+        VectorBinaryOutputStream outStream(data);
+        ScenePersistation::WriteSceneSnapshotToStream(outStream, testingScene.getScene());
+
+        BinaryInputStream inStream(data.data());
+        EXPECT_TRUE(ScenePersistation::ReadSceneFromStream(inStream, loadedScene));
+        testingScene.CheckEquivalentTo<IScene>(loadedScene);
+    }
+
+    TEST_F(ASceneSnapshot, reportsFailureThroughScenePersistation)
+    {
+        VectorBinaryOutputStream outStream(data);
+        ScenePersistation::WriteSceneSnapshotToStream(outStream, testingScene.getScene());
+        const uint32_t otherVersion = SceneSnapshot::FormatVersion + 1u;
+        std::memcpy(data.data() + sizeof(uint32_t), &otherVersion, sizeof(otherVersion));
+
+        BinaryInputStream inStream(data.data());
+        EXPECT_FALSE(ScenePersistation::ReadSceneFromStream(inStream, loadedScene));
+        ExpectSceneEmpty(loadedScene);
+    }
+}
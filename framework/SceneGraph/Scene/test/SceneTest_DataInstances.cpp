@@ -53,6 +53,31 @@ namespace ramses_internal
         }
     }
 
+    TYPED_TEST(AScene, InitializesDataInstanceFieldsWithZeroWhenReusingReleasedDataInstance)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Float) }, ResourceContentHash(123u, 0u));
+        const DataInstanceHandle releasedInstance = this->m_scene.allocateDataInstance(dataLayout);
+        const float value = 1.f;
+        this->m_scene.setDataFloatArray(releasedInstance, DataFieldHandle(0u), 1u, &value);
+        this->m_scene.releaseDataInstance(releasedInstance);
+
+        const DataInstanceHandle containerHandle = this->m_scene.allocateDataInstance(dataLayout);
+        EXPECT_EQ(0.0f, this->m_scene.getDataSingleFloat(containerHandle, DataFieldHandle(0u)));
+    }
+
+    TYPED_TEST(AScene, PlacesDataOfDataInstancesWithSameLayoutNextToEachOther)
+    {
+        const DataLayoutHandle dataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Vector4F) }, ResourceContentHash(123u, 0u));
+        const DataLayoutHandle otherDataLayout = this->m_scene.allocateDataLayout({ DataFieldInfo(EDataType::Float) }, ResourceContentHash(124u, 0u));
+        const DataInstanceHandle instance1 = this->m_scene.allocateDataInstance(dataLayout);
+        this->m_scene.allocateDataInstance(otherDataLayout);
+        const DataInstanceHandle instance2 = this->m_scene.allocateDataInstance(dataLayout);
+
+        const auto data1 = reinterpret_cast<uintptr_t>(this->m_scene.getDataVector4fArray(instance1, DataFieldHandle(0u))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        const auto data2 = reinterpret_cast<uintptr_t>(this->m_scene.getDataVector4fArray(instance2, DataFieldHandle(0u))); // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        EXPECT_EQ(data1 + sizeof(glm::vec4), data2);
+    }
+
     TYPED_TEST(AScene, SetsTheValueOfADataInstanceProperty)
     {
         const DataFieldInfoVector dataFields =
@@ -35,4 +35,91 @@ namespace ramses_internal
         EXPECT_EQ(1u, this->m_scene.getNodeCount());
     }
 
+    TYPED_TEST(AScene, KeepsOrderOfChildrenWhenAddingAndRemovingChildren)
+    {
+        const NodeHandle parent = this->m_scene.allocateNode(2u);
+        NodeHandleVector children;
+        for (uint32_t i = 0u; i < 10u; ++i)
+        {
+            children.push_back(this->m_scene.allocateNode());
+            this->m_scene.addChildToNode(parent, children.back());
+        }
+
+        this->m_scene.removeChildFromNode(parent, children[0]);
+        this->m_scene.removeChildFromNode(parent, children[5]);
+        this->m_scene.removeChildFromNode(parent, children[9]);
+        this->m_scene.addChildToNode(parent, children[5]);
+
+        const NodeHandleVector expectedChildren{ children[1], children[2], children[3], children[4], children[6], children[7], children[8], children[5] };
+        ASSERT_EQ(expectedChildren.size(), this->m_scene.getChildCount(parent));
+        for (uint32_t i = 0u; i < expectedChildren.size(); ++i)
+            EXPECT_EQ(expectedChildren[i], this->m_scene.getChild(parent, i));
+        EXPECT_EQ(parent, this->m_scene.getParent(children[5]));
+        EXPECT_FALSE(this->m_scene.getParent(children[0]).isValid());
+    }
+
+    TYPED_TEST(AScene, KeepsChildrenOfNodesWhenManyNodesAreReparentedAndReleased)
+    {
+        const NodeHandle root1 = this->m_scene.allocateNode();
+        const NodeHandle root2 = this->m_scene.allocateNode();
+        NodeHandleVector parents;
+        for (uint32_t i = 0u; i < 500u; ++i)
+        {
+            parents.push_back(this->m_scene.allocateNode());
+            this->m_scene.addChildToNode(root1, parents.back());
+            for (uint32_t j = 0u; j < 5u; ++j)
+                this->m_scene.addChildToNode(parents.back(), this->m_scene.allocateNode());
+        }
+
+        for (uint32_t i = 0u; i < 500u; i += 2u)
+        {
+            this->m_scene.removeChildFromNode(root1, parents[i]);
+            this->m_scene.addChildToNode(root2, parents[i]);
+        }
+        for (uint32_t i = 1u; i < 500u; i += 2u)
+        {
+            while (this->m_scene.getChildCount(parents[i]) > 0u)
+            {
+                const NodeHandle child = this->m_scene.getChild(parents[i], 0u);
+                this->m_scene.removeChildFromNode(parents[i], child);
+                this->m_scene.releaseNode(child);
+            }
+        }
+
+        ASSERT_EQ(250u, this->m_scene.getChildCount(root1));
+        ASSERT_EQ(250u, this->m_scene.getChildCount(root2));
+        for (uint32_t i = 0u; i < 250u; ++i)
+        {
+            EXPECT_EQ(parents[2u * i + 1u], this->m_scene.getChild(root1, i));
+            EXPECT_EQ(0u, this->m_scene.getChildCount(parents[2u * i + 1u]));
+            EXPECT_EQ(parents[2u * i], this->m_scene.getChild(root2, i));
+            ASSERT_EQ(5u, this->m_scene.getChildCount(parents[2u * i]));
+            for (uint32_t j = 0u; j < 5u; ++j)
+                EXPECT_EQ(parents[2u * i], this->m_scene.getParent(this->m_scene.getChild(parents[2u * i], j)));
+        }
+    }
+
+    TYPED_TEST(AScene, KeepsChildrenOfNodeWhenChildrenOfReleasedNodesAreReclaimed)
+    {
+        const NodeHandle parent = this->m_scene.allocateNode();
+        NodeHandleVector children;
+        for (uint32_t i = 0u; i < 3u; ++i)
+        {
+            children.push_back(this->m_scene.allocateNode());
+            this->m_scene.addChildToNode(parent, children.back());
+        }
+
+        for (uint32_t i = 0u; i < 1000u; ++i)
+            this->m_scene.releaseNode(this->m_scene.allocateNode(4u));
+
+        for (uint32_t i = 0u; i < 5u; ++i)
+        {
+            children.push_back(this->m_scene.allocateNode());
+            this->m_scene.addChildToNode(parent, children.back());
+        }
+
+        ASSERT_EQ(children.size(), this->m_scene.getChildCount(parent));
+        for (uint32_t i = 0u; i < children.size(); ++i)
+            EXPECT_EQ(children[i], this->m_scene.getChild(parent, i));
+    }
 }
@@ -11,7 +11,9 @@
 #include "Scene/Scene.h"
 #include "TestEqualHelper.h"
 #include "Math3d/Rotation.h"
+#include "TaskFramework/ParallelForExecutor.h"
 #include "glm/gtx/transform.hpp"
+#include <algorithm>
 
 using namespace testing;
 
@@ -467,4 +469,112 @@ namespace ramses_internal
 
         this->expectCorrectMatrices(child, expectedUpdatedChildWorldMatrix, expectedUpdatedChildObjectMatrix);
     }
+
+    class ATransformationCachedSceneWithBatchUpdate : public ATransformationCachedScene
+    {
+    protected:
+        // creates a tree with given depth where every node has two children and every second node has a transform
+        NodeHandleVector createBinaryTree(uint32_t depth)
+        {
+            NodeHandleVector leaves;
+            NodeHandleVector currentLevel{ this->scene.allocateNode() };
+            for (uint32_t level = 0u; level < depth; ++level)
+            {
+                NodeHandleVector nextLevel;
+                for (const auto parent : currentLevel)
+                {
+                    for (int child = 0; child < 2; ++child)
+                    {
+                        const NodeHandle node = this->scene.allocateNode();
+                        this->scene.addChildToNode(parent, node);
+                        if (node.asMemoryHandle() % 2 == 0)
+                        {
+                            const TransformHandle nodeTransform = this->scene.allocateTransform(node);
+                            this->scene.setTranslation(nodeTransform, glm::vec3(float(node.asMemoryHandle()), 1.f, -2.f));
+                            this->scene.setRotation(nodeTransform, glm::vec4(10.f * float(level), 0.f, 5.f, 1.f), ERotationType::Euler_XYZ);
+                            this->scene.setScaling(nodeTransform, glm::vec3(1.f + 0.1f * float(child)));
+                            m_transforms.push_back(nodeTransform);
+                        }
+                        nextLevel.push_back(node);
+                    }
+                }
+                currentLevel.swap(nextLevel);
+            }
+            return currentLevel;
+        }
+
+        void expectBatchUpdateEqualToSingleNodeUpdate(const NodeHandleVector& nodes, ParallelForExecutor* executor)
+        {
+            std::vector<glm::mat4> expectedWorldMatrices;
+            std::vector<glm::mat4> expectedObjectMatrices;
+            for (const auto node : nodes)
+            {
+                expectedWorldMatrices.push_back(computeReferenceMatrix(ETransformationMatrixType_World, node));
+                expectedObjectMatrices.push_back(computeReferenceMatrix(ETransformationMatrixType_Object, node));
+            }
+
+            this->scene.updateMatrixCacheForNodes(ETransformationMatrixType_World, nodes, executor);
+            this->scene.updateMatrixCacheForNodes(ETransformationMatrixType_Object, nodes, executor);
+            for (size_t i = 0u; i < nodes.size(); ++i)
+            {
+                EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, nodes[i]));
+                EXPECT_FALSE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_Object, nodes[i]));
+                expectMatrixFloatEqual(expectedWorldMatrices[i], this->scene.getCachedMatrix(ETransformationMatrixType_World, nodes[i]));
+                expectMatrixFloatEqual(expectedObjectMatrices[i], this->scene.getCachedMatrix(ETransformationMatrixType_Object, nodes[i]));
+            }
+        }
+
+        glm::mat4 computeReferenceMatrix(ETransformationMatrixType matrixType, NodeHandle node) const
+        {
+            glm::mat4 result = glm::identity<glm::mat4>();
+            for (NodeHandle current = node; current.isValid(); current = this->scene.getParent(current))
+            {
+                const auto it = std::find_if(m_transforms.cbegin(), m_transforms.cend(), [&](TransformHandle t) { return this->scene.getTransformNode(t) == current; });
+                if (it == m_transforms.cend())
+                    continue;
+                const auto& t = this->scene.getTransform(*it);
+                const glm::mat4 local = glm::translate(t.translation) * Math3d::Rotation(t.rotation, t.rotationType) * glm::scale(t.scaling);
+                result = (matrixType == ETransformationMatrixType_World) ? local * result : result * glm::inverse(local);
+            }
+            return result;
+        }
+
+        std::vector<TransformHandle> m_transforms;
+    };
+
+    TEST_F(ATransformationCachedSceneWithBatchUpdate, computesSameMatricesAsSingleNodeUpdate)
+    {
+        const NodeHandleVector leaves = createBinaryTree(6u);
+        expectBatchUpdateEqualToSingleNodeUpdate(leaves, nullptr);
+    }
+
+    TEST_F(ATransformationCachedSceneWithBatchUpdate, computesSameMatricesAsSingleNodeUpdateUsingWorkerThreads)
+    {
+        ParallelForExecutor executor{ 3u };
+        const NodeHandleVector leaves = createBinaryTree(10u);
+        expectBatchUpdateEqualToSingleNodeUpdate(leaves, &executor);
+    }
+
+    TEST_F(ATransformationCachedSceneWithBatchUpdate, updatesOnlyDirtySubtreeAfterTransformChanged)
+    {
+        ParallelForExecutor executor{ 2u };
+        const NodeHandleVector leaves = createBinaryTree(10u);
+        expectBatchUpdateEqualToSingleNodeUpdate(leaves, &executor);
+
+        this->scene.setTranslation(m_transforms[1], glm::vec3(-3.f, 2.f, 1.f));
+        EXPECT_TRUE(this->scene.isMatrixCacheDirty(ETransformationMatrixType_World, this->scene.getTransformNode(m_transforms[1])));
+        expectBatchUpdateEqualToSingleNodeUpdate(leaves, &executor);
+    }
+
+    TEST_F(ATransformationCachedSceneWithBatchUpdate, canUpdateNodesContainedInEachOthersParentChain)
+    {
+        const NodeHandle parent = this->scene.allocateNode();
+        const NodeHandle child = this->scene.allocateNode();
+        this->scene.addChildToNode(parent, child);
+        this->scene.addChildToNode(child, this->nodeWithTransform);
+        this->scene.setTranslation(this->transform, glm::vec3(1.f, 2.f, 3.f));
+        m_transforms.push_back(this->transform);
+
+        expectBatchUpdateEqualToSingleNodeUpdate({ this->nodeWithTransform, parent, child, this->nodeWithTransform }, nullptr);
+    }
 }
@@ -75,6 +75,15 @@ namespace ramses_internal
     }
 
     using ResourceContentHashVector = std::vector<ResourceContentHash>;
+
+    // Cheap hasher for hash maps which mix the hash bits themselves (FlatHashMap), avoids byte wise hashing done by std::hash
+    struct ResourceContentHashFoldingHasher
+    {
+        size_t operator()(const ResourceContentHash& v) const
+        {
+            return static_cast<size_t>(v.lowPart ^ (v.highPart * 0x9e3779b97f4a7c15ull));
+        }
+    };
 }
 
 template <>
@@ -50,12 +50,16 @@ namespace ramses
         /// Base level of features released with version 28.0
         EFeatureLevel_01 = 1,
 
+        /// Resources larger than 1 MiB are compressed (in files and for sending over network) in chunks
+        /// which can be compressed and decompressed in parallel
+        EFeatureLevel_02 = 2,
+
         /// Equals to the latest feature level
-        EFeatureLevel_Latest = EFeatureLevel_01
+        EFeatureLevel_Latest = EFeatureLevel_02
     };
 
     /// List of all supported feature levels
-    constexpr std::array<EFeatureLevel, 1u> AllFeatureLevels{ EFeatureLevel_01 };
+    constexpr std::array<EFeatureLevel, 2u> AllFeatureLevels{ EFeatureLevel_01, EFeatureLevel_02 };
 
     static_assert(AllFeatureLevels.back() == EFeatureLevel_Latest, "All feature levels array inconsistent!");
 }
@@ -251,6 +251,35 @@ namespace ramses
         */
         RAMSES_API status_t setConnectionKeepaliveSettings(std::chrono::milliseconds interval, std::chrono::milliseconds timeout);
 
+        /**
+        * @brief Enables loading of scene files through memory mapping
+        *
+        * When enabled, #ramses::RamsesClient::loadSceneFromFile and #ramses::RamsesClient::loadSceneFromFileAsync
+        * map the file into memory and resource data is referenced directly from the mapping where possible
+        * instead of being copied to heap memory. This reduces load time and memory usage for large resources,
+        * but the file must not be modified or truncated as long as any scene or resource loaded from it exists.
+        *
+        * Default value is disabled.
+        *
+        * @param[in] enabled true to load scene files through memory mapping
+        */
+        RAMSES_API void setMemoryMappedSceneFileLoadingEnabled(bool enabled);
+
+        /**
+        * @brief Enables saving of scene files in snapshot format
+        *
+        * When enabled, #ramses::Scene::saveToFile stores the internal scene content as contiguous memory blocks
+        * instead of a sequence of scene actions. Such scene files load considerably faster because the content
+        * is copied into the scene at once instead of being recreated action by action, but they can only be loaded
+        * by a ramses version using the same snapshot format version on a platform with same memory layout.
+        * Loading detects the format automatically, this setting affects only saving.
+        *
+        * Default value is disabled.
+        *
+        * @param[in] enabled true to save scene files in snapshot format
+        */
+        RAMSES_API void setSceneSnapshotFileFormatEnabled(bool enabled);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
@@ -65,6 +65,12 @@ namespace ramses
 
         status_t setConnectionSystem(EConnectionSystem connectionSystem);
 
+        void setMemoryMappedSceneFileLoadingEnabled(bool enabled);
+        [[nodiscard]] bool isMemoryMappedSceneFileLoadingEnabled() const;
+
+        void setSceneSnapshotFileFormatEnabled(bool enabled);
+        [[nodiscard]] bool isSceneSnapshotFileFormatEnabled() const;
+
         TCPConfig        m_tcpConfig;
         ERamsesShellType m_shellType;
         ramses_internal::ThreadWatchdogConfig m_watchdogConfig;
@@ -81,6 +87,8 @@ namespace ramses
         std::string m_participantName;
         bool m_enableDltApplicationRegistration = true;
         ramses_internal::Guid m_userProvidedGuid;
+        bool m_memoryMappedSceneFileLoadingEnabled = false;
+        bool m_sceneSnapshotFileFormatEnabled = false;
     };
 }
 
@@ -59,6 +59,8 @@ namespace ramses
         status_t disconnect();
 
         EFeatureLevel getFeatureLevel() const;
+        [[nodiscard]] bool isMemoryMappedSceneFileLoadingEnabled() const;
+        [[nodiscard]] bool isSceneSnapshotFileFormatEnabled() const;
         ramses_internal::ResourceComponent& getResourceComponent();
         ramses_internal::SceneGraphComponent& getScenegraphComponent();
         ramses_internal::ParticipantIdentifier getParticipantAddress() const;
@@ -98,6 +100,8 @@ namespace ramses
         std::shared_ptr<ramses_internal::LogConnectionInfo> m_ramshCommandLogConnectionInformation;
 
         EFeatureLevel m_featureLevel;
+        bool m_memoryMappedSceneFileLoadingEnabled;
+        bool m_sceneSnapshotFileFormatEnabled;
         std::unordered_map<RamsesClient*, ClientUniquePtr> m_ramsesClients;
         RendererUniquePtr m_ramsesRenderer;
     };
@@ -157,4 +157,14 @@ namespace ramses
         m_impl.get().m_tcpConfig.setAliveTimeout(timeout);
         return StatusOK;
     }
+
+    void RamsesFrameworkConfig::setMemoryMappedSceneFileLoadingEnabled(bool enabled)
+    {
+        m_impl.get().setMemoryMappedSceneFileLoadingEnabled(enabled);
+    }
+
+    void RamsesFrameworkConfig::setSceneSnapshotFileFormatEnabled(bool enabled)
+    {
+        m_impl.get().setSceneSnapshotFileFormatEnabled(enabled);
+    }
 }
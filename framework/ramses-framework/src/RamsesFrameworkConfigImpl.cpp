@@ -190,6 +190,26 @@ namespace ramses
         return StatusOK;
     }
 
+    void RamsesFrameworkConfigImpl::setMemoryMappedSceneFileLoadingEnabled(bool enabled)
+    {
+        m_memoryMappedSceneFileLoadingEnabled = enabled;
+    }
+
+    bool RamsesFrameworkConfigImpl::isMemoryMappedSceneFileLoadingEnabled() const
+    {
+        return m_memoryMappedSceneFileLoadingEnabled;
+    }
+
+    void RamsesFrameworkConfigImpl::setSceneSnapshotFileFormatEnabled(bool enabled)
+    {
+        m_sceneSnapshotFileFormatEnabled = enabled;
+    }
+
+    bool RamsesFrameworkConfigImpl::isSceneSnapshotFileFormatEnabled() const
+    {
+        return m_sceneSnapshotFileFormatEnabled;
+    }
+
     ramses_internal::Guid RamsesFrameworkConfigImpl::getUserProvidedGuid() const
     {
         return m_userProvidedGuid;
@@ -197,8 +217,7 @@ namespace ramses
 
     void RamsesFrameworkConfigImpl::setFeatureLevelNoCheck(EFeatureLevel featureLevel)
     {
-        static_assert(EFeatureLevel_Latest == EFeatureLevel_01,
-            "remove this method which is used only for testing while there is no valid mismatching feature level yet");
+        // used only for testing of unknown feature levels
         m_featureLevel = featureLevel;
     }
 }
@@ -50,6 +50,8 @@ namespace ramses
             config.getFeatureLevel())
         , m_ramshCommandLogConnectionInformation(std::make_shared<ramses_internal::LogConnectionInfo>(*m_communicationSystem))
         , m_featureLevel{ config.getFeatureLevel() }
+        , m_memoryMappedSceneFileLoadingEnabled{ config.isMemoryMappedSceneFileLoadingEnabled() }
+        , m_sceneSnapshotFileFormatEnabled{ config.isSceneSnapshotFileFormatEnabled() }
         , m_ramsesClients()
         , m_ramsesRenderer(nullptr, [](RamsesRenderer*) {})
     {
@@ -163,6 +165,16 @@ namespace ramses
         return m_featureLevel;
     }
 
+    bool RamsesFrameworkImpl::isMemoryMappedSceneFileLoadingEnabled() const
+    {
+        return m_memoryMappedSceneFileLoadingEnabled;
+    }
+
+    bool RamsesFrameworkImpl::isSceneSnapshotFileFormatEnabled() const
+    {
+        return m_sceneSnapshotFileFormatEnabled;
+    }
+
     ramses_internal::ResourceComponent& RamsesFrameworkImpl::getResourceComponent()
     {
         return m_resourceComponent;
@@ -211,3 +211,21 @@ TEST_F(ARamsesFrameworkConfig, CanSetTCPKeepAlive)
     EXPECT_EQ(std::chrono::milliseconds(9000), frameworkConfig.m_impl.get().m_tcpConfig.getAliveTimeout());
 }
 
+
+TEST_F(ARamsesFrameworkConfig, CanEnableMemoryMappedSceneFileLoading)
+{
+    EXPECT_FALSE(frameworkConfig.m_impl.get().isMemoryMappedSceneFileLoadingEnabled());
+    frameworkConfig.setMemoryMappedSceneFileLoadingEnabled(true);
+    EXPECT_TRUE(frameworkConfig.m_impl.get().isMemoryMappedSceneFileLoadingEnabled());
+    frameworkConfig.setMemoryMappedSceneFileLoadingEnabled(false);
+    EXPECT_FALSE(frameworkConfig.m_impl.get().isMemoryMappedSceneFileLoadingEnabled());
+}
+
+TEST_F(ARamsesFrameworkConfig, CanEnableSceneSnapshotFileFormat)
+{
+    EXPECT_FALSE(frameworkConfig.m_impl.get().isSceneSnapshotFileFormatEnabled());
+    frameworkConfig.setSceneSnapshotFileFormatEnabled(true);
+    EXPECT_TRUE(frameworkConfig.m_impl.get().isSceneSnapshotFileFormatEnabled());
+    frameworkConfig.setSceneSnapshotFileFormatEnabled(false);
+    EXPECT_FALSE(frameworkConfig.m_impl.get().isSceneSnapshotFileFormatEnabled());
+}
@@ -11,6 +11,7 @@
 
 #include "Platform_Base/ShaderGPUResource.h"
 #include "Device_GL/ShaderProgramInfo.h"
+#include "Platform_Base/UniformValueCache.h"
 #include "Resource/EffectInputInformation.h"
 
 namespace ramses_internal
@@ -39,6 +40,11 @@ namespace ramses_internal
         [[nodiscard]] GLInputLocation     getAttributeLocation(DataFieldHandle) const;
         [[nodiscard]] TextureSlotInfo     getTextureSlot(DataFieldHandle) const;
 
+        // uniform values are kept by the program object, a value only needs to be uploaded
+        // if it differs from the value last uploaded for the uniform of this program
+        template <typename T>
+        bool                updateUniformValue(DataFieldHandle field, uint32_t count, const T* value) const;
+
         bool                getBinaryInfo(UInt8Vector& binaryShader, BinaryShaderFormatID& binaryShaderFormat) const;
 
     private:
@@ -54,7 +60,15 @@ namespace ramses_internal
         BufferSlotMap    m_bufferSlots;
         InputLocationMap m_uniformLocationMap;
         InputLocationMap m_attributeLocationMap;
+
+        mutable UniformValueCache m_uniformValueCache;
     };
+
+    template <typename T>
+    inline bool ShaderGPUResource_GL::updateUniformValue(DataFieldHandle field, uint32_t count, const T* value) const
+    {
+        return m_uniformValueCache.updateValue(field, count, value);
+    }
 }
 
 #endif
@@ -412,7 +412,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const float* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniform1fv(uniformLocation.getValue(), count, value);
@@ -422,7 +422,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec2* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniform2fv(uniformLocation.getValue(), count, glm::value_ptr(value[0]));
@@ -432,7 +432,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec3* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniform3fv(uniformLocation.getValue(), count, glm::value_ptr(value[0]));
@@ -442,7 +442,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::vec4* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniform4fv(uniformLocation.getValue(), count, glm::value_ptr(value[0]));
@@ -452,7 +452,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const int32_t* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniform1iv(uniformLocation.getValue(), count, value);
@@ -462,7 +462,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec2* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniform2iv(uniformLocation.getValue(), count, glm::value_ptr(value[0]));
@@ -472,7 +472,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec3* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniform3iv(uniformLocation.getValue(), count, glm::value_ptr(value[0]));
@@ -482,7 +482,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::ivec4* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniform4iv(uniformLocation.getValue(), count, glm::value_ptr(value[0]));
@@ -492,7 +492,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat2* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniformMatrix2fv(uniformLocation.getValue(), count, ToGLboolean(false), glm::value_ptr(value[0]));
@@ -502,7 +502,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat3* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniformMatrix3fv(uniformLocation.getValue(), count, ToGLboolean(false), glm::value_ptr(value[0]));
@@ -512,7 +512,7 @@ namespace ramses_internal
     void Device_GL::setConstant(DataFieldHandle field, uint32_t count, const glm::mat4* value)
     {
         GLInputLocation uniformLocation;
-        if (getUniformLocation(field, uniformLocation))
+        if (getUniformLocation(field, uniformLocation) && m_activeShader->updateUniformValue(field, count, value))
         {
             assert(nullptr != value);
             glUniformMatrix4fv(uniformLocation.getValue(), count, ToGLboolean(false), glm::value_ptr(value[0]));
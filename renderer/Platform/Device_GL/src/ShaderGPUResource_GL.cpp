@@ -16,6 +16,7 @@ namespace ramses_internal
     ShaderGPUResource_GL::ShaderGPUResource_GL(const EffectResource& effect, ShaderProgramInfo shaderProgramInfo)
         : ShaderGPUResource(shaderProgramInfo.shaderProgramHandle)
         , m_shaderProgramInfo(std::move(shaderProgramInfo))
+        , m_uniformValueCache(effect.getUniformInputs().size())
     {
         preloadVariableLocations(effect);
     }
@@ -0,0 +1,44 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_UNIFORMVALUECACHE_H
+#define RAMSES_UNIFORMVALUECACHE_H
+
+#include "SceneAPI/Handles.h"
+#include "PlatformAbstraction/PlatformTypes.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    // Values last uploaded to uniforms of a single shader program.
+    // Uniform values are state of the program object (shared by all contexts sharing the program), so a value only needs
+    // to be uploaded if it differs from the value last uploaded to the same uniform of the same program.
+    // Every program (and every program created in a new context) must use its own cache.
+    class UniformValueCache
+    {
+    public:
+        explicit UniformValueCache(size_t uniformCount);
+
+        // returns true if value differs from the last uploaded one and has to be uploaded, it is then stored as uploaded value
+        template <typename T>
+        bool updateValue(DataFieldHandle field, uint32_t count, const T* value);
+
+    private:
+        bool updateValueData(DataFieldHandle field, const Byte* data, size_t dataSize);
+
+        std::vector<std::vector<Byte>> m_uploadedValues;
+    };
+
+    template <typename T>
+    inline bool UniformValueCache::updateValue(DataFieldHandle field, uint32_t count, const T* value)
+    {
+        return updateValueData(field, reinterpret_cast<const Byte*>(value), count * sizeof(T));
+    }
+}
+
+#endif
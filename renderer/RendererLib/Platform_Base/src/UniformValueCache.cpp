@@ -0,0 +1,30 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "Platform_Base/UniformValueCache.h"
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    UniformValueCache::UniformValueCache(size_t uniformCount)
+        : m_uploadedValues(uniformCount)
+    {
+    }
+
+    bool UniformValueCache::updateValueData(DataFieldHandle field, const Byte* data, size_t dataSize)
+    {
+        assert(field.asMemoryHandle() < m_uploadedValues.size());
+        std::vector<Byte>& uploadedValue = m_uploadedValues[field.asMemoryHandle()];
+        if (uploadedValue.size() == dataSize && std::equal(uploadedValue.cbegin(), uploadedValue.cend(), data))
+            return false;
+
+        uploadedValue.assign(data, data + dataSize);
+        return true;
+    }
+}
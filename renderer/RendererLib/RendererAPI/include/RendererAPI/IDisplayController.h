@@ -43,6 +43,9 @@ namespace ramses_internal
         virtual void                    readPixels(DeviceResourceHandle renderTargetHandle, uint32_t x, uint32_t y, uint32_t width, uint32_t height, std::vector<uint8_t>& dataOut) = 0;
 
         virtual void                    validateRenderingStatusHealthy() const = 0;
+
+        // number of device state changes skipped because state did not change between renderables since last call
+        virtual uint32_t                getAndResetAvoidedStateChangeCount() = 0;
     };
 }
 
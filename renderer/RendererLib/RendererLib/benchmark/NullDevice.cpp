@@ -0,0 +1,433 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "NullDevice.h"
+
+namespace ramses_internal
+{
+    const DeviceResourceHandle NullDevice::FramebufferRenderTarget(1u);
+
+    const NullDevice::CallCounts& NullDevice::getCallCounts() const
+    {
+        return m_callCounts;
+    }
+
+    void NullDevice::resetCallCounts()
+    {
+        m_callCounts = {};
+    }
+
+    DeviceResourceHandle NullDevice::allocateHandle()
+    {
+        const DeviceResourceHandle handle = m_nextHandle;
+        ++m_nextHandle;
+        return handle;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const float*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::vec2*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::vec3*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::vec4*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const int32_t*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::ivec2*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::ivec3*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::ivec4*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::mat2*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::mat3*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::setConstant(DataFieldHandle, uint32_t, const glm::mat4*)
+    {
+        ++m_callCounts.uniformUploads;
+    }
+
+    void NullDevice::colorMask(bool, bool, bool, bool)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::clearColor(const glm::vec4&)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::blendOperations(EBlendOperation, EBlendOperation)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::blendFactors(EBlendFactor, EBlendFactor, EBlendFactor, EBlendFactor)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::blendColor(const glm::vec4&)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::cullMode(ECullMode)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::depthFunc(EDepthFunc)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::depthWrite(EDepthWrite)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::scissorTest(EScissorTest, const RenderState::ScissorRegion&)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::stencilFunc(EStencilFunc, uint8_t, uint8_t)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::stencilOp(EStencilOp, EStencilOp, EStencilOp)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::drawMode(EDrawMode)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::setViewport(int32_t, int32_t, uint32_t, uint32_t)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    DeviceResourceHandle NullDevice::allocateVertexBuffer(uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    void NullDevice::uploadVertexBufferData(DeviceResourceHandle, const Byte*, uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+    }
+
+    void NullDevice::deleteVertexBuffer(DeviceResourceHandle)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::allocateVertexArray(const VertexArrayInfo&)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    void NullDevice::activateVertexArray(DeviceResourceHandle)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::deleteVertexArray(DeviceResourceHandle)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::allocateIndexBuffer(EDataType, uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    void NullDevice::uploadIndexBufferData(DeviceResourceHandle, const Byte*, uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+    }
+
+    void NullDevice::deleteIndexBuffer(DeviceResourceHandle)
+    {
+    }
+
+    std::unique_ptr<const GPUResource> NullDevice::uploadShader(const EffectResource&)
+    {
+        ++m_callCounts.resourceUploads;
+        return nullptr;
+    }
+
+    DeviceResourceHandle NullDevice::registerShader(std::unique_ptr<const GPUResource>)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    DeviceResourceHandle NullDevice::uploadBinaryShader(const EffectResource&, const uint8_t*, uint32_t, BinaryShaderFormatID)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    bool NullDevice::getBinaryShader(DeviceResourceHandle, UInt8Vector&, BinaryShaderFormatID&)
+    {
+        return false;
+    }
+
+    void NullDevice::deleteShader(DeviceResourceHandle)
+    {
+    }
+
+    void NullDevice::activateShader(DeviceResourceHandle)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    DeviceResourceHandle NullDevice::allocateTexture2D(uint32_t, uint32_t, ETextureFormat, const TextureSwizzleArray&, uint32_t, uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    DeviceResourceHandle NullDevice::allocateTexture3D(uint32_t, uint32_t, uint32_t, ETextureFormat, uint32_t, uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    DeviceResourceHandle NullDevice::allocateTextureCube(uint32_t, ETextureFormat, const TextureSwizzleArray&, uint32_t, uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    DeviceResourceHandle NullDevice::allocateExternalTexture()
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    DeviceResourceHandle NullDevice::getEmptyExternalTexture() const
+    {
+        return {};
+    }
+
+    void NullDevice::bindTexture(DeviceResourceHandle)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::generateMipmaps(DeviceResourceHandle)
+    {
+    }
+
+    void NullDevice::uploadTextureData(DeviceResourceHandle, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, uint32_t, const Byte*, uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+    }
+
+    DeviceResourceHandle NullDevice::uploadStreamTexture2D(DeviceResourceHandle, uint32_t, uint32_t, ETextureFormat, const uint8_t*, const TextureSwizzleArray&)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    void NullDevice::deleteTexture(DeviceResourceHandle)
+    {
+    }
+
+    void NullDevice::activateTexture(DeviceResourceHandle, DataFieldHandle)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    DeviceResourceHandle NullDevice::uploadRenderBuffer(uint32_t, uint32_t, ERenderBufferType, ETextureFormat, ERenderBufferAccessMode, uint32_t)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    void NullDevice::deleteRenderBuffer(DeviceResourceHandle)
+    {
+    }
+
+    void NullDevice::activateTextureSamplerObject(const TextureSamplerStates&, DataFieldHandle)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    DeviceResourceHandle NullDevice::uploadDmaRenderBuffer(uint32_t, uint32_t, DmaBufferFourccFormat, DmaBufferUsageFlags, DmaBufferModifiers)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    int NullDevice::getDmaRenderBufferFD(DeviceResourceHandle)
+    {
+        return 0;
+    }
+
+    uint32_t NullDevice::getDmaRenderBufferStride(DeviceResourceHandle)
+    {
+        return 0u;
+    }
+
+    void NullDevice::destroyDmaRenderBuffer(DeviceResourceHandle)
+    {
+    }
+
+    DeviceResourceHandle NullDevice::getFramebufferRenderTarget() const
+    {
+        return FramebufferRenderTarget;
+    }
+
+    DeviceResourceHandle NullDevice::uploadRenderTarget(const DeviceHandleVector&)
+    {
+        ++m_callCounts.resourceUploads;
+        return allocateHandle();
+    }
+
+    void NullDevice::activateRenderTarget(DeviceResourceHandle)
+    {
+        ++m_callCounts.stateChanges;
+    }
+
+    void NullDevice::deleteRenderTarget(DeviceResourceHandle)
+    {
+    }
+
+    void NullDevice::discardDepthStencil()
+    {
+    }
+
+    void NullDevice::blitRenderTargets(DeviceResourceHandle, DeviceResourceHandle, const PixelRectangle&, const PixelRectangle&, bool)
+    {
+    }
+
+    void NullDevice::drawIndexedTriangles(int32_t, int32_t, uint32_t)
+    {
+        ++m_callCounts.drawCalls;
+        ++m_drawCallsSinceLastReset;
+    }
+
+    void NullDevice::drawTriangles(int32_t, int32_t, uint32_t)
+    {
+        ++m_callCounts.drawCalls;
+        ++m_drawCallsSinceLastReset;
+    }
+
+    void NullDevice::clear(uint32_t)
+    {
+    }
+
+    void NullDevice::pairRenderTargetsForDoubleBuffering(const std::array<DeviceResourceHandle, 2>&, const std::array<DeviceResourceHandle, 2>&)
+    {
+    }
+
+    void NullDevice::unpairRenderTargets(DeviceResourceHandle)
+    {
+    }
+
+    void NullDevice::swapDoubleBufferedRenderTarget(DeviceResourceHandle)
+    {
+    }
+
+    void NullDevice::readPixels(uint8_t*, uint32_t, uint32_t, uint32_t, uint32_t)
+    {
+    }
+
+    uint32_t NullDevice::getTotalGpuMemoryUsageInKB() const
+    {
+        return 0u;
+    }
+
+    uint32_t NullDevice::getAndResetDrawCallCount()
+    {
+        const uint32_t drawCalls = m_drawCallsSinceLastReset;
+        m_drawCallsSinceLastReset = 0u;
+        return drawCalls;
+    }
+
+    void NullDevice::clearDepth(float)
+    {
+    }
+
+    void NullDevice::clearStencil(int32_t)
+    {
+    }
+
+    int32_t NullDevice::getTextureAddress(DeviceResourceHandle) const
+    {
+        return 0;
+    }
+
+    void NullDevice::validateDeviceStatusHealthy() const
+    {
+    }
+
+    bool NullDevice::isDeviceStatusHealthy() const
+    {
+        return true;
+    }
+
+    void NullDevice::getSupportedBinaryProgramFormats(std::vector<BinaryShaderFormatID>&) const
+    {
+    }
+
+    bool NullDevice::isExternalTextureExtensionSupported() const
+    {
+        return false;
+    }
+
+    void NullDevice::flush()
+    {
+    }
+
+    uint32_t NullDevice::getGPUHandle(DeviceResourceHandle) const
+    {
+        return 0u;
+    }
+}
@@ -0,0 +1,95 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_NULLRENDERERCOMPONENTS_H
+#define RAMSES_NULLRENDERERCOMPONENTS_H
+
+#include "RendererLib/IResourceDeviceHandleAccessor.h"
+#include "RendererLib/SceneReferenceLogic.h"
+#include "RendererAPI/IPlatform.h"
+#include "RendererFramework/IRendererSceneEventSender.h"
+#include "Watchdog/IThreadAliveNotifier.h"
+
+namespace ramses_internal
+{
+    // Trivial implementations of renderer interfaces needed to run renderer components headless,
+    // unlike mocks they add no overhead to the measured code.
+
+    // Reports every resource as uploaded
+    class NullResourceDeviceHandleAccessor final : public IResourceDeviceHandleAccessor
+    {
+    public:
+        [[nodiscard]] DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& /*resourceHash*/) const override { return UploadedHandle(); }
+        [[nodiscard]] BoundingBox getResourceBoundingBox(const ResourceContentHash& /*resourceHash*/) const override { return {}; }
+        [[nodiscard]] DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle /*targetHandle*/, SceneId /*sceneId*/) const override { return UploadedHandle(); }
+        [[nodiscard]] DeviceResourceHandle getRenderTargetBufferDeviceHandle(RenderBufferHandle /*bufferHandle*/, SceneId /*sceneId*/) const override { return UploadedHandle(); }
+        void getBlitPassRenderTargetsDeviceHandle(BlitPassHandle /*blitPassHandle*/, SceneId /*sceneId*/, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const override
+        {
+            srcRT = UploadedHandle();
+            dstRT = UploadedHandle();
+        }
+        [[nodiscard]] DeviceResourceHandle getOffscreenBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return UploadedHandle(); }
+        [[nodiscard]] DeviceResourceHandle getOffscreenBufferColorBufferDeviceHandle(OffscreenBufferHandle /*bufferHandle*/) const override { return UploadedHandle(); }
+        [[nodiscard]] int getDmaOffscreenBufferFD(OffscreenBufferHandle /*bufferHandle*/) const override { return -1; }
+        [[nodiscard]] uint32_t getDmaOffscreenBufferStride(OffscreenBufferHandle /*bufferHandle*/) const override { return 0u; }
+        [[nodiscard]] OffscreenBufferHandle getOffscreenBufferHandle(DeviceResourceHandle /*bufferDeviceHandle*/) const override { return {}; }
+        [[nodiscard]] DeviceResourceHandle getStreamBufferDeviceHandle(StreamBufferHandle /*bufferHandle*/) const override { return UploadedHandle(); }
+        [[nodiscard]] DeviceResourceHandle getExternalBufferDeviceHandle(ExternalBufferHandle /*bufferHandle*/) const override { return UploadedHandle(); }
+        [[nodiscard]] DeviceResourceHandle getEmptyExternalBufferDeviceHandle() const override { return UploadedHandle(); }
+        [[nodiscard]] uint32_t getExternalBufferGlId(ExternalBufferHandle /*externalTexHandle*/) const override { return 0u; }
+        [[nodiscard]] DeviceResourceHandle getDataBufferDeviceHandle(DataBufferHandle /*dataBufferHandle*/, SceneId /*sceneId*/) const override { return UploadedHandle(); }
+        [[nodiscard]] DeviceResourceHandle getTextureBufferDeviceHandle(TextureBufferHandle /*textureBufferHandle*/, SceneId /*sceneId*/) const override { return UploadedHandle(); }
+        [[nodiscard]] DeviceResourceHandle getVertexArrayDeviceHandle(RenderableHandle /*renderableHandle*/, SceneId /*sceneId*/) const override { return UploadedHandle(); }
+
+    private:
+        static constexpr DeviceResourceHandle UploadedHandle()
+        {
+            return DeviceResourceHandle{ 1000u };
+        }
+    };
+
+    // Platform without any backend, usable only for displays which never get to render
+    class NullPlatform final : public IPlatform
+    {
+    public:
+        IRenderBackend* createRenderBackend(const DisplayConfig& /*displayConfig*/, IWindowEventHandler& /*windowEventHandler*/) override { return nullptr; }
+        void destroyRenderBackend() override {}
+        IResourceUploadRenderBackend* createResourceUploadRenderBackend() override { return nullptr; }
+        void destroyResourceUploadRenderBackend() override {}
+        ISystemCompositorController* getSystemCompositorController() override { return nullptr; }
+    };
+
+    class NullSceneEventSender final : public IRendererSceneEventSender
+    {
+    public:
+        void sendSubscribeScene(SceneId /*sceneId*/) override {}
+        void sendUnsubscribeScene(SceneId /*sceneId*/) override {}
+        void sendSceneStateChanged(SceneId /*masterScene*/, SceneId /*referencedScene*/, RendererSceneState /*newState*/) override {}
+        void sendSceneFlushed(SceneId /*masterScene*/, SceneId /*referencedScene*/, SceneVersionTag /*tag*/) override {}
+        void sendDataLinked(SceneId /*masterScene*/, SceneId /*providerScene*/, DataSlotId /*provider*/, SceneId /*consumerScene*/, DataSlotId /*consumer*/, bool /*success*/) override {}
+        void sendDataUnlinked(SceneId /*masterScene*/, SceneId /*consumerScene*/, DataSlotId /*consumer*/, bool /*success*/) override {}
+    };
+
+    class NullThreadAliveNotifier final : public IThreadAliveNotifier
+    {
+    public:
+        uint64_t registerThread() override { return 0u; }
+        void unregisterThread(uint64_t /*identifier*/) override {}
+        void notifyAlive(uint64_t /*identifier*/) override {}
+        [[nodiscard]] std::chrono::milliseconds calculateTimeout() const override { return std::chrono::milliseconds{ 1000 }; }
+    };
+
+    class NullSceneReferenceLogic final : public ISceneReferenceLogic
+    {
+    public:
+        void addActions(SceneId /*masterScene*/, const SceneReferenceActionVector& /*actions*/) override {}
+        void update() override {}
+    };
+}
+
+#endif
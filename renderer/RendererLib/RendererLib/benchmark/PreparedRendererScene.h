@@ -0,0 +1,60 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PREPAREDRENDERERSCENE_H
+#define RAMSES_PREPAREDRENDERERSCENE_H
+
+#include "SyntheticScene.h"
+#include "NullRendererComponents.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererEventCollector.h"
+
+namespace ramses_internal
+{
+    // Renderer scene with generated content and all resources reported as uploaded, ready to be rendered
+    class PreparedRendererScene
+    {
+    public:
+        explicit PreparedRendererScene(const SyntheticSceneParams& params)
+            : m_rendererScene(m_rendererScenes.createScene(SceneInfo(SceneId{ 1u })))
+            , m_syntheticScene(m_rendererScene, params)
+        {
+            m_rendererScene.updateRenderablesAndResourceCache(m_resourceAccessor);
+            m_rendererScene.updateRenderableVertexArrays(m_resourceAccessor, m_syntheticScene.getRenderables());
+            m_rendererScene.markVertexArraysClean();
+            m_rendererScene.updateRenderableWorldMatrices();
+        }
+
+        // same sequence as renderer scene updater runs every frame on a rendered scene
+        void update()
+        {
+            m_rendererScene.updateRenderablesAndResourceCache(m_resourceAccessor);
+            m_rendererScene.updateRenderableWorldMatrices();
+        }
+
+        RendererCachedScene& getScene()
+        {
+            return m_rendererScene;
+        }
+
+        SyntheticScene& getSyntheticScene()
+        {
+            return m_syntheticScene;
+        }
+
+    private:
+        RendererEventCollector m_eventCollector;
+        RendererScenes m_rendererScenes{ m_eventCollector };
+        RendererCachedScene& m_rendererScene;
+        SyntheticScene m_syntheticScene;
+        NullResourceDeviceHandleAccessor m_resourceAccessor;
+    };
+}
+
+#endif
@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "PreparedRendererScene.h"
+#include "NullDevice.h"
+#include "RenderExecutor.h"
+#include "RendererAPI/RenderingContext.h"
+
+namespace ramses_internal
+{
+    static void BM_RenderExecutor_ExecuteScene(benchmark::State& state)
+    {
+        const SyntheticSceneParams params{ static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)), static_cast<uint32_t>(state.range(2)) };
+        PreparedRendererScene scene(params);
+
+        NullDevice device;
+        RenderingContext renderContext;
+        renderContext.displayBufferDeviceHandle = NullDevice::FramebufferRenderTarget;
+        renderContext.viewportWidth = 1280u;
+        renderContext.viewportHeight = 480u;
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            RenderExecutor executor(device, renderContext);
+            benchmark::DoNotOptimize(executor.executeScene(scene.getScene()));
+        }
+
+        // device calls of single frame, so that effect of render state and uniform caching is visible
+        const auto& counts = device.getCallCounts();
+        const auto iterations = static_cast<double>(state.iterations());
+        state.counters["drawCalls"] = static_cast<double>(counts.drawCalls) / iterations;
+        state.counters["stateChanges"] = static_cast<double>(counts.stateChanges) / iterations;
+        state.counters["uniformUploads"] = static_cast<double>(counts.uniformUploads) / iterations;
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+    BENCHMARK(BM_RenderExecutor_ExecuteScene)->ArgNames({ "nodes", "renderables", "passes" })
+        ->Args({ 100, 100, 1 })->Args({ 1000, 1000, 1 })->Args({ 1000, 1000, 8 })->Args({ 10000, 10000, 1 })->Args({ 10000, 10000, 16 });
+
+    // frame with changing transformations, uniforms of all affected renderables are uploaded again
+    static void BM_RenderExecutor_UpdateAndExecuteScene(benchmark::State& state)
+    {
+        const SyntheticSceneParams params{ static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(0)), 1u };
+        const auto modifiedTransforms = static_cast<uint32_t>(state.range(1));
+        PreparedRendererScene scene(params);
+
+        NullDevice device;
+        RenderingContext renderContext;
+        renderContext.displayBufferDeviceHandle = NullDevice::FramebufferRenderTarget;
+        renderContext.viewportWidth = 1280u;
+        renderContext.viewportHeight = 480u;
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            scene.getSyntheticScene().modifyTransforms(modifiedTransforms);
+            scene.update();
+            RenderExecutor executor(device, renderContext);
+            benchmark::DoNotOptimize(executor.executeScene(scene.getScene()));
+        }
+        state.counters["drawCalls"] = static_cast<double>(device.getCallCounts().drawCalls) / static_cast<double>(state.iterations());
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+    BENCHMARK(BM_RenderExecutor_UpdateAndExecuteScene)->ArgNames({ "nodes", "modified" })
+        ->Args({ 1000, 10 })->Args({ 1000, 1000 })->Args({ 10000, 100 })->Args({ 10000, 10000 });
+}
@@ -0,0 +1,31 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "PreparedRendererScene.h"
+
+namespace ramses_internal
+{
+    static void BM_RendererCachedScene_Update(benchmark::State& state)
+    {
+        const SyntheticSceneParams params{ static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)), 1u };
+        const auto modifiedTransforms = static_cast<uint32_t>(state.range(2));
+        PreparedRendererScene scene(params);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            scene.getSyntheticScene().modifyTransforms(modifiedTransforms);
+            scene.update();
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(1));
+    }
+    BENCHMARK(BM_RendererCachedScene_Update)->ArgNames({ "nodes", "renderables", "modified" })
+        ->Args({ 1000, 1000, 0 })->Args({ 1000, 1000, 10 })->Args({ 1000, 1000, 1000 })
+        ->Args({ 10000, 10000, 100 })->Args({ 10000, 10000, 10000 });
+}
@@ -0,0 +1,152 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "SyntheticScene.h"
+#include "NullRendererComponents.h"
+#include "Scene/ActionCollectingScene.h"
+#include "Scene/EScenePublicationMode.h"
+#include "Components/SceneUpdate.h"
+#include "RendererLib/RendererSceneUpdater.h"
+#include "RendererLib/Renderer.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererLib/SceneStateExecutor.h"
+#include "RendererLib/SceneExpirationMonitor.h"
+#include "RendererLib/RendererStatistics.h"
+#include "RendererLib/FrameTimer.h"
+#include "RendererEventCollector.h"
+#include <memory>
+#include <vector>
+
+namespace ramses_internal
+{
+    // Renderer scene updater without display, scenes are subscribed but not mapped,
+    // i.e. measures receiving, consolidating and applying of flushes.
+    class HeadlessSceneUpdater
+    {
+    public:
+        HeadlessSceneUpdater()
+        {
+            m_sceneUpdater.setSceneReferenceLogicHandler(m_sceneReferenceLogic);
+        }
+
+        void subscribeScene(ActionCollectingScene& scene)
+        {
+            const SceneId sceneId = scene.getSceneId();
+            m_sceneUpdater.handleScenePublished(sceneId, EScenePublicationMode_LocalAndRemote);
+            m_sceneUpdater.handleSceneSubscriptionRequest(sceneId);
+            m_sceneUpdater.handleSceneReceived(SceneInfo(sceneId));
+            flush(scene);
+            doOneFrame();
+        }
+
+        void flush(ActionCollectingScene& scene)
+        {
+            const SceneSizeInformation newSizeInfo = scene.getSceneSizeInformation();
+            const SceneSizeInformation currSizeInfo = m_rendererScenes.hasScene(scene.getSceneId()) ? m_rendererScenes.getScene(scene.getSceneId()).getSceneSizeInformation() : SceneSizeInformation();
+
+            SceneUpdate update;
+            update.actions = std::move(scene.getSceneActionCollection());
+            update.flushInfos.flushCounter = ++m_flushCounter;
+            update.flushInfos.sizeInfo = newSizeInfo;
+            update.flushInfos.hasSizeInfo = newSizeInfo > currSizeInfo;
+            update.flushInfos.containsValidInformation = true;
+            scene.getSceneActionCollection().clear();
+            m_sceneUpdater.handleSceneUpdate(scene.getSceneId(), std::move(update));
+        }
+
+        void doOneFrame()
+        {
+            m_frameTimer.startFrame();
+            m_renderer.getProfilerStatistics().markFrameFinished(std::chrono::microseconds{ 0u });
+            m_sceneUpdater.updateScenes();
+
+            // events are never consumed otherwise
+            m_rendererEvents.clear();
+            m_sceneControlEvents.clear();
+            m_internalSceneEvents.clear();
+            m_eventCollector.appendAndConsumePendingEvents(m_rendererEvents, m_sceneControlEvents);
+            m_eventCollector.dispatchInternalSceneStateEvents(m_internalSceneEvents);
+        }
+
+    private:
+        RendererEventCollector m_eventCollector;
+        RendererScenes m_rendererScenes{ m_eventCollector };
+        FrameTimer m_frameTimer;
+        RendererStatistics m_statistics;
+        SceneExpirationMonitor m_expirationMonitor{ m_rendererScenes, m_eventCollector, m_statistics };
+        NullPlatform m_platform;
+        Renderer m_renderer{ DisplayHandle{ 1u }, m_platform, m_rendererScenes, m_eventCollector, m_frameTimer, m_expirationMonitor, m_statistics };
+        NullSceneEventSender m_sceneEventSender;
+        SceneStateExecutor m_sceneStateExecutor{ m_renderer, m_sceneEventSender, m_eventCollector };
+        NullThreadAliveNotifier m_threadAliveNotifier;
+        RendererSceneUpdater m_sceneUpdater{ DisplayHandle{ 1u }, m_platform, m_renderer, m_rendererScenes, m_sceneStateExecutor, m_eventCollector, m_frameTimer, m_expirationMonitor, m_threadAliveNotifier };
+        NullSceneReferenceLogic m_sceneReferenceLogic;
+
+        uint64_t m_flushCounter = 0u;
+        RendererEventVector m_rendererEvents;
+        RendererEventVector m_sceneControlEvents;
+        InternalSceneStateEvents m_internalSceneEvents;
+    };
+
+    static void BM_RendererSceneUpdater_ApplyFlushes(benchmark::State& state)
+    {
+        const SyntheticSceneParams params{ static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(0)), 1u };
+        const auto flushesPerFrame = static_cast<uint32_t>(state.range(1));
+        const auto modifiedTransformsPerFlush = static_cast<uint32_t>(state.range(2));
+
+        ActionCollectingScene clientScene(SceneInfo(SceneId{ 1u }));
+        SyntheticScene syntheticScene(clientScene, params);
+        HeadlessSceneUpdater updater;
+        updater.subscribeScene(clientScene);
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (uint32_t i = 0u; i < flushesPerFrame; ++i)
+            {
+                syntheticScene.modifyTransforms(modifiedTransformsPerFlush);
+                updater.flush(clientScene);
+            }
+            updater.doOneFrame();
+        }
+        state.SetItemsProcessed(state.iterations() * flushesPerFrame);
+    }
+    BENCHMARK(BM_RendererSceneUpdater_ApplyFlushes)->ArgNames({ "nodes", "flushes", "modified" })
+        ->Args({ 1000, 1, 10 })->Args({ 1000, 10, 10 })->Args({ 1000, 1, 1000 })
+        ->Args({ 10000, 1, 100 })->Args({ 10000, 10, 100 })->Args({ 10000, 60, 100 });
+
+    // many small scenes updated in one frame
+    static void BM_RendererSceneUpdater_ManyScenes(benchmark::State& state)
+    {
+        const auto sceneCount = static_cast<uint32_t>(state.range(0));
+        const SyntheticSceneParams params{ 100u, 100u, 1u };
+
+        HeadlessSceneUpdater updater;
+        std::vector<std::unique_ptr<ActionCollectingScene>> clientScenes;
+        std::vector<std::unique_ptr<SyntheticScene>> syntheticScenes;
+        for (uint32_t i = 0u; i < sceneCount; ++i)
+        {
+            clientScenes.push_back(std::make_unique<ActionCollectingScene>(SceneInfo(SceneId{ i + 1u })));
+            syntheticScenes.push_back(std::make_unique<SyntheticScene>(*clientScenes.back(), params));
+            updater.subscribeScene(*clientScenes.back());
+        }
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            for (uint32_t i = 0u; i < sceneCount; ++i)
+            {
+                syntheticScenes[i]->modifyTransforms(10u);
+                updater.flush(*clientScenes[i]);
+            }
+            updater.doOneFrame();
+        }
+        state.SetItemsProcessed(state.iterations() * sceneCount);
+    }
+    BENCHMARK(BM_RendererSceneUpdater_ManyScenes)->ArgNames({ "scenes" })->Arg(1)->Arg(10)->Arg(50);
+}
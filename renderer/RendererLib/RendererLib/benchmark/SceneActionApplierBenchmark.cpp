@@ -0,0 +1,71 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "benchmark/benchmark.h"
+
+#include "SyntheticScene.h"
+#include "Scene/ActionCollectingScene.h"
+#include "Scene/SceneActionApplier.h"
+#include "RendererLib/RendererScenes.h"
+#include "RendererLib/RendererCachedScene.h"
+#include "RendererEventCollector.h"
+#include <memory>
+
+namespace ramses_internal
+{
+    // whole scene content received in initial flush
+    static void BM_SceneActionApplier_InitialFlush(benchmark::State& state)
+    {
+        const SyntheticSceneParams params{ static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(1)), static_cast<uint32_t>(state.range(2)) };
+        ActionCollectingScene clientScene(SceneInfo(SceneId{ 1u }));
+        SyntheticScene syntheticScene(clientScene, params);
+        const SceneActionCollection actions = clientScene.getSceneActionCollection().copy();
+        const SceneSizeInformation sizeInfo = clientScene.getSceneSizeInformation();
+
+        RendererEventCollector eventCollector;
+        std::unique_ptr<RendererScenes> rendererScenes;
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+        {
+            state.PauseTiming();
+            rendererScenes = std::make_unique<RendererScenes>(eventCollector);
+            RendererCachedScene& rendererScene = rendererScenes->createScene(SceneInfo(SceneId{ 1u }));
+            rendererScene.preallocateSceneSize(sizeInfo);
+            state.ResumeTiming();
+
+            SceneActionApplier::ApplyActionsOnScene(rendererScene, actions);
+        }
+        state.SetItemsProcessed(state.iterations() * actions.numberOfActions());
+        state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(actions.collectionData().size()));
+    }
+    BENCHMARK(BM_SceneActionApplier_InitialFlush)->ArgNames({ "nodes", "renderables", "passes" })
+        ->Args({ 100, 100, 1 })->Args({ 1000, 1000, 4 })->Args({ 10000, 10000, 16 });
+
+    // typical per frame flush changing a number of transformations
+    static void BM_SceneActionApplier_TransformFlush(benchmark::State& state)
+    {
+        const SyntheticSceneParams params{ static_cast<uint32_t>(state.range(0)), static_cast<uint32_t>(state.range(0)), 1u };
+        ActionCollectingScene clientScene(SceneInfo(SceneId{ 1u }));
+        SyntheticScene syntheticScene(clientScene, params);
+
+        RendererEventCollector eventCollector;
+        RendererScenes rendererScenes(eventCollector);
+        RendererCachedScene& rendererScene = rendererScenes.createScene(SceneInfo(SceneId{ 1u }));
+        rendererScene.preallocateSceneSize(clientScene.getSceneSizeInformation());
+        SceneActionApplier::ApplyActionsOnScene(rendererScene, clientScene.getSceneActionCollection());
+        clientScene.getSceneActionCollection().clear();
+
+        syntheticScene.modifyTransforms(static_cast<uint32_t>(state.range(1)));
+        const SceneActionCollection actions = clientScene.getSceneActionCollection().copy();
+
+        for (auto _ : state) // NOLINT(clang-analyzer-deadcode.DeadStores) False positive
+            SceneActionApplier::ApplyActionsOnScene(rendererScene, actions);
+        state.SetItemsProcessed(state.iterations() * actions.numberOfActions());
+    }
+    BENCHMARK(BM_SceneActionApplier_TransformFlush)->ArgNames({ "nodes", "modified" })
+        ->Args({ 1000, 10 })->Args({ 1000, 1000 })->Args({ 10000, 100 })->Args({ 10000, 10000 });
+}
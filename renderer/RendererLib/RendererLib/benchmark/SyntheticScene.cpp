@@ -0,0 +1,137 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "SyntheticScene.h"
+#include "SceneAPI/IScene.h"
+#include "SceneAPI/Camera.h"
+#include "SceneAPI/DataFieldInfo.h"
+#include "SceneAPI/ECameraProjectionType.h"
+#include <cassert>
+
+namespace ramses_internal
+{
+    const ResourceContentHash SyntheticScene::EffectHash{ 0xEFFEC7u, 0u };
+    const ResourceContentHash SyntheticScene::IndexArrayHash{ 0x1D1CE5u, 0u };
+    const ResourceContentHash SyntheticScene::VertexArrayHash{ 0x7E87E5u, 0u };
+
+    SyntheticScene::SyntheticScene(IScene& scene, const SyntheticSceneParams& params)
+        : m_scene(scene)
+    {
+        assert(params.nodeCount > 0u && params.passCount > 0u);
+        createNodes(params.nodeCount);
+        createPasses(params.passCount);
+        createRenderables(params.renderableCount);
+    }
+
+    void SyntheticScene::modifyTransforms(uint32_t count)
+    {
+        m_translationOffset += 1.f;
+        for (uint32_t i = 0u; i < count; ++i)
+        {
+            m_scene.setTranslation(m_transforms[m_nextModifiedTransform], { m_translationOffset, 0.f, 0.f });
+            m_nextModifiedTransform = (m_nextModifiedTransform + 1u) % static_cast<uint32_t>(m_transforms.size());
+        }
+    }
+
+    const std::vector<RenderableHandle>& SyntheticScene::getRenderables() const
+    {
+        return m_renderables;
+    }
+
+    void SyntheticScene::createNodes(uint32_t nodeCount)
+    {
+        // each node has up to 4 children, i.e. hierarchy depth grows logarithmically with node count
+        constexpr uint32_t ChildrenPerNode = 4u;
+        m_nodes.reserve(nodeCount);
+        m_transforms.reserve(nodeCount);
+        for (uint32_t i = 0u; i < nodeCount; ++i)
+        {
+            const NodeHandle node = m_scene.allocateNode();
+            if (i > 0u)
+                m_scene.addChildToNode(m_nodes[(i - 1u) / ChildrenPerNode], node);
+            m_nodes.push_back(node);
+            m_transforms.push_back(m_scene.allocateTransform(node));
+        }
+    }
+
+    void SyntheticScene::createPasses(uint32_t passCount)
+    {
+        m_renderGroups.reserve(passCount);
+        for (uint32_t i = 0u; i < passCount; ++i)
+        {
+            const RenderPassHandle pass = m_scene.allocateRenderPass();
+            m_scene.setRenderPassCamera(pass, createCamera());
+            m_scene.setRenderPassRenderOrder(pass, static_cast<int32_t>(i));
+
+            const RenderGroupHandle group = m_scene.allocateRenderGroup();
+            m_scene.addRenderGroupToRenderPass(pass, group, 0);
+            m_renderGroups.push_back(group);
+        }
+    }
+
+    CameraHandle SyntheticScene::createCamera()
+    {
+        const DataLayoutHandle cameraLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::DataReference }, DataFieldInfo{ EDataType::DataReference } }, {});
+        const DataLayoutHandle vec2iLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2I } }, {});
+        const DataLayoutHandle vec2fLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector2F } }, {});
+        const DataLayoutHandle vec4fLayout = m_scene.allocateDataLayout({ DataFieldInfo{ EDataType::Vector4F } }, {});
+
+        const DataInstanceHandle cameraData = m_scene.allocateDataInstance(cameraLayout);
+        const DataInstanceHandle viewportOffset = m_scene.allocateDataInstance(vec2iLayout);
+        const DataInstanceHandle viewportSize = m_scene.allocateDataInstance(vec2iLayout);
+        const DataInstanceHandle frustumPlanes = m_scene.allocateDataInstance(vec4fLayout);
+        const DataInstanceHandle frustumNearFar = m_scene.allocateDataInstance(vec2fLayout);
+        m_scene.setDataReference(cameraData, Camera::ViewportOffsetField, viewportOffset);
+        m_scene.setDataReference(cameraData, Camera::ViewportSizeField, viewportSize);
+        m_scene.setDataReference(cameraData, Camera::FrustumPlanesField, frustumPlanes);
+        m_scene.setDataReference(cameraData, Camera::FrustumNearFarPlanesField, frustumNearFar);
+        m_scene.setDataSingleVector2i(viewportOffset, DataFieldHandle{ 0 }, { 0, 0 });
+        m_scene.setDataSingleVector2i(viewportSize, DataFieldHandle{ 0 }, { 1280, 480 });
+        m_scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { -1.f, 1.f, -1.f, 1.f });
+        m_scene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0 }, { 0.1f, 100.f });
+
+        const NodeHandle cameraNode = m_scene.allocateNode();
+        m_scene.allocateTransform(cameraNode);
+        return m_scene.allocateCamera(ECameraProjectionType::Perspective, cameraNode, cameraData);
+    }
+
+    void SyntheticScene::createRenderables(uint32_t renderableCount)
+    {
+        const DataLayoutHandle uniformLayout = m_scene.allocateDataLayout({
+            DataFieldInfo{ EDataType::Matrix44F, 1u, EFixedSemantics::ModelMatrix },
+            DataFieldInfo{ EDataType::Matrix44F, 1u, EFixedSemantics::ViewMatrix },
+            DataFieldInfo{ EDataType::Matrix44F, 1u, EFixedSemantics::ProjectionMatrix },
+            DataFieldInfo{ EDataType::Vector4F } }, EffectHash);
+        const DataLayoutHandle geometryLayout = m_scene.allocateDataLayout({
+            DataFieldInfo{ EDataType::Indices, 1u, EFixedSemantics::Indices },
+            DataFieldInfo{ EDataType::Vector3Buffer } }, EffectHash);
+
+        const DataInstanceHandle geometry = m_scene.allocateDataInstance(geometryLayout);
+        m_scene.setDataResource(geometry, DataFieldHandle{ 0 }, IndexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        m_scene.setDataResource(geometry, DataFieldHandle{ 1 }, VertexArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        const RenderStateHandle renderState = m_scene.allocateRenderState();
+
+        m_renderables.reserve(renderableCount);
+        for (uint32_t i = 0u; i < renderableCount; ++i)
+        {
+            // prefer leaf nodes so that renderables are spread over the whole hierarchy
+            const NodeHandle node = m_nodes[m_nodes.size() - 1u - (i % m_nodes.size())];
+            const RenderableHandle renderable = m_scene.allocateRenderable(node);
+
+            const DataInstanceHandle uniforms = m_scene.allocateDataInstance(uniformLayout);
+            m_scene.setDataSingleVector4f(uniforms, DataFieldHandle{ 3 }, { 1.f, 0.f, 0.f, 1.f });
+            m_scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Uniforms, uniforms);
+            m_scene.setRenderableDataInstance(renderable, ERenderableDataSlotType_Geometry, geometry);
+            m_scene.setRenderableRenderState(renderable, renderState);
+            m_scene.setRenderableIndexCount(renderable, 6u);
+
+            m_scene.addRenderableToRenderGroup(m_renderGroups[i % m_renderGroups.size()], renderable, static_cast<int32_t>(i));
+            m_renderables.push_back(renderable);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_SYNTHETICSCENE_H
+#define RAMSES_SYNTHETICSCENE_H
+
+#include "SceneAPI/SceneTypes.h"
+#include "SceneAPI/ResourceContentHash.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class IScene;
+
+    struct SyntheticSceneParams
+    {
+        uint32_t nodeCount = 1u;
+        uint32_t renderableCount = 1u;
+        uint32_t passCount = 1u;
+    };
+
+    // Fills a scene with generated content of given size, same as a client would create it:
+    // node hierarchy with transformation on every node, renderables distributed over the nodes,
+    // each renderable with own uniforms, all sharing one effect, geometry and render state,
+    // and render passes with own camera each, renderables are distributed over the passes.
+    class SyntheticScene
+    {
+    public:
+        static const ResourceContentHash EffectHash;
+        static const ResourceContentHash IndexArrayHash;
+        static const ResourceContentHash VertexArrayHash;
+
+        SyntheticScene(IScene& scene, const SyntheticSceneParams& params);
+
+        // Changes translation of given number of transformations, consecutive calls change subsequent transformations
+        void modifyTransforms(uint32_t count);
+
+        [[nodiscard]] const std::vector<RenderableHandle>& getRenderables() const;
+
+    private:
+        void createNodes(uint32_t nodeCount);
+        void createPasses(uint32_t passCount);
+        CameraHandle createCamera();
+        void createRenderables(uint32_t renderableCount);
+
+        IScene& m_scene;
+        std::vector<NodeHandle> m_nodes;
+        std::vector<TransformHandle> m_transforms;
+        std::vector<RenderableHandle> m_renderables;
+        std::vector<RenderGroupHandle> m_renderGroups;
+        uint32_t m_nextModifiedTransform = 0u;
+        float m_translationOffset = 0.f;
+    };
+}
+
+#endif
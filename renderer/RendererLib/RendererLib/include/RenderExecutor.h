@@ -26,6 +26,7 @@ namespace ramses_internal
         RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer = nullptr);
 
         [[nodiscard]] SceneRenderExecutionIterator executeScene(const RendererCachedScene& scene) const;
+        [[nodiscard]] uint32_t getAvoidedStateChangeCount() const;
 
         // This is exposed and can be modified but acts as a global parameter
         static constexpr const uint32_t DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks = 10u;
@@ -47,6 +48,7 @@ namespace ramses_internal
         void activateRenderTarget       (RenderTargetHandle renderTarget) const;
 
         void resolveAndSetSemanticDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle) const;
+        void resolveAndSetInstancedSemanticDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle) const;
         void setSemanticDataFields  () const;
         void executeCamera(CameraHandle camera) const;
 
@@ -54,6 +56,11 @@ namespace ramses_internal
         [[nodiscard]] bool executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const;
         void executeBlitPass(const RendererCachedScene& scene, const BlitPassHandle pass) const;
         [[nodiscard]] bool canDiscardDepthBuffer() const;
+        void batchFollowingRenderablesIntoCurrentDrawCall(const RenderableVector& orderedRenderables) const;
+        [[nodiscard]] bool hasSameInputsAndStatesAsCurrentDrawCall(RenderableHandle renderableHandle) const;
+        [[nodiscard]] bool canAppendIndexRangeToCurrentDrawCall(RenderableHandle renderableHandle) const;
+        [[nodiscard]] bool canDrawAsInstanceOfCurrentDrawCall(RenderableHandle renderableHandle) const;
+        [[nodiscard]] uint32_t getMaxInstancesOfCurrentDrawCall() const;
 
         static RenderBufferHandle FindDepthRenderBufferInRenderTarget(const IScene& scene, RenderTargetHandle renderTarget);
     };
@@ -11,12 +11,14 @@
 
 #include "Math3d/CameraMatrixHelper.h"
 #include "SceneAPI/Handles.h"
+#include "SceneAPI/SceneTypes.h"
 #include "SceneAPI/Viewport.h"
 #include "RendererAPI/SceneRenderExecutionIterator.h"
 #include "RendererAPI/RenderingContext.h"
 #include "RendererLib/FrameTimer.h"
 #include "RenderExecutorInternalRenderStates.h"
 #include <optional>
+#include <vector>
 
 namespace ramses_internal
 {
@@ -88,9 +90,18 @@ namespace ramses_internal
 
         [[nodiscard]] bool hasExceededTimeBudgetForRendering() const;
 
+        // counts states which were set for a renderable but did not need to be changed on device
+        void                   trackAvoidedStateChanges();
+        [[nodiscard]] uint32_t getAvoidedStateChangeCount() const;
+
         CachedState<DeviceResourceHandle> shaderDeviceHandle;
         DeviceResourceHandle              vertexArrayDeviceHandle;
         bool                              vertexArrayUsesIndices = false;
+        uint32_t                          drawElementCount = 0u; // can span multiple renderables if draw calls are batched
+        uint32_t                          drawInstanceCount = 0u;
+        RenderableVector                  instancedRenderables; // renderables drawn as instances of batched draw call, first is current renderable
+        std::vector<glm::mat4>            instanceMatrices;
+        std::vector<glm::mat3>            instanceMatrices33;
         CachedState<ScissorState>         scissorState;
         CachedState<EDepthFunc>           depthFuncState;
         CachedState<EDepthWrite>          depthWriteState;
@@ -124,6 +135,7 @@ namespace ramses_internal
         CachedState < CameraHandle >       m_camera;
 
         const FrameTimer* const            m_frameTimer;
+        uint32_t                           m_avoidedStateChanges = 0u;
     };
 
     inline RenderableHandle RenderExecutorInternalState::getRenderable() const
@@ -182,6 +194,11 @@ namespace ramses_internal
         return m_modelViewProjectionMatrix;
     }
 
+    inline uint32_t RenderExecutorInternalState::getAvoidedStateChangeCount() const
+    {
+        return m_avoidedStateChanges;
+    }
+
     inline bool RenderExecutorInternalState::hasExceededTimeBudgetForRendering() const
     {
         return m_frameTimer != nullptr ? m_frameTimer->isTimeBudgetExceededForSection(EFrameTimerSectionBudget::OffscreenBufferRender) : false;
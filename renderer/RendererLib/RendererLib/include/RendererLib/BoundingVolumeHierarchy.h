@@ -0,0 +1,149 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_BOUNDINGVOLUMEHIERARCHY_H
+#define RAMSES_BOUNDINGVOLUMEHIERARCHY_H
+
+#include "Math3d/BoundingBox.h"
+#include <vector>
+#include <array>
+#include <utility>
+#include <limits>
+#include <cstdint>
+#include <cassert>
+
+namespace ramses_internal
+{
+    // Binary tree of axis aligned bounding boxes over primitives identified by their index (e.g. triangles or objects),
+    // used to find primitives possibly hit by ray without testing all of them.
+    // Primitive boxes can be changed after build, refit() then updates boxes of tree nodes while keeping the tree structure,
+    // which is much cheaper than build but makes queries less efficient if primitives moved a lot.
+    class BoundingVolumeHierarchy
+    {
+    public:
+        void build(std::vector<BoundingBox> primitiveBoxes);
+        void setPrimitiveBoundingBox(uint32_t primitive, const BoundingBox& box);
+        void refit();
+
+        [[nodiscard]] bool isEmpty() const;
+        [[nodiscard]] uint32_t getPrimitiveCount() const;
+        [[nodiscard]] const BoundingBox& getPrimitiveBoundingBox(uint32_t primitive) const;
+        // box of all primitives, invalid if empty
+        [[nodiscard]] const BoundingBox& getBoundingBox() const;
+
+        // Calls visitor(uint32_t primitive, float& maxDistance) for every primitive whose box is hit by ray (nearer nodes first).
+        // Visitor can lower maxDistance (in units of ray direction length) to skip nodes entered by ray farther than that.
+        template <typename VISITOR>
+        void traverse(const glm::vec3& rayOrigin, const glm::vec3& rayDir, VISITOR&& visitor) const;
+
+        static constexpr uint32_t MaxPrimitivesInLeaf = 4u;
+
+    private:
+        struct Node
+        {
+            BoundingBox box;
+            // inner node: index of second child (first child directly follows its parent)
+            // leaf: index of first primitive in m_primitives
+            uint32_t offset = 0u;
+            // zero for inner node
+            uint32_t primitiveCount = 0u;
+        };
+
+        void buildNode(uint32_t begin, uint32_t end, const std::vector<glm::vec3>& centers);
+
+        std::vector<BoundingBox> m_primitiveBoxes;
+        std::vector<Node> m_nodes;
+        // primitive indices ordered so that each leaf references continuous range
+        std::vector<uint32_t> m_primitives;
+
+        // median split halves primitive count on each level, depth of tree is well below this for any practical primitive count
+        static constexpr size_t MaxDepth = 64u;
+    };
+
+    inline bool BoundingVolumeHierarchy::isEmpty() const
+    {
+        return m_nodes.empty();
+    }
+
+    inline uint32_t BoundingVolumeHierarchy::getPrimitiveCount() const
+    {
+        return static_cast<uint32_t>(m_primitiveBoxes.size());
+    }
+
+    inline const BoundingBox& BoundingVolumeHierarchy::getPrimitiveBoundingBox(uint32_t primitive) const
+    {
+        assert(primitive < m_primitiveBoxes.size());
+        return m_primitiveBoxes[primitive];
+    }
+
+    template <typename VISITOR>
+    void BoundingVolumeHierarchy::traverse(const glm::vec3& rayOrigin, const glm::vec3& rayDir, VISITOR&& visitor) const
+    {
+        float maxDistance = std::numeric_limits<float>::max();
+        float distance = 0.f;
+        if (isEmpty() || !m_nodes.front().box.intersectsRay(rayOrigin, rayDir, distance))
+            return;
+
+        // node indices with entry distance of ray, so that node can be skipped if visitor lowered max distance meanwhile
+        std::array<std::pair<uint32_t, float>, MaxDepth> stack;
+        size_t stackSize = 0u;
+        stack[stackSize++] = { 0u, distance };
+
+        while (stackSize > 0u)
+        {
+            const auto [nodeIdx, entryDistance] = stack[--stackSize];
+            if (entryDistance > maxDistance)
+                continue;
+
+            const Node& node = m_nodes[nodeIdx];
+            if (node.primitiveCount > 0u)
+            {
+                for (uint32_t i = node.offset; i < node.offset + node.primitiveCount; ++i)
+                {
+                    const uint32_t primitive = m_primitives[i];
+                    if (m_primitiveBoxes[primitive].intersectsRay(rayOrigin, rayDir, distance) && distance <= maxDistance)
+                        visitor(primitive, maxDistance);
+                }
+                continue;
+            }
+
+            const uint32_t firstChild = nodeIdx + 1u;
+            const uint32_t secondChild = node.offset;
+            float firstDistance = 0.f;
+            float secondDistance = 0.f;
+            const bool firstHit = m_nodes[firstChild].box.intersectsRay(rayOrigin, rayDir, firstDistance) && firstDistance <= maxDistance;
+            const bool secondHit = m_nodes[secondChild].box.intersectsRay(rayOrigin, rayDir, secondDistance) && secondDistance <= maxDistance;
+
+            // push farther child first so that nearer one is visited first
+            assert(stackSize + 2u <= stack.size());
+            if (firstHit && secondHit)
+            {
+                if (firstDistance <= secondDistance)
+                {
+                    stack[stackSize++] = { secondChild, secondDistance };
+                    stack[stackSize++] = { firstChild, firstDistance };
+                }
+                else
+                {
+                    stack[stackSize++] = { firstChild, firstDistance };
+                    stack[stackSize++] = { secondChild, secondDistance };
+                }
+            }
+            else if (firstHit)
+            {
+                stack[stackSize++] = { firstChild, firstDistance };
+            }
+            else if (secondHit)
+            {
+                stack[stackSize++] = { secondChild, secondDistance };
+            }
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,100 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_DIRTYHANDLETRACKER_H
+#define RAMSES_DIRTYHANDLETRACKER_H
+
+#include "RendererAPI/Types.h"
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+namespace ramses_internal
+{
+    // Dirtiness flags of scene objects of one type which additionally keeps list of objects marked dirty,
+    // so that dirty objects can be visited without scanning flags of all objects in scene.
+    // Object marked clean stays in the list until removeClean() is called, users iterating the list have to check its flag.
+    template <typename HANDLE>
+    class DirtyHandleTracker
+    {
+    public:
+        [[nodiscard]] size_t size() const
+        {
+            return m_dirty.size();
+        }
+
+        void resize(size_t size)
+        {
+            m_dirty.resize(size);
+            m_listed.resize(size);
+        }
+
+        [[nodiscard]] bool isDirty(HANDLE handle) const
+        {
+            const auto index = handle.asMemoryHandle();
+            assert(index < m_dirty.size());
+            return m_dirty[index];
+        }
+
+        void setDirty(HANDLE handle, bool dirty)
+        {
+            const auto index = handle.asMemoryHandle();
+            assert(index < m_dirty.size());
+            m_dirty[index] = dirty;
+
+            if (dirty && !m_listed[index])
+            {
+                m_listed[index] = true;
+                m_list.push_back(handle);
+            }
+        }
+
+        // all dirty objects, possibly also objects marked clean since last removeClean()
+        [[nodiscard]] const std::vector<HANDLE>& getList() const
+        {
+            return m_list;
+        }
+
+        void removeClean()
+        {
+            const auto it = std::remove_if(m_list.begin(), m_list.end(), [this](HANDLE handle)
+            {
+                const auto index = handle.asMemoryHandle();
+                if (m_dirty[index])
+                    return false;
+                m_listed[index] = false;
+                return true;
+            });
+            m_list.erase(it, m_list.end());
+        }
+
+        // marks all objects clean
+        void clear()
+        {
+            for (const auto handle : m_list)
+            {
+                const auto index = handle.asMemoryHandle();
+                m_dirty[index] = false;
+                m_listed[index] = false;
+            }
+            m_list.clear();
+        }
+
+        [[nodiscard]] const BoolVector& getFlags() const
+        {
+            return m_dirty;
+        }
+
+    private:
+        BoolVector m_dirty;
+        BoolVector m_listed;
+        std::vector<HANDLE> m_list;
+    };
+}
+
+#endif
@@ -122,6 +122,21 @@ namespace ramses_internal
         void setResourceUploadBatchSize(uint32_t batchSize);
         [[nodiscard]] uint32_t getResourceUploadBatchSize() const;
 
+        void setFrustumCullingEnabled(bool enabled);
+        [[nodiscard]] bool isFrustumCullingEnabled() const;
+
+        void setSceneUpdateWorkerThreadCount(uint32_t threadCount);
+        [[nodiscard]] uint32_t getSceneUpdateWorkerThreadCount() const;
+
+        void setStateSortingEnabled(bool enabled);
+        [[nodiscard]] bool isStateSortingEnabled() const;
+
+        void setDrawCallBatchingEnabled(bool enabled);
+        [[nodiscard]] bool isDrawCallBatchingEnabled() const;
+
+        void setAsyncFlushPreparationEnabled(bool enabled);
+        [[nodiscard]] bool isAsyncFlushPreparationEnabled() const;
+
         bool operator==(const DisplayConfig& other) const;
         bool operator!=(const DisplayConfig& other) const;
 
@@ -166,6 +181,11 @@ namespace ramses_internal
         int32_t m_swapInterval = -1;
         std::unordered_map<SceneId, int32_t> m_scenePriorities;
         uint32_t m_resourceUploadBatchSize = 10u;
+        bool m_frustumCullingEnabled = false;
+        uint32_t m_sceneUpdateWorkerThreadCount = 0u;
+        bool m_stateSortingEnabled = false;
+        bool m_drawCallBatchingEnabled = false;
+        bool m_asyncFlushPreparationEnabled = false;
     };
 }
 
@@ -47,6 +47,8 @@ namespace ramses_internal
 
         void validateRenderingStatusHealthy() const override;
 
+        uint32_t getAndResetAvoidedStateChangeCount() override;
+
     private:
         IRenderBackend&         m_renderBackend;
         IDevice&                m_device;
@@ -54,6 +56,8 @@ namespace ramses_internal
 
         const uint32_t            m_displayWidth;
         const uint32_t            m_displayHeight;
+
+        uint32_t                  m_avoidedStateChanges = 0u;
     };
 }
 
@@ -0,0 +1,61 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_FLUSHPREPARATIONWORKER_H
+#define RAMSES_FLUSHPREPARATIONWORKER_H
+
+#include "Components/ManagedResource.h"
+#include "PlatformAbstraction/PlatformThread.h"
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+
+namespace ramses_internal
+{
+    // Decompresses resource data of arrived flushes on a worker thread so that the render thread does not have to do it
+    // within its frame budget when the resource is uploaded.
+    // Preparations are done in order of enqueuing, each is identified by ticket which can be queried for completion.
+    class FlushPreparationWorker final : private Runnable
+    {
+    public:
+        FlushPreparationWorker();
+        ~FlushPreparationWorker() override;
+
+        // enqueues decompression of those resources which are not decompressed yet,
+        // returns InvalidTicket if there is nothing to decompress
+        uint64_t prepare(const ManagedResourceVector& resources);
+
+        [[nodiscard]] bool isPrepared(uint64_t ticket) const;
+        void waitUntilPrepared(uint64_t ticket);
+
+        // for testing only: while held every preparation gets a ticket and none is finished,
+        // waiting for a preparation enqueued while held blocks until released
+        void holdPreparations(bool hold);
+
+        // ticket of nothing to prepare, always reported as prepared
+        static constexpr uint64_t InvalidTicket = 0u;
+
+    private:
+        void run() override;
+
+        PlatformThread m_thread;
+
+        std::mutex m_lock;
+        std::condition_variable m_workAvailable;
+        std::condition_variable m_workDone;
+        std::deque<ManagedResourceVector> m_queue;
+        uint64_t m_lastEnqueuedTicket = InvalidTicket;
+        bool m_preparationsHeld = false;
+        std::atomic<uint64_t> m_lastPreparedTicket{ InvalidTicket };
+    };
+}
+
+#endif
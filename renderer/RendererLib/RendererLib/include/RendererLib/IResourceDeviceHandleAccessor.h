@@ -13,6 +13,7 @@
 #include "SceneAPI/Handles.h"
 #include "SceneAPI/SceneId.h"
 #include "RendererAPI/Types.h"
+#include "Math3d/BoundingBox.h"
 
 namespace ramses_internal
 {
@@ -22,6 +23,7 @@ namespace ramses_internal
         virtual ~IResourceDeviceHandleAccessor() {}
 
         [[nodiscard]] virtual DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& resourceHash) const = 0;
+        [[nodiscard]] virtual BoundingBox          getResourceBoundingBox(const ResourceContentHash& resourceHash) const = 0;
         [[nodiscard]] virtual DeviceResourceHandle getRenderTargetDeviceHandle(RenderTargetHandle targetHandle, SceneId sceneId) const = 0;
         [[nodiscard]] virtual DeviceResourceHandle getRenderTargetBufferDeviceHandle(RenderBufferHandle bufferHandle, SceneId sceneId) const = 0;
         virtual void                 getBlitPassRenderTargetsDeviceHandle(BlitPassHandle blitPassHandle, SceneId sceneId, DeviceResourceHandle& srcRT, DeviceResourceHandle& dstRT) const = 0;
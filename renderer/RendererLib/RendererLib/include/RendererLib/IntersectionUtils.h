@@ -11,6 +11,7 @@
 
 #include "PlatformAbstraction/PlatformTypes.h"
 #include "TransformationLinkCachedScene.h"
+#include "RendererLib/BoundingVolumeHierarchy.h"
 
 namespace ramses_internal
 {
@@ -26,10 +27,13 @@ namespace ramses_internal
 
         static glm::vec3 CalculatePlaneNormal(const Triangle& triangle);
         static bool IntersectRayVsTriangle(const Triangle& triangle, const glm::vec3& rayOrigin, const glm::vec3& rayDir, glm::vec3& intersectionPointInModelSpace, float& distanceRayOriginToIntersection);
+        static bool IntersectRayVsGeometry(const float* geometry, const BoundingVolumeHierarchy& geometryBVH, const glm::vec3& rayOrigin, const glm::vec3& rayDir, glm::vec3& intersectionPointInModelSpace);
         static bool TestGeometryPicked(const glm::vec2& pickCoordsNDS, const float* geometry, const size_t geometrySize, const glm::mat4& modelMatrix, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec3& intersectionPointInModelSpace);
         static void CheckSceneForIntersectedPickableObjects(const TransformationLinkCachedScene& scene, const glm::ivec2 coordsInBufferSpace, PickableObjectIds& pickedObjects);
 
     private:
+        static void UnprojectRay(const glm::vec2& pickCoordsNDS, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec4& rayOriginWorld, glm::vec4& rayTargetWorld);
+        static Triangle GetTriangle(const float* geometry, size_t triangleIndex);
         static bool TestPointInTriangle(const Triangle& triangle, const glm::vec3& planeNormal, const glm::vec3& testPoint);
         static bool CalculateRayVsPlaneIntersection(const glm::vec3& triangleVertex,
             const glm::vec3& triangleNormal,
@@ -0,0 +1,80 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#ifndef RAMSES_PICKINGCACHE_H
+#define RAMSES_PICKINGCACHE_H
+
+#include "RendererLib/BoundingVolumeHierarchy.h"
+#include "SceneAPI/Handles.h"
+#include "DataTypesImpl.h"
+#include <vector>
+
+namespace ramses_internal
+{
+    class TransformationLinkCachedScene;
+
+    // Acceleration structures for picking of pickable objects of one scene:
+    // - BVH over triangles of each pick geometry, built lazily at first pick after geometry data changed
+    // - BVH over world space bounding boxes of all active pickable objects, refit when their transformations change
+    // Scene marks cache dirty on any change that can affect it, update() is cheap if nothing changed.
+    class PickingCache
+    {
+    public:
+        struct Pickable
+        {
+            PickableObjectHandle handle;
+            glm::mat4 worldMatrix{ 1.f };
+            glm::mat4 inverseWorldMatrix{ 1.f };
+        };
+
+        void markDirty();
+        void markGeometryDirty(DataBufferHandle geometry);
+        void update(const TransformationLinkCachedScene& scene);
+
+        // distinct cameras of enabled pickable objects
+        [[nodiscard]] const std::vector<CameraHandle>& getCameras() const;
+        // calls visitor(const Pickable&) for every enabled pickable object whose world space bounding box is hit by ray
+        template <typename VISITOR>
+        void forEachPickableHitByRay(const glm::vec3& rayOrigin, const glm::vec3& rayDir, VISITOR&& visitor) const;
+        // BVH over triangles of pick geometry, primitive index is index of triangle in geometry data buffer
+        [[nodiscard]] const BoundingVolumeHierarchy& getGeometryBVH(DataBufferHandle geometry) const;
+
+    private:
+        struct Geometry
+        {
+            BoundingVolumeHierarchy bvh;
+            bool dirty = true;
+        };
+
+        const BoundingVolumeHierarchy& updateGeometry(const TransformationLinkCachedScene& scene, DataBufferHandle geometryHandle);
+
+        bool m_dirty = true;
+        std::vector<Geometry> m_geometries;
+        std::vector<Pickable> m_pickables;
+        std::vector<CameraHandle> m_cameras;
+        // primitive index is index to m_pickables
+        BoundingVolumeHierarchy m_pickablesBVH;
+    };
+
+    inline const std::vector<CameraHandle>& PickingCache::getCameras() const
+    {
+        return m_cameras;
+    }
+
+    template <typename VISITOR>
+    void PickingCache::forEachPickableHitByRay(const glm::vec3& rayOrigin, const glm::vec3& rayDir, VISITOR&& visitor) const
+    {
+        assert(!m_dirty);
+        m_pickablesBVH.traverse(rayOrigin, rayDir, [&](uint32_t primitive, float& /*maxDistance*/)
+        {
+            visitor(m_pickables[primitive]);
+        });
+    }
+}
+
+#endif
@@ -10,6 +10,7 @@
 #define RAMSES_RENDERABLECOMPARATOR_H
 
 #include "RendererLib/ResourceCachedScene.h"
+#include <vector>
 
 namespace ramses_internal
 {
@@ -56,6 +57,38 @@ namespace ramses_internal
     private:
         const ResourceCachedScene& m_scene;
     };
+
+    // Breaks ties of equal order using precomputed state sort keys (indexed by renderable handle),
+    // falls back to renderable handle to keep the resulting order deterministic
+    class RenderableStateSortKeyComparator
+    {
+    public:
+        explicit RenderableStateSortKeyComparator(const std::vector<uint64_t>& stateSortKeys)
+            : m_stateSortKeys(stateSortKeys)
+        {
+        }
+
+        bool operator()(const RenderableOrderEntry& renderableOrder1, const RenderableOrderEntry& renderableOrder2) const
+        {
+            if (renderableOrder1.order == renderableOrder2.order)
+            {
+                assert(renderableOrder1.renderable.asMemoryHandle() < m_stateSortKeys.size());
+                assert(renderableOrder2.renderable.asMemoryHandle() < m_stateSortKeys.size());
+                const uint64_t key1 = m_stateSortKeys[renderableOrder1.renderable.asMemoryHandle()];
+                const uint64_t key2 = m_stateSortKeys[renderableOrder2.renderable.asMemoryHandle()];
+
+                if (key1 == key2)
+                    return renderableOrder1.renderable < renderableOrder2.renderable;
+
+                return key1 < key2;
+            }
+
+            return renderableOrder1.order < renderableOrder2.order;
+        }
+
+    private:
+        const std::vector<uint64_t>& m_stateSortKeys;
+    };
 }
 
 #endif
@@ -11,10 +11,12 @@
 
 #include "RendererLib/ResourceCachedScene.h"
 #include "RenderingPassInfo.h"
+#include "Math3d/BoundingBox.h"
 
 namespace ramses_internal
 {
     class IResourceDeviceHandleAccessor;
+    class Frustum;
 
     class RendererCachedScene final : public ResourceCachedScene
     {
@@ -22,8 +24,39 @@ namespace ramses_internal
         explicit RendererCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo = SceneInfo());
 
         void updateRenderablesAndResourceCache(const IResourceDeviceHandleAccessor& resourceAccessor);
-        void updateRenderableWorldMatrices();
-        void updateRenderableWorldMatricesWithLinks();
+        void updateRenderableWorldMatrices(ParallelForExecutor* executor = nullptr);
+        void updateRenderableWorldMatricesWithLinks(ParallelForExecutor* executor = nullptr);
+
+        /**
+         * Frustum culling removes renderables whose bounding box lies completely outside of the frustum
+         * of the camera of the render pass they are rendered with from the renderables returned by
+         * getOrderedRenderablesForPass. Bounding boxes are calculated when vertex arrays are (re-)uploaded
+         * and transformed to world space whenever they or the world matrix of their renderable change.
+         * Culling itself has to be updated after world matrices and data links of the scene were updated,
+         * a pass is culled again only if its camera matrices or any renderable (box, matrix, order) changed.
+         */
+        void setFrustumCullingEnabled(bool enabled);
+        [[nodiscard]] bool isFrustumCullingEnabled() const;
+        void updateRenderableBoundingBoxes(const IResourceDeviceHandleAccessor& resourceAccessor, const RenderableVector& renderablesWithUpdatedVertexArrays);
+        void updateFrustumCulling();
+
+        /**
+         * State sorting orders renderables with equal render order within a render group by a 64 bit key
+         * which packs (from most to least significant) effect, texture samplers, render state and geometry,
+         * so that consecutive renderables share as much device state as possible and the redundant state
+         * filtering of the render executor can skip most of the state changes.
+         * Keys are recalculated whenever the renderables of a render group are sorted again.
+         */
+        void setStateSortingEnabled(bool enabled);
+        [[nodiscard]] bool isStateSortingEnabled() const;
+
+        /**
+         * Draw call batching lets the render executor merge consecutive renderables of a pass into one draw call
+         * if they only differ in which part of a shared index range they draw, or in their transformation
+         * if the effect takes transformation semantics as arrays (renderables are then drawn as instances).
+         */
+        void setDrawCallBatchingEnabled(bool enabled);
+        [[nodiscard]] bool isDrawCallBatchingEnabled() const;
 
         void retriggerAllRenderOncePasses();
         void markAllRenderOncePassesAsRendered() const;
@@ -48,12 +81,15 @@ namespace ramses_internal
         bool hasActiveShaderAnimation() const;
 
         void                        setRenderableVisibility         (RenderableHandle renderableHandle, EVisibilityMode visible) override;
+        void                        setRenderableInstanceCount      (RenderableHandle renderableHandle, uint32_t instanceCount) override;
 
         void                        releaseRenderGroup              (RenderGroupHandle groupHandle) override;
         void                        addRenderableToRenderGroup      (RenderGroupHandle groupHandle, RenderableHandle renderableHandle, int32_t order) override;
         void                        removeRenderableFromRenderGroup (RenderGroupHandle groupHandle, RenderableHandle renderableHandle) override;
 
+        RenderPassHandle            allocateRenderPass              (uint32_t renderGroupCount = 0u, RenderPassHandle passHandle = RenderPassHandle::Invalid()) override;
         void                        releaseRenderPass               (RenderPassHandle passHandle) override;
+        void                        setRenderPassCamera             (RenderPassHandle passHandle, CameraHandle cameraHandle) override;
         void                        setRenderPassRenderOrder        (RenderPassHandle passHandle, int32_t renderOrder) override;
         void                        setRenderPassEnabled            (RenderPassHandle passHandle, bool isEnabled) override;
         void                        setRenderPassRenderOnce         (RenderPassHandle passHandle, bool enable) override;
@@ -71,20 +107,68 @@ namespace ramses_internal
         const RenderingPassInfoVector&      getSortedRenderingPasses        () const;
         const RenderableVector&             getOrderedRenderablesForPass    (RenderPassHandle pass) const;
         const glm::mat4&                    getRenderableWorldMatrix        (RenderableHandle renderable) const;
+        const BoundingBox&                  getRenderableBoundingBox        (RenderableHandle renderable) const;
 
     private:
         void updatePassRenderableSorting();
-        void updateRenderablesInPass(RenderPassHandle passHandle);
-        void addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle);
+        void flattenRenderablesInPass(RenderPassHandle passHandle);
+        void updateVisibleRenderablesInPass(RenderPassHandle passHandle);
+        void updateRenderableVisibilityInPass(RenderPassHandle passHandle, RenderableHandle renderable, bool visible);
+        void flattenRenderablesInRenderGroup(RenderGroupHandle renderGroupHandle);
+        void markRenderGroupDirty(RenderGroupHandle renderGroupHandle);
+        void markRenderPassDirty(RenderPassHandle passHandle);
+        void collectRenderPassesContainingRenderGroup(RenderGroupHandle renderGroupHandle, RenderPassVector& passes) const;
+        void ensureRenderGroupCacheSize(RenderGroupHandle renderGroupHandle);
+        void ensureRenderPassCacheSize(RenderPassHandle passHandle);
         bool shouldRenderPassBeRendered(RenderPassHandle handle) const;
+        void collectNodesOfRenderablesInPasses();
+        void updateRenderableWorldMatricesFromCache();
+        BoundingBox calculateRenderableBoundingBox(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable) const;
+        glm::mat4 calculateCameraViewProjectionMatrix(CameraHandle camera) const;
+        void updateRenderableWorldBoundingBox(RenderableHandle renderable);
+        bool isRenderableInsideFrustum(RenderableHandle renderable, const Frustum& frustum) const;
+        void updateRenderableStateSortKeys(const RenderableOrderVector& renderables);
+        uint64_t calculateRenderableStateSortKey(const Renderable& renderable);
+        uint16_t getTextureSamplersStateSortId(DataInstanceHandle uniformInstance);
 
         RenderingPassInfoVector m_sortedRenderingPasses;
         using PassRenderableOrder = std::vector<RenderableVector>;
         PassRenderableOrder     m_passRenderableOrder;
-        mutable bool            m_renderableOrderingDirty;
+        mutable bool            m_renderingPassesDirty;
+
+        // renderables of passes and render groups flattened in render order including invisible ones,
+        // only passes/groups affected by a change are flattened again, visibility change of renderable only inserts/removes it
+        // in visible renderables of pass, at position given by indices of visible renderables in flattened order
+        using RenderGroupVector = std::vector<RenderGroupHandle>;
+        PassRenderableOrder                 m_passFlattenedRenderables;
+        BoolVector                          m_passRenderablesDirty;
+        BoolVector                          m_passVisibilityDirty;
+        using IndexVector = std::vector<uint32_t>;
+        std::vector<IndexVector>            m_passVisibleFlattenedIndices;
+        bool                                m_hasDirtyPasses = false;
+        std::vector<RenderableVector>       m_renderGroupFlattenedRenderables;
+        BoolVector                          m_renderGroupRenderablesDirty;
+        std::vector<RenderGroupVector>      m_renderGroupParents;
+        std::vector<RenderPassVector>       m_renderGroupPasses;
+        std::vector<RenderGroupVector>      m_renderableGroups;
 
         using MatrixVector = std::vector<glm::mat4>;
         MatrixVector            m_renderableMatrices;
+        NodeHandleVector        m_renderableNodes;
+
+        bool                     m_frustumCullingEnabled = false;
+        bool                     m_frustumCullingUpToDate = false;
+        std::vector<BoundingBox> m_renderableBoundingBoxes;
+        std::vector<BoundingBox> m_renderableWorldBoundingBoxes;
+        MatrixVector             m_passViewProjectionMatrices;
+        PassRenderableOrder      m_passCulledRenderableOrder;
+
+        bool                                    m_stateSortingEnabled = false;
+        std::vector<uint64_t>                   m_renderableStateSortKeys;
+        HashMap<ResourceContentHash, uint16_t>  m_stateSortEffectIds;
+        HashMap<std::size_t, uint16_t>          m_stateSortTextureSamplersIds;
+
+        bool m_drawCallBatchingEnabled = false;
 
         using RenderPasses = HashSet<RenderPassHandle>;
         mutable RenderPasses m_renderOncePassesToRender;
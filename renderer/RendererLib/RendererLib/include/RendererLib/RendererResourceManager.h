@@ -41,7 +41,8 @@ namespace ramses_internal
             IEmbeddedCompositingManager& embeddedCompositingManager,
             const DisplayConfig& displayConfig,
             const FrameTimer& frameTimer,
-            RendererStatistics& stats);
+            RendererStatistics& stats,
+            ParallelForExecutor* decompressionExecutor = nullptr);
         ~RendererResourceManager() override;
 
         // Immutable resources
@@ -53,6 +54,7 @@ namespace ramses_internal
         void                 uploadAndUnloadPendingResources() override;
 
         [[nodiscard]] DeviceResourceHandle getResourceDeviceHandle(const ResourceContentHash& hash) const override;
+        [[nodiscard]] BoundingBox          getResourceBoundingBox(const ResourceContentHash& hash) const override;
         [[nodiscard]] EResourceStatus      getResourceStatus(const ResourceContentHash& hash) const override;
         [[nodiscard]] EResourceType        getResourceType(const ResourceContentHash& hash) const override;
 
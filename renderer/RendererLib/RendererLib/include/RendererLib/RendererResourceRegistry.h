@@ -15,6 +15,8 @@
 
 namespace ramses_internal
 {
+    class ArrayResource;
+
     class RendererResourceRegistry
     {
     public:
@@ -44,6 +46,7 @@ namespace ramses_internal
         void updateCachedLists(const ResourceContentHash& hash, EResourceStatus currentStatus, EResourceStatus newStatus);
         void updateListOfResourcesNotInUseByScenes(const ResourceContentHash& hash);
         static bool ValidateStatusChange(EResourceStatus currentStatus, EResourceStatus newStatus);
+        static BoundingBox CalculateVertexArrayBoundingBox(const ArrayResource& vertexArray);
 
         ResourceDescriptors m_resources;
 
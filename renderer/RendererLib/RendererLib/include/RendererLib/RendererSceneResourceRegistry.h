@@ -13,7 +13,7 @@
 #include "SceneAPI/Handles.h"
 #include "SceneAPI/SceneTypes.h"
 #include "SceneAPI/TextureEnums.h"
-#include "Collections/HashMap.h"
+#include "Common/DenseHandleMap.h"
 
 namespace ramses_internal
 {
@@ -98,13 +98,13 @@ namespace ramses_internal
             EDataBufferType dataBufferType;
         };
 
-        using RenderBufferMap        = HashMap<RenderBufferHandle,   RenderBufferEntry>;
-        using RenderTargetMap        = HashMap<RenderTargetHandle,   DeviceResourceHandle>;
-        using BlitPassMap            = HashMap<BlitPassHandle,       BlitPassEntry>;
-        using DataBufferMap          = HashMap<DataBufferHandle,     DataBufferEntry>;
-        using TextureBufferMap       = HashMap<TextureBufferHandle,  TextureBufferEntry>;
-        using TextureSamplerMap      = HashMap<TextureSamplerHandle, DeviceResourceHandle>;
-        using VertexArrayMap         = HashMap<RenderableHandle,   DeviceResourceHandle>;
+        using RenderBufferMap        = DenseHandleMap<RenderBufferHandle,   RenderBufferEntry>;
+        using RenderTargetMap        = DenseHandleMap<RenderTargetHandle,   DeviceResourceHandle>;
+        using BlitPassMap            = DenseHandleMap<BlitPassHandle,       BlitPassEntry>;
+        using DataBufferMap          = DenseHandleMap<DataBufferHandle,     DataBufferEntry>;
+        using TextureBufferMap       = DenseHandleMap<TextureBufferHandle,  TextureBufferEntry>;
+        using TextureSamplerMap      = DenseHandleMap<TextureSamplerHandle, DeviceResourceHandle>;
+        using VertexArrayMap         = DenseHandleMap<RenderableHandle,   DeviceResourceHandle>;
 
         RenderBufferMap        m_renderBuffers;
         RenderTargetMap        m_renderTargets;
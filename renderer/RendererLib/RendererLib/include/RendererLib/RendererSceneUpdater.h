@@ -20,7 +20,10 @@
 #include "RendererLib/IRendererResourceManager.h"
 #include "Scene/EScenePublicationMode.h"
 #include "AsyncEffectUploader.h"
+#include "FlushPreparationWorker.h"
+#include "TaskFramework/ParallelForExecutor.h"
 #include <unordered_map>
+#include <functional>
 
 namespace ramses_internal
 {
@@ -114,6 +117,7 @@ namespace ramses_internal
         virtual void destroyResourceManager();
 
         std::chrono::milliseconds m_maximumWaitingTimeToForceMap{ 2000 };
+        std::unique_ptr<FlushPreparationWorker> m_flushPreparationWorker;
 
     private:
         void destroyScene(SceneId sceneID);
@@ -125,6 +129,7 @@ namespace ramses_internal
         void applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo);
         void processStagedResourceChanges(SceneId sceneID, StagingInfo& stagingInfo);
 
+        [[nodiscard]] bool isFlushPrepared(const PendingFlush& pendingFlush) const;
         [[nodiscard]] bool areResourcesFromPendingFlushesUploaded(SceneId sceneId) const;
 
         void consolidatePendingSceneActions(SceneId sceneID, SceneUpdate&& sceneUpdate);
@@ -140,7 +145,9 @@ namespace ramses_internal
         void updateScenesShaderAnimations();
         void updateScenesTransformationCache();
         void updateScenesDataLinks();
+        void updateScenesFrustumCulling();
         void updateScenesStates();
+        void updateScenesInParallel(const std::vector<RendererCachedScene*>& scenes, const std::function<void(RendererCachedScene&, ParallelForExecutor*)>& updateFunction);
 
         void resolveDataLinksForConsumerScenes(const DataReferenceLinkManager& dataRefLinkManager);
         void markScenesDependantOnModifiedConsumersAsModified(const DataReferenceLinkManager& dataRefLinkManager, const TransformationLinkManager &transfLinkManager, const TextureLinkManager& texLinkManager);
@@ -164,6 +171,8 @@ namespace ramses_internal
         ISceneReferenceLogic*                             m_sceneReferenceLogic = nullptr;
         IRendererResourceCache*                           m_rendererResourceCache = nullptr;
 
+        // scene update executor is also used by resource manager to decompress resources, it must outlive it
+        std::unique_ptr<ParallelForExecutor> m_sceneUpdateExecutor;
         std::unique_ptr<IRendererResourceManager> m_displayResourceManager;
         std::unique_ptr<AsyncEffectUploader> m_asyncEffectUploader;
 
@@ -174,10 +183,16 @@ namespace ramses_internal
         };
         std::unordered_map<SceneId, SceneMapRequest> m_scenesToBeMapped;
 
-        // extracted from RendererSceneUpdater::updateScenesTransformationCache to avoid per frame allocation
+        // extracted from RendererSceneUpdater::updateScenesTransformationCache and updateScenesFrustumCulling to avoid per frame allocation
         HashSet<SceneId> m_scenesNeedingTransformationCacheUpdate;
+        HashSet<SceneId> m_scenesNeedingFrustumCullingUpdate;
+        // scenes to be updated by single update stage, kept as member to avoid per frame allocation
+        std::vector<RendererCachedScene*> m_scenesToUpdate;
 
         bool m_skipUnmodifiedScenes = true;
+        bool m_frustumCullingEnabled = false;
+        bool m_stateSortingEnabled = false;
+        bool m_drawCallBatchingEnabled = false;
         HashSet<SceneId> m_modifiedScenesToRerender;
         //used as caches for algorithms that mark scenes as modified
         std::vector<SceneId> m_offscreeenBufferModifiedScenesVisitingCache;
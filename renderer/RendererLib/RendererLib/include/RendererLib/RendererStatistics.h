@@ -29,6 +29,7 @@ namespace ramses_internal
     public:
         [[nodiscard]] float  getFps() const;
         [[nodiscard]] uint32_t getDrawCallsPerFrame() const;
+        [[nodiscard]] uint32_t getAvoidedStateChangesPerFrame() const;
 
         void sceneRendered(SceneId sceneId);
         void trackArrivedFlush(SceneId sceneId, size_t numSceneActions, size_t numAddedResources, size_t numRemovedResources, size_t numSceneResourceActions, std::chrono::milliseconds latency);
@@ -51,7 +52,7 @@ namespace ramses_internal
 
         void addExpirationOffset(SceneId sceneId, int64_t expirationOffset);
 
-        void frameFinished(uint32_t drawCalls);
+        void frameFinished(uint32_t drawCalls, uint32_t avoidedStateChanges = 0u);
         void reset();
 
         void writeStatsToStream(StringOutputStream& str) const;
@@ -60,6 +61,7 @@ namespace ramses_internal
         int32_t m_frameNumber = 0;
         uint64_t m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         uint32_t m_drawCalls = 0u;
+        uint32_t m_avoidedStateChanges = 0u;
         uint64_t m_lastFrameTick = 0u;
         uint32_t m_frameDurationMin = std::numeric_limits<uint32_t>::max();
         uint32_t m_frameDurationMax = 0u;
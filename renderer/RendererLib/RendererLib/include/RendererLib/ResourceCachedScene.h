@@ -10,6 +10,9 @@
 #define RAMSES_RESOURCECACHEDSCENE_H
 
 #include "RendererLib/TextureLinkCachedScene.h"
+#include "RendererLib/DirtyHandleTracker.h"
+#include <array>
+#include <limits>
 
 namespace ramses_internal
 {
@@ -57,6 +60,8 @@ namespace ramses_internal
         const DeviceHandleVector&           getCachedHandlesForRenderTargets() const;
         const DeviceHandleVector&           getCachedHandlesForBlitPassRenderTargets() const;
         const BoolVector&                   getVertexArraysDirtinessFlags() const;
+        // renderables with dirty vertex array, can contain also renderables which are not dirty anymore (check isRenderableVertexArrayDirty)
+        const RenderableVector&             getRenderablesWithDirtyVertexArrays() const;
 
         void updateRenderableResources(const IResourceDeviceHandleAccessor& resourceAccessor);
         void updateRenderablesResourcesDirtiness();
@@ -81,6 +86,10 @@ namespace ramses_internal
         bool isDataInstanceDirty(DataInstanceHandle handle) const;
         bool isTextureSamplerDirty(TextureSamplerHandle handle) const;
         bool isGeometryDataLayout(const DataLayout& layout) const;
+        void addDataInstanceUser(DataInstanceHandle dataInstance, RenderableHandle renderable, ERenderableDataSlotType slot);
+        void removeDataInstanceUser(DataInstanceHandle dataInstance, RenderableHandle renderable, ERenderableDataSlotType slot);
+        void addTextureSamplerUser(TextureSamplerHandle sampler, DataInstanceHandle dataInstance, DataFieldHandle field);
+        void removeTextureSamplerUser(TextureSamplerHandle sampler, DataInstanceHandle dataInstance, DataFieldHandle field);
         static bool CheckAndUpdateDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, DeviceResourceHandle& deviceHandleInOut, const ResourceContentHash& resourceHash);
 
         bool checkAndUpdateEffectResource(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable);
@@ -102,10 +111,28 @@ namespace ramses_internal
 
         mutable bool       m_renderableResourcesDirtinessNeedsUpdate = false;
         mutable bool       m_renderableVertexArraysDirty = false;
-        mutable BoolVector m_renderableResourcesDirty;
-        mutable BoolVector m_dataInstancesDirty;
-        mutable BoolVector m_textureSamplersDirty;
-        mutable BoolVector m_renderableVertexArrayDirty;
+        mutable DirtyHandleTracker<RenderableHandle>     m_renderableResourcesDirty;
+        mutable DirtyHandleTracker<DataInstanceHandle>   m_dataInstancesDirty;
+        mutable DirtyHandleTracker<TextureSamplerHandle> m_textureSamplersDirty;
+        mutable DirtyHandleTracker<RenderableHandle>     m_renderableVertexArrayDirty;
+
+        // reverse references so that dirtiness of data instance or texture sampler is propagated only to its users,
+        // every user knows its index in the list of users (unordered) so that it can be removed in constant time
+        struct DataInstanceUser
+        {
+            RenderableHandle renderable;
+            ERenderableDataSlotType slot;
+        };
+        struct TextureSamplerUser
+        {
+            DataInstanceHandle dataInstance;
+            DataFieldHandle field;
+        };
+        static constexpr uint32_t InvalidUserIndex = std::numeric_limits<uint32_t>::max();
+        std::vector<std::vector<DataInstanceUser>>                              m_renderablesUsingDataInstance;
+        std::vector<std::array<uint32_t, ERenderableDataSlotType_MAX_SLOTS>>    m_dataInstanceUserIndices;
+        std::vector<std::vector<TextureSamplerUser>>                            m_dataInstancesUsingTextureSampler;
+        std::vector<std::vector<uint32_t>>                                      m_textureSamplerUserIndices;
 
         bool m_renderTargetsDirty = false;
         bool m_blitPassesDirty = false;
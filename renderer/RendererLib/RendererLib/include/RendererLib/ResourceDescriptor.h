@@ -16,6 +16,7 @@
 #include "SceneAPI/ResourceContentHash.h"
 #include "Components/ManagedResource.h"
 #include "Collections/HashMap.h"
+#include "Math3d/BoundingBox.h"
 
 namespace ramses_internal
 {
@@ -30,6 +31,8 @@ namespace ramses_internal
         uint32_t compressedSize = 0;
         uint32_t decompressedSize = 0;
         uint32_t vramSize = 0;
+        // only calculated for vertex arrays with float elements, invalid otherwise
+        BoundingBox boundingBox;
     };
 
     using ResourceDescriptors = HashMap<ResourceContentHash, ResourceDescriptor>;
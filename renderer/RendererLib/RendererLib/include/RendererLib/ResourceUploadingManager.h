@@ -12,8 +12,9 @@
 #include "RendererLib/ResourceDescriptor.h"
 #include "RendererLib/IResourceUploader.h"
 #include "RendererLib/AsyncEffectUploader.h"
-#include "Collections/HashMap.h"
+#include "Collections/FlatHashMap.h"
 #include <map>
+#include <memory>
 
 namespace ramses_internal
 {
@@ -23,6 +24,7 @@ namespace ramses_internal
     class FrameTimer;
     class RendererStatistics;
     class DisplayConfig;
+    class ParallelForExecutor;
 
     class ResourceUploadingManager
     {
@@ -34,7 +36,8 @@ namespace ramses_internal
             AsyncEffectUploader& asyncEffectUploader,
             const DisplayConfig& displayConfig,
             const FrameTimer& frameTimer,
-            RendererStatistics& stats);
+            RendererStatistics& stats,
+            ParallelForExecutor* decompressionExecutor = nullptr);
         ~ResourceUploadingManager();
 
         [[nodiscard]] bool hasAnythingToUpload() const;
@@ -68,7 +71,7 @@ namespace ramses_internal
         const bool   m_keepEffects;
         const FrameTimer& m_frameTimer;
 
-        using SizeMap = HashMap<ResourceContentHash, uint32_t>;
+        using SizeMap = FlatHashMap<ResourceContentHash, uint32_t, ResourceContentHashFoldingHasher>;
         SizeMap       m_resourceSizes;
         uint64_t        m_resourceTotalUploadedSize = 0u;
         const uint64_t  m_resourceCacheSize = 0u;
@@ -78,6 +81,9 @@ namespace ramses_internal
 
         std::unordered_map<SceneId, int32_t> m_scenePriorities;
         mutable std::map<int32_t, ResourceContentHashVector> m_buckets;
+
+        // decompresses chunks of large compressed resources in parallel, shared with scene updates (not owned, can be null)
+        ParallelForExecutor* m_decompressionExecutor;
     };
 }
 
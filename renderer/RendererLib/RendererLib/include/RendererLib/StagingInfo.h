@@ -31,6 +31,9 @@ namespace ramses_internal
         ManagedResourceVector     resourceDataToProvide;
         ResourceContentHashVector resourcesAdded;
         ResourceContentHashVector resourcesRemoved;
+
+        // resource data is being decompressed asynchronously until this ticket is done, see FlushPreparationWorker
+        uint64_t                  preparationTicket = 0u;
     };
     using PendingFlushes = std::vector<PendingFlush>;
 
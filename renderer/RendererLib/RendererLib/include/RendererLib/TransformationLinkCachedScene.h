@@ -10,6 +10,7 @@
 #define RAMSES_TRANSFORMATIONLINKCACHEDSCENE_H
 
 #include "RendererLib/SceneLinkScene.h"
+#include "RendererLib/PickingCache.h"
 
 namespace ramses_internal
 {
@@ -26,10 +27,25 @@ namespace ramses_internal
         void                    setRotation(TransformHandle transform, const glm::vec4& rotation, ERotationType rotationType) override;
         void                    setScaling(TransformHandle transform, const glm::vec3& scaling) override;
 
+        void                    releaseTransform(TransformHandle transform) override;
+
         void                    releaseDataSlot(DataSlotHandle handle) override;
+
+        PickableObjectHandle    allocatePickableObject(DataBufferHandle geometryHandle, NodeHandle nodeHandle, PickableObjectId id, PickableObjectHandle pickableHandle = PickableObjectHandle::Invalid()) override;
+        void                    releasePickableObject(PickableObjectHandle pickableHandle) override;
+        void                    setPickableObjectCamera(PickableObjectHandle pickableHandle, CameraHandle cameraHandle) override;
+        void                    setPickableObjectEnabled(PickableObjectHandle pickableHandle, bool isEnabled) override;
+
+        void                    releaseDataBuffer(DataBufferHandle handle) override;
+        void                    updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const Byte* data) override;
+
         [[nodiscard]] glm::mat4 updateMatrixCacheWithLinks(ETransformationMatrixType matrixType, NodeHandle node) const;
+        void                    updateMatrixCacheWithLinksForNodes(ETransformationMatrixType matrixType, const NodeHandleVector& nodes, ParallelForExecutor* executor = nullptr) const;
         void      propagateDirtyToConsumers(NodeHandle node) const;
 
+        // brings picking acceleration structures up to date with scene, cheap if no pickable object or its geometry or transformation changed
+        const PickingCache&     updatePickingCache() const;
+
     private:
         void getMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, glm::mat4& chainMatrix) const;
         void resolveMatrix(ETransformationMatrixType matrixType, NodeHandle node, glm::mat4& chainMatrix) const;
@@ -37,6 +53,8 @@ namespace ramses_internal
         // to avoid memory allocations the pool for dirty nodes is member variable
         // even though it is used in the scope of matrix cache update only
         mutable NodeHandleVector m_dirtyNodes;
+
+        mutable PickingCache m_pickingCache;
     };
 }
 
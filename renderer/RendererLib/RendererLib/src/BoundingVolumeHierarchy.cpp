@@ -0,0 +1,108 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/BoundingVolumeHierarchy.h"
+#include <algorithm>
+#include <numeric>
+
+namespace ramses_internal
+{
+    void BoundingVolumeHierarchy::build(std::vector<BoundingBox> primitiveBoxes)
+    {
+        m_primitiveBoxes = std::move(primitiveBoxes);
+        m_nodes.clear();
+        m_primitives.resize(m_primitiveBoxes.size());
+        std::iota(m_primitives.begin(), m_primitives.end(), 0u);
+
+        if (m_primitiveBoxes.empty())
+            return;
+
+        std::vector<glm::vec3> centers;
+        centers.reserve(m_primitiveBoxes.size());
+        for (const auto& box : m_primitiveBoxes)
+        {
+            assert(box.isValid());
+            centers.push_back((box.getMin() + box.getMax()) * 0.5f);
+        }
+
+        // a binary tree with leaves holding at least half of max primitives has less than this many nodes
+        m_nodes.reserve(2u * (m_primitiveBoxes.size() / (MaxPrimitivesInLeaf / 2u) + 1u));
+        buildNode(0u, static_cast<uint32_t>(m_primitives.size()), centers);
+    }
+
+    void BoundingVolumeHierarchy::buildNode(uint32_t begin, uint32_t end, const std::vector<glm::vec3>& centers)
+    {
+        const auto nodeIdx = static_cast<uint32_t>(m_nodes.size());
+        m_nodes.emplace_back();
+
+        BoundingBox centersBox;
+        for (uint32_t i = begin; i < end; ++i)
+        {
+            m_nodes[nodeIdx].box.extend(m_primitiveBoxes[m_primitives[i]]);
+            centersBox.extend(centers[m_primitives[i]]);
+        }
+
+        if (end - begin <= MaxPrimitivesInLeaf)
+        {
+            m_nodes[nodeIdx].offset = begin;
+            m_nodes[nodeIdx].primitiveCount = end - begin;
+            return;
+        }
+
+        // split at median of primitive centers along longest axis, keeps tree balanced also for unevenly distributed primitives
+        const glm::vec3 extent = centersBox.getMax() - centersBox.getMin();
+        glm::length_t axis = 0;
+        if (extent.y > extent[axis])
+            axis = 1;
+        if (extent.z > extent[axis])
+            axis = 2;
+
+        const uint32_t middle = begin + (end - begin) / 2u;
+        std::nth_element(m_primitives.begin() + begin, m_primitives.begin() + middle, m_primitives.begin() + end, [&](uint32_t a, uint32_t b)
+        {
+            return centers[a][axis] < centers[b][axis];
+        });
+
+        buildNode(begin, middle, centers);
+        m_nodes[nodeIdx].offset = static_cast<uint32_t>(m_nodes.size());
+        buildNode(middle, end, centers);
+    }
+
+    void BoundingVolumeHierarchy::setPrimitiveBoundingBox(uint32_t primitive, const BoundingBox& box)
+    {
+        assert(primitive < m_primitiveBoxes.size());
+        assert(box.isValid());
+        m_primitiveBoxes[primitive] = box;
+    }
+
+    void BoundingVolumeHierarchy::refit()
+    {
+        // children are always stored after their parent
+        for (auto nodeIdx = static_cast<uint32_t>(m_nodes.size()); nodeIdx-- > 0u;)
+        {
+            Node& node = m_nodes[nodeIdx];
+            node.box = {};
+            if (node.primitiveCount > 0u)
+            {
+                for (uint32_t i = node.offset; i < node.offset + node.primitiveCount; ++i)
+                    node.box.extend(m_primitiveBoxes[m_primitives[i]]);
+            }
+            else
+            {
+                node.box.extend(m_nodes[nodeIdx + 1u].box);
+                node.box.extend(m_nodes[node.offset].box);
+            }
+        }
+    }
+
+    const BoundingBox& BoundingVolumeHierarchy::getBoundingBox() const
+    {
+        static const BoundingBox EmptyBox;
+        return isEmpty() ? EmptyBox : m_nodes.front().box;
+    }
+}
@@ -94,10 +94,14 @@ namespace ramses_internal
     void DisplayBundle::finishFrameStatistics(std::chrono::microseconds prevFrameSleepTime)
     {
         uint32_t drawCalls = 0u;
+        uint32_t avoidedStateChanges = 0u;
         if (m_renderer.hasDisplayController())
+        {
             drawCalls = m_renderer.getDisplayController().getRenderBackend().getDevice().getAndResetDrawCallCount();
+            avoidedStateChanges = m_renderer.getDisplayController().getAndResetAvoidedStateChangeCount();
+        }
 
-        m_renderer.getStatistics().frameFinished(drawCalls);
+        m_renderer.getStatistics().frameFinished(drawCalls, avoidedStateChanges);
         m_renderer.getProfilerStatistics().markFrameFinished(prevFrameSleepTime);
     }
 
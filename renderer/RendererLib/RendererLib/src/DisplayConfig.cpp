@@ -336,6 +336,56 @@ namespace ramses_internal
         return m_resourceUploadBatchSize;
     }
 
+    void DisplayConfig::setFrustumCullingEnabled(bool enabled)
+    {
+        m_frustumCullingEnabled = enabled;
+    }
+
+    bool DisplayConfig::isFrustumCullingEnabled() const
+    {
+        return m_frustumCullingEnabled;
+    }
+
+    void DisplayConfig::setSceneUpdateWorkerThreadCount(uint32_t threadCount)
+    {
+        m_sceneUpdateWorkerThreadCount = threadCount;
+    }
+
+    uint32_t DisplayConfig::getSceneUpdateWorkerThreadCount() const
+    {
+        return m_sceneUpdateWorkerThreadCount;
+    }
+
+    void DisplayConfig::setStateSortingEnabled(bool enabled)
+    {
+        m_stateSortingEnabled = enabled;
+    }
+
+    bool DisplayConfig::isStateSortingEnabled() const
+    {
+        return m_stateSortingEnabled;
+    }
+
+    void DisplayConfig::setDrawCallBatchingEnabled(bool enabled)
+    {
+        m_drawCallBatchingEnabled = enabled;
+    }
+
+    bool DisplayConfig::isDrawCallBatchingEnabled() const
+    {
+        return m_drawCallBatchingEnabled;
+    }
+
+    void DisplayConfig::setAsyncFlushPreparationEnabled(bool enabled)
+    {
+        m_asyncFlushPreparationEnabled = enabled;
+    }
+
+    bool DisplayConfig::isAsyncFlushPreparationEnabled() const
+    {
+        return m_asyncFlushPreparationEnabled;
+    }
+
     bool DisplayConfig::operator == (const DisplayConfig& other) const
     {
         return
@@ -365,7 +415,12 @@ namespace ramses_internal
             m_platformRenderNode         == other.m_platformRenderNode &&
             m_swapInterval               == other.m_swapInterval &&
             m_scenePriorities            == other.m_scenePriorities &&
-            m_resourceUploadBatchSize    == other.m_resourceUploadBatchSize;
+            m_resourceUploadBatchSize    == other.m_resourceUploadBatchSize &&
+            m_frustumCullingEnabled      == other.m_frustumCullingEnabled &&
+            m_sceneUpdateWorkerThreadCount == other.m_sceneUpdateWorkerThreadCount &&
+            m_stateSortingEnabled        == other.m_stateSortingEnabled &&
+            m_drawCallBatchingEnabled    == other.m_drawCallBatchingEnabled &&
+            m_asyncFlushPreparationEnabled == other.m_asyncFlushPreparationEnabled;
     }
 
     bool DisplayConfig::operator != (const DisplayConfig& other) const
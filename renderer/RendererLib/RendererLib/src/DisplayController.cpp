@@ -56,7 +56,10 @@ namespace ramses_internal
     {
         RenderExecutor executor(m_renderBackend.getDevice(), renderContext, frameTimer);
 
-        return executor.executeScene(scene);
+        const SceneRenderExecutionIterator renderIterator = executor.executeScene(scene);
+        m_avoidedStateChanges += executor.getAvoidedStateChangeCount();
+
+        return renderIterator;
     }
 
     void DisplayController::clearBuffer(DeviceResourceHandle buffer, uint32_t clearFlags, const glm::vec4& clearColor)
@@ -114,4 +117,11 @@ namespace ramses_internal
     {
         m_renderBackend.getDevice().validateDeviceStatusHealthy();
     }
+
+    uint32_t DisplayController::getAndResetAvoidedStateChangeCount()
+    {
+        const uint32_t avoidedStateChanges = m_avoidedStateChanges;
+        m_avoidedStateChanges = 0u;
+        return avoidedStateChanges;
+    }
 }
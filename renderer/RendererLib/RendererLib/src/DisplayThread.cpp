@@ -9,6 +9,7 @@
 #include "RendererLib/DisplayThread.h"
 #include "RendererLib/DisplayBundle.h"
 #include "Utils/ThreadLocalLog.h"
+#include "Utils/TraceRecorder.h"
 
 namespace ramses_internal
 {
@@ -76,6 +77,7 @@ namespace ramses_internal
     void DisplayThread::run()
     {
         ThreadLocalLog::SetPrefix(static_cast<int>(m_displayHandle.asMemoryHandle()));
+        GetTraceRecorder().setThreadName(fmt::format("Display {}", m_displayHandle));
 
         std::chrono::milliseconds lastLoopSleepTime{ 0u };
         while (!isCancelRequested())
@@ -107,7 +109,10 @@ namespace ramses_internal
             {
                 m_display->traceId() = 10004;
                 auto loopStartTime = std::chrono::steady_clock::now();
-                m_display->doOneLoop(loopMode, lastLoopSleepTime);
+                {
+                    RAMSES_TRACE_SCOPE_ARG("renderer", "DisplayLoop", "frame", m_frameCounter.load());
+                    m_display->doOneLoop(loopMode, lastLoopSleepTime);
+                }
                 const auto loopEndTime = std::chrono::steady_clock::now();
 
                 m_display->traceId() = 10005;
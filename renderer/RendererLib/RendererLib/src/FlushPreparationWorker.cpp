@@ -0,0 +1,106 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/FlushPreparationWorker.h"
+#include "Resource/IResource.h"
+#include "Utils/TraceRecorder.h"
+#include <algorithm>
+#include <iterator>
+#include <cassert>
+
+namespace ramses_internal
+{
+    FlushPreparationWorker::FlushPreparationWorker()
+        : m_thread("R_FlushPrep")
+    {
+        m_thread.start(*this);
+    }
+
+    FlushPreparationWorker::~FlushPreparationWorker()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            // cancel inside critical section to avoid missing wake up of worker
+            m_thread.cancel();
+        }
+        m_workAvailable.notify_one();
+        m_thread.join();
+    }
+
+    uint64_t FlushPreparationWorker::prepare(const ManagedResourceVector& resources)
+    {
+        ManagedResourceVector resourcesToDecompress;
+        std::copy_if(resources.cbegin(), resources.cend(), std::back_inserter(resourcesToDecompress),
+            [](const auto& mr) { return mr->isCompressedAvailable() && !mr->isDeCompressedAvailable(); });
+
+        uint64_t ticket = InvalidTicket;
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            if (resourcesToDecompress.empty() && !m_preparationsHeld)
+                return InvalidTicket;
+            m_queue.push_back(std::move(resourcesToDecompress));
+            ticket = ++m_lastEnqueuedTicket;
+        }
+        m_workAvailable.notify_one();
+
+        return ticket;
+    }
+
+    bool FlushPreparationWorker::isPrepared(uint64_t ticket) const
+    {
+        return ticket <= m_lastPreparedTicket.load(std::memory_order_acquire);
+    }
+
+    void FlushPreparationWorker::waitUntilPrepared(uint64_t ticket)
+    {
+        if (isPrepared(ticket))
+            return;
+
+        RAMSES_TRACE_SCOPE("renderer", "WaitForFlushPreparation");
+        std::unique_lock<std::mutex> guard(m_lock);
+        assert(ticket <= m_lastEnqueuedTicket);
+        m_workDone.wait(guard, [&]() { return isPrepared(ticket); });
+    }
+
+    void FlushPreparationWorker::holdPreparations(bool hold)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_lock);
+            m_preparationsHeld = hold;
+        }
+        m_workAvailable.notify_one();
+    }
+
+    void FlushPreparationWorker::run()
+    {
+        std::unique_lock<std::mutex> guard(m_lock);
+        while (!isCancelRequested())
+        {
+            m_workAvailable.wait(guard, [&]() { return (!m_queue.empty() && !m_preparationsHeld) || isCancelRequested(); });
+            while (!m_queue.empty() && !m_preparationsHeld && !isCancelRequested())
+            {
+                ManagedResourceVector resources = std::move(m_queue.front());
+                m_queue.pop_front();
+                guard.unlock();
+
+                {
+                    RAMSES_TRACE_SCOPE_ARG("renderer", "PrepareFlush", "resources", resources.size());
+                    // decompression is synchronized within resource, render thread can safely use resource in parallel
+                    for (const auto& resource : resources)
+                        resource->decompress();
+                    // release resources here, they might be last references
+                    resources.clear();
+                }
+
+                guard.lock();
+                m_lastPreparedTicket.fetch_add(1u, std::memory_order_release);
+                m_workDone.notify_all();
+            }
+        }
+    }
+}
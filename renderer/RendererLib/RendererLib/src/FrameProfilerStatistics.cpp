@@ -10,6 +10,7 @@
 #include "Collections/StringOutputStream.h"
 #include "Utils/LoggingUtils.h"
 #include "PlatformAbstraction/PlatformMath.h"
+#include "Utils/TraceRecorder.h"
 
 namespace ramses_internal
 {
@@ -40,6 +41,10 @@ namespace ramses_internal
 
         const size_t totalRegionTime = static_cast<size_t>(PlatformTime::GetMicrosecondsMonotonic() - m_regionStartTimes[regionId]);
         m_frameTimings[m_frameTimings.size() - NumberOfRegions + regionId] = totalRegionTime;
+
+        TraceRecorder& traceRecorder = GetTraceRecorder();
+        if (traceRecorder.isEnabled())
+            traceRecorder.recordComplete("renderer", EnumToString(region), m_regionStartTimes[regionId], totalRegionTime);
     }
 
     void FrameProfilerStatistics::initNextFrameTimings()
@@ -90,16 +90,26 @@ namespace ramses_internal
         return TestPointInTriangle(triangle, planeNormal, intersectionPointInModelSpace);
     }
 
-    bool IntersectionUtils::TestGeometryPicked(const glm::vec2& pickCoordsNDS, const float* geometry, const size_t geometrySize, const glm::mat4& modelMatrix, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec3& intersectionPointInModelSpace)
+    IntersectionUtils::Triangle IntersectionUtils::GetTriangle(const float* geometry, size_t triangleIndex)
+    {
+        const float* triData = &geometry[triangleIndex * 9u];
+        Triangle triangle;
+        std::copy(triData + 0, triData + 3, glm::value_ptr(triangle.v0));
+        std::copy(triData + 3, triData + 6, glm::value_ptr(triangle.v1));
+        std::copy(triData + 6, triData + 9, glm::value_ptr(triangle.v2));
+        return triangle;
+    }
+
+    void IntersectionUtils::UnprojectRay(const glm::vec2& pickCoordsNDS, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec4& rayOriginWorld, glm::vec4& rayTargetWorld)
     {
-        assert(geometrySize % 9 == 0);
         // 4D homogeneous Clip Coordinates
         const glm::vec4 ray_orig_clip(pickCoordsNDS.x, pickCoordsNDS.y, -1.0f, 1.0f);
         const glm::vec4 ray_target_clip(pickCoordsNDS.x, pickCoordsNDS.y, 1.0f, 1.0f);
 
         // 4D Camera Coordinates
-        glm::vec4 ray_orig_camera(glm::inverse(projectionMatrix) * ray_orig_clip);
-        glm::vec4 ray_target_camera(glm::inverse(projectionMatrix) * ray_target_clip);
+        const auto inverseProjectionMatrix = glm::inverse(projectionMatrix);
+        glm::vec4 ray_orig_camera(inverseProjectionMatrix * ray_orig_clip);
+        glm::vec4 ray_target_camera(inverseProjectionMatrix * ray_target_clip);
         ray_orig_camera /=  ray_orig_camera.w;
         ray_target_camera /= ray_target_camera.w;
         ray_orig_camera.w = 1.f;
@@ -107,8 +117,34 @@ namespace ramses_internal
 
         // 4D World Coordinates --> for ray and camera
         const auto inverseViewMatrix = glm::inverse(viewMatrix);
-        const glm::vec4 ray_orig_world(inverseViewMatrix * ray_orig_camera);
-        const glm::vec4 ray_target_world(inverseViewMatrix * ray_target_camera);
+        rayOriginWorld = inverseViewMatrix * ray_orig_camera;
+        rayTargetWorld = inverseViewMatrix * ray_target_camera;
+    }
+
+    bool IntersectionUtils::IntersectRayVsGeometry(const float* geometry, const BoundingVolumeHierarchy& geometryBVH, const glm::vec3& rayOrigin, const glm::vec3& rayDir, glm::vec3& intersectionPointInModelSpace)
+    {
+        bool intersectionResult = false;
+        geometryBVH.traverse(rayOrigin, rayDir, [&](uint32_t triangleIndex, float& distanceInModelSpace)
+        {
+            float distanceResult = 0.f;
+            glm::vec3 intersectionPoint;
+            if (IntersectRayVsTriangle(GetTriangle(geometry, triangleIndex), rayOrigin, rayDir, intersectionPoint, distanceResult) && distanceResult < distanceInModelSpace)
+            {
+                // only triangles nearer than this one are of interest from now on
+                intersectionResult = true;
+                intersectionPointInModelSpace = intersectionPoint;
+                distanceInModelSpace = distanceResult;
+            }
+        });
+        return intersectionResult;
+    }
+
+    bool IntersectionUtils::TestGeometryPicked(const glm::vec2& pickCoordsNDS, const float* geometry, const size_t geometrySize, const glm::mat4& modelMatrix, const glm::mat4& viewMatrix, const glm::mat4& projectionMatrix, glm::vec3& intersectionPointInModelSpace)
+    {
+        assert(geometrySize % 9 == 0);
+        glm::vec4 ray_orig_world;
+        glm::vec4 ray_target_world;
+        UnprojectRay(pickCoordsNDS, viewMatrix, projectionMatrix, ray_orig_world, ray_target_world);
 
         // 3D Model Coordinates
         const auto inverseModelMatrix = glm::inverse(modelMatrix);
@@ -119,17 +155,11 @@ namespace ramses_internal
         bool intersectionResult = false;
         float distanceInModelSpace = std::numeric_limits<float>::max();
 
-        for (size_t fltIdx = 0u; fltIdx < geometrySize; fltIdx += 9)
+        for (size_t triangleIdx = 0u; triangleIdx < geometrySize / 9; ++triangleIdx)
         {
-            const float* triData = &geometry[fltIdx];
-            Triangle triangle;
-            std::copy(triData + 0, triData + 3, glm::value_ptr(triangle.v0));
-            std::copy(triData + 3, triData + 6, glm::value_ptr(triangle.v1));
-            std::copy(triData + 6, triData + 9, glm::value_ptr(triangle.v2));
-
             float distanceResult = 0.f;
             glm::vec3 intersectionPoint;
-            if (IntersectRayVsTriangle(triangle, ray_orig_model, ray_dir_model, intersectionPoint, distanceResult))
+            if (IntersectRayVsTriangle(GetTriangle(geometry, triangleIdx), ray_orig_model, ray_dir_model, intersectionPoint, distanceResult))
             {
                 intersectionResult = true;
                 if (distanceResult < distanceInModelSpace)
@@ -153,61 +183,62 @@ namespace ramses_internal
         };
         std::vector<PickedObjectEntry> pickedObjectEntries;
 
-        for (PickableObjectHandle pickableHandle(0); pickableHandle < scene.getPickableObjectCount(); ++pickableHandle)
+        // only pickable objects whose bounding box is hit by pick ray of their camera are tested against triangles of their geometry,
+        // which in turn are only tested if their bounding box is hit
+        const PickingCache& pickingCache = scene.updatePickingCache();
+        for (const auto cameraHandle : pickingCache.getCameras())
         {
-            if (scene.isPickableObjectAllocated(pickableHandle))
+            const Camera& pickableCamera = scene.getCamera(cameraHandle);
+
+            // get viewport data here and pass to next function
+            const auto vpOffsetRef = scene.getDataReference(pickableCamera.dataInstance, Camera::ViewportOffsetField);
+            const auto vpSizeRef = scene.getDataReference(pickableCamera.dataInstance, Camera::ViewportSizeField);
+            const auto& vpOffset = scene.getDataSingleVector2i(vpOffsetRef, DataFieldHandle{ 0 });
+            const auto& vpSize = scene.getDataSingleVector2i(vpSizeRef, DataFieldHandle{ 0 });
+
+            const glm::ivec2 coordsInViewportSpace = coordsInBufferSpace - vpOffset;
+            //if pick event happened outside of viewport: ignore it
+            if (coordsInViewportSpace.x < 0 || coordsInViewportSpace.y < 0 || coordsInViewportSpace.x > vpSize.x || coordsInViewportSpace.y > vpSize.y)
+                continue;
+
+            const glm::vec2 coordsNDS = { 2.f * coordsInViewportSpace.x / vpSize.x - 1.f, 2.f * coordsInViewportSpace.y / vpSize.y - 1.f };
+
+            const auto cameraViewMatrix = scene.updateMatrixCacheWithLinks(
+                ETransformationMatrixType_Object, pickableCamera.node);
+
+            const auto frustumPlanesRef = scene.getDataReference(pickableCamera.dataInstance, Camera::FrustumPlanesField);
+            const auto frustumNearFarRef = scene.getDataReference(pickableCamera.dataInstance, Camera::FrustumNearFarPlanesField);
+            const auto& frustumPlanes = scene.getDataSingleVector4f(frustumPlanesRef, DataFieldHandle{ 0 });
+            const auto& frustumNearFar = scene.getDataSingleVector2f(frustumNearFarRef, DataFieldHandle{ 0 });
+
+            const auto projectionMatrix = CameraMatrixHelper::ProjectionMatrix(
+                ProjectionParams::Frustum(pickableCamera.projectionType, frustumPlanes.x, frustumPlanes.y, frustumPlanes.z, frustumPlanes.w, frustumNearFar.x, frustumNearFar.y));
+
+            glm::vec4 rayOriginWorld;
+            glm::vec4 rayTargetWorld;
+            UnprojectRay(coordsNDS, cameraViewMatrix, projectionMatrix, rayOriginWorld, rayTargetWorld);
+
+            pickingCache.forEachPickableHitByRay(glm::vec3(rayOriginWorld), glm::vec3(rayTargetWorld - rayOriginWorld), [&](const PickingCache::Pickable& pickable)
             {
-                const PickableObject& pickableObject = scene.getPickableObject(pickableHandle);
-                if (!pickableObject.isEnabled || !pickableObject.cameraHandle.isValid())
-                    continue;
-
-                const Camera& pickableCamera = scene.getCamera(pickableObject.cameraHandle);
-
-                // get viewport data here and pass to next function
-                const auto vpOffsetRef = scene.getDataReference(pickableCamera.dataInstance, Camera::ViewportOffsetField);
-                const auto vpSizeRef = scene.getDataReference(pickableCamera.dataInstance, Camera::ViewportSizeField);
-                const auto& vpOffset = scene.getDataSingleVector2i(vpOffsetRef, DataFieldHandle{ 0 });
-                const auto& vpSize = scene.getDataSingleVector2i(vpSizeRef, DataFieldHandle{ 0 });
-
-                const glm::ivec2 coordsInViewportSpace = coordsInBufferSpace - vpOffset;
-                //if pick event happened outside of viewport: ignore it
-                if (coordsInViewportSpace.x < 0 || coordsInViewportSpace.y < 0 || coordsInViewportSpace.x > vpSize.x || coordsInViewportSpace.y > vpSize.y)
-                    continue;
-
-                const glm::vec2 coordsNDS = { 2.f * coordsInViewportSpace.x / vpSize.x - 1.f, 2.f * coordsInViewportSpace.y / vpSize.y - 1.f };
-
-                const auto cameraViewMatrix = scene.updateMatrixCacheWithLinks(
-                    ETransformationMatrixType_Object, pickableCamera.node);
-                const auto modelMatrix = scene.updateMatrixCacheWithLinks(
-                    ETransformationMatrixType_World, pickableObject.nodeHandle);
-
-                const auto frustumPlanesRef = scene.getDataReference(pickableCamera.dataInstance, Camera::FrustumPlanesField);
-                const auto frustumNearFarRef = scene.getDataReference(pickableCamera.dataInstance, Camera::FrustumNearFarPlanesField);
-                const auto& frustumPlanes = scene.getDataSingleVector4f(frustumPlanesRef, DataFieldHandle{ 0 });
-                const auto& frustumNearFar = scene.getDataSingleVector2f(frustumNearFarRef, DataFieldHandle{ 0 });
-
-                const auto projectionMatrix = CameraMatrixHelper::ProjectionMatrix(
-                    ProjectionParams::Frustum(pickableCamera.projectionType, frustumPlanes.x, frustumPlanes.y, frustumPlanes.z, frustumPlanes.w, frustumNearFar.x, frustumNearFar.y));
-
-                const GeometryDataBuffer& geometryBuffer =
-                    scene.getDataBuffer(pickableObject.geometryHandle);
-                assert(geometryBuffer.bufferType == EDataBufferType::VertexBuffer);
-                assert(geometryBuffer.dataType == EDataType::Vector3F);
-                const float*  geometryBufferFloat =
-                    reinterpret_cast<const float*>(geometryBuffer.data.data());
-                const uint32_t geometrySize = geometryBuffer.usedSize / sizeof(float);
-                assert(0 == geometrySize % 9);
+                const PickableObject& pickableObject = scene.getPickableObject(pickable.handle);
+                if (pickableObject.cameraHandle != cameraHandle)
+                    return;
+
+                const glm::vec3 rayOriginModel(pickable.inverseWorldMatrix * rayOriginWorld);
+                const glm::vec3 rayTargetModel(pickable.inverseWorldMatrix * rayTargetWorld);
+                const auto rayDirModel = glm::normalize(rayTargetModel - rayOriginModel);
+
+                const GeometryDataBuffer& geometryBuffer = scene.getDataBuffer(pickableObject.geometryHandle);
+                const float* geometryBufferFloat = reinterpret_cast<const float*>(geometryBuffer.data.data());
 
                 glm::vec3 intersectionPointInModelSpace;
-                if (IntersectionUtils::TestGeometryPicked(coordsNDS,
-                                                            geometryBufferFloat,
-                                                            geometrySize,
-                                                            modelMatrix,
-                                                            cameraViewMatrix,
-                                                            projectionMatrix,
-                                                            intersectionPointInModelSpace))
+                if (IntersectionUtils::IntersectRayVsGeometry(geometryBufferFloat,
+                                                              pickingCache.getGeometryBVH(pickableObject.geometryHandle),
+                                                              rayOriginModel,
+                                                              rayDirModel,
+                                                              intersectionPointInModelSpace))
                 {
-                    const glm::vec4 intersectionPointInClipSpace = projectionMatrix * cameraViewMatrix * modelMatrix * glm::vec4(intersectionPointInModelSpace, 1.f);
+                    const glm::vec4 intersectionPointInClipSpace = projectionMatrix * cameraViewMatrix * pickable.worldMatrix * glm::vec4(intersectionPointInModelSpace, 1.f);
                     const glm::vec4 intersectionPointInNDS = intersectionPointInClipSpace / intersectionPointInClipSpace.w;
 
                     assert(std::abs(intersectionPointInNDS.x - coordsNDS.x) <= std::numeric_limits<float>::epsilon() * 10);
@@ -216,7 +247,7 @@ namespace ramses_internal
 
                     pickedObjectEntries.push_back({ pickableObject.id , intersectionDepthInNDS });
                 }
-            }
+            });
         }
 
         pickedObjects.resize(pickedObjectEntries.size());
@@ -224,4 +255,3 @@ namespace ramses_internal
         std::transform(pickedObjectEntries.cbegin(), pickedObjectEntries.cend(), pickedObjects.begin(), [](const PickedObjectEntry& e) { return e.id; });
     }
 }
-
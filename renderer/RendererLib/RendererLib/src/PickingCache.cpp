@@ -0,0 +1,152 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "RendererLib/PickingCache.h"
+#include "RendererLib/TransformationLinkCachedScene.h"
+#include "SceneAPI/GeometryDataBuffer.h"
+#include "SceneAPI/PickableObject.h"
+#include "glm/gtc/type_ptr.hpp"
+#include <algorithm>
+
+namespace ramses_internal
+{
+    namespace
+    {
+        // enlarges box slightly so that rounding errors in ray vs box test cannot reject ray hitting triangle exactly at its edge
+        BoundingBox Pad(const BoundingBox& box)
+        {
+            const glm::vec3 magnitude = glm::max(glm::abs(box.getMin()), glm::abs(box.getMax()));
+            const float padding = std::max({ magnitude.x, magnitude.y, magnitude.z, 1.f }) * 1e-5f;
+            return { box.getMin() - glm::vec3(padding), box.getMax() + glm::vec3(padding) };
+        }
+    }
+
+    void PickingCache::markDirty()
+    {
+        m_dirty = true;
+    }
+
+    void PickingCache::markGeometryDirty(DataBufferHandle geometry)
+    {
+        const auto index = geometry.asMemoryHandle();
+        if (index < m_geometries.size())
+            m_geometries[index].dirty = true;
+        m_dirty = true;
+    }
+
+    void PickingCache::update(const TransformationLinkCachedScene& scene)
+    {
+        if (!m_dirty)
+            return;
+        m_dirty = false;
+
+        m_cameras.clear();
+        std::vector<BoundingBox> boxes;
+        boxes.reserve(m_pickables.size());
+        bool pickablesChanged = false;
+
+        for (PickableObjectHandle handle(0); handle < scene.getPickableObjectCount(); ++handle)
+        {
+            if (!scene.isPickableObjectAllocated(handle))
+                continue;
+
+            const PickableObject& pickableObject = scene.getPickableObject(handle);
+            if (!pickableObject.isEnabled || !pickableObject.cameraHandle.isValid())
+                continue;
+
+            const BoundingVolumeHierarchy& geometryBVH = updateGeometry(scene, pickableObject.geometryHandle);
+            if (geometryBVH.isEmpty())
+                continue;
+
+            // keep cached inverse matrix of pickables which stayed at same position in list and did not move
+            const size_t index = boxes.size();
+            bool matrixKnown = true;
+            if (index == m_pickables.size())
+            {
+                m_pickables.push_back({ handle });
+                pickablesChanged = true;
+                matrixKnown = false;
+            }
+            else if (m_pickables[index].handle != handle)
+            {
+                m_pickables[index] = { handle };
+                pickablesChanged = true;
+                matrixKnown = false;
+            }
+
+            Pickable& pickable = m_pickables[index];
+            const glm::mat4 worldMatrix = scene.updateMatrixCacheWithLinks(ETransformationMatrixType_World, pickableObject.nodeHandle);
+            if (!matrixKnown || worldMatrix != pickable.worldMatrix)
+            {
+                pickable.worldMatrix = worldMatrix;
+                pickable.inverseWorldMatrix = glm::inverse(worldMatrix);
+            }
+            boxes.push_back(geometryBVH.getBoundingBox().transformed(worldMatrix));
+
+            if (std::find(m_cameras.cbegin(), m_cameras.cend(), pickableObject.cameraHandle) == m_cameras.cend())
+                m_cameras.push_back(pickableObject.cameraHandle);
+        }
+
+        if (boxes.size() != m_pickables.size())
+        {
+            m_pickables.resize(boxes.size());
+            pickablesChanged = true;
+        }
+
+        if (pickablesChanged)
+        {
+            m_pickablesBVH.build(std::move(boxes));
+        }
+        else
+        {
+            for (uint32_t i = 0u; i < boxes.size(); ++i)
+                m_pickablesBVH.setPrimitiveBoundingBox(i, boxes[i]);
+            m_pickablesBVH.refit();
+        }
+    }
+
+    const BoundingVolumeHierarchy& PickingCache::getGeometryBVH(DataBufferHandle geometry) const
+    {
+        assert(geometry.asMemoryHandle() < m_geometries.size());
+        assert(!m_geometries[geometry.asMemoryHandle()].dirty);
+        return m_geometries[geometry.asMemoryHandle()].bvh;
+    }
+
+    const BoundingVolumeHierarchy& PickingCache::updateGeometry(const TransformationLinkCachedScene& scene, DataBufferHandle geometryHandle)
+    {
+        const auto index = geometryHandle.asMemoryHandle();
+        if (index >= m_geometries.size())
+            m_geometries.resize(index + 1u);
+
+        Geometry& geometry = m_geometries[index];
+        if (geometry.dirty)
+        {
+            const GeometryDataBuffer& geometryBuffer = scene.getDataBuffer(geometryHandle);
+            assert(geometryBuffer.bufferType == EDataBufferType::VertexBuffer);
+            assert(geometryBuffer.dataType == EDataType::Vector3F);
+            const float* geometryBufferFloat = reinterpret_cast<const float*>(geometryBuffer.data.data());
+            const uint32_t geometrySize = geometryBuffer.usedSize / sizeof(float);
+            assert(0 == geometrySize % 9);
+
+            std::vector<BoundingBox> triangleBoxes;
+            triangleBoxes.reserve(geometrySize / 9u);
+            for (uint32_t fltIdx = 0u; fltIdx + 9u <= geometrySize; fltIdx += 9u)
+            {
+                BoundingBox box;
+                for (uint32_t vertex = 0u; vertex < 3u; ++vertex)
+                    box.extend(glm::make_vec3(geometryBufferFloat + fltIdx + 3u * vertex));
+                triangleBoxes.push_back(Pad(box));
+            }
+
+            geometry.bvh.build(std::move(triangleBoxes));
+            geometry.dirty = false;
+        }
+
+        return geometry.bvh;
+    }
+}
@@ -11,9 +11,61 @@
 #include "RendererAPI/IDevice.h"
 #include "SceneAPI/BlitPass.h"
 #include "Components/EffectUniformTime.h"
+#include <optional>
+#include <algorithm>
 
 namespace ramses_internal
 {
+    namespace
+    {
+        bool IsTransformationDependentSemantic(EFixedSemantics semantics)
+        {
+            switch (semantics)
+            {
+            case EFixedSemantics::ModelMatrix:
+            case EFixedSemantics::ModelViewMatrix:
+            case EFixedSemantics::ModelViewMatrix33:
+            case EFixedSemantics::ModelViewProjectionMatrix:
+            case EFixedSemantics::NormalMatrix:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+        // renderable drawn alone only sets first element of semantic input taken as array (instance index 0),
+        // other elements keep their values
+        void SetSemanticMatrix(RendererCachedScene& scene, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle, const glm::mat4& mat, std::vector<glm::mat4>& arrayValues)
+        {
+            const uint32_t elementCount = scene.getDataLayout(scene.getLayoutOfDataInstance(dataInstHandle)).getField(dataFieldHandle).elementCount;
+            if (elementCount == 1u)
+            {
+                scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+                return;
+            }
+
+            const glm::mat4* currentValues = scene.getDataMatrix44fArray(dataInstHandle, dataFieldHandle);
+            arrayValues.assign(currentValues, currentValues + elementCount);
+            arrayValues.front() = mat;
+            scene.setDataMatrix44fArray(dataInstHandle, dataFieldHandle, elementCount, arrayValues.data());
+        }
+
+        void SetSemanticMatrix(RendererCachedScene& scene, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle, const glm::mat3& mat, std::vector<glm::mat3>& arrayValues)
+        {
+            const uint32_t elementCount = scene.getDataLayout(scene.getLayoutOfDataInstance(dataInstHandle)).getField(dataFieldHandle).elementCount;
+            if (elementCount == 1u)
+            {
+                scene.setDataSingleMatrix33f(dataInstHandle, dataFieldHandle, mat);
+                return;
+            }
+
+            const glm::mat3* currentValues = scene.getDataMatrix33fArray(dataInstHandle, dataFieldHandle);
+            arrayValues.assign(currentValues, currentValues + elementCount);
+            arrayValues.front() = mat;
+            scene.setDataMatrix33fArray(dataInstHandle, dataFieldHandle, elementCount, arrayValues.data());
+        }
+    }
+
     uint32_t RenderExecutor::NumRenderablesToRenderInBetweenTimeBudgetChecks = RenderExecutor::DefaultNumRenderablesToRenderInBetweenTimeBudgetChecks;
 
     RenderExecutor::RenderExecutor(IDevice& device, RenderingContext& renderContext, const FrameTimer* frameTimer)
@@ -49,6 +101,11 @@ namespace ramses_internal
         return {};
     }
 
+    uint32_t RenderExecutor::getAvoidedStateChangeCount() const
+    {
+        return m_state.getAvoidedStateChangeCount();
+    }
+
     bool RenderExecutor::executeRenderPass(const RendererCachedScene& scene, const RenderPassHandle pass) const
     {
         const RenderPass& renderPass = scene.getRenderPass(pass);
@@ -101,17 +158,25 @@ namespace ramses_internal
         const RenderableVector& orderedRenderables = scene.getOrderedRenderablesForPass(pass);
         while (m_state.m_currentRenderIterator.getRenderableIdx() < orderedRenderables.size())
         {
+            const uint32_t flattenedRenderableIdx = m_state.m_currentRenderIterator.getFlattenedRenderableIdx();
             const RenderableHandle renderableHandle = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx()];
             if (!scene.renderableResourcesDirty(renderableHandle))
             {
                 assert(!scene.isRenderableVertexArrayDirty(renderableHandle));
                 setRenderableInternalStates(renderableHandle);
+                if (scene.isDrawCallBatchingEnabled())
+                    batchFollowingRenderablesIntoCurrentDrawCall(orderedRenderables);
                 setSemanticDataFields();
+
                 executeRenderable();
+                m_state.trackAvoidedStateChanges();
             }
             m_state.m_currentRenderIterator.incrementRenderableIdx();
 
-            if ((m_state.m_currentRenderIterator.getFlattenedRenderableIdx() % NumRenderablesToRenderInBetweenTimeBudgetChecks == 0u) && m_state.hasExceededTimeBudgetForRendering())
+            // batched renderables are skipped at once, check time budget if any check point was passed
+            const uint32_t numCheckPointsPassed = m_state.m_currentRenderIterator.getFlattenedRenderableIdx() / NumRenderablesToRenderInBetweenTimeBudgetChecks
+                - flattenedRenderableIdx / NumRenderablesToRenderInBetweenTimeBudgetChecks;
+            if (numCheckPointsPassed > 0u && m_state.hasExceededTimeBudgetForRendering())
                 return false;
         }
 
@@ -372,9 +437,110 @@ namespace ramses_internal
         const Renderable& renderable = renderScene.getRenderable(m_state.getRenderable());
 
         if (m_state.vertexArrayUsesIndices)
-            device.drawIndexedTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawIndexedTriangles(renderable.startIndex, m_state.drawElementCount, m_state.drawInstanceCount);
         else
-            device.drawTriangles(renderable.startIndex, renderable.indexCount, renderable.instanceCount);
+            device.drawTriangles(renderable.startIndex, m_state.drawElementCount, m_state.drawInstanceCount);
+    }
+
+    void RenderExecutor::batchFollowingRenderablesIntoCurrentDrawCall(const RenderableVector& orderedRenderables) const
+    {
+        // following renderables with identical states and inputs are merged into this draw call,
+        // either drawing the next index range at same place or drawing the same index range at other place as another instance
+        const uint32_t maxInstances = getMaxInstancesOfCurrentDrawCall();
+        while (m_state.m_currentRenderIterator.getRenderableIdx() + 1u < orderedRenderables.size())
+        {
+            const RenderableHandle renderable = orderedRenderables[m_state.m_currentRenderIterator.getRenderableIdx() + 1u];
+            if (canAppendIndexRangeToCurrentDrawCall(renderable))
+            {
+                m_state.drawElementCount += m_state.getScene().getRenderable(renderable).indexCount;
+            }
+            else if (m_state.instancedRenderables.size() < maxInstances && canDrawAsInstanceOfCurrentDrawCall(renderable))
+            {
+                m_state.instancedRenderables.push_back(renderable);
+                ++m_state.drawInstanceCount;
+            }
+            else
+                break;
+
+            m_state.m_currentRenderIterator.incrementRenderableIdx();
+        }
+    }
+
+    bool RenderExecutor::hasSameInputsAndStatesAsCurrentDrawCall(RenderableHandle renderableHandle) const
+    {
+        const RendererCachedScene& renderScene = m_state.getScene();
+        if (renderScene.renderableResourcesDirty(renderableHandle))
+            return false;
+
+        const Renderable& current = renderScene.getRenderable(m_state.getRenderable());
+        const Renderable& renderable = renderScene.getRenderable(renderableHandle);
+
+        // uniforms, vertex inputs and states are taken from the first renderable of a batch, so all of them must be identical
+        return renderable.startVertex == current.startVertex
+            && renderable.renderState == current.renderState
+            && renderable.dataInstances[ERenderableDataSlotType_Geometry] == current.dataInstances[ERenderableDataSlotType_Geometry]
+            && renderable.dataInstances[ERenderableDataSlotType_Uniforms] == current.dataInstances[ERenderableDataSlotType_Uniforms]
+            && renderScene.getRenderableEffectDeviceHandle(renderableHandle) == m_state.shaderDeviceHandle.getState();
+    }
+
+    bool RenderExecutor::canAppendIndexRangeToCurrentDrawCall(RenderableHandle renderableHandle) const
+    {
+        const RendererCachedScene& renderScene = m_state.getScene();
+        const Renderable& current = renderScene.getRenderable(m_state.getRenderable());
+        const Renderable& renderable = renderScene.getRenderable(renderableHandle);
+
+        // index range must continue the current one and be drawn at same place
+        return m_state.instancedRenderables.size() == 1u
+            && renderable.startIndex == current.startIndex + m_state.drawElementCount
+            && renderable.instanceCount == current.instanceCount
+            && hasSameInputsAndStatesAsCurrentDrawCall(renderableHandle)
+            && renderScene.getRenderableWorldMatrix(renderableHandle) == m_state.getModelMatrix();
+    }
+
+    bool RenderExecutor::canDrawAsInstanceOfCurrentDrawCall(RenderableHandle renderableHandle) const
+    {
+        const RendererCachedScene& renderScene = m_state.getScene();
+        const Renderable& current = renderScene.getRenderable(m_state.getRenderable());
+        const Renderable& renderable = renderScene.getRenderable(renderableHandle);
+
+        // instances draw exactly the same index range, renderables which are instanced themselves cannot be merged
+        return m_state.drawElementCount == current.indexCount
+            && renderable.startIndex == current.startIndex
+            && renderable.indexCount == current.indexCount
+            && renderable.instanceCount == 1u
+            && current.instanceCount == 1u
+            && hasSameInputsAndStatesAsCurrentDrawCall(renderableHandle);
+    }
+
+    uint32_t RenderExecutor::getMaxInstancesOfCurrentDrawCall() const
+    {
+        // renderables placed differently can only be drawn as instances of one draw call if the effect takes all semantic inputs
+        // depending on the renderable's transformation as arrays (indexed by gl_InstanceID in shader), array size limits instance count
+        const auto& scene = m_state.getScene();
+        const Renderable& renderable = scene.getRenderable(m_state.getRenderable());
+
+        // geometry with instanced vertex attributes would feed attribute data of further instances to merged renderables
+        const DataInstanceHandle geometryInstance = renderable.dataInstances[ERenderableDataSlotType_Geometry];
+        const DataLayout& geometryLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(geometryInstance));
+        // indices are always in the 1st field (field Zero)
+        for (DataFieldHandle field(1u); field < geometryLayout.getFieldCount(); ++field)
+        {
+            if (scene.getDataResource(geometryInstance, field).instancingDivisor != 0u)
+                return 1u;
+        }
+
+        const DataInstanceHandle dataInstance = renderable.dataInstances[ERenderableDataSlotType_Uniforms];
+        const DataLayout& dataLayout = scene.getDataLayout(scene.getLayoutOfDataInstance(dataInstance));
+
+        std::optional<uint32_t> maxInstances;
+        for (DataFieldHandle i(0u); i < dataLayout.getFieldCount(); ++i)
+        {
+            const DataFieldInfo& field = dataLayout.getField(i);
+            if (IsTransformationDependentSemantic(field.semantics))
+                maxInstances = std::min(maxInstances.value_or(field.elementCount), field.elementCount);
+        }
+
+        return maxInstances.value_or(1u);
     }
 
     void RenderExecutor::setGlobalInternalStates(const RendererCachedScene& scene) const
@@ -395,6 +561,10 @@ namespace ramses_internal
         const auto& vertexArray = renderScene.getCachedHandlesForVertexArrays()[m_state.getRenderable().asMemoryHandle()];
         m_state.vertexArrayDeviceHandle = vertexArray.deviceHandle;
         m_state.vertexArrayUsesIndices = vertexArray.usesIndexArray;
+        m_state.drawElementCount = renderable.indexCount;
+        m_state.drawInstanceCount = renderable.instanceCount;
+        m_state.instancedRenderables.clear();
+        m_state.instancedRenderables.push_back(renderableHandle);
 
         const RenderState& renderState = renderScene.getRenderState(renderable.renderState);
         ScissorState scissorState;
@@ -457,6 +627,13 @@ namespace ramses_internal
     {
         // semantic data is 'cached' directly in scene, for this special case non-const access is needed
         auto& scene = const_cast<RendererCachedScene&>(m_state.getScene());
+
+        // transformation dependent semantic input is set per instance only if renderables were merged into instances of one draw call
+        if (m_state.instancedRenderables.size() > 1u && IsTransformationDependentSemantic(semantics))
+        {
+            resolveAndSetInstancedSemanticDataField(semantics, dataInstHandle, dataFieldHandle);
+            return;
+        }
         switch (semantics)
         {
         case EFixedSemantics::ViewMatrix:
@@ -474,25 +651,25 @@ namespace ramses_internal
         case EFixedSemantics::ModelMatrix:
         {
             const auto& mat = m_state.getModelMatrix();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticMatrix(scene, dataInstHandle, dataFieldHandle, mat, m_state.instanceMatrices);
             break;
         }
         case EFixedSemantics::ModelViewMatrix:
         {
             const auto& mat = m_state.getModelViewMatrix();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticMatrix(scene, dataInstHandle, dataFieldHandle, mat, m_state.instanceMatrices);
             break;
         }
         case EFixedSemantics::ModelViewMatrix33:
         {
             const auto mat = glm::mat3(m_state.getModelViewMatrix());
-            scene.setDataSingleMatrix33f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticMatrix(scene, dataInstHandle, dataFieldHandle, mat, m_state.instanceMatrices33);
             break;
         }
         case EFixedSemantics::ModelViewProjectionMatrix:
         {
             const auto& mat = m_state.getModelViewProjectionMatrix();
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticMatrix(scene, dataInstHandle, dataFieldHandle, mat, m_state.instanceMatrices);
             break;
         }
         case EFixedSemantics::CameraWorldPosition:
@@ -504,7 +681,7 @@ namespace ramses_internal
         case EFixedSemantics::NormalMatrix:
         {
             const auto& mat = glm::transpose(glm::inverse(m_state.getModelViewMatrix()));
-            scene.setDataSingleMatrix44f(dataInstHandle, dataFieldHandle, mat);
+            SetSemanticMatrix(scene, dataInstHandle, dataFieldHandle, mat, m_state.instanceMatrices);
             break;
         }
         case EFixedSemantics::DisplayBufferResolution:
@@ -529,6 +706,56 @@ namespace ramses_internal
         }
     }
 
+    void RenderExecutor::resolveAndSetInstancedSemanticDataField(EFixedSemantics semantics, DataInstanceHandle dataInstHandle, DataFieldHandle dataFieldHandle) const
+    {
+        // each renderable drawn as instance gets its matrix at its instance index of the semantic array,
+        // elements beyond instance count are not accessed by any instance and keep their values
+        auto& scene = const_cast<RendererCachedScene&>(m_state.getScene());
+        const RenderableVector& instances = m_state.instancedRenderables;
+        const auto instanceCount = static_cast<uint32_t>(instances.size());
+        const uint32_t elementCount = scene.getDataLayout(scene.getLayoutOfDataInstance(dataInstHandle)).getField(dataFieldHandle).elementCount;
+        assert(instanceCount <= elementCount);
+        const glm::mat4& viewMatrix = m_state.getViewMatrix();
+
+        if (semantics == EFixedSemantics::ModelViewMatrix33)
+        {
+            auto& matrices = m_state.instanceMatrices33;
+            const glm::mat3* currentValues = scene.getDataMatrix33fArray(dataInstHandle, dataFieldHandle);
+            matrices.assign(currentValues, currentValues + elementCount);
+            for (uint32_t i = 0u; i < instanceCount; ++i)
+                matrices[i] = glm::mat3(viewMatrix * scene.getRenderableWorldMatrix(instances[i]));
+            scene.setDataMatrix33fArray(dataInstHandle, dataFieldHandle, elementCount, matrices.data());
+            return;
+        }
+
+        auto& matrices = m_state.instanceMatrices;
+        const glm::mat4* currentValues = scene.getDataMatrix44fArray(dataInstHandle, dataFieldHandle);
+        matrices.assign(currentValues, currentValues + elementCount);
+        for (uint32_t i = 0u; i < instanceCount; ++i)
+        {
+            const glm::mat4& modelMatrix = scene.getRenderableWorldMatrix(instances[i]);
+            switch (semantics)
+            {
+            case EFixedSemantics::ModelMatrix:
+                matrices[i] = modelMatrix;
+                break;
+            case EFixedSemantics::ModelViewMatrix:
+                matrices[i] = viewMatrix * modelMatrix;
+                break;
+            case EFixedSemantics::ModelViewProjectionMatrix:
+                matrices[i] = m_state.getProjectionMatrix() * (viewMatrix * modelMatrix);
+                break;
+            case EFixedSemantics::NormalMatrix:
+                matrices[i] = glm::transpose(glm::inverse(viewMatrix * modelMatrix));
+                break;
+            default:
+                assert(false && "Unsupported semantics");
+                break;
+            }
+        }
+        scene.setDataMatrix44fArray(dataInstHandle, dataFieldHandle, elementCount, matrices.data());
+    }
+
     void RenderExecutor::setSemanticDataFields() const
     {
         const auto& scene = m_state.getScene();
@@ -70,4 +70,19 @@ namespace ramses_internal
         m_modelViewMatrix = m_viewMatrix * m_modelMatrix;
         m_modelViewProjectionMatrix = m_projectionMatrix * m_modelViewMatrix;
     }
+
+    void RenderExecutorInternalState::trackAvoidedStateChanges()
+    {
+        const auto countUnchanged = [](const auto& state) { return state.hasChanged() ? 0u : 1u; };
+        m_avoidedStateChanges += countUnchanged(shaderDeviceHandle)
+            + countUnchanged(scissorState)
+            + countUnchanged(depthFuncState)
+            + countUnchanged(depthWriteState)
+            + countUnchanged(stencilState)
+            + countUnchanged(blendOperationsState)
+            + countUnchanged(blendFactorsState)
+            + countUnchanged(blendColorState)
+            + countUnchanged(colorWriteMaskState)
+            + countUnchanged(cullModeState);
+    }
 }
@@ -9,57 +9,134 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/RenderableComparator.h"
 #include "RenderingPassOrderComparator.h"
+#include "RendererLib/IResourceDeviceHandleAccessor.h"
+#include "Math3d/CameraMatrixHelper.h"
+#include "Math3d/Frustum.h"
+#include "SceneAPI/Camera.h"
+#include "PlatformAbstraction/Hash.h"
+#include "Collections/Vector.h"
 #include <algorithm>
 
 namespace ramses_internal
 {
     RendererCachedScene::RendererCachedScene(SceneLinksManager& sceneLinksManager, const SceneInfo& sceneInfo)
         : ResourceCachedScene(sceneLinksManager, sceneInfo)
-        , m_renderableOrderingDirty(true)
+        , m_renderingPassesDirty(true)
     {
     }
 
+    template <typename T>
+    static void RemoveFromVector(std::vector<T>& vec, const T& value)
+    {
+        const auto it = find_c(vec, value);
+        if (it != vec.end())
+            vec.erase(it);
+    }
+
     void RendererCachedScene::setRenderableVisibility(RenderableHandle renderableHandle, EVisibilityMode visible)
     {
+        const bool wasVisible = (ResourceCachedScene::getRenderable(renderableHandle).visibilityMode == EVisibilityMode::Visible);
         ResourceCachedScene::setRenderableVisibility(renderableHandle, visible);
-        m_renderableOrderingDirty = true;
+
+        // visibility does not change ordering, only the renderable itself is added to or removed from visible renderables of passes containing it
+        const bool isVisible = (visible == EVisibilityMode::Visible);
+        if (wasVisible != isVisible && renderableHandle.asMemoryHandle() < m_renderableGroups.size())
+        {
+            RenderPassVector passes;
+            for (const auto group : m_renderableGroups[renderableHandle.asMemoryHandle()])
+                collectRenderPassesContainingRenderGroup(group, passes);
+            for (const auto pass : passes)
+                updateRenderableVisibilityInPass(pass, renderableHandle, isVisible);
+        }
     }
 
     void RendererCachedScene::releaseRenderGroup(RenderGroupHandle groupHandle)
     {
+        ensureRenderGroupCacheSize(groupHandle);
+        markRenderGroupDirty(groupHandle);
+
+        const RenderGroup& renderGroup = ResourceCachedScene::getRenderGroup(groupHandle);
+        for (const auto& renderableEntry : renderGroup.renderables)
+        {
+            if (renderableEntry.renderable.asMemoryHandle() < m_renderableGroups.size())
+                RemoveFromVector(m_renderableGroups[renderableEntry.renderable.asMemoryHandle()], groupHandle);
+        }
+        for (const auto& groupEntry : renderGroup.renderGroups)
+        {
+            if (groupEntry.renderGroup.asMemoryHandle() < m_renderGroupParents.size())
+                RemoveFromVector(m_renderGroupParents[groupEntry.renderGroup.asMemoryHandle()], groupHandle);
+        }
+
+        m_renderGroupParents[groupHandle.asMemoryHandle()].clear();
+        m_renderGroupPasses[groupHandle.asMemoryHandle()].clear();
+        m_renderGroupFlattenedRenderables[groupHandle.asMemoryHandle()].clear();
+
         ResourceCachedScene::releaseRenderGroup(groupHandle);
-        m_renderableOrderingDirty = true;
     }
 
     void RendererCachedScene::addRenderableToRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle, int32_t order)
     {
         ResourceCachedScene::addRenderableToRenderGroup(groupHandle, renderableHandle, order);
-        m_renderableOrderingDirty = true;
+
+        ensureRenderGroupCacheSize(groupHandle);
+        if (renderableHandle.asMemoryHandle() >= m_renderableGroups.size())
+            m_renderableGroups.resize(std::max(ResourceCachedScene::getRenderableCount(), renderableHandle.asMemoryHandle() + 1u));
+        m_renderableGroups[renderableHandle.asMemoryHandle()].push_back(groupHandle);
+        markRenderGroupDirty(groupHandle);
     }
 
     void RendererCachedScene::removeRenderableFromRenderGroup(RenderGroupHandle groupHandle, RenderableHandle renderableHandle)
     {
         ResourceCachedScene::removeRenderableFromRenderGroup(groupHandle, renderableHandle);
-        m_renderableOrderingDirty = true;
+
+        ensureRenderGroupCacheSize(groupHandle);
+        if (renderableHandle.asMemoryHandle() < m_renderableGroups.size())
+            RemoveFromVector(m_renderableGroups[renderableHandle.asMemoryHandle()], groupHandle);
+        markRenderGroupDirty(groupHandle);
+    }
+
+    RenderPassHandle RendererCachedScene::allocateRenderPass(uint32_t renderGroupCount, RenderPassHandle passHandle)
+    {
+        const RenderPassHandle renderPass = ResourceCachedScene::allocateRenderPass(renderGroupCount, passHandle);
+        ensureRenderPassCacheSize(renderPass);
+        markRenderPassDirty(renderPass);
+        m_renderingPassesDirty = true;
+
+        return renderPass;
     }
 
     void RendererCachedScene::releaseRenderPass(RenderPassHandle passHandle)
     {
+        ensureRenderPassCacheSize(passHandle);
+        for (const auto& groupEntry : ResourceCachedScene::getRenderPass(passHandle).renderGroups)
+        {
+            if (groupEntry.renderGroup.asMemoryHandle() < m_renderGroupPasses.size())
+                RemoveFromVector(m_renderGroupPasses[groupEntry.renderGroup.asMemoryHandle()], passHandle);
+        }
+        m_passFlattenedRenderables[passHandle.asMemoryHandle()].clear();
+        markRenderPassDirty(passHandle);
+
         m_renderOncePassesToRender.remove(passHandle);
         ResourceCachedScene::releaseRenderPass(passHandle);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
+    }
+
+    void RendererCachedScene::setRenderPassCamera(RenderPassHandle passHandle, CameraHandle cameraHandle)
+    {
+        ResourceCachedScene::setRenderPassCamera(passHandle, cameraHandle);
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassRenderOrder(RenderPassHandle passHandle, int32_t renderOrder)
     {
         ResourceCachedScene::setRenderPassRenderOrder(passHandle, renderOrder);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     BlitPassHandle RendererCachedScene::allocateBlitPass(RenderBufferHandle sourceRenderBufferHandle, RenderBufferHandle destinationRenderBufferHandle, BlitPassHandle passHandle /*= BlitPassHandle::Invalid()*/)
     {
         const BlitPassHandle blitPass = ResourceCachedScene::allocateBlitPass(sourceRenderBufferHandle, destinationRenderBufferHandle, passHandle);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
 
         return blitPass;
     }
@@ -67,19 +144,19 @@ namespace ramses_internal
     void RendererCachedScene::releaseBlitPass(BlitPassHandle passHandle)
     {
         ResourceCachedScene::releaseBlitPass(passHandle);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setBlitPassRenderOrder(BlitPassHandle passHandle, int32_t renderOrder)
     {
         ResourceCachedScene::setBlitPassRenderOrder(passHandle, renderOrder);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setBlitPassEnabled(BlitPassHandle passHandle, bool isEnabled)
     {
         ResourceCachedScene::setBlitPassEnabled(passHandle, isEnabled);
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassEnabled(RenderPassHandle passHandle, bool isEnabled)
@@ -93,7 +170,7 @@ namespace ramses_internal
         {
             m_renderOncePassesToRender.remove(passHandle);
         }
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::setRenderPassRenderOnce(RenderPassHandle passHandle, bool enable)
@@ -107,7 +184,7 @@ namespace ramses_internal
         {
             m_renderOncePassesToRender.remove(passHandle);
         }
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::retriggerRenderPassRenderOnce(RenderPassHandle passHandle)
@@ -116,32 +193,48 @@ namespace ramses_internal
         if (ResourceCachedScene::getRenderPass(passHandle).isEnabled)
         {
             m_renderOncePassesToRender.put(passHandle);
-            m_renderableOrderingDirty = true;
+            m_renderingPassesDirty = true;
         }
     }
 
     void RendererCachedScene::addRenderGroupToRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle, int32_t order)
     {
         ResourceCachedScene::addRenderGroupToRenderPass(passHandle, groupHandle, order);
-        m_renderableOrderingDirty = true;
+
+        ensureRenderPassCacheSize(passHandle);
+        ensureRenderGroupCacheSize(groupHandle);
+        m_renderGroupPasses[groupHandle.asMemoryHandle()].push_back(passHandle);
+        markRenderPassDirty(passHandle);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderPass(RenderPassHandle passHandle, RenderGroupHandle groupHandle)
     {
         ResourceCachedScene::removeRenderGroupFromRenderPass(passHandle, groupHandle);
-        m_renderableOrderingDirty = true;
+
+        ensureRenderPassCacheSize(passHandle);
+        ensureRenderGroupCacheSize(groupHandle);
+        RemoveFromVector(m_renderGroupPasses[groupHandle.asMemoryHandle()], passHandle);
+        markRenderPassDirty(passHandle);
     }
 
     void RendererCachedScene::addRenderGroupToRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild, int32_t order)
     {
         ResourceCachedScene::addRenderGroupToRenderGroup(groupHandleParent, groupHandleChild, order);
-        m_renderableOrderingDirty = true;
+
+        ensureRenderGroupCacheSize(groupHandleParent);
+        ensureRenderGroupCacheSize(groupHandleChild);
+        m_renderGroupParents[groupHandleChild.asMemoryHandle()].push_back(groupHandleParent);
+        markRenderGroupDirty(groupHandleParent);
     }
 
     void RendererCachedScene::removeRenderGroupFromRenderGroup(RenderGroupHandle groupHandleParent, RenderGroupHandle groupHandleChild)
     {
         ResourceCachedScene::removeRenderGroupFromRenderGroup(groupHandleParent, groupHandleChild);
-        m_renderableOrderingDirty = true;
+
+        ensureRenderGroupCacheSize(groupHandleParent);
+        ensureRenderGroupCacheSize(groupHandleChild);
+        RemoveFromVector(m_renderGroupParents[groupHandleChild.asMemoryHandle()], groupHandleParent);
+        markRenderGroupDirty(groupHandleParent);
     }
 
     const RenderingPassInfoVector& RendererCachedScene::getSortedRenderingPasses() const
@@ -151,6 +244,12 @@ namespace ramses_internal
 
     const RenderableVector& RendererCachedScene::getOrderedRenderablesForPass(RenderPassHandle pass) const
     {
+        if (m_frustumCullingEnabled && m_frustumCullingUpToDate)
+        {
+            assert(pass.asMemoryHandle() < m_passCulledRenderableOrder.size());
+            return m_passCulledRenderableOrder[pass.asMemoryHandle()];
+        }
+
         assert(pass.asMemoryHandle() < m_passRenderableOrder.size());
         return m_passRenderableOrder[pass.asMemoryHandle()];
     }
@@ -163,20 +262,33 @@ namespace ramses_internal
 
     void RendererCachedScene::updatePassRenderableSorting()
     {
-        if (m_renderableOrderingDirty)
+        if (!m_renderingPassesDirty && !m_hasDirtyPasses)
+            return;
+
+        const uint32_t totalNumberOfRenderPasses = ResourceCachedScene::getRenderPassCount();
+        if (totalNumberOfRenderPasses > 0u)
+            ensureRenderPassCacheSize(RenderPassHandle(totalNumberOfRenderPasses - 1u));
+        m_passRenderableOrder.resize(totalNumberOfRenderPasses);
+        m_passVisibleFlattenedIndices.resize(totalNumberOfRenderPasses);
+
+        if (m_renderingPassesDirty)
         {
             m_sortedRenderingPasses.clear();
 
-            const uint32_t totalNumberOfRenderPasses = ResourceCachedScene::getRenderPassCount();
             const uint32_t totalNumberOfBlitPasses = ResourceCachedScene::getBlitPassCount();
 
-            //add render passes
-            m_passRenderableOrder.resize(totalNumberOfRenderPasses);
+            //add render passes, passes which are not rendered have no visible renderables and have to be filtered once they get rendered
             for (RenderPassHandle passHandle(0); passHandle < totalNumberOfRenderPasses; ++passHandle)
             {
-                m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
                 if (shouldRenderPassBeRendered(passHandle))
+                {
                     m_sortedRenderingPasses.emplace_back(passHandle);
+                }
+                else
+                {
+                    m_passRenderableOrder[passHandle.asMemoryHandle()].clear();
+                    m_passVisibilityDirty[passHandle.asMemoryHandle()] = true;
+                }
             }
 
             //add blit passes
@@ -197,16 +309,39 @@ namespace ramses_internal
             //sort
             RenderingPassOrderComparator comparator(*this);
             std::sort(m_sortedRenderingPasses.begin(), m_sortedRenderingPasses.end(), comparator);
+        }
+
+        // state sort ids are only valid within one update of renderable ordering
+        m_stateSortEffectIds.clear();
+        m_stateSortTextureSamplersIds.clear();
 
-            //update renderables according to sorted render passes
-            for (const auto& pass : m_sortedRenderingPasses)
+        //update renderables of rendered passes, only passes affected by changes are flattened and sorted again,
+        //passes which are not rendered keep their dirty state and are updated once they get rendered
+        bool renderablesChanged = m_renderingPassesDirty;
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass == pass.getType())
             {
-                if (ERenderingPassType::RenderPass == pass.getType())
-                    updateRenderablesInPass(pass.getRenderPassHandle());
+                const RenderPassHandle passHandle = pass.getRenderPassHandle();
+                if (m_passRenderablesDirty[passHandle.asMemoryHandle()])
+                {
+                    flattenRenderablesInPass(passHandle);
+                    m_passRenderablesDirty[passHandle.asMemoryHandle()] = false;
+                    m_passVisibilityDirty[passHandle.asMemoryHandle()] = true;
+                }
+                if (m_passVisibilityDirty[passHandle.asMemoryHandle()])
+                {
+                    updateVisibleRenderablesInPass(passHandle);
+                    m_passVisibilityDirty[passHandle.asMemoryHandle()] = false;
+                    renderablesChanged = true;
+                }
             }
-
-            m_renderableOrderingDirty = false;
         }
+
+        m_renderingPassesDirty = false;
+        m_hasDirtyPasses = false;
+        if (renderablesChanged)
+            m_frustumCullingUpToDate = false;
     }
 
     const glm::mat4& RendererCachedScene::getRenderableWorldMatrix(RenderableHandle renderable) const
@@ -215,9 +350,10 @@ namespace ramses_internal
         return m_renderableMatrices[renderable.asMemoryHandle()];
     }
 
-    void RendererCachedScene::updateRenderablesInPass(RenderPassHandle passHandle)
+    void RendererCachedScene::flattenRenderablesInPass(RenderPassHandle passHandle)
     {
-        RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        RenderableVector& flattenedRenderables = m_passFlattenedRenderables[passHandle.asMemoryHandle()];
+        flattenedRenderables.clear();
 
         // we sort in-place in scene's RenderPass, although we don't have to but it might speed up sorting if topology/order changes frequently
         RenderGroupOrderVector& orderedRenderGroups = getRenderPassInternal(passHandle).renderGroups;
@@ -226,31 +362,102 @@ namespace ramses_internal
 
         for(const auto& renderGroup : orderedRenderGroups)
         {
-            addRenderablesFromRenderGroup(orderedRenderables, renderGroup.renderGroup);
+            flattenRenderablesInRenderGroup(renderGroup.renderGroup);
+            const RenderableVector& groupRenderables = m_renderGroupFlattenedRenderables[renderGroup.renderGroup.asMemoryHandle()];
+            flattenedRenderables.insert(flattenedRenderables.end(), groupRenderables.cbegin(), groupRenderables.cend());
         }
     }
 
-    static void AddRenderable(const IScene& scene, RenderableVector& orderedRenderables, RenderableHandle renderable)
+    void RendererCachedScene::updateVisibleRenderablesInPass(RenderPassHandle passHandle)
     {
-        if (scene.getRenderable(renderable).visibilityMode == EVisibilityMode::Visible)
+        const RenderableVector& flattenedRenderables = m_passFlattenedRenderables[passHandle.asMemoryHandle()];
+        RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        IndexVector& flattenedIndices = m_passVisibleFlattenedIndices[passHandle.asMemoryHandle()];
+        orderedRenderables.clear();
+        flattenedIndices.clear();
+        for (uint32_t i = 0u; i < flattenedRenderables.size(); ++i)
         {
-            orderedRenderables.push_back(renderable);
+            if (ResourceCachedScene::getRenderable(flattenedRenderables[i]).visibilityMode == EVisibilityMode::Visible)
+            {
+                orderedRenderables.push_back(flattenedRenderables[i]);
+                flattenedIndices.push_back(i);
+            }
         }
     }
 
-    void RendererCachedScene::addRenderablesFromRenderGroup(RenderableVector& orderedRenderables, RenderGroupHandle renderGroupHandle)
+    void RendererCachedScene::updateRenderableVisibilityInPass(RenderPassHandle passHandle, RenderableHandle renderable, bool visible)
+    {
+        // pass which is going to be flattened or filtered anyway (e.g. because it is not rendered) does not need to be updated now
+        if (m_passRenderablesDirty[passHandle.asMemoryHandle()] || m_passVisibilityDirty[passHandle.asMemoryHandle()])
+            return;
+
+        const RenderableVector& flattenedRenderables = m_passFlattenedRenderables[passHandle.asMemoryHandle()];
+        RenderableVector& orderedRenderables = m_passRenderableOrder[passHandle.asMemoryHandle()];
+        IndexVector& flattenedIndices = m_passVisibleFlattenedIndices[passHandle.asMemoryHandle()];
+        assert(orderedRenderables.size() == flattenedIndices.size());
+
+        // renderable can be contained in pass multiple times (via multiple groups), each occurrence is found at its position
+        // in flattened order and inserted/removed at corresponding position in visible order
+        for (uint32_t i = 0u; i < flattenedRenderables.size(); ++i)
+        {
+            if (flattenedRenderables[i] != renderable)
+                continue;
+
+            const auto indexIt = std::lower_bound(flattenedIndices.begin(), flattenedIndices.end(), i);
+            const auto renderableIt = orderedRenderables.begin() + std::distance(flattenedIndices.begin(), indexIt);
+            if (visible)
+            {
+                assert(indexIt == flattenedIndices.end() || *indexIt != i);
+                flattenedIndices.insert(indexIt, i);
+                orderedRenderables.insert(renderableIt, renderable);
+            }
+            else if (indexIt != flattenedIndices.end() && *indexIt == i)
+            {
+                flattenedIndices.erase(indexIt);
+                orderedRenderables.erase(renderableIt);
+            }
+        }
+
+        m_frustumCullingUpToDate = false;
+    }
+
+    void RendererCachedScene::flattenRenderablesInRenderGroup(RenderGroupHandle renderGroupHandle)
     {
         assert(isRenderGroupAllocated(renderGroupHandle));
+        ensureRenderGroupCacheSize(renderGroupHandle);
+        if (!m_renderGroupRenderablesDirty[renderGroupHandle.asMemoryHandle()])
+            return;
 
         RenderGroup& renderGroup = getRenderGroupInternal(renderGroupHandle);
         // we sort in-place in scene's TopologyRenderGroup, although we don't have to but it might speed up sorting if topology/order changes frequently
         RenderableOrderVector& orderedGroupRenderables = renderGroup.renderables;
         RenderGroupOrderVector& orderedRenderGroups = renderGroup.renderGroups;
 
-        RenderableComparator renderableComp(*this);
-        std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
+        if (m_stateSortingEnabled)
+        {
+            updateRenderableStateSortKeys(orderedGroupRenderables);
+            RenderableStateSortKeyComparator renderableComp(m_renderableStateSortKeys);
+            std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
+        }
+        else
+        {
+            RenderableComparator renderableComp(*this);
+            std::sort(orderedGroupRenderables.begin(), orderedGroupRenderables.end(), renderableComp);
+        }
         std::sort(orderedRenderGroups.begin(), orderedRenderGroups.end());
 
+        // nested groups are flattened first, their cached renderables are merged into this group's cache
+        for (const auto& nestedGroup : orderedRenderGroups)
+            flattenRenderablesInRenderGroup(nestedGroup.renderGroup);
+
+        RenderableVector& flattenedRenderables = m_renderGroupFlattenedRenderables[renderGroupHandle.asMemoryHandle()];
+        flattenedRenderables.clear();
+
+        const auto appendNestedGroup = [&](RenderGroupHandle nestedGroup) {
+            const RenderableVector& nestedRenderables = m_renderGroupFlattenedRenderables[nestedGroup.asMemoryHandle()];
+            flattenedRenderables.insert(flattenedRenderables.end(), nestedRenderables.cbegin(), nestedRenderables.cend());
+        };
+
         RenderableOrderVector::iterator renderablesIterator = orderedGroupRenderables.begin();
         RenderGroupOrderVector::iterator renderGroupIterator = orderedRenderGroups.begin();
         while (renderablesIterator != orderedGroupRenderables.end()
@@ -258,58 +465,372 @@ namespace ramses_internal
         {
             if (renderGroupIterator == orderedRenderGroups.end())
             {
-                AddRenderable(*this, orderedRenderables, renderablesIterator->renderable);
+                flattenedRenderables.push_back(renderablesIterator->renderable);
                 ++renderablesIterator;
             }
             else if (renderablesIterator == orderedGroupRenderables.end())
             {
-                addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
+                appendNestedGroup(renderGroupIterator->renderGroup);
                 ++renderGroupIterator;
             }
             else
             {
                 if (renderablesIterator->order < renderGroupIterator->order)
                 {
-                    AddRenderable(*this, orderedRenderables, renderablesIterator->renderable);
+                    flattenedRenderables.push_back(renderablesIterator->renderable);
                     ++renderablesIterator;
                 }
                 else
                 {
-                    addRenderablesFromRenderGroup(orderedRenderables, renderGroupIterator->renderGroup);
+                    appendNestedGroup(renderGroupIterator->renderGroup);
                     ++renderGroupIterator;
                 }
             }
         }
+
+        m_renderGroupRenderablesDirty[renderGroupHandle.asMemoryHandle()] = false;
     }
 
-    void RendererCachedScene::updateRenderableWorldMatrices()
+    void RendererCachedScene::markRenderGroupDirty(RenderGroupHandle renderGroupHandle)
     {
-        m_renderableMatrices.resize(ResourceCachedScene::getRenderableCount());
+        // a dirty group has all its parent groups and all passes containing any of them already marked dirty
+        if (m_renderGroupRenderablesDirty[renderGroupHandle.asMemoryHandle()])
+            return;
+
+        m_renderGroupRenderablesDirty[renderGroupHandle.asMemoryHandle()] = true;
+        for (const auto pass : m_renderGroupPasses[renderGroupHandle.asMemoryHandle()])
+            markRenderPassDirty(pass);
+        for (const auto parentGroup : m_renderGroupParents[renderGroupHandle.asMemoryHandle()])
+            markRenderGroupDirty(parentGroup);
+    }
+
+    void RendererCachedScene::markRenderPassDirty(RenderPassHandle passHandle)
+    {
+        m_passRenderablesDirty[passHandle.asMemoryHandle()] = true;
+        m_hasDirtyPasses = true;
+    }
+
+    void RendererCachedScene::collectRenderPassesContainingRenderGroup(RenderGroupHandle renderGroupHandle, RenderPassVector& passes) const
+    {
+        for (const auto pass : m_renderGroupPasses[renderGroupHandle.asMemoryHandle()])
+        {
+            if (!contains_c(passes, pass))
+                passes.push_back(pass);
+        }
+        for (const auto parentGroup : m_renderGroupParents[renderGroupHandle.asMemoryHandle()])
+            collectRenderPassesContainingRenderGroup(parentGroup, passes);
+    }
+
+    void RendererCachedScene::ensureRenderGroupCacheSize(RenderGroupHandle renderGroupHandle)
+    {
+        if (renderGroupHandle.asMemoryHandle() < m_renderGroupRenderablesDirty.size())
+            return;
+
+        const uint32_t groupCount = std::max(ResourceCachedScene::getRenderGroupCount(), renderGroupHandle.asMemoryHandle() + 1u);
+        m_renderGroupRenderablesDirty.resize(groupCount, true);
+        m_renderGroupFlattenedRenderables.resize(groupCount);
+        m_renderGroupParents.resize(groupCount);
+        m_renderGroupPasses.resize(groupCount);
+    }
+
+    void RendererCachedScene::ensureRenderPassCacheSize(RenderPassHandle passHandle)
+    {
+        if (passHandle.asMemoryHandle() < m_passRenderablesDirty.size())
+            return;
+
+        const uint32_t passCount = std::max(ResourceCachedScene::getRenderPassCount(), passHandle.asMemoryHandle() + 1u);
+        m_passRenderablesDirty.resize(passCount, true);
+        m_passVisibilityDirty.resize(passCount, true);
+        m_passFlattenedRenderables.resize(passCount);
+        m_hasDirtyPasses = true;
+    }
+
+    void RendererCachedScene::updateRenderableWorldMatrices(ParallelForExecutor* executor)
+    {
+        collectNodesOfRenderablesInPasses();
+        updateMatrixCacheForNodes(ETransformationMatrixType_World, m_renderableNodes, executor);
+        updateRenderableWorldMatricesFromCache();
+    }
+
+    void RendererCachedScene::updateRenderableWorldMatricesWithLinks(ParallelForExecutor* executor)
+    {
+        collectNodesOfRenderablesInPasses();
+        updateMatrixCacheWithLinksForNodes(ETransformationMatrixType_World, m_renderableNodes, executor);
+        updateRenderableWorldMatricesFromCache();
+    }
+
+    void RendererCachedScene::collectNodesOfRenderablesInPasses()
+    {
+        m_renderableNodes.clear();
         for (const auto& renderables : m_passRenderableOrder)
         {
             for (const auto renderable : renderables)
             {
                 assert(renderable.isValid());
-                const NodeHandle node = getRenderable(renderable).node;
+                const NodeHandle node = ResourceCachedScene::getRenderable(renderable).node;
                 assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCache(ETransformationMatrixType_World, node);
+                m_renderableNodes.push_back(node);
             }
         }
     }
 
-    void RendererCachedScene::updateRenderableWorldMatricesWithLinks()
+    void RendererCachedScene::updateRenderableWorldMatricesFromCache()
     {
         m_renderableMatrices.resize(ResourceCachedScene::getRenderableCount());
+        if (m_frustumCullingEnabled)
+        {
+            m_renderableBoundingBoxes.resize(ResourceCachedScene::getRenderableCount());
+            m_renderableWorldBoundingBoxes.resize(ResourceCachedScene::getRenderableCount());
+        }
+
         for (const auto& renderables : m_passRenderableOrder)
         {
             for (const auto renderable : renderables)
             {
-                assert(renderable.isValid());
-                const NodeHandle node = ResourceCachedScene::getRenderable(renderable).node;
-                assert(node.isValid());
-                m_renderableMatrices[renderable.asMemoryHandle()] = updateMatrixCacheWithLinks(ETransformationMatrixType_World, node);
+                const glm::mat4& worldMatrix = getCachedMatrix(ETransformationMatrixType_World, ResourceCachedScene::getRenderable(renderable).node);
+                glm::mat4& renderableMatrix = m_renderableMatrices[renderable.asMemoryHandle()];
+                if (renderableMatrix == worldMatrix)
+                    continue;
+
+                renderableMatrix = worldMatrix;
+                if (m_frustumCullingEnabled)
+                    updateRenderableWorldBoundingBox(renderable);
+            }
+        }
+    }
+
+    void RendererCachedScene::setRenderableInstanceCount(RenderableHandle renderableHandle, uint32_t instanceCount)
+    {
+        ResourceCachedScene::setRenderableInstanceCount(renderableHandle, instanceCount);
+        // instanced renderables are never culled
+        m_frustumCullingUpToDate = false;
+    }
+
+    void RendererCachedScene::setFrustumCullingEnabled(bool enabled)
+    {
+        m_frustumCullingEnabled = enabled;
+        m_frustumCullingUpToDate = false;
+    }
+
+    bool RendererCachedScene::isFrustumCullingEnabled() const
+    {
+        return m_frustumCullingEnabled;
+    }
+
+    void RendererCachedScene::setStateSortingEnabled(bool enabled)
+    {
+        if (m_stateSortingEnabled != enabled)
+        {
+            m_stateSortingEnabled = enabled;
+
+            // all cached orderings have to be sorted again
+            m_renderGroupRenderablesDirty.assign(m_renderGroupRenderablesDirty.size(), true);
+            m_passRenderablesDirty.assign(m_passRenderablesDirty.size(), true);
+            m_hasDirtyPasses = true;
+        }
+    }
+
+    bool RendererCachedScene::isStateSortingEnabled() const
+    {
+        return m_stateSortingEnabled;
+    }
+
+    void RendererCachedScene::setDrawCallBatchingEnabled(bool enabled)
+    {
+        m_drawCallBatchingEnabled = enabled;
+    }
+
+    bool RendererCachedScene::isDrawCallBatchingEnabled() const
+    {
+        return m_drawCallBatchingEnabled;
+    }
+
+    void RendererCachedScene::updateRenderableStateSortKeys(const RenderableOrderVector& renderables)
+    {
+        m_renderableStateSortKeys.resize(ResourceCachedScene::getRenderableCount());
+        for (const auto& renderableEntry : renderables)
+            m_renderableStateSortKeys[renderableEntry.renderable.asMemoryHandle()] = calculateRenderableStateSortKey(ResourceCachedScene::getRenderable(renderableEntry.renderable));
+    }
+
+    uint64_t RendererCachedScene::calculateRenderableStateSortKey(const Renderable& renderable)
+    {
+        // every state gets 16 bits, ids exceeding that range are clamped which only reduces the quality of sorting
+        const auto clampId = [](uint32_t id) { return static_cast<uint64_t>(std::min<uint32_t>(id, std::numeric_limits<uint16_t>::max())); };
+
+        const DataInstanceHandle geometryInstance = renderable.dataInstances[ERenderableDataSlotType_Geometry];
+        ResourceContentHash effectHash = ResourceContentHash::Invalid();
+        if (geometryInstance.isValid())
+            effectHash = ResourceCachedScene::getDataLayout(ResourceCachedScene::getLayoutOfDataInstance(geometryInstance)).getEffectHash();
+
+        // effect ids are assigned in order of first occurrence, this keeps renderables with same effect together
+        // without having to compare the full content hashes during sorting
+        auto effectIt = m_stateSortEffectIds.find(effectHash);
+        if (effectIt == m_stateSortEffectIds.end())
+            effectIt = m_stateSortEffectIds.put(effectHash, static_cast<uint16_t>(std::min<std::size_t>(m_stateSortEffectIds.size(), std::numeric_limits<uint16_t>::max())));
+        const uint16_t effectId = effectIt->value;
+
+        const uint16_t textureSamplersId = getTextureSamplersStateSortId(renderable.dataInstances[ERenderableDataSlotType_Uniforms]);
+
+        return (static_cast<uint64_t>(effectId) << 48u)
+            | (static_cast<uint64_t>(textureSamplersId) << 32u)
+            | (clampId(renderable.renderState.asMemoryHandle()) << 16u)
+            | clampId(geometryInstance.asMemoryHandle());
+    }
+
+    uint16_t RendererCachedScene::getTextureSamplersStateSortId(DataInstanceHandle uniformInstance)
+    {
+        // renderables with different uniform instances can still share all of their texture samplers,
+        // therefore the samplers referenced by the uniform instance are hashed rather than the instance handle
+        std::size_t textureSamplersHash = 0u;
+        if (uniformInstance.isValid())
+        {
+            const DataLayout& uniformLayout = ResourceCachedScene::getDataLayout(ResourceCachedScene::getLayoutOfDataInstance(uniformInstance));
+            for (DataFieldHandle field(0u); field < uniformLayout.getFieldCount(); ++field)
+            {
+                if (IsTextureSamplerType(uniformLayout.getField(field).dataType))
+                    HashCombine(textureSamplersHash, ResourceCachedScene::getDataTextureSamplerHandle(uniformInstance, field).asMemoryHandle());
+            }
+        }
+
+        auto it = m_stateSortTextureSamplersIds.find(textureSamplersHash);
+        if (it == m_stateSortTextureSamplersIds.end())
+            it = m_stateSortTextureSamplersIds.put(textureSamplersHash, static_cast<uint16_t>(std::min<std::size_t>(m_stateSortTextureSamplersIds.size(), std::numeric_limits<uint16_t>::max())));
+
+        return it->value;
+    }
+
+    const BoundingBox& RendererCachedScene::getRenderableBoundingBox(RenderableHandle renderable) const
+    {
+        assert(renderable.asMemoryHandle() < m_renderableBoundingBoxes.size());
+        return m_renderableBoundingBoxes[renderable.asMemoryHandle()];
+    }
+
+    void RendererCachedScene::updateRenderableBoundingBoxes(const IResourceDeviceHandleAccessor& resourceAccessor, const RenderableVector& renderablesWithUpdatedVertexArrays)
+    {
+        if (!m_frustumCullingEnabled)
+            return;
+
+        m_renderableBoundingBoxes.resize(ResourceCachedScene::getRenderableCount());
+        m_renderableWorldBoundingBoxes.resize(ResourceCachedScene::getRenderableCount());
+        m_renderableMatrices.resize(ResourceCachedScene::getRenderableCount());
+        for (const auto renderable : renderablesWithUpdatedVertexArrays)
+        {
+            BoundingBox& boundingBox = m_renderableBoundingBoxes[renderable.asMemoryHandle()];
+            boundingBox = {};
+            if (ResourceCachedScene::isRenderableAllocated(renderable) && getCachedHandlesForVertexArrays()[renderable.asMemoryHandle()].deviceHandle.isValid())
+                boundingBox = calculateRenderableBoundingBox(resourceAccessor, renderable);
+            updateRenderableWorldBoundingBox(renderable);
+        }
+    }
+
+    void RendererCachedScene::updateRenderableWorldBoundingBox(RenderableHandle renderable)
+    {
+        // world matrix might not be up to date yet, box is transformed again when matrix gets updated
+        const BoundingBox& boundingBox = m_renderableBoundingBoxes[renderable.asMemoryHandle()];
+        m_renderableWorldBoundingBoxes[renderable.asMemoryHandle()] = boundingBox.isValid() ? boundingBox.transformed(m_renderableMatrices[renderable.asMemoryHandle()]) : BoundingBox{};
+        m_frustumCullingUpToDate = false;
+    }
+
+    BoundingBox RendererCachedScene::calculateRenderableBoundingBox(const IResourceDeviceHandleAccessor& resourceAccessor, RenderableHandle renderable) const
+    {
+        const DataInstanceHandle geometryInstance = ResourceCachedScene::getRenderable(renderable).dataInstances[ERenderableDataSlotType_Geometry];
+        const DataLayout& geometryLayout = ResourceCachedScene::getDataLayout(ResourceCachedScene::getLayoutOfDataInstance(geometryInstance));
+
+        // The position attribute cannot be identified from the geometry layout alone, therefore the bounding box
+        // is the union of all float vertex attributes which is conservative but never too small.
+        // Vertex data which can change without the vertex array being re-uploaded (data buffers) or whose
+        // layout cannot be interpreted (instanced, interleaved, custom) leaves the bounding box invalid, i.e. never culled.
+        BoundingBox boundingBox;
+        // indices are always in the 1st field (field Zero)
+        for (DataFieldHandle field(1u); field < geometryLayout.getFieldCount(); ++field)
+        {
+            const ResourceField& attribute = ResourceCachedScene::getDataResource(geometryInstance, field);
+            if (!attribute.hash.isValid() && !attribute.dataBuffer.isValid())
+                continue;
+
+            switch (geometryLayout.getField(field).dataType)
+            {
+            case EDataType::FloatBuffer:
+            case EDataType::Vector2Buffer:
+            case EDataType::Vector3Buffer:
+            case EDataType::Vector4Buffer:
+                break;
+            default:
+                return {};
             }
+
+            if (attribute.dataBuffer.isValid() || attribute.instancingDivisor != 0u || attribute.offsetWithinElementInBytes != 0u || attribute.stride != 0u)
+                return {};
+
+            const BoundingBox attributeBoundingBox = resourceAccessor.getResourceBoundingBox(attribute.hash);
+            if (!attributeBoundingBox.isValid())
+                return {};
+            boundingBox.extend(attributeBoundingBox);
         }
+
+        return boundingBox;
+    }
+
+    void RendererCachedScene::updateFrustumCulling()
+    {
+        if (!m_frustumCullingEnabled)
+            return;
+
+        m_renderableBoundingBoxes.resize(ResourceCachedScene::getRenderableCount());
+        m_renderableWorldBoundingBoxes.resize(ResourceCachedScene::getRenderableCount());
+        m_passCulledRenderableOrder.resize(m_passRenderableOrder.size());
+        m_passViewProjectionMatrices.resize(m_passRenderableOrder.size(), glm::mat4(0.f));
+        for (const auto& pass : m_sortedRenderingPasses)
+        {
+            if (ERenderingPassType::RenderPass != pass.getType())
+                continue;
+
+            // pass is culled again only if its camera or any of the renderables changed since last culling
+            const RenderPassHandle passHandle = pass.getRenderPassHandle();
+            const glm::mat4 viewProjectionMatrix = calculateCameraViewProjectionMatrix(ResourceCachedScene::getRenderPass(passHandle).camera);
+            glm::mat4& cachedViewProjectionMatrix = m_passViewProjectionMatrices[passHandle.asMemoryHandle()];
+            if (m_frustumCullingUpToDate && cachedViewProjectionMatrix == viewProjectionMatrix)
+                continue;
+            cachedViewProjectionMatrix = viewProjectionMatrix;
+
+            // boxes are in world space, so one frustum serves all renderables of pass
+            const Frustum frustum(viewProjectionMatrix);
+            RenderableVector& culledRenderables = m_passCulledRenderableOrder[passHandle.asMemoryHandle()];
+            culledRenderables.clear();
+            for (const auto renderable : m_passRenderableOrder[passHandle.asMemoryHandle()])
+            {
+                if (isRenderableInsideFrustum(renderable, frustum))
+                    culledRenderables.push_back(renderable);
+            }
+        }
+
+        m_frustumCullingUpToDate = true;
+    }
+
+    glm::mat4 RendererCachedScene::calculateCameraViewProjectionMatrix(CameraHandle camera) const
+    {
+        // same as the matrices used by RenderExecutor when rendering with this camera
+        const Camera& cameraData = ResourceCachedScene::getCamera(camera);
+        const glm::mat4 viewMatrix = updateMatrixCacheWithLinks(ETransformationMatrixType_Object, cameraData.node);
+
+        const auto frustumPlanesRef = ResourceCachedScene::getDataReference(cameraData.dataInstance, Camera::FrustumPlanesField);
+        const auto frustumNearFarRef = ResourceCachedScene::getDataReference(cameraData.dataInstance, Camera::FrustumNearFarPlanesField);
+        const auto& frustumPlanes = ResourceCachedScene::getDataSingleVector4f(frustumPlanesRef, DataFieldHandle{ 0 });
+        const auto& frustumNearFar = ResourceCachedScene::getDataSingleVector2f(frustumNearFarRef, DataFieldHandle{ 0 });
+        const glm::mat4 projectionMatrix = CameraMatrixHelper::ProjectionMatrix(
+            ProjectionParams::Frustum(cameraData.projectionType, frustumPlanes.x, frustumPlanes.y, frustumPlanes.z, frustumPlanes.w, frustumNearFar.x, frustumNearFar.y));
+
+        return projectionMatrix * viewMatrix;
+    }
+
+    bool RendererCachedScene::isRenderableInsideFrustum(RenderableHandle renderable, const Frustum& frustum) const
+    {
+        const BoundingBox& worldBoundingBox = m_renderableWorldBoundingBoxes[renderable.asMemoryHandle()];
+        // instances are placed by the shader, their extent is unknown
+        if (!worldBoundingBox.isValid() || ResourceCachedScene::getRenderable(renderable).instanceCount > 1u)
+            return true;
+
+        return frustum.intersects(worldBoundingBox);
     }
 
     bool RendererCachedScene::shouldRenderPassBeRendered(RenderPassHandle handle) const
@@ -343,7 +864,7 @@ namespace ramses_internal
             }
         }
 
-        m_renderableOrderingDirty = true;
+        m_renderingPassesDirty = true;
     }
 
     void RendererCachedScene::markAllRenderOncePassesAsRendered() const
@@ -353,7 +874,7 @@ namespace ramses_internal
             // some render once passes were rendered, remove them from list
             // and force update of cached render pass list for next update
             m_renderOncePassesToRender.clear();
-            m_renderableOrderingDirty = true;
+            m_renderingPassesDirty = true;
         }
     }
 }
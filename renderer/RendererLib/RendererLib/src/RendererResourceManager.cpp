@@ -33,10 +33,11 @@ namespace ramses_internal
         IEmbeddedCompositingManager& embeddedCompositingManager,
         const DisplayConfig& displayConfig,
         const FrameTimer& frameTimer,
-        RendererStatistics& stats)
+        RendererStatistics& stats,
+        ParallelForExecutor* decompressionExecutor)
         : m_renderBackend(renderBackend)
         , m_embeddedCompositingManager(embeddedCompositingManager)
-        , m_resourceUploadingManager(m_resourceRegistry, std::move(resourceUploader), renderBackend, asyncEffectUploader, displayConfig, frameTimer, stats)
+        , m_resourceUploadingManager(m_resourceRegistry, std::move(resourceUploader), renderBackend, asyncEffectUploader, displayConfig, frameTimer, stats, decompressionExecutor)
         , m_stats(stats)
     {
     }
@@ -203,6 +204,11 @@ namespace ramses_internal
         return m_resourceRegistry.getResourceDescriptor(hash).deviceHandle;
     }
 
+    BoundingBox RendererResourceManager::getResourceBoundingBox(const ResourceContentHash& hash) const
+    {
+        return m_resourceRegistry.getResourceDescriptor(hash).boundingBox;
+    }
+
     DeviceResourceHandle RendererResourceManager::getRenderTargetDeviceHandle(RenderTargetHandle handle, SceneId sceneId) const
     {
         assert(m_sceneResourceRegistryMap.contains(sceneId));
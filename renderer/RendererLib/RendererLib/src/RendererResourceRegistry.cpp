@@ -8,6 +8,7 @@
 
 #include "RendererLib/RendererResourceRegistry.h"
 #include "Utils/ThreadLocalLogForced.h"
+#include "Resource/ArrayResource.h"
 
 namespace ramses_internal
 {
@@ -149,12 +150,53 @@ namespace ramses_internal
         assert(!rd.deviceHandle.isValid());
         rd.deviceHandle = deviceHandle;
         rd.vramSize = vramSize;
+        if (rd.type == EResourceType_VertexArray && rd.resource)
+            rd.boundingBox = CalculateVertexArrayBoundingBox(*rd.resource->convertTo<ArrayResource>());
         // release resource data
         rd.resource.reset();
 
         setResourceStatus(hash, EResourceStatus::Uploaded);
     }
 
+    BoundingBox RendererResourceRegistry::CalculateVertexArrayBoundingBox(const ArrayResource& vertexArray)
+    {
+        uint32_t numComponents = 0u;
+        switch (vertexArray.getElementType())
+        {
+        case EDataType::Float:
+            numComponents = 1u;
+            break;
+        case EDataType::Vector2F:
+            numComponents = 2u;
+            break;
+        case EDataType::Vector3F:
+        case EDataType::Vector4F:
+            // w component does not contribute to position
+            numComponents = 3u;
+            break;
+        default:
+            // non-float or interleaved data, bounds cannot be determined
+            return {};
+        }
+
+        if (!vertexArray.isDeCompressedAvailable())
+            return {};
+
+        const auto* data = reinterpret_cast<const float*>(vertexArray.getResourceData().data());
+        const uint32_t elementStride = EnumToNumComponents(vertexArray.getElementType());
+        BoundingBox box;
+        for (uint32_t i = 0u; i < vertexArray.getElementCount(); ++i)
+        {
+            const float* element = data + i * elementStride;
+            glm::vec3 point{ 0.f };
+            for (uint32_t c = 0u; c < numComponents; ++c)
+                point[c] = element[c];
+            box.extend(point);
+        }
+
+        return box;
+    }
+
     void RendererResourceRegistry::setResourceBroken(const ResourceContentHash& hash)
     {
         // release resource data
@@ -34,9 +34,11 @@
 #include "Components/SceneUpdate.h"
 #include "Utils/ThreadLocalLogForced.h"
 #include "Utils/Image.h"
+#include "Utils/TraceRecorder.h"
 #include "PlatformAbstraction/PlatformTime.h"
 #include "PlatformAbstraction/Macros.h"
 #include <algorithm>
+#include <iterator>
 #include "RendererLib/SceneResourceUploader.h"
 
 namespace ramses_internal
@@ -81,6 +83,7 @@ namespace ramses_internal
 
     void RendererSceneUpdater::handleSceneUpdate(SceneId sceneId, SceneUpdate&& sceneUpdate)
     {
+        RAMSES_TRACE_INSTANT("renderer", "FlushArrived", "scene", sceneId.getValue());
         ESceneState sceneState = m_sceneStateExecutor.getSceneState(sceneId);
 
         LOG_TRACE_P(CONTEXT_RENDERER, "RendererSceneUpdater::handleSceneUpdate: for sceneId {}, flushCounter {}, sceneState {}",
@@ -110,6 +113,22 @@ namespace ramses_internal
         m_renderer.resetRenderInterruptState();
         m_renderer.createDisplayContext(displayConfig);
 
+        if (displayConfig.getSceneUpdateWorkerThreadCount() > 0u)
+            m_sceneUpdateExecutor = std::make_unique<ParallelForExecutor>(displayConfig.getSceneUpdateWorkerThreadCount());
+        // keep worker if display is re-created, pending flushes might refer to its tickets
+        if (displayConfig.isAsyncFlushPreparationEnabled() && !m_flushPreparationWorker)
+            m_flushPreparationWorker = std::make_unique<FlushPreparationWorker>();
+
+        m_frustumCullingEnabled = displayConfig.isFrustumCullingEnabled();
+        m_stateSortingEnabled = displayConfig.isStateSortingEnabled();
+        m_drawCallBatchingEnabled = displayConfig.isDrawCallBatchingEnabled();
+        for (const auto& sceneIt : m_rendererScenes)
+        {
+            sceneIt.value.scene->setFrustumCullingEnabled(m_frustumCullingEnabled);
+            sceneIt.value.scene->setStateSortingEnabled(m_stateSortingEnabled);
+            sceneIt.value.scene->setDrawCallBatchingEnabled(m_drawCallBatchingEnabled);
+        }
+
         if (m_renderer.hasDisplayController())
         {
             IDisplayController& displayController = m_renderer.getDisplayController();
@@ -152,7 +171,8 @@ namespace ramses_internal
             embeddedCompositingManager,
             displayConfig,
             m_frameTimer,
-            m_renderer.getStatistics());
+            m_renderer.getStatistics(),
+            m_sceneUpdateExecutor.get());
     }
 
     void RendererSceneUpdater::destroyResourceManager()
@@ -273,7 +293,13 @@ namespace ramses_internal
             updateScenesDataLinks();
         }
 
-        m_renderer.m_traceId = 12;
+        {
+            m_renderer.m_traceId = 12;
+            LOG_TRACE(CONTEXT_PROFILING, "    RendererSceneUpdater::updateScenes update scenes frustum culling");
+            updateScenesFrustumCulling();
+        }
+
+        m_renderer.m_traceId = 13;
         for (const auto scene : m_modifiedScenesToRerender)
         {
             if (m_sceneStateExecutor.getSceneState(scene) == ESceneState::Rendered)
@@ -377,6 +403,9 @@ namespace ramses_internal
         flushInfo.resourcesRemoved = std::move(resourceChanges.m_resourcesRemoved);
         flushInfo.sceneActions = std::move(sceneUpdate.actions);
 
+        if (m_flushPreparationWorker && !flushInfo.resourceDataToProvide.empty())
+            flushInfo.preparationTicket = m_flushPreparationWorker->prepare(flushInfo.resourceDataToProvide);
+
         if (stagingInfo.pendingData.pendingFlushes.size() > m_maximumPendingFlushesToKillScene)
         {
             const auto numPendingFlushes = getNumberOfPendingNonEmptyFlushes(sceneID);
@@ -437,6 +466,11 @@ namespace ramses_internal
         // collect from pending flushes
         for (auto& pendingFlush : stagingInfo.pendingData.pendingFlushes)
         {
+            // provide resources of flushes still being prepared later, so that their upload does not wait for decompression,
+            // keep order of flushes (flushes are prepared in order anyway)
+            if (!isFlushPrepared(pendingFlush))
+                break;
+
             if (!pendingFlush.resourceDataToProvide.empty())
             {
                 m_displayResourceManager->referenceResourcesForScene(sceneID, pendingFlush.resourcesAdded);
@@ -545,6 +579,16 @@ namespace ramses_internal
                 LOG_ERROR(CONTEXT_RENDERER, "Force applying pending flushes! Scene " << sceneID << " has " << numPendingFlushes << " pending flushes, renderer cannot catch up with resource updates.");
                 logMissingResources(stagingInfo.pendingData, sceneID);
 
+                // resources of flushes still being prepared were not provided yet, they must not get lost when flushes are applied
+                if (m_flushPreparationWorker)
+                {
+                    uint64_t lastTicket = FlushPreparationWorker::InvalidTicket;
+                    for (const auto& pendingFlush : stagingInfo.pendingData.pendingFlushes)
+                        lastTicket = std::max(lastTicket, pendingFlush.preparationTicket);
+                    m_flushPreparationWorker->waitUntilPrepared(lastTicket);
+                    referenceAndProvidePendingResourceData(sceneID);
+                }
+
                 canApplyFlushes = true;
                 m_renderer.resetRenderInterruptState();
             }
@@ -561,6 +605,7 @@ namespace ramses_internal
 
     void RendererSceneUpdater::applyPendingFlushes(SceneId sceneID, StagingInfo& stagingInfo)
     {
+        RAMSES_TRACE_SCOPE_ARG("renderer", "ApplyFlushes", "scene", sceneID.getValue());
         auto& rendererScene = const_cast<RendererCachedScene&>(m_rendererScenes.getScene(sceneID));
         rendererScene.preallocateSceneSize(stagingInfo.sizeInformation);
 
@@ -705,10 +750,9 @@ namespace ramses_internal
 
                     bool dirtyVAOLeft = false;
 
-                    const auto& vertexArraysDirtinessFlags = rendererScene.getVertexArraysDirtinessFlags();
-                    for (RenderableHandle renderable(0u); renderable < rendererScene.getRenderableCount(); ++renderable)
+                    for (const auto renderable : rendererScene.getRenderablesWithDirtyVertexArrays())
                     {
-                        if (vertexArraysDirtinessFlags[renderable.asMemoryHandle()])
+                        if (rendererScene.isRenderableVertexArrayDirty(renderable))
                         {
                             bool updated = false;
 
@@ -739,6 +783,7 @@ namespace ramses_internal
                     }
 
                     rendererScene.updateRenderableVertexArrays(*m_displayResourceManager, m_tempRenderablesWithUpdatedVertexArrays);
+                    rendererScene.updateRenderableBoundingBoxes(*m_displayResourceManager, m_tempRenderablesWithUpdatedVertexArrays);
                     if (!dirtyVAOLeft)
                         rendererScene.markVertexArraysClean();
                 }
@@ -749,16 +794,19 @@ namespace ramses_internal
     void RendererSceneUpdater::updateScenesResourceCache()
     {
         // update renderer scenes renderables and resource cache
+        m_scenesToUpdate.clear();
         for (const auto& sceneIt : m_rendererScenes)
         {
-            const SceneId sceneId = sceneIt.key;
             // update resource cache only if scene is actually rendered
-            if (m_sceneStateExecutor.getSceneState(sceneId) == ESceneState::Rendered)
-            {
-                RendererCachedScene& rendererScene = *(sceneIt.value.scene);
-                rendererScene.updateRenderablesAndResourceCache(*m_displayResourceManager);
-            }
+            if (m_sceneStateExecutor.getSceneState(sceneIt.key) == ESceneState::Rendered)
+                m_scenesToUpdate.push_back(sceneIt.value.scene);
         }
+
+        // resource manager is only read here, device handles of resources are not changed before all scenes are updated
+        const IResourceDeviceHandleAccessor& resourceAccessor = *m_displayResourceManager;
+        updateScenesInParallel(m_scenesToUpdate, [&resourceAccessor](RendererCachedScene& rendererScene, ParallelForExecutor* /*executor*/) {
+            rendererScene.updateRenderablesAndResourceCache(resourceAccessor);
+        });
     }
 
     void RendererSceneUpdater::updateScenesStates()
@@ -1137,7 +1185,10 @@ namespace ramses_internal
     {
         if (m_sceneStateExecutor.checkIfCanBeSubscriptionPending(sceneInfo.sceneID))
         {
-            m_rendererScenes.createScene(sceneInfo);
+            RendererCachedScene& rendererScene = m_rendererScenes.createScene(sceneInfo);
+            rendererScene.setFrustumCullingEnabled(m_frustumCullingEnabled);
+            rendererScene.setStateSortingEnabled(m_stateSortingEnabled);
+            rendererScene.setDrawCallBatchingEnabled(m_drawCallBatchingEnabled);
             m_sceneStateExecutor.setSubscriptionPending(sceneInfo.sceneID);
         }
     }
@@ -1617,9 +1668,24 @@ namespace ramses_internal
         m_sceneReferenceLogic = &sceneRefLogic;
     }
 
+    bool RendererSceneUpdater::isFlushPrepared(const PendingFlush& pendingFlush) const
+    {
+        return !m_flushPreparationWorker || m_flushPreparationWorker->isPrepared(pendingFlush.preparationTicket);
+    }
+
     bool RendererSceneUpdater::areResourcesFromPendingFlushesUploaded(SceneId sceneId) const
     {
         const auto& pendingData = m_rendererScenes.getStagingInfo(sceneId).pendingData;
+
+        // flush which was not prepared yet or got prepared after resources were provided in this frame did not reference its resources,
+        // its resources can still be uploaded already because of other scene using them but it must not be applied without its references
+        const bool allFlushesReferencedResources = std::all_of(pendingData.pendingFlushes.cbegin(), pendingData.pendingFlushes.cend(), [this](const auto& pendingFlush)
+        {
+            return isFlushPrepared(pendingFlush) && pendingFlush.resourceDataToProvide.empty();
+        });
+        if (!allFlushesReferencedResources)
+            return false;
+
         for (const auto& pendingFlush : pendingData.pendingFlushes)
             for (const auto& res : pendingFlush.resourcesAdded)
                 if (m_displayResourceManager->getResourceStatus(res) != EResourceStatus::Uploaded)
@@ -1659,17 +1725,68 @@ namespace ramses_internal
             if (m_scenesNeedingTransformationCacheUpdate.contains(sceneId))
             {
                 RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
-                renderScene.updateRenderableWorldMatricesWithLinks();
+                renderScene.updateRenderableWorldMatricesWithLinks(m_sceneUpdateExecutor.get());
                 m_scenesNeedingTransformationCacheUpdate.remove(sceneId);
             }
         }
 
-        // update rest of scenes that have no dependencies
+        // update rest of scenes that have no dependencies, these are independent of each other
+        m_scenesToUpdate.clear();
         for(const auto sceneId : m_scenesNeedingTransformationCacheUpdate)
+            m_scenesToUpdate.push_back(&m_rendererScenes.getScene(sceneId));
+        updateScenesInParallel(m_scenesToUpdate, [](RendererCachedScene& renderScene, ParallelForExecutor* executor) {
+            renderScene.updateRenderableWorldMatrices(executor);
+        });
+    }
+
+    void RendererSceneUpdater::updateScenesFrustumCulling()
+    {
+        if (!m_frustumCullingEnabled)
+            return;
+
+        m_scenesNeedingFrustumCullingUpdate.clear();
+        for (const auto& sceneIt : m_rendererScenes)
+        {
+            if (m_sceneStateExecutor.getSceneState(sceneIt.key) == ESceneState::Rendered)
+                m_scenesNeedingFrustumCullingUpdate.put(sceneIt.key);
+        }
+
+        // camera of consumer scene can be linked to provider scene and culling then updates matrix caches of both scenes,
+        // therefore scenes with transformation links are culled one after another in dependency order
+        const SceneIdVector& dependencyOrderedScenes = m_rendererScenes.getSceneLinksManager().getTransformationLinkManager().getDependencyChecker().getDependentScenesInOrder();
+        for (const auto sceneId : dependencyOrderedScenes)
         {
-            RendererCachedScene& renderScene = m_rendererScenes.getScene(sceneId);
-            renderScene.updateRenderableWorldMatrices();
+            if (m_scenesNeedingFrustumCullingUpdate.contains(sceneId))
+            {
+                m_rendererScenes.getScene(sceneId).updateFrustumCulling();
+                m_scenesNeedingFrustumCullingUpdate.remove(sceneId);
+            }
         }
+
+        // rest of scenes is independent of each other
+        m_scenesToUpdate.clear();
+        for (const auto sceneId : m_scenesNeedingFrustumCullingUpdate)
+            m_scenesToUpdate.push_back(&m_rendererScenes.getScene(sceneId));
+        updateScenesInParallel(m_scenesToUpdate, [](RendererCachedScene& renderScene, ParallelForExecutor* /*executor*/) {
+            renderScene.updateFrustumCulling();
+        });
+    }
+
+    void RendererSceneUpdater::updateScenesInParallel(const std::vector<RendererCachedScene*>& scenes, const std::function<void(RendererCachedScene&, ParallelForExecutor*)>& updateFunction)
+    {
+        // with single scene (or no workers) the executor is passed on to parallelize work within the scene,
+        // otherwise scenes are distributed to workers and each scene is updated by single thread (executor cannot be used recursively)
+        if (!m_sceneUpdateExecutor || scenes.size() < 2u)
+        {
+            for (auto scene : scenes)
+                updateFunction(*scene, m_sceneUpdateExecutor.get());
+            return;
+        }
+
+        m_sceneUpdateExecutor->execute(scenes.size(), 1u, [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i)
+                updateFunction(*scenes[i], nullptr);
+        });
     }
 
     void RendererSceneUpdater::updateScenesDataLinks()
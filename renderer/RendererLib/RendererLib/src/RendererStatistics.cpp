@@ -26,6 +26,11 @@ namespace ramses_internal
         return m_frameNumber <= 0 ? 0u : m_drawCalls / m_frameNumber;
     }
 
+    uint32_t RendererStatistics::getAvoidedStateChangesPerFrame() const
+    {
+        return m_frameNumber <= 0 ? 0u : m_avoidedStateChanges / m_frameNumber;
+    }
+
     void RendererStatistics::sceneRendered(SceneId sceneId)
     {
         m_sceneStatistics[sceneId].numRendered++;
@@ -151,7 +156,7 @@ namespace ramses_internal
         m_streamTextureStatistics.erase(sourceId);
     }
 
-    void RendererStatistics::frameFinished(uint32_t drawCalls)
+    void RendererStatistics::frameFinished(uint32_t drawCalls, uint32_t avoidedStateChanges)
     {
         const uint64_t currTick = PlatformTime::GetMicrosecondsMonotonic();
         const uint32_t frameDuration = static_cast<uint32_t>(currTick - m_lastFrameTick);
@@ -175,6 +180,7 @@ namespace ramses_internal
 
         m_frameNumber++;
         m_drawCalls += drawCalls;
+        m_avoidedStateChanges += avoidedStateChanges;
 
         m_lastFrameTick = currTick;
     }
@@ -192,6 +198,7 @@ namespace ramses_internal
         m_timeBase = PlatformTime::GetMillisecondsMonotonic();
         m_frameNumber = 0;
         m_drawCalls = 0u;
+        m_avoidedStateChanges = 0u;
         m_frameDurationMin = std::numeric_limits<uint32_t>::max();
         m_frameDurationMax = 0u;
         m_resourcesUploaded = 0u;
@@ -255,6 +262,8 @@ namespace ramses_internal
             ", maxFrameTime " << m_frameDurationMax << "us]" <<
             ", drawcallsPerFrame " << getDrawCallsPerFrame() <<
             ", numFrames " << m_frameNumber;
+        if (m_avoidedStateChanges > 0u)
+            str << ", avoidedStateChangesPerFrame " << getAvoidedStateChangesPerFrame();
         if (m_resourcesUploaded > 0u)
             str << ", resUploaded " << m_resourcesUploaded << " (" << m_resourcesBytesUploaded << " B)";
         str << ", RC VRAM usage/cache (" << (m_totalResourceUploadedSize >> 20) << "/" << (m_gpuCacheSize >> 20) << " MB)";
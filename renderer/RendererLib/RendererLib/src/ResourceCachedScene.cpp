@@ -34,6 +34,9 @@ namespace ramses_internal
         resizeContainerIfSmaller(m_renderableResourcesDirty, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_dataInstancesDirty, sizeInfo.datainstanceCount);
         resizeContainerIfSmaller(m_textureSamplersDirty, sizeInfo.textureSamplerCount);
+        resizeContainerIfSmaller(m_renderablesUsingDataInstance, sizeInfo.datainstanceCount);
+        resizeContainerIfSmaller(m_textureSamplerUserIndices, sizeInfo.datainstanceCount);
+        resizeContainerIfSmaller(m_dataInstancesUsingTextureSampler, sizeInfo.textureSamplerCount);
         resizeContainerIfSmaller(m_effectDeviceHandleCache, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_renderableVertexArrayDirty, sizeInfo.renderableCount);
         resizeContainerIfSmaller(m_vertexArrayCache, sizeInfo.renderableCount);
@@ -56,6 +59,10 @@ namespace ramses_internal
 
     void ResourceCachedScene::releaseRenderable(RenderableHandle renderableHandle)
     {
+        const auto& dataInstances = getRenderable(renderableHandle).dataInstances;
+        for (uint32_t slot = 0u; slot < dataInstances.size(); ++slot)
+            removeDataInstanceUser(dataInstances[slot], renderableHandle, static_cast<ERenderableDataSlotType>(slot));
+
         TextureLinkCachedScene::releaseRenderable(renderableHandle);
         setRenderableResourcesDirtyFlag(renderableHandle, false);
         setRenderableVertexArrayDirtyFlag(renderableHandle, true);
@@ -88,6 +95,14 @@ namespace ramses_internal
 
     void ResourceCachedScene::releaseDataInstance(DataInstanceHandle dataInstanceHandle)
     {
+        const DataLayout& layout = getDataLayout(getLayoutOfDataInstance(dataInstanceHandle));
+        const uint32_t fieldCount = layout.getFieldCount();
+        for (DataFieldHandle dataField(0u); dataField < fieldCount; ++dataField)
+        {
+            if (IsTextureSamplerType(layout.getField(dataField).dataType))
+                removeTextureSamplerUser(getDataTextureSamplerHandle(dataInstanceHandle, dataField), dataInstanceHandle, dataField);
+        }
+
         TextureLinkCachedScene::releaseDataInstance(dataInstanceHandle);
         setDataInstanceDirtyFlag(dataInstanceHandle, true);
     }
@@ -112,7 +127,9 @@ namespace ramses_internal
 
     void ResourceCachedScene::setRenderableDataInstance(RenderableHandle renderableHandle, ERenderableDataSlotType slot, DataInstanceHandle newDataInstance)
     {
+        removeDataInstanceUser(getRenderable(renderableHandle).dataInstances[slot], renderableHandle, slot);
         TextureLinkCachedScene::setRenderableDataInstance(renderableHandle, slot, newDataInstance);
+        addDataInstanceUser(newDataInstance, renderableHandle, slot);
 
         const uint32_t indexIntoCache = renderableHandle.asMemoryHandle();
         assert(indexIntoCache < m_effectDeviceHandleCache.size());
@@ -130,7 +147,9 @@ namespace ramses_internal
 
     void ResourceCachedScene::setDataTextureSamplerHandle(DataInstanceHandle dataInstanceHandle, DataFieldHandle field, TextureSamplerHandle samplerHandle)
     {
+        removeTextureSamplerUser(getDataTextureSamplerHandle(dataInstanceHandle, field), dataInstanceHandle, field);
         TextureLinkCachedScene::setDataTextureSamplerHandle(dataInstanceHandle, field, samplerHandle);
+        addTextureSamplerUser(samplerHandle, dataInstanceHandle, field);
         setDataInstanceDirtyFlag(dataInstanceHandle, true);
     }
 
@@ -161,8 +180,7 @@ namespace ramses_internal
 
     bool ResourceCachedScene::renderableResourcesDirty(RenderableHandle handle) const
     {
-        uint32_t renderableAsIndex = handle.asMemoryHandle();
-        return m_renderableResourcesDirty[renderableAsIndex];
+        return m_renderableResourcesDirty.isDirty(handle);
     }
 
     bool ResourceCachedScene::renderableResourcesDirty(const RenderableVector& handles) const
@@ -205,7 +223,12 @@ namespace ramses_internal
 
     const BoolVector& ResourceCachedScene::getVertexArraysDirtinessFlags() const
     {
-        return m_renderableVertexArrayDirty;
+        return m_renderableVertexArrayDirty.getFlags();
+    }
+
+    const RenderableVector& ResourceCachedScene::getRenderablesWithDirtyVertexArrays() const
+    {
+        return m_renderableVertexArrayDirty.getList();
     }
 
     bool ResourceCachedScene::CheckAndUpdateDeviceHandle(const IResourceDeviceHandleAccessor& resourceAccessor, DeviceResourceHandle& deviceHandleInOut, const ResourceContentHash& resourceHash)
@@ -444,11 +467,10 @@ namespace ramses_internal
     {
         updateRenderablesResourcesDirtiness();
 
-        for (const auto& renderableIt : getRenderables())
+        const auto& dirtyRenderables = m_renderableResourcesDirty.getList();
+        for (const auto renderable : dirtyRenderables)
         {
-            const auto renderable = renderableIt.first;
-            const uint32_t renderableAsIndex = renderable.asMemoryHandle();
-            if (m_renderableResourcesDirty[renderableAsIndex] && renderableIt.second->visibilityMode != EVisibilityMode::Off)
+            if (m_renderableResourcesDirty.isDirty(renderable) && isRenderableAllocated(renderable) && getRenderable(renderable).visibilityMode != EVisibilityMode::Off)
             {
                 if (checkAndUpdateEffectResource(resourceAccessor, renderable) &&
                     checkAndUpdateTextureResources(resourceAccessor, renderable) &&
@@ -458,6 +480,7 @@ namespace ramses_internal
                 }
             }
         }
+        m_renderableResourcesDirty.removeClean();
 
         checkAndUpdateRenderTargetResources(resourceAccessor);
         checkAndUpdateBlitPassResources(resourceAccessor);
@@ -467,41 +490,44 @@ namespace ramses_internal
     {
         if (m_renderableResourcesDirtinessNeedsUpdate)
         {
-            const uint32_t totalDataInstanceCount = getDataInstanceCount();
-            for (DataInstanceHandle d(0u); d < totalDataInstanceCount; ++d)
+            // only objects using dirty ones are visited, all texture samplers and data instances are marked dirty via lists
+            for (const auto t : m_textureSamplersDirty.getList())
             {
-                if (!isDataInstanceDirty(d) && doesDataInstanceReferToDirtyTextureSampler(d))
+                if (!isTextureSamplerDirty(t) || t.asMemoryHandle() >= m_dataInstancesUsingTextureSampler.size())
+                    continue;
+
+                for (const auto& user : m_dataInstancesUsingTextureSampler[t.asMemoryHandle()])
                 {
-                    setDataInstanceDirtyFlag(d, true);
+                    const DataInstanceHandle d = user.dataInstance;
+                    if (!isDataInstanceDirty(d) && doesDataInstanceReferToDirtyTextureSampler(d))
+                        setDataInstanceDirtyFlag(d, true);
                 }
             }
 
-            const uint32_t totalRenderableCount = getRenderableCount();
-            for (RenderableHandle r(0u); r < totalRenderableCount; ++r)
+            for (const auto d : m_dataInstancesDirty.getList())
             {
-                if(isRenderableAllocated(r))
-                {
-                    if (doesRenderableReferToDirtyUniforms(r))
-                        setRenderableResourcesDirtyFlag(r, true);
+                if (!isDataInstanceDirty(d) || d.asMemoryHandle() >= m_renderablesUsingDataInstance.size())
+                    continue;
 
-                    if (doesRenderableReferToDirtyGeometry(r))
+                for (const auto& user : m_renderablesUsingDataInstance[d.asMemoryHandle()])
+                {
+                    const RenderableHandle r = user.renderable;
+                    if (isRenderableAllocated(r))
                     {
-                        setRenderableResourcesDirtyFlag(r, true);
-                        setRenderableVertexArrayDirtyFlag(r, true);
+                        if (doesRenderableReferToDirtyUniforms(r))
+                            setRenderableResourcesDirtyFlag(r, true);
+
+                        if (doesRenderableReferToDirtyGeometry(r))
+                        {
+                            setRenderableResourcesDirtyFlag(r, true);
+                            setRenderableVertexArrayDirtyFlag(r, true);
+                        }
                     }
                 }
             }
 
-            for (DataInstanceHandle d(0u); d < totalDataInstanceCount; ++d)
-            {
-                setDataInstanceDirtyFlag(d, false);
-            }
-
-            const uint32_t totalTextureSamplerCount = getTextureSamplerCount();
-            for (TextureSamplerHandle t(0u); t < totalTextureSamplerCount; ++t)
-            {
-                setTextureSamplerDirtyFlag(t, false);
-            }
+            m_dataInstancesDirty.clear();
+            m_textureSamplersDirty.clear();
 
             m_renderableResourcesDirtinessNeedsUpdate = false;
         }
@@ -509,38 +535,101 @@ namespace ramses_internal
 
     void ResourceCachedScene::setRenderableResourcesDirtyFlag(RenderableHandle handle, bool dirty) const
     {
-        const uint32_t indexIntoCache = handle.asMemoryHandle();
-        assert(indexIntoCache < m_renderableResourcesDirty.size());
-        m_renderableResourcesDirty[indexIntoCache] = dirty;
+        m_renderableResourcesDirty.setDirty(handle, dirty);
     }
 
     void ResourceCachedScene::setRenderableVertexArrayDirtyFlag(RenderableHandle handle, bool dirty) const
     {
-        const uint32_t indexIntoCache = handle.asMemoryHandle();
-        assert(indexIntoCache < m_renderableVertexArrayDirty.size());
-        m_renderableVertexArrayDirty[indexIntoCache] = dirty;
+        m_renderableVertexArrayDirty.setDirty(handle, dirty);
 
         m_renderableVertexArraysDirty |= dirty;
     }
 
     void ResourceCachedScene::setDataInstanceDirtyFlag(DataInstanceHandle handle, bool dirty) const
     {
-        const uint32_t indexIntoCache = handle.asMemoryHandle();
-        assert(indexIntoCache < m_dataInstancesDirty.size());
-        m_dataInstancesDirty[indexIntoCache] = dirty;
+        m_dataInstancesDirty.setDirty(handle, dirty);
 
         m_renderableResourcesDirtinessNeedsUpdate |= dirty;
     }
 
     void ResourceCachedScene::setTextureSamplerDirtyFlag(TextureSamplerHandle handle, bool dirty) const
     {
-        const uint32_t indexIntoCache = handle.asMemoryHandle();
-        assert(indexIntoCache < m_textureSamplersDirty.size());
-        m_textureSamplersDirty[indexIntoCache] = dirty;
+        m_textureSamplersDirty.setDirty(handle, dirty);
 
         m_renderableResourcesDirtinessNeedsUpdate |= dirty;
     }
 
+    void ResourceCachedScene::addDataInstanceUser(DataInstanceHandle dataInstance, RenderableHandle renderable, ERenderableDataSlotType slot)
+    {
+        if (!dataInstance.isValid())
+            return;
+
+        resizeContainerIfSmaller(m_renderablesUsingDataInstance, dataInstance.asMemoryHandle() + 1u);
+        auto& users = m_renderablesUsingDataInstance[dataInstance.asMemoryHandle()];
+        if (renderable.asMemoryHandle() >= m_dataInstanceUserIndices.size())
+        {
+            std::array<uint32_t, ERenderableDataSlotType_MAX_SLOTS> noIndices;
+            noIndices.fill(InvalidUserIndex);
+            m_dataInstanceUserIndices.resize(renderable.asMemoryHandle() + 1u, noIndices);
+        }
+        m_dataInstanceUserIndices[renderable.asMemoryHandle()][slot] = static_cast<uint32_t>(users.size());
+        users.push_back({ renderable, slot });
+    }
+
+    void ResourceCachedScene::removeDataInstanceUser(DataInstanceHandle dataInstance, RenderableHandle renderable, ERenderableDataSlotType slot)
+    {
+        if (!dataInstance.isValid() || dataInstance.asMemoryHandle() >= m_renderablesUsingDataInstance.size() || renderable.asMemoryHandle() >= m_dataInstanceUserIndices.size())
+            return;
+
+        auto& users = m_renderablesUsingDataInstance[dataInstance.asMemoryHandle()];
+        uint32_t& userIndex = m_dataInstanceUserIndices[renderable.asMemoryHandle()][slot];
+        if (userIndex >= users.size() || users[userIndex].renderable != renderable || users[userIndex].slot != slot)
+            return;
+
+        // order of users does not matter, last user takes place of removed one
+        const DataInstanceUser& lastUser = users.back();
+        m_dataInstanceUserIndices[lastUser.renderable.asMemoryHandle()][lastUser.slot] = userIndex;
+        users[userIndex] = lastUser;
+        users.pop_back();
+        userIndex = InvalidUserIndex;
+    }
+
+    void ResourceCachedScene::addTextureSamplerUser(TextureSamplerHandle sampler, DataInstanceHandle dataInstance, DataFieldHandle field)
+    {
+        if (!sampler.isValid())
+            return;
+
+        resizeContainerIfSmaller(m_dataInstancesUsingTextureSampler, sampler.asMemoryHandle() + 1u);
+        auto& users = m_dataInstancesUsingTextureSampler[sampler.asMemoryHandle()];
+        resizeContainerIfSmaller(m_textureSamplerUserIndices, dataInstance.asMemoryHandle() + 1u);
+        auto& fieldIndices = m_textureSamplerUserIndices[dataInstance.asMemoryHandle()];
+        if (field.asMemoryHandle() >= fieldIndices.size())
+            fieldIndices.resize(field.asMemoryHandle() + 1u, InvalidUserIndex);
+        fieldIndices[field.asMemoryHandle()] = static_cast<uint32_t>(users.size());
+        users.push_back({ dataInstance, field });
+    }
+
+    void ResourceCachedScene::removeTextureSamplerUser(TextureSamplerHandle sampler, DataInstanceHandle dataInstance, DataFieldHandle field)
+    {
+        if (!sampler.isValid() || sampler.asMemoryHandle() >= m_dataInstancesUsingTextureSampler.size() || dataInstance.asMemoryHandle() >= m_textureSamplerUserIndices.size())
+            return;
+
+        auto& users = m_dataInstancesUsingTextureSampler[sampler.asMemoryHandle()];
+        auto& fieldIndices = m_textureSamplerUserIndices[dataInstance.asMemoryHandle()];
+        if (field.asMemoryHandle() >= fieldIndices.size())
+            return;
+        uint32_t& userIndex = fieldIndices[field.asMemoryHandle()];
+        if (userIndex >= users.size() || users[userIndex].dataInstance != dataInstance || users[userIndex].field != field)
+            return;
+
+        // order of users does not matter, last user takes place of removed one
+        const TextureSamplerUser& lastUser = users.back();
+        m_textureSamplerUserIndices[lastUser.dataInstance.asMemoryHandle()][lastUser.field.asMemoryHandle()] = userIndex;
+        users[userIndex] = lastUser;
+        users.pop_back();
+        userIndex = InvalidUserIndex;
+    }
+
     bool ResourceCachedScene::doesRenderableReferToDirtyUniforms(RenderableHandle handle) const
     {
         assert(isRenderableAllocated(handle));
@@ -557,16 +646,12 @@ namespace ramses_internal
 
     bool ResourceCachedScene::isDataInstanceDirty(DataInstanceHandle handle) const
     {
-        const uint32_t indexIntoCache = handle.asMemoryHandle();
-        assert(indexIntoCache < m_dataInstancesDirty.size());
-        return m_dataInstancesDirty[indexIntoCache];
+        return m_dataInstancesDirty.isDirty(handle);
     }
 
     bool ResourceCachedScene::isTextureSamplerDirty(TextureSamplerHandle handle) const
     {
-        const uint32_t indexIntoCache = handle.asMemoryHandle();
-        assert(indexIntoCache < m_textureSamplersDirty.size());
-        return m_textureSamplersDirty[indexIntoCache];
+        return m_textureSamplersDirty.isDirty(handle);
     }
 
     bool ResourceCachedScene::isGeometryDataLayout(const DataLayout& layout) const
@@ -593,9 +678,7 @@ namespace ramses_internal
 
     bool ResourceCachedScene::isRenderableVertexArrayDirty(RenderableHandle renderable) const
     {
-        const uint32_t indexIntoCache = renderable.asMemoryHandle();
-        assert(indexIntoCache < m_renderableVertexArrayDirty.size());
-        return m_renderableVertexArrayDirty[indexIntoCache];
+        return m_renderableVertexArrayDirty.isDirty(renderable);
     }
 
     void ResourceCachedScene::updateRenderableVertexArrays(const IResourceDeviceHandleAccessor& resourceAccessor, const RenderableVector& renderablesWithUpdatedVertexArrays)
@@ -603,12 +686,12 @@ namespace ramses_internal
         for (const auto renderableHandle : renderablesWithUpdatedVertexArrays)
         {
             const uint32_t renderableAsIndex = renderableHandle.asMemoryHandle();
-            assert(m_renderableVertexArrayDirty[renderableAsIndex]);
+            assert(m_renderableVertexArrayDirty.isDirty(renderableHandle));
 
             m_vertexArrayCache[renderableAsIndex].deviceHandle = {};
             if (!isRenderableAllocated(renderableHandle))
                 setRenderableVertexArrayDirtyFlag(renderableHandle, false);
-            else if (!m_renderableResourcesDirty[renderableAsIndex])
+            else if (!m_renderableResourcesDirty.isDirty(renderableHandle))
             {
                 assert(getRenderable(renderableHandle).visibilityMode != EVisibilityMode::Off);
                 const auto geometryInstance = getRenderable(renderableHandle).dataInstances[ERenderableDataSlotType_Geometry];
@@ -623,6 +706,7 @@ namespace ramses_internal
                 setRenderableVertexArrayDirtyFlag(renderableHandle, false);
             }
         }
+        m_renderableVertexArrayDirty.removeClean();
     }
 
     void ResourceCachedScene::markVertexArraysClean()
@@ -659,8 +743,8 @@ namespace ramses_internal
         const auto& renderables = getRenderables();
         for (const auto& renderableIt : renderables)
         {
-            m_renderableResourcesDirty[renderableIt.first.asMemoryHandle()] = true;
-            m_renderableVertexArrayDirty[renderableIt.first.asMemoryHandle()] = true;
+            m_renderableResourcesDirty.setDirty(renderableIt.first, true);
+            m_renderableVertexArrayDirty.setDirty(renderableIt.first, true);
         }
 
         std::fill(m_effectDeviceHandleCache.begin(), m_effectDeviceHandleCache.end(), DeviceResourceHandle::Invalid());
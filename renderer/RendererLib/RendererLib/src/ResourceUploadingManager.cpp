@@ -30,7 +30,8 @@ namespace ramses_internal
         AsyncEffectUploader& asyncEffectUploader,
         const DisplayConfig& displayConfig,
         const FrameTimer& frameTimer,
-        RendererStatistics& stats)
+        RendererStatistics& stats,
+        ParallelForExecutor* decompressionExecutor)
         : m_resources(resources)
         , m_uploader{ std::move(uploader) }
         , m_renderBackend(renderBackend)
@@ -41,6 +42,7 @@ namespace ramses_internal
         , m_resourceUploadBatchSize(displayConfig.getResourceUploadBatchSize())
         , m_stats(stats)
         , m_scenePriorities(displayConfig.getScenePriorities())
+        , m_decompressionExecutor(decompressionExecutor)
     {
         assert(m_uploader);
         assert(m_resourceUploadBatchSize > 0u);
@@ -183,7 +185,7 @@ namespace ramses_internal
 
         const IResource* pResource = rd.resource.get();
         // decompress resource if needed
-        pResource->decompress();
+        pResource->decompress(m_decompressionExecutor);
         assert(pResource->isDeCompressedAvailable());
 
         const uint32_t resourceSize = pResource->getDecompressedDataSize();
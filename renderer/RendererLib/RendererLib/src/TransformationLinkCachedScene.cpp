@@ -52,6 +52,12 @@ namespace ramses_internal
         SceneLinkScene::setTranslation(transform, translation);
     }
 
+    void TransformationLinkCachedScene::releaseTransform(TransformHandle transform)
+    {
+        m_pickingCache.markDirty();
+        SceneLinkScene::releaseTransform(transform);
+    }
+
     void TransformationLinkCachedScene::releaseDataSlot(DataSlotHandle handle)
     {
         const DataSlot& dataSlot = getDataSlot(handle);
@@ -63,8 +69,51 @@ namespace ramses_internal
         SceneLinkScene::releaseDataSlot(handle);
     }
 
+    PickableObjectHandle TransformationLinkCachedScene::allocatePickableObject(DataBufferHandle geometryHandle, NodeHandle nodeHandle, PickableObjectId id, PickableObjectHandle pickableHandle)
+    {
+        m_pickingCache.markDirty();
+        return SceneLinkScene::allocatePickableObject(geometryHandle, nodeHandle, id, pickableHandle);
+    }
+
+    void TransformationLinkCachedScene::releasePickableObject(PickableObjectHandle pickableHandle)
+    {
+        m_pickingCache.markDirty();
+        SceneLinkScene::releasePickableObject(pickableHandle);
+    }
+
+    void TransformationLinkCachedScene::setPickableObjectCamera(PickableObjectHandle pickableHandle, CameraHandle cameraHandle)
+    {
+        m_pickingCache.markDirty();
+        SceneLinkScene::setPickableObjectCamera(pickableHandle, cameraHandle);
+    }
+
+    void TransformationLinkCachedScene::setPickableObjectEnabled(PickableObjectHandle pickableHandle, bool isEnabled)
+    {
+        m_pickingCache.markDirty();
+        SceneLinkScene::setPickableObjectEnabled(pickableHandle, isEnabled);
+    }
+
+    void TransformationLinkCachedScene::releaseDataBuffer(DataBufferHandle handle)
+    {
+        m_pickingCache.markGeometryDirty(handle);
+        SceneLinkScene::releaseDataBuffer(handle);
+    }
+
+    void TransformationLinkCachedScene::updateDataBuffer(DataBufferHandle handle, uint32_t offsetInBytes, uint32_t dataSizeInBytes, const Byte* data)
+    {
+        m_pickingCache.markGeometryDirty(handle);
+        SceneLinkScene::updateDataBuffer(handle, offsetInBytes, dataSizeInBytes, data);
+    }
+
+    const PickingCache& TransformationLinkCachedScene::updatePickingCache() const
+    {
+        m_pickingCache.update(*this);
+        return m_pickingCache;
+    }
+
     void TransformationLinkCachedScene::propagateDirtyToConsumers(NodeHandle startNode) const
     {
+        m_pickingCache.markDirty();
         assert(m_dirtyPropagationTraversalBuffer.empty());
         m_dirtyPropagationTraversalBuffer.push_back(startNode);
 
@@ -78,7 +127,7 @@ namespace ramses_internal
 
             if (!wasDirty)
             {
-                const NodeHandleVector& children = getNode(node).children;
+                const auto children = getChildren(node);
                 m_dirtyPropagationTraversalBuffer.insert(m_dirtyPropagationTraversalBuffer.end(), children.cbegin(), children.cend());
             }
         }
@@ -105,6 +154,19 @@ namespace ramses_internal
         return chainMatrix;
     }
 
+    void TransformationLinkCachedScene::updateMatrixCacheWithLinksForNodes(ETransformationMatrixType matrixType, const NodeHandleVector& nodes, ParallelForExecutor* executor) const
+    {
+        if (!m_sceneLinksManager.getTransformationLinkManager().getDependencyChecker().hasDependencyAsConsumer(getSceneId()))
+        {
+            SceneLinkScene::updateMatrixCacheForNodes(matrixType, nodes, executor);
+            return;
+        }
+
+        // resolving a link updates matrix cache of provider scene, this cannot be done in parallel
+        for (const auto node : nodes)
+            std::ignore = updateMatrixCacheWithLinks(matrixType, node);
+    }
+
     void TransformationLinkCachedScene::getMatrixForNode(ETransformationMatrixType matrixType, NodeHandle node, glm::mat4& chainMatrix) const
     {
         if (m_sceneLinksManager.getTransformationLinkManager().nodeHasDataLinkToProvider(getSceneId(), node))
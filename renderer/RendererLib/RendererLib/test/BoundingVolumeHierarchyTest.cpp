@@ -0,0 +1,111 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/BoundingVolumeHierarchy.h"
+#include <set>
+#include <algorithm>
+
+namespace ramses_internal
+{
+    class ABoundingVolumeHierarchy : public ::testing::Test
+    {
+    protected:
+        ABoundingVolumeHierarchy()
+        {
+            // row of unit boxes along X axis with gaps between them, in shuffled order
+            std::vector<BoundingBox> boxes(PrimitiveCount);
+            for (uint32_t i = 0u; i < PrimitiveCount; ++i)
+                boxes[i] = GetBoxAtPosition((i * 7u) % PrimitiveCount);
+            bvh.build(std::move(boxes));
+        }
+
+        static BoundingBox GetBoxAtPosition(uint32_t position)
+        {
+            const float x = 2.f * static_cast<float>(position);
+            return { { x, 0.f, 0.f }, { x + 1.f, 1.f, 1.f } };
+        }
+
+        std::set<uint32_t> getPrimitivesHitByRay(const glm::vec3& rayOrigin, const glm::vec3& rayDir) const
+        {
+            std::set<uint32_t> primitives;
+            bvh.traverse(rayOrigin, rayDir, [&](uint32_t primitive, float& /*maxDistance*/)
+            {
+                EXPECT_TRUE(primitives.insert(primitive).second);
+            });
+            return primitives;
+        }
+
+        static constexpr uint32_t PrimitiveCount = 100u;
+        BoundingVolumeHierarchy bvh;
+    };
+
+    TEST_F(ABoundingVolumeHierarchy, isEmptyWithoutPrimitives)
+    {
+        BoundingVolumeHierarchy emptyBvh;
+        EXPECT_TRUE(emptyBvh.isEmpty());
+        emptyBvh.build({});
+        EXPECT_TRUE(emptyBvh.isEmpty());
+        EXPECT_EQ(0u, emptyBvh.getPrimitiveCount());
+        EXPECT_FALSE(emptyBvh.getBoundingBox().isValid());
+
+        emptyBvh.traverse({ 0.f, 0.f, 10.f }, { 0.f, 0.f, -1.f }, [](uint32_t /*primitive*/, float& /*maxDistance*/)
+        {
+            ADD_FAILURE();
+        });
+    }
+
+    TEST_F(ABoundingVolumeHierarchy, boundsAllPrimitives)
+    {
+        EXPECT_FALSE(bvh.isEmpty());
+        EXPECT_EQ(PrimitiveCount, bvh.getPrimitiveCount());
+        EXPECT_EQ(GetBoxAtPosition(7u), bvh.getPrimitiveBoundingBox(1u));
+        EXPECT_EQ(BoundingBox({ 0.f, 0.f, 0.f }, { 2.f * PrimitiveCount - 1.f, 1.f, 1.f }), bvh.getBoundingBox());
+    }
+
+    TEST_F(ABoundingVolumeHierarchy, visitsOnlyPrimitivesHitByRay)
+    {
+        // primitive 2 is at position 14
+        EXPECT_EQ(std::set<uint32_t>{ 2u }, getPrimitivesHitByRay({ 28.5f, 0.5f, 10.f }, { 0.f, 0.f, -1.f }));
+        EXPECT_EQ(std::set<uint32_t>{ 0u }, getPrimitivesHitByRay({ 0.5f, -10.f, 0.5f }, { 0.f, 1.f, 0.f }));
+        EXPECT_TRUE(getPrimitivesHitByRay({ 27.5f, 0.5f, 10.f }, { 0.f, 0.f, -1.f }).empty());
+        EXPECT_TRUE(getPrimitivesHitByRay({ 28.5f, 0.5f, 10.f }, { 0.f, 0.f, 1.f }).empty());
+        EXPECT_TRUE(getPrimitivesHitByRay({ -1.f, 2.f, 0.5f }, { 1.f, 0.f, 0.f }).empty());
+    }
+
+    TEST_F(ABoundingVolumeHierarchy, visitsAllPrimitivesAlongRay)
+    {
+        EXPECT_EQ(PrimitiveCount, getPrimitivesHitByRay({ -1.f, 0.5f, 0.5f }, { 1.f, 0.f, 0.f }).size());
+        EXPECT_EQ(PrimitiveCount / 2u, getPrimitivesHitByRay({ 99.5f, 0.5f, 0.5f }, { 1.f, 0.f, 0.f }).size());
+    }
+
+    TEST_F(ABoundingVolumeHierarchy, skipsPrimitivesFartherThanMaxDistanceSetByVisitor)
+    {
+        std::set<uint32_t> primitives;
+        bvh.traverse({ -1.f, 0.5f, 0.5f }, { 1.f, 0.f, 0.f }, [&](uint32_t primitive, float& maxDistance)
+        {
+            primitives.insert(primitive);
+            // nearest primitive ends at distance 2
+            maxDistance = std::min(maxDistance, 2.f);
+        });
+
+        EXPECT_EQ(1u, primitives.count(0u));
+        EXPECT_GE(BoundingVolumeHierarchy::MaxPrimitivesInLeaf, primitives.size());
+    }
+
+    TEST_F(ABoundingVolumeHierarchy, findsPrimitivesAfterRefit)
+    {
+        // move primitive 2 from position 14 above position 0
+        bvh.setPrimitiveBoundingBox(2u, { { 0.f, 5.f, 0.f }, { 1.f, 6.f, 1.f } });
+        bvh.refit();
+
+        EXPECT_TRUE(getPrimitivesHitByRay({ 28.5f, 0.5f, 10.f }, { 0.f, 0.f, -1.f }).empty());
+        EXPECT_EQ((std::set<uint32_t>{ 0u, 2u }), getPrimitivesHitByRay({ 0.5f, -10.f, 0.5f }, { 0.f, 1.f, 0.f }));
+        EXPECT_EQ(BoundingBox({ 0.f, 0.f, 0.f }, { 2.f * PrimitiveCount - 1.f, 6.f, 1.f }), bvh.getBoundingBox());
+    }
+}
@@ -0,0 +1,90 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/DirtyHandleTracker.h"
+#include "SceneAPI/Handles.h"
+
+namespace ramses_internal
+{
+    class ADirtyHandleTracker : public ::testing::Test
+    {
+    protected:
+        ADirtyHandleTracker()
+        {
+            tracker.resize(10u);
+        }
+
+        DirtyHandleTracker<RenderableHandle> tracker;
+    };
+
+    TEST_F(ADirtyHandleTracker, isInitiallyClean)
+    {
+        EXPECT_EQ(10u, tracker.size());
+        for (RenderableHandle handle(0u); handle < 10u; ++handle)
+            EXPECT_FALSE(tracker.isDirty(handle));
+        EXPECT_TRUE(tracker.getList().empty());
+    }
+
+    TEST_F(ADirtyHandleTracker, listsDirtyHandlesOnlyOnce)
+    {
+        tracker.setDirty(RenderableHandle{ 7u }, true);
+        tracker.setDirty(RenderableHandle{ 2u }, true);
+        tracker.setDirty(RenderableHandle{ 7u }, true);
+
+        EXPECT_TRUE(tracker.isDirty(RenderableHandle{ 2u }));
+        EXPECT_TRUE(tracker.isDirty(RenderableHandle{ 7u }));
+        EXPECT_TRUE(tracker.getFlags()[7u]);
+        EXPECT_EQ((std::vector<RenderableHandle>{ RenderableHandle{ 7u }, RenderableHandle{ 2u } }), tracker.getList());
+    }
+
+    TEST_F(ADirtyHandleTracker, keepsHandleMarkedCleanListedUntilRemoved)
+    {
+        tracker.setDirty(RenderableHandle{ 1u }, true);
+        tracker.setDirty(RenderableHandle{ 3u }, true);
+        tracker.setDirty(RenderableHandle{ 1u }, false);
+        EXPECT_FALSE(tracker.isDirty(RenderableHandle{ 1u }));
+        EXPECT_EQ(2u, tracker.getList().size());
+
+        // marking dirty again does not list it twice
+        tracker.setDirty(RenderableHandle{ 1u }, true);
+        tracker.setDirty(RenderableHandle{ 1u }, false);
+        EXPECT_EQ(2u, tracker.getList().size());
+
+        tracker.removeClean();
+        EXPECT_EQ((std::vector<RenderableHandle>{ RenderableHandle{ 3u } }), tracker.getList());
+
+        tracker.setDirty(RenderableHandle{ 1u }, true);
+        EXPECT_EQ((std::vector<RenderableHandle>{ RenderableHandle{ 3u }, RenderableHandle{ 1u } }), tracker.getList());
+    }
+
+    TEST_F(ADirtyHandleTracker, clearMarksAllClean)
+    {
+        tracker.setDirty(RenderableHandle{ 4u }, true);
+        tracker.setDirty(RenderableHandle{ 9u }, true);
+        tracker.clear();
+
+        EXPECT_FALSE(tracker.isDirty(RenderableHandle{ 4u }));
+        EXPECT_FALSE(tracker.isDirty(RenderableHandle{ 9u }));
+        EXPECT_TRUE(tracker.getList().empty());
+
+        tracker.setDirty(RenderableHandle{ 9u }, true);
+        EXPECT_EQ((std::vector<RenderableHandle>{ RenderableHandle{ 9u } }), tracker.getList());
+    }
+
+    TEST_F(ADirtyHandleTracker, keepsStateWhenGrowing)
+    {
+        tracker.setDirty(RenderableHandle{ 5u }, true);
+        tracker.resize(20u);
+
+        EXPECT_TRUE(tracker.isDirty(RenderableHandle{ 5u }));
+        EXPECT_FALSE(tracker.isDirty(RenderableHandle{ 15u }));
+        tracker.setDirty(RenderableHandle{ 15u }, true);
+        EXPECT_EQ((std::vector<RenderableHandle>{ RenderableHandle{ 5u }, RenderableHandle{ 15u } }), tracker.getList());
+    }
+}
@@ -43,6 +43,9 @@ TEST_F(AInternalDisplayConfig, hasDefaultValues)
     EXPECT_EQ(0, m_config.getScenePriority(ramses_internal::SceneId()));
     EXPECT_EQ(0, m_config.getScenePriority(ramses_internal::SceneId(15562)));
     EXPECT_EQ(10u, m_config.getResourceUploadBatchSize());
+    EXPECT_FALSE(m_config.isFrustumCullingEnabled());
+    EXPECT_EQ(0u, m_config.getSceneUpdateWorkerThreadCount());
+    EXPECT_FALSE(m_config.isAsyncFlushPreparationEnabled());
 }
 
 TEST_F(AInternalDisplayConfig, setAndGetValues)
@@ -123,6 +126,21 @@ TEST_F(AInternalDisplayConfig, setAndGetValues)
     m_config.setResourceUploadBatchSize(3);
     EXPECT_EQ(3u, m_config.getResourceUploadBatchSize());
 
+    m_config.setDrawCallBatchingEnabled(true);
+    EXPECT_TRUE(m_config.isDrawCallBatchingEnabled());
+
+    m_config.setAsyncFlushPreparationEnabled(true);
+    EXPECT_TRUE(m_config.isAsyncFlushPreparationEnabled());
+
+    m_config.setStateSortingEnabled(true);
+    EXPECT_TRUE(m_config.isStateSortingEnabled());
+
+    m_config.setFrustumCullingEnabled(true);
+    EXPECT_TRUE(m_config.isFrustumCullingEnabled());
+
+    m_config.setSceneUpdateWorkerThreadCount(4u);
+    EXPECT_EQ(4u, m_config.getSceneUpdateWorkerThreadCount());
+
     m_config.setScenePriority(ramses_internal::SceneId(15562), -1);
     EXPECT_EQ(-1, m_config.getScenePriority(ramses_internal::SceneId(15562)));
     EXPECT_EQ(0, m_config.getScenePriority(ramses_internal::SceneId(15562 + 1)));
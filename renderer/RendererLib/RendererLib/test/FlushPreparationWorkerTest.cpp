@@ -0,0 +1,118 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "RendererLib/FlushPreparationWorker.h"
+#include "Resource/ArrayResource.h"
+#include <vector>
+#include <memory>
+
+namespace ramses_internal
+{
+    class AFlushPreparationWorker : public ::testing::Test
+    {
+    protected:
+        static ManagedResource CreateCompressedResource(uint32_t seed)
+        {
+            std::vector<float> data(4096u);
+            for (size_t i = 0u; i < data.size(); ++i)
+                data[i] = static_cast<float>((i + seed) % 16u);
+
+            const ArrayResource source(EResourceType_VertexArray, static_cast<uint32_t>(data.size()), EDataType::Float, data.data(), ResourceCacheFlag_DoNotCache, {});
+            source.compress(IResource::CompressionLevel::Realtime);
+            EXPECT_TRUE(source.isCompressedAvailable());
+
+            auto resource = std::make_shared<ArrayResource>(EResourceType_VertexArray, 0u, EDataType::Float, nullptr, ResourceCacheFlag_DoNotCache, std::string_view{});
+            const auto& compressedData = source.getCompressedResourceData();
+            resource->setCompressedResourceData(CompressedResourceBlob(compressedData.size(), compressedData.data()),
+                IResource::CompressionLevel::Realtime, source.getDecompressedDataSize(), source.getHash());
+            return resource;
+        }
+
+        FlushPreparationWorker worker;
+    };
+
+    TEST_F(AFlushPreparationWorker, reportsInvalidTicketAsPrepared)
+    {
+        EXPECT_TRUE(worker.isPrepared(FlushPreparationWorker::InvalidTicket));
+        worker.waitUntilPrepared(FlushPreparationWorker::InvalidTicket);
+    }
+
+    TEST_F(AFlushPreparationWorker, decompressesResources)
+    {
+        const ManagedResourceVector resources{ CreateCompressedResource(1u), CreateCompressedResource(2u) };
+        for (const auto& resource : resources)
+            EXPECT_FALSE(resource->isDeCompressedAvailable());
+
+        const auto ticket = worker.prepare(resources);
+        EXPECT_NE(FlushPreparationWorker::InvalidTicket, ticket);
+        worker.waitUntilPrepared(ticket);
+        EXPECT_TRUE(worker.isPrepared(ticket));
+
+        for (const auto& resource : resources)
+            EXPECT_TRUE(resource->isDeCompressedAvailable());
+        const auto* floats = reinterpret_cast<const float*>(resources[1]->getResourceData().data());
+        EXPECT_FLOAT_EQ(2.f, floats[0]);
+        EXPECT_FLOAT_EQ(3.f, floats[1]);
+    }
+
+    TEST_F(AFlushPreparationWorker, preparesInOrderOfEnqueuing)
+    {
+        std::vector<uint64_t> tickets;
+        std::vector<ManagedResource> resources;
+        for (uint32_t i = 0u; i < 10u; ++i)
+        {
+            resources.push_back(CreateCompressedResource(i));
+            tickets.push_back(worker.prepare({ resources.back() }));
+        }
+
+        for (size_t i = 1u; i < tickets.size(); ++i)
+            EXPECT_LT(tickets[i - 1u], tickets[i]);
+
+        worker.waitUntilPrepared(tickets.back());
+        for (size_t i = 0u; i < tickets.size(); ++i)
+        {
+            EXPECT_TRUE(worker.isPrepared(tickets[i]));
+            EXPECT_TRUE(resources[i]->isDeCompressedAvailable());
+        }
+    }
+
+    TEST_F(AFlushPreparationWorker, returnsInvalidTicketIfThereIsNothingToDecompress)
+    {
+        const auto resource = CreateCompressedResource(1u);
+        resource->decompress();
+        EXPECT_EQ(FlushPreparationWorker::InvalidTicket, worker.prepare({}));
+        EXPECT_EQ(FlushPreparationWorker::InvalidTicket, worker.prepare({ resource }));
+    }
+
+    TEST_F(AFlushPreparationWorker, finishesNoPreparationWhileHeld)
+    {
+        worker.holdPreparations(true);
+        const auto resource = CreateCompressedResource(1u);
+        const auto ticket1 = worker.prepare({ resource });
+        const auto ticket2 = worker.prepare({});
+        EXPECT_NE(FlushPreparationWorker::InvalidTicket, ticket1);
+        EXPECT_NE(FlushPreparationWorker::InvalidTicket, ticket2);
+        EXPECT_FALSE(worker.isPrepared(ticket1));
+        EXPECT_FALSE(worker.isPrepared(ticket2));
+        EXPECT_FALSE(resource->isDeCompressedAvailable());
+
+        worker.holdPreparations(false);
+        worker.waitUntilPrepared(ticket2);
+        EXPECT_TRUE(worker.isPrepared(ticket1));
+        EXPECT_TRUE(resource->isDeCompressedAvailable());
+    }
+
+    TEST_F(AFlushPreparationWorker, canBeDestroyedWithPendingPreparations)
+    {
+        auto otherWorker = std::make_unique<FlushPreparationWorker>();
+        for (uint32_t i = 0u; i < 10u; ++i)
+            otherWorker->prepare({ CreateCompressedResource(i) });
+        otherWorker.reset();
+    }
+}
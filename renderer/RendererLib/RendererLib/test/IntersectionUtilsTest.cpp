@@ -578,3 +578,80 @@ TEST(IntersectionUtilsTest, handlesPickableViewportCorrectly)
     checkSceneForIntersectedPickableObjects(scene, coordsInNDSMissPickablesInTopLeft, dispResolution, {});
     checkSceneForIntersectedPickableObjects(scene, coordsInNDSMissPickablesInBottomRight, dispResolution, {});
 }
+
+TEST(IntersectionUtilsTest, findsPickedObjectAfterItsTransformationOrGeometryChanged)
+{
+    RendererEventCollector rendererEventCollector;
+    RendererScenes rendererScenes(rendererEventCollector);
+    TransformationLinkCachedScene scene(rendererScenes.getSceneLinksManager(), {});
+    SceneAllocateHelper sceneAllocator(scene);
+    const float vertexPositionsTriangle[] = { -1.f, -1.f, 0.f, 1.f, -1.f, 0.f, 0.f, 1.f, 0.f };
+    const glm::ivec2 dispResolution = { 1280, 480 };
+
+    const CameraHandle cameraHandle = preparePickableCamera(scene, sceneAllocator, { 0, 0 }, dispResolution, { 0.f, 0.f, 10.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+    const DataBufferHandle geometryBuffer = prepareGeometryBuffer(scene, sceneAllocator, vertexPositionsTriangle, sizeof(vertexPositionsTriangle));
+
+    const PickableObjectId pickableId(341u);
+    const NodeHandle pickableNodeHandle = sceneAllocator.allocateNode();
+    const PickableObjectHandle pickableHandle = sceneAllocator.allocatePickableObject(geometryBuffer, pickableNodeHandle, pickableId);
+    scene.setPickableObjectCamera(pickableHandle, cameraHandle);
+    const TransformHandle pickableTransformation = sceneAllocator.allocateTransform(pickableNodeHandle);
+
+    const glm::vec2 coordsInNDSCenter = { 0.f, 0.f };
+    checkSceneForIntersectedPickableObjects(scene, coordsInNDSCenter, dispResolution, { pickableId });
+
+    scene.setTranslation(pickableTransformation, { 5.f, 0.f, 0.f });
+    checkSceneForIntersectedPickableObjects(scene, coordsInNDSCenter, dispResolution, {});
+
+    // move triangle in model space so that it is in center again
+    const float vertexPositionsTriangleMoved[] = { -6.f, -1.f, 0.f, -4.f, -1.f, 0.f, -5.f, 1.f, 0.f };
+    scene.updateDataBuffer(geometryBuffer, 0, sizeof(vertexPositionsTriangleMoved), reinterpret_cast<const Byte*>(vertexPositionsTriangleMoved));
+    checkSceneForIntersectedPickableObjects(scene, coordsInNDSCenter, dispResolution, { pickableId });
+
+    scene.setPickableObjectEnabled(pickableHandle, false);
+    checkSceneForIntersectedPickableObjects(scene, coordsInNDSCenter, dispResolution, {});
+    scene.setPickableObjectEnabled(pickableHandle, true);
+    checkSceneForIntersectedPickableObjects(scene, coordsInNDSCenter, dispResolution, { pickableId });
+}
+
+TEST(IntersectionUtilsTest, findsPickedObjectsAmongManyPickablesWithManyTriangles)
+{
+    RendererEventCollector rendererEventCollector;
+    RendererScenes rendererScenes(rendererEventCollector);
+    TransformationLinkCachedScene scene(rendererScenes.getSceneLinksManager(), {});
+    SceneAllocateHelper sceneAllocator(scene);
+    const glm::ivec2 dispResolution = { 1280, 480 };
+
+    // grid of 10x10 quads of size 0.1, each made of two triangles, covering square [-0.5, 0.5]
+    std::vector<float> vertexPositionsGrid;
+    for (int y = 0; y < 10; ++y)
+    {
+        for (int x = 0; x < 10; ++x)
+        {
+            const float x0 = -0.5f + 0.1f * static_cast<float>(x);
+            const float y0 = -0.5f + 0.1f * static_cast<float>(y);
+            const float x1 = x0 + 0.1f;
+            const float y1 = y0 + 0.1f;
+            vertexPositionsGrid.insert(vertexPositionsGrid.end(), { x0, y0, 0.f, x1, y0, 0.f, x1, y1, 0.f });
+            vertexPositionsGrid.insert(vertexPositionsGrid.end(), { x0, y0, 0.f, x1, y1, 0.f, x0, y1, 0.f });
+        }
+    }
+
+    const CameraHandle cameraHandle = preparePickableCamera(scene, sceneAllocator, { 0, 0 }, dispResolution, { 0.f, 0.f, 30.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+    const DataBufferHandle geometryBuffer = prepareGeometryBuffer(scene, sceneAllocator, vertexPositionsGrid.data(), static_cast<uint32_t>(vertexPositionsGrid.size() * sizeof(float)));
+
+    // row of pickables with gaps between them, one of them in center and one right behind it
+    // (slightly offset so that picks do not hit exactly edges of triangles)
+    for (uint32_t i = 0u; i < 9u; ++i)
+        preparePickableObject(scene, sceneAllocator, geometryBuffer, cameraHandle, PickableObjectId{ i }, { 2.f * static_cast<float>(i) - 7.95f, 0.02f, 0.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+    const PickableObjectId pickableBehindId(100u);
+    preparePickableObject(scene, sceneAllocator, geometryBuffer, cameraHandle, pickableBehindId, { 0.05f, 0.02f, -1.f }, { 0.f, 0.f, 0.f }, { 1.f, 1.f, 1.f });
+
+    checkSceneForIntersectedPickableObjects(scene, { 0.f, 0.f }, dispResolution, { PickableObjectId{ 4u }, pickableBehindId });
+    checkSceneForIntersectedPickableObjects(scene, { 0.f, 0.2f }, dispResolution, {});
+
+    // pickable left of center in camera view
+    const auto projection = CameraMatrixHelper::ProjectionMatrix(ProjectionParams::Perspective(19.f, static_cast<float>(dispResolution.x) / static_cast<float>(dispResolution.y), 0.1f, 100.f));
+    const glm::vec4 pickableLeftInClipSpace = projection * glm::vec4{ -2.f, 0.f, -30.f, 1.f };
+    checkSceneForIntersectedPickableObjects(scene, { pickableLeftInClipSpace.x / pickableLeftInClipSpace.w, 0.f }, dispResolution, { PickableObjectId{ 3u } });
+}
@@ -108,11 +108,12 @@ MATCHER_P(TimeEq, expectedTime, "")
 class FakeEffectInputs
 {
 public:
-    explicit FakeEffectInputs(bool withTimeMs)
+    explicit FakeEffectInputs(bool withTimeMs, uint32_t modelMatrixElementCount = 1u)
+        : modelMatrixElementCount(modelMatrixElementCount)
     {
         uniformInputs.push_back(EffectInputInformation("dataRefField1", 1, EDataType::Float, EFixedSemantics::Invalid));
         dataRefField1 = DataFieldHandle(0);
-        uniformInputs.push_back(EffectInputInformation("fieldModelMatrix", 1, EDataType::Matrix44F, EFixedSemantics::ModelMatrix));
+        uniformInputs.push_back(EffectInputInformation("fieldModelMatrix", modelMatrixElementCount, EDataType::Matrix44F, EFixedSemantics::ModelMatrix));
         fieldModelMatrix = DataFieldHandle(1);
         uniformInputs.push_back(EffectInputInformation("fieldViewMatrix", 1, EDataType::Matrix44F, EFixedSemantics::ViewMatrix));
         fieldViewMatrix  = DataFieldHandle(2);
@@ -156,19 +157,20 @@ public:
     DataFieldHandle fieldModelMatrix;
     DataFieldHandle fieldViewMatrix;
     DataFieldHandle fieldProjMatrix;
+    uint32_t modelMatrixElementCount;
 };
 
 
 class ARenderExecutorBase: public ::testing::Test
 {
 public:
-    explicit ARenderExecutorBase(bool withTimeMs)
+    explicit ARenderExecutorBase(bool withTimeMs, uint32_t modelMatrixElementCount = 1u)
         : device(renderer.deviceMock)
         , renderContext{ DeviceMock::FakeFrameBufferRenderTargetDeviceHandle, fakeViewportWidth, fakeViewportHeight, {}, EClearFlags_All, glm::vec4{0.f}, false }
         , rendererScenes(rendererEventCollector)
         , scene(rendererScenes.createScene(SceneInfo()))
         , sceneAllocator(scene)
-        , fakeEffectInputs(withTimeMs)
+        , fakeEffectInputs(withTimeMs, modelMatrixElementCount)
         , indicesField(0u)
         , vertPosField(1u)
         , vertTexcoordField(2u)
@@ -449,7 +451,7 @@ protected:
         }
         EXPECT_CALL(device, activateVertexArray(_))                                                                               .InSequence(deviceSequence);
         EXPECT_CALL(device, setConstant(fakeEffectInputs.dataRefField1, 1, Matcher<const float*>(Pointee(Eq(0.1f)))))                                       .InSequence(deviceSequence);
-        EXPECT_CALL(device, setConstant(fieldModelMatrix, 1, Matcher<const glm::mat4*>(Pointee(PermissiveMatrixEq(expectedModelMatrix)))))                  .InSequence(deviceSequence);
+        EXPECT_CALL(device, setConstant(fieldModelMatrix, fakeEffectInputs.modelMatrixElementCount, Matcher<const glm::mat4*>(Pointee(PermissiveMatrixEq(expectedModelMatrix))))).InSequence(deviceSequence);
         EXPECT_CALL(device, setConstant(fieldViewMatrix, 1, Matcher<const glm::mat4*>(Pointee(PermissiveMatrixEq(expectedViewMatrix)))))                    .InSequence(deviceSequence);
         EXPECT_CALL(device, setConstant(fieldProjMatrix, 1, Matcher<const glm::mat4*>(Pointee(PermissiveMatrixEq(expectedProjMatrix)))))                    .InSequence(deviceSequence);
         EXPECT_CALL(device, activateTexture(FakeTextureDeviceHandle, textureField))                                                                         .InSequence(deviceSequence);
@@ -562,6 +564,25 @@ public:
     }
 };
 
+class ARenderExecutorWithModelMatrixArray : public ARenderExecutorBase
+{
+public:
+    ARenderExecutorWithModelMatrixArray()
+        : ARenderExecutorBase(false, ModelMatrixArraySize)
+    {
+    }
+
+protected:
+    // vertex attributes must not be instanced, otherwise renderables cannot be merged into instances of one draw call
+    void setVertexAttributesNotInstanced(const DataInstances& dataInstances)
+    {
+        scene.setDataResource(dataInstances.second, vertPosField, MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 17u, 77u);
+        scene.setDataResource(dataInstances.second, vertTexcoordField, MockResourceHash::VertArrayHash2, DataBufferHandle::Invalid(), 0u, 18u, 88u);
+    }
+
+    static constexpr uint32_t ModelMatrixArraySize = 3u;
+};
+
 TEST(CustomMatrixPrinter, PrintsMatrixValuesNotAByteString)
 {
     // see matrix_printer.h for more info if this test ever fails
@@ -963,6 +984,243 @@ TEST_F(ARenderExecutor, RenderStatesAppliedOnceIfSameForMultipleRenderables)
     Mock::VerifyAndClearExpectations(&device);
 }
 
+TEST_F(ARenderExecutor, CountsAvoidedStateChangesForRenderablesSharingStates)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle renderPass1 = createRenderPassWithCamera(projParams);
+    const RenderPassHandle renderPass2 = createRenderPassWithCamera(projParams);
+    const RenderableHandle renderable1 = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass1));
+    const RenderableHandle renderable2 = createTestRenderable(createTestDataInstance(), createRenderGroup(renderPass2));
+
+    updateScenes({ renderable1, renderable2 });
+
+    const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    expectActivateFramebufferRenderTarget();
+    expectClearRenderTarget();
+
+    expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+    expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+    RenderExecutor executor(device, renderContext);
+    std::ignore = executor.executeScene(scene);
+    Mock::VerifyAndClearExpectations(&device);
+
+    // shader and all 9 render states of second renderable are same as for first renderable
+    EXPECT_EQ(10u, executor.getAvoidedStateChangeCount());
+}
+
+TEST_F(ARenderExecutor, BatchesRenderablesWithContinuousIndexRangesIntoSingleDrawCallIfEnabled)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+    const RenderGroupHandle renderGroup = createRenderGroup(renderPass);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances);
+    scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+    scene.setRenderableIndexCount(renderable1, indexCount - 5u);
+    scene.setRenderableStartIndex(renderable2, startIndex + indexCount - 5u);
+    scene.setRenderableIndexCount(renderable2, 5u);
+    scene.addRenderableToRenderGroup(renderGroup, renderable1, 0);
+    scene.addRenderableToRenderGroup(renderGroup, renderable2, 1);
+    scene.setDrawCallBatchingEnabled(true);
+
+    updateScenes({ renderable1, renderable2 });
+
+    const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    expectActivateFramebufferRenderTarget();
+    expectClearRenderTarget();
+
+    // single draw call covering index ranges of both renderables
+    expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+}
+
+TEST_F(ARenderExecutor, DoesNotBatchRenderablesWithSameIndexRange)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+    const RenderGroupHandle renderGroup = createRenderGroup(renderPass);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances);
+    scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+    scene.addRenderableToRenderGroup(renderGroup, renderable1, 0);
+    scene.addRenderableToRenderGroup(renderGroup, renderable2, 1);
+    scene.setDrawCallBatchingEnabled(true);
+
+    updateScenes({ renderable1, renderable2 });
+
+    const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    expectActivateFramebufferRenderTarget();
+    expectClearRenderTarget();
+
+    expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+    expectFrameRenderCommands(renderable2, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+}
+
+TEST_F(ARenderExecutor, DoesNotBatchDifferentlyPlacedRenderablesIfModelMatrixIsNotArray)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+    const RenderGroupHandle renderGroup = createRenderGroup(renderPass);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances);
+    scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+    scene.setTranslation(addTransformToRenderable(renderable2), { 1.f, 0.f, 0.f });
+    scene.addRenderableToRenderGroup(renderGroup, renderable1, 0);
+    scene.addRenderableToRenderGroup(renderGroup, renderable2, 1);
+    scene.setDrawCallBatchingEnabled(true);
+
+    updateScenes({ renderable1, renderable2 });
+
+    const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    expectActivateFramebufferRenderTarget();
+    expectClearRenderTarget();
+
+    expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+    expectFrameRenderCommands(renderable2, glm::translate(glm::vec3(1.f, 0.f, 0.f)), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+}
+
+TEST_F(ARenderExecutorWithModelMatrixArray, BatchesDifferentlyPlacedRenderablesWithSameIndexRangeAsInstancesOfSingleDrawCall)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+    const RenderGroupHandle renderGroup = createRenderGroup(renderPass);
+    const DataInstances dataInstances = createTestDataInstance();
+    setVertexAttributesNotInstanced(dataInstances);
+
+    // list of items sharing geometry and appearance, each placed at other position
+    RenderableVector renderables;
+    for (int32_t i = 0; i < 3; ++i)
+    {
+        const RenderableHandle renderable = createTestRenderable(dataInstances);
+        if (!renderables.empty())
+            scene.setRenderableRenderState(renderable, scene.getRenderable(renderables.front()).renderState);
+        scene.setTranslation(addTransformToRenderable(renderable), { 0.f, static_cast<float>(i), 0.f });
+        scene.addRenderableToRenderGroup(renderGroup, renderable, i);
+        renderables.push_back(renderable);
+    }
+    scene.setDrawCallBatchingEnabled(true);
+
+    updateScenes(renderables);
+
+    const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    expectActivateFramebufferRenderTarget();
+    expectClearRenderTarget();
+
+    // single draw call with instance per item
+    expectFrameRenderCommands(renderables.front(), glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, true, EExpectedRenderStateChange::All, 3u);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+
+    // model matrix of each item is passed at its instance index
+    const glm::mat4* modelMatrices = scene.getDataMatrix44fArray(dataInstances.first, fieldModelMatrix);
+    for (uint32_t i = 0u; i < 3u; ++i)
+        EXPECT_THAT(modelMatrices[i], PermissiveMatrixEq(glm::translate(glm::vec3(0.f, static_cast<float>(i), 0.f))));
+}
+
+TEST_F(ARenderExecutorWithModelMatrixArray, DoesNotBatchDifferentlyPlacedRenderablesIfGeometryHasInstancedVertexAttributes)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+    const RenderGroupHandle renderGroup = createRenderGroup(renderPass);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable1 = createTestRenderable(dataInstances);
+    const RenderableHandle renderable2 = createTestRenderable(dataInstances);
+    scene.setRenderableRenderState(renderable2, scene.getRenderable(renderable1).renderState);
+    scene.setTranslation(addTransformToRenderable(renderable2), { 1.f, 0.f, 0.f });
+    scene.addRenderableToRenderGroup(renderGroup, renderable1, 0);
+    scene.addRenderableToRenderGroup(renderGroup, renderable2, 1);
+    scene.setDrawCallBatchingEnabled(true);
+
+    updateScenes({ renderable1, renderable2 });
+
+    const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    expectActivateFramebufferRenderTarget();
+    expectClearRenderTarget();
+
+    expectFrameRenderCommands(renderable1, glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix);
+    expectFrameRenderCommands(renderable2, glm::translate(glm::vec3(1.f, 0.f, 0.f)), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+}
+
+TEST_F(ARenderExecutorWithModelMatrixArray, StartsNewDrawCallIfInstancesExceedModelMatrixArraySize)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+    const RenderGroupHandle renderGroup = createRenderGroup(renderPass);
+    const DataInstances dataInstances = createTestDataInstance();
+    setVertexAttributesNotInstanced(dataInstances);
+
+    RenderableVector renderables;
+    for (int32_t i = 0; i < 5; ++i)
+    {
+        const RenderableHandle renderable = createTestRenderable(dataInstances);
+        if (!renderables.empty())
+            scene.setRenderableRenderState(renderable, scene.getRenderable(renderables.front()).renderState);
+        scene.setTranslation(addTransformToRenderable(renderable), { 0.f, static_cast<float>(i), 0.f });
+        scene.addRenderableToRenderGroup(renderGroup, renderable, i);
+        renderables.push_back(renderable);
+    }
+    scene.setDrawCallBatchingEnabled(true);
+
+    updateScenes(renderables);
+
+    const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    expectActivateFramebufferRenderTarget();
+    expectClearRenderTarget();
+
+    expectFrameRenderCommands(renderables[0], glm::identity<glm::mat4>(), glm::identity<glm::mat4>(), projMatrix, true, EExpectedRenderStateChange::All, ModelMatrixArraySize);
+    expectFrameRenderCommands(renderables[3], glm::translate(glm::vec3(0.f, 3.f, 0.f)), glm::identity<glm::mat4>(), projMatrix, false, EExpectedRenderStateChange::None, 2u);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+}
+
+TEST_F(ARenderExecutorWithModelMatrixArray, SetsOnlyFirstModelMatrixOfArrayForRenderableDrawnAlone)
+{
+    const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
+    const RenderPassHandle renderPass = createRenderPassWithCamera(projParams);
+    const RenderGroupHandle renderGroup = createRenderGroup(renderPass);
+    const DataInstances dataInstances = createTestDataInstance();
+    const RenderableHandle renderable = createTestRenderable(dataInstances);
+    scene.setTranslation(addTransformToRenderable(renderable), { 1.f, 0.f, 0.f });
+    scene.addRenderableToRenderGroup(renderGroup, renderable, 0);
+
+    const glm::mat4 otherMatrix = glm::translate(glm::vec3(0.f, 0.f, 5.f));
+    const std::vector<glm::mat4> otherMatrices(ModelMatrixArraySize, otherMatrix);
+    scene.setDataMatrix44fArray(dataInstances.first, fieldModelMatrix, ModelMatrixArraySize, otherMatrices.data());
+
+    updateScenes({ renderable });
+
+    const auto projMatrix = CameraMatrixHelper::ProjectionMatrix(projParams);
+    expectActivateFramebufferRenderTarget();
+    expectClearRenderTarget();
+
+    expectFrameRenderCommands(renderable, glm::translate(glm::vec3(1.f, 0.f, 0.f)), glm::identity<glm::mat4>(), projMatrix);
+
+    executeScene();
+    Mock::VerifyAndClearExpectations(&device);
+
+    // remaining elements of array are not touched
+    const glm::mat4* modelMatrices = scene.getDataMatrix44fArray(dataInstances.first, fieldModelMatrix);
+    for (uint32_t i = 1u; i < ModelMatrixArraySize; ++i)
+        EXPECT_THAT(modelMatrices[i], PermissiveMatrixEq(otherMatrix));
+}
+
 TEST_F(ARenderExecutor, RenderStatesAppliedForEachRenderableIfDifferent)
 {
     const auto projParams = getDefaultProjectionParams(ECameraProjectionType::Perspective);
@@ -11,6 +11,9 @@
 #include "RendererLib/RendererCachedScene.h"
 #include "RendererLib/RendererScenes.h"
 #include "RendererEventCollector.h"
+#include "Math3d/ProjectionParams.h"
+#include "SceneAPI/Camera.h"
+#include "TaskFramework/ParallelForExecutor.h"
 
 namespace ramses_internal
 {
@@ -35,6 +38,53 @@ namespace ramses_internal
                 EXPECT_EQ(r, orderedRenderables[i++]);
         }
 
+        RenderPassHandle createRenderPassWithPerspectiveCamera()
+        {
+            const auto params = ProjectionParams::Perspective(90.f, 1.f, 1.f, 100.f);
+            const RenderPassHandle pass = sceneAllocator.allocateRenderPass();
+            const auto dataLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference} }, {});
+            const auto dataInstance = sceneAllocator.allocateDataInstance(dataLayout);
+            const auto vpDataRefLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2I} }, {});
+            const auto frustumPlanesLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector4F} }, {});
+            const auto frustumPlanes = sceneAllocator.allocateDataInstance(frustumPlanesLayout);
+            const auto frustumNearFarLayout = sceneAllocator.allocateDataLayout({ DataFieldInfo{EDataType::Vector2F} }, {});
+            const auto frustumNearFar = sceneAllocator.allocateDataInstance(frustumNearFarLayout);
+            scene.setDataReference(dataInstance, Camera::ViewportOffsetField, sceneAllocator.allocateDataInstance(vpDataRefLayout));
+            scene.setDataReference(dataInstance, Camera::ViewportSizeField, sceneAllocator.allocateDataInstance(vpDataRefLayout));
+            scene.setDataReference(dataInstance, Camera::FrustumPlanesField, frustumPlanes);
+            scene.setDataReference(dataInstance, Camera::FrustumNearFarPlanesField, frustumNearFar);
+            scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { params.leftPlane, params.rightPlane, params.bottomPlane, params.topPlane });
+            scene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0 }, { params.nearPlane, params.farPlane });
+
+            const CameraHandle camera = sceneAllocator.allocateCamera(ECameraProjectionType::Perspective, sceneAllocator.allocateNode(), dataInstance);
+            scene.setRenderPassCamera(pass, camera);
+            return pass;
+        }
+
+        RenderableHandle createRenderableWithVertexArrayAt(RenderGroupHandle group, const glm::vec3& translation)
+        {
+            const RenderableHandle renderable = sceneHelper.createRenderable(group);
+            sceneHelper.createAndAssignVertexDataInstance(renderable);
+            sceneHelper.createAndAssignUniformDataInstance(renderable, sceneHelper.createTextureSamplerWithFakeTexture());
+            sceneHelper.setResourcesToRenderable(renderable);
+
+            const TransformHandle transform = sceneAllocator.allocateTransform(scene.getRenderable(renderable).node);
+            scene.setTranslation(transform, translation);
+            return renderable;
+        }
+
+        void updateFrustumCulling(const RenderableVector& renderablesWithUpdatedVertexArrays)
+        {
+            scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+            scene.updateRenderableVertexArrays(sceneHelper.resourceManager, renderablesWithUpdatedVertexArrays);
+            scene.updateRenderableBoundingBoxes(sceneHelper.resourceManager, renderablesWithUpdatedVertexArrays);
+            scene.markVertexArraysClean();
+            scene.updateRenderableWorldMatrices();
+            scene.updateFrustumCulling();
+        }
+
+        const BoundingBox unitBoundingBox{ glm::vec3(-1.f), glm::vec3(1.f) };
+
         RendererEventCollector rendererEventCollector;
         RendererScenes rendererScenes;
         RendererCachedScene& scene;
@@ -889,6 +939,187 @@ namespace ramses_internal
         expectOrderedRenderablesInPass(pass2, {});
     }
 
+    TEST_F(ARendererCachedScene, keepsOrderOfRenderablesWhenVisibilityToggledBetweenUpdates)
+    {
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        const RenderGroupHandle group = sceneAllocator.allocateRenderGroup();
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+
+        scene.addRenderableToRenderGroup(group, rend1, 1);
+        scene.addRenderableToRenderGroup(group, rend2, 5);
+        scene.addRenderableToRenderGroup(group, rend3, -3);
+        scene.addRenderGroupToRenderPass(pass, group, 0);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend3, rend1, rend2 });
+
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Invisible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend3, rend2 });
+
+        scene.setRenderableVisibility(rend3, EVisibilityMode::Off);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2 });
+
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Visible);
+        scene.setRenderableVisibility(rend3, EVisibilityMode::Visible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend3, rend1, rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, keepsOrderOfRenderablesInNestedGroupWhenVisibilityToggledBetweenUpdates)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderGroupToRenderGroup(group, nestedGroup, 1);
+        scene.addRenderableToRenderGroup(nestedGroup, rend2, 0);
+        scene.addRenderableToRenderGroup(nestedGroup, rend3, 1);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3 });
+
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Invisible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3 });
+
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Visible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, updatesOnlyRenderableWithChangedVisibilityInVisibleRenderablesOfPass)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group1 = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle group2 = sceneAllocator.allocateRenderGroup();
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        // rend2 is contained in pass twice
+        scene.addRenderableToRenderGroup(group1, rend1, 0);
+        scene.addRenderableToRenderGroup(group1, rend2, 1);
+        scene.addRenderableToRenderGroup(group2, rend2, 0);
+        scene.addRenderableToRenderGroup(group2, rend3, 1);
+        scene.addRenderGroupToRenderPass(pass, group2, 1);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend2, rend3 });
+
+        // visible renderables are updated right away without filtering whole pass in next update
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Invisible);
+        expectOrderedRenderablesInPass(pass, { rend2, rend2, rend3 });
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Off);
+        expectOrderedRenderablesInPass(pass, { rend3 });
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Visible);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3 });
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Invisible);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3 });
+        scene.setRenderableVisibility(rend2, EVisibilityMode::Visible);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend2, rend3 });
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend2, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, filtersVisibleRenderablesOfPassWhenItGetsRenderedAfterVisibilityChangedWhileNotRendered)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderableToRenderGroup(group, rend2, 1);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+
+        scene.setRenderPassEnabled(pass, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Off);
+        expectOrderedRenderablesInPass(pass, {});
+
+        scene.setRenderPassEnabled(pass, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, updatesOrderOfRenderablesWhenRenderableAddedToNestedGroupBetweenUpdates)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderGroupHandle nestedGroup = sceneAllocator.allocateRenderGroup();
+        const RenderGroupHandle nestedNestedGroup = sceneAllocator.allocateRenderGroup();
+        const RenderableHandle rend1 = sceneHelper.createRenderable();
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend1, 0);
+        scene.addRenderGroupToRenderGroup(group, nestedGroup, 1);
+        scene.addRenderGroupToRenderGroup(nestedGroup, nestedNestedGroup, 0);
+        scene.addRenderableToRenderGroup(nestedNestedGroup, rend2, 0);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2 });
+
+        scene.addRenderableToRenderGroup(nestedNestedGroup, rend3, -1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3, rend2 });
+
+        scene.removeRenderGroupFromRenderGroup(group, nestedGroup);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1 });
+    }
+
+    TEST_F(ARendererCachedScene, updatesRenderablesOfModifiedPassAndKeepsRenderablesOfOtherPass)
+    {
+        const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
+        const RenderPassHandle pass2 = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group1 = sceneHelper.createRenderGroup(pass1);
+        const RenderGroupHandle group2 = sceneHelper.createRenderGroup(pass2);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group1);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group2);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass1, { rend1 });
+        expectOrderedRenderablesInPass(pass2, { rend2 });
+
+        const RenderableHandle rend3 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group1, rend3, -1);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass1, { rend3, rend1 });
+        expectOrderedRenderablesInPass(pass2, { rend2 });
+    }
+
+    TEST_F(ARendererCachedScene, updatesRenderablesOfPassModifiedWhileDisabledWhenReenabled)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1 });
+
+        scene.setRenderPassEnabled(pass, false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(scene.getOrderedRenderablesForPass(pass).empty());
+
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        scene.addRenderableToRenderGroup(group, rend2, -1);
+        scene.setRenderableVisibility(rend1, EVisibilityMode::Invisible);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        EXPECT_TRUE(scene.getOrderedRenderablesForPass(pass).empty());
+
+        scene.setRenderPassEnabled(pass, true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2 });
+    }
+
     TEST_F(ARendererCachedScene, ordersRenderablesWithSameEffectTogether)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -1055,6 +1286,89 @@ namespace ramses_internal
         expectOrderedRenderablesInPass(pass, { rend1, rend3, rend5, rend6, rend2, rend4 });
     }
 
+    TEST_F(ARendererCachedScene, ordersRenderablesWithSameEffectByTextureSamplersIfStateSortingEnabled)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend4 = sceneHelper.createRenderable(group);
+
+        const TextureSamplerHandle sampler1 = sceneHelper.createTextureSamplerWithFakeTexture();
+        const TextureSamplerHandle sampler2 = sceneHelper.createTextureSamplerWithFakeTexture();
+        for (const auto rend : { rend1, rend2, rend3, rend4 })
+            sceneHelper.createAndAssignVertexDataInstance(rend);
+        sceneHelper.createAndAssignUniformDataInstance(rend1, sampler1);
+        sceneHelper.createAndAssignUniformDataInstance(rend2, sampler2);
+        sceneHelper.createAndAssignUniformDataInstance(rend3, sampler1);
+        sceneHelper.createAndAssignUniformDataInstance(rend4, sampler2);
+
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3, rend4 });
+
+        scene.setStateSortingEnabled(true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3, rend2, rend4 });
+
+        scene.setStateSortingEnabled(false);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend2, rend3, rend4 });
+    }
+
+    TEST_F(ARendererCachedScene, ordersRenderablesWithSameEffectAndTextureSamplersByRenderStateIfStateSortingEnabled)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend4 = sceneHelper.createRenderable(group);
+
+        const RenderStateHandle state1 = sceneAllocator.allocateRenderState();
+        const RenderStateHandle state2 = sceneAllocator.allocateRenderState();
+        scene.setRenderableRenderState(rend1, state2);
+        scene.setRenderableRenderState(rend2, state1);
+        scene.setRenderableRenderState(rend3, state2);
+        scene.setRenderableRenderState(rend4, state1);
+
+        const TextureSamplerHandle sampler = sceneHelper.createTextureSamplerWithFakeTexture();
+        for (const auto rend : { rend1, rend2, rend3, rend4 })
+        {
+            sceneHelper.createAndAssignVertexDataInstance(rend);
+            sceneHelper.createAndAssignUniformDataInstance(rend, sampler);
+        }
+
+        scene.setStateSortingEnabled(true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend2, rend4, rend1, rend3 });
+    }
+
+    TEST_F(ARendererCachedScene, explicitOrderingOverridesStateSorting)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+
+        const RenderableHandle rend1 = sceneHelper.createRenderable(group);
+        const RenderableHandle rend2 = sceneHelper.createRenderable();
+        const RenderableHandle rend3 = sceneHelper.createRenderable(group);
+        scene.addRenderableToRenderGroup(group, rend2, 1);
+
+        const TextureSamplerHandle sampler1 = sceneHelper.createTextureSamplerWithFakeTexture();
+        const TextureSamplerHandle sampler2 = sceneHelper.createTextureSamplerWithFakeTexture();
+        for (const auto rend : { rend1, rend2, rend3 })
+            sceneHelper.createAndAssignVertexDataInstance(rend);
+        sceneHelper.createAndAssignUniformDataInstance(rend1, sampler1);
+        sceneHelper.createAndAssignUniformDataInstance(rend2, sampler1);
+        sceneHelper.createAndAssignUniformDataInstance(rend3, sampler2);
+
+        scene.setStateSortingEnabled(true);
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        expectOrderedRenderablesInPass(pass, { rend1, rend3, rend2 });
+    }
+
     TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderable)
     {
         const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
@@ -1097,6 +1411,34 @@ namespace ramses_internal
         EXPECT_EQ(expectedWorldMatrix, cachedWorldMatrix);
     }
 
+    TEST_F(ARendererCachedScene, updatesWorldMatrixCacheForRenderablesUsingWorkerThreads)
+    {
+        const RenderPassHandle pass = sceneHelper.createRenderPassWithCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const NodeHandle rootNode = sceneAllocator.allocateNode();
+        scene.setTranslation(sceneAllocator.allocateTransform(rootNode), glm::vec3(1, 2, 3));
+
+        RenderableVector renderables;
+        for (uint32_t i = 0u; i < 1000u; ++i)
+        {
+            const RenderableHandle rend = sceneHelper.createRenderable(group);
+            const NodeHandle rendNode = scene.getRenderable(rend).node;
+            scene.addChildToNode(rootNode, rendNode);
+            scene.setScaling(sceneAllocator.allocateTransform(rendNode), glm::vec3(float(i)));
+            renderables.push_back(rend);
+        }
+
+        ParallelForExecutor executor{ 3u };
+        scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
+        scene.updateRenderableWorldMatrices(&executor);
+
+        for (const auto rend : renderables)
+        {
+            const auto expectedWorldMatrix = scene.updateMatrixCache(ETransformationMatrixType_World, scene.getRenderable(rend).node);
+            EXPECT_EQ(expectedWorldMatrix, scene.getRenderableWorldMatrix(rend));
+        }
+    }
+
     TEST_F(ARendererCachedScene, CanSortPassesWithRenderOrder_RenderPasses)
     {
         const RenderPassHandle pass1 = sceneHelper.createRenderPassWithCamera();
@@ -1435,4 +1777,137 @@ namespace ramses_internal
         scene.updateRenderablesAndResourceCache(sceneHelper.resourceManager);
         EXPECT_TRUE(orderedPasses.empty());
     }
+
+    TEST_F(ARendererCachedScene, doesNotCullRenderablesIfFrustumCullingDisabled)
+    {
+        const RenderPassHandle pass = createRenderPassWithPerspectiveCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rendInFront = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, -10.f });
+        const RenderableHandle rendBehind = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, 10.f });
+
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingBox(_)).Times(0);
+        updateFrustumCulling({ rendInFront, rendBehind });
+
+        EXPECT_FALSE(scene.isFrustumCullingEnabled());
+        expectOrderedRenderablesInPass(pass, { rendInFront, rendBehind });
+    }
+
+    TEST_F(ARendererCachedScene, cullsRenderablesOutsideOfCameraFrustum)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const RenderPassHandle pass = createRenderPassWithPerspectiveCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rendInFront = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, -10.f });
+        const RenderableHandle rendBehind = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, 10.f });
+        const RenderableHandle rendAside = createRenderableWithVertexArrayAt(group, { 50.f, 0.f, -10.f });
+        const RenderableHandle rendTooFar = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, -200.f });
+        const RenderableHandle rendIntersectingNearPlane = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, -1.5f });
+
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingBox(MockResourceHash::VertArrayHash)).WillRepeatedly(Return(unitBoundingBox));
+        updateFrustumCulling({ rendInFront, rendBehind, rendAside, rendTooFar, rendIntersectingNearPlane });
+
+        EXPECT_EQ(unitBoundingBox, scene.getRenderableBoundingBox(rendInFront));
+        expectOrderedRenderablesInPass(pass, { rendInFront, rendIntersectingNearPlane });
+    }
+
+    TEST_F(ARendererCachedScene, updatesCulledRenderablesWhenRenderableMovesIntoCameraFrustum)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const RenderPassHandle pass = createRenderPassWithPerspectiveCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, 10.f });
+        const NodeHandle parentNode = sceneAllocator.allocateNode();
+        const TransformHandle parentTransform = sceneAllocator.allocateTransform(parentNode);
+        scene.addChildToNode(parentNode, scene.getRenderable(rend).node);
+
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingBox(MockResourceHash::VertArrayHash)).WillRepeatedly(Return(unitBoundingBox));
+        updateFrustumCulling({ rend });
+        expectOrderedRenderablesInPass(pass, {});
+
+        scene.setTranslation(parentTransform, { 0.f, 0.f, -20.f });
+        updateFrustumCulling({});
+        expectOrderedRenderablesInPass(pass, { rend });
+    }
+
+    TEST_F(ARendererCachedScene, updatesCulledRenderablesWhenCameraMoves)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const RenderPassHandle pass = createRenderPassWithPerspectiveCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rendInFront = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, -10.f });
+        const RenderableHandle rendBehind = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, 10.f });
+        const TransformHandle cameraTransform = sceneAllocator.allocateTransform(scene.getCamera(scene.getRenderPass(pass).camera).node);
+
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingBox(MockResourceHash::VertArrayHash)).WillRepeatedly(Return(unitBoundingBox));
+        updateFrustumCulling({ rendInFront, rendBehind });
+        expectOrderedRenderablesInPass(pass, { rendInFront });
+
+        // nothing changed, culling result kept
+        updateFrustumCulling({});
+        expectOrderedRenderablesInPass(pass, { rendInFront });
+
+        scene.setTranslation(cameraTransform, { 0.f, 0.f, 20.f });
+        updateFrustumCulling({});
+        expectOrderedRenderablesInPass(pass, { rendInFront, rendBehind });
+    }
+
+    TEST_F(ARendererCachedScene, updatesCulledRenderablesWhenRenderableBecomesInstanced)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const RenderPassHandle pass = createRenderPassWithPerspectiveCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, 10.f });
+
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingBox(MockResourceHash::VertArrayHash)).WillRepeatedly(Return(unitBoundingBox));
+        updateFrustumCulling({ rend });
+        expectOrderedRenderablesInPass(pass, {});
+
+        scene.setRenderableInstanceCount(rend, 2u);
+        updateFrustumCulling({});
+        expectOrderedRenderablesInPass(pass, { rend });
+    }
+
+    TEST_F(ARendererCachedScene, neverCullsRenderableWithoutValidBoundingBox)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const RenderPassHandle pass = createRenderPassWithPerspectiveCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, 10.f });
+
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingBox(MockResourceHash::VertArrayHash)).WillRepeatedly(Return(BoundingBox{}));
+        updateFrustumCulling({ rend });
+
+        EXPECT_FALSE(scene.getRenderableBoundingBox(rend).isValid());
+        expectOrderedRenderablesInPass(pass, { rend });
+    }
+
+    TEST_F(ARendererCachedScene, neverCullsInstancedRenderable)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const RenderPassHandle pass = createRenderPassWithPerspectiveCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, 10.f });
+        scene.setRenderableInstanceCount(rend, 2u);
+
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingBox(MockResourceHash::VertArrayHash)).WillRepeatedly(Return(unitBoundingBox));
+        updateFrustumCulling({ rend });
+
+        expectOrderedRenderablesInPass(pass, { rend });
+    }
+
+    TEST_F(ARendererCachedScene, neverCullsRenderableUsingVertexDataBuffer)
+    {
+        scene.setFrustumCullingEnabled(true);
+        const RenderPassHandle pass = createRenderPassWithPerspectiveCamera();
+        const RenderGroupHandle group = sceneHelper.createRenderGroup(pass);
+        const RenderableHandle rend = createRenderableWithVertexArrayAt(group, { 0.f, 0.f, 10.f });
+        const DataBufferHandle vertexDataBuffer = sceneAllocator.allocateDataBuffer(EDataBufferType::VertexBuffer, EDataType::Vector3Buffer, sizeof(float) * 3);
+        scene.setDataResource(scene.getRenderable(rend).dataInstances[ERenderableDataSlotType_Geometry], sceneHelper.vertAttribField, ResourceContentHash::Invalid(), vertexDataBuffer, 0u, 0u, 0u);
+        ON_CALL(sceneHelper.resourceManager, getDataBufferDeviceHandle(vertexDataBuffer, _)).WillByDefault(Return(DeviceMock::FakeVertexBufferDeviceHandle));
+
+        EXPECT_CALL(sceneHelper.resourceManager, getResourceBoundingBox(_)).Times(0);
+        updateFrustumCulling({ rend });
+
+        expectOrderedRenderablesInPass(pass, { rend });
+    }
 }
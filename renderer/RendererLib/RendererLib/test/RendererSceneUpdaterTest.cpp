@@ -5216,4 +5216,150 @@ TEST_F(ARendererSceneUpdater, queuesAndPropagatesSceneReferenceActionsFromMultip
     update();
 }
 
+TEST_F(ARendererSceneUpdater, updatesAllRenderedScenesWhenDistributedToSceneUpdateWorkerThreads)
+{
+    DisplayConfig displayConfig;
+    displayConfig.setSceneUpdateWorkerThreadCount(2u);
+    createDisplayAndExpectSuccess(displayConfig);
+
+    constexpr uint32_t NumScenes = 3u;
+    for (uint32_t i = 0u; i < NumScenes; ++i)
+    {
+        createPublishAndSubscribeScene();
+        mapScene(i);
+        showScene(i);
+
+        expectResourcesReferencedAndProvided({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash }, i);
+        createRenderable(i);
+        setRenderableResources(i);
+        expectModifiedScenesReportedToRenderer({ i });
+        expectVertexArrayUploaded(i);
+        update();
+        expectRenderableResourcesClean(i);
+    }
+
+    for (uint32_t i = 0u; i < NumScenes; ++i)
+    {
+        IScene& scene = *stagingScene[i];
+        const TransformHandle transform = scene.allocateTransform(NodeHandle(1u));
+        scene.setTranslation(transform, { static_cast<float>(i + 1u), 0.f, 0.f });
+        performFlush(i);
+    }
+    expectModifiedScenesReportedToRenderer({ 0u, 1u, 2u });
+    update();
+
+    for (uint32_t i = 0u; i < NumScenes; ++i)
+    {
+        expectRenderableResourcesClean(i);
+        const auto& worldMatrix = rendererScenes.getScene(getSceneId(i)).getRenderableWorldMatrix(renderableHandle);
+        EXPECT_FLOAT_EQ(static_cast<float>(i + 1u), worldMatrix[3][0]);
+    }
+
+    for (uint32_t i = 0u; i < NumScenes; ++i)
+    {
+        hideScene(i);
+        unmapScene(i);
+    }
+    destroyDisplay();
+}
+
+
+TEST_F(ARendererSceneUpdater, cullsConsumerScenesWithCamerasLinkedToSameProviderWhenDistributedToSceneUpdateWorkerThreads)
+{
+    DisplayConfig displayConfig;
+    displayConfig.setSceneUpdateWorkerThreadCount(2u);
+    displayConfig.setFrustumCullingEnabled(true);
+    createDisplayAndExpectSuccess(displayConfig);
+    ON_CALL(*rendererSceneUpdater->m_resourceManagerMock, getResourceBoundingBox(MockResourceHash::VertArrayHash)).WillByDefault(Return(BoundingBox{ glm::vec3(-1.f), glm::vec3(1.f) }));
+
+    // scene 0 provides transformation to cameras of consumer scenes 1 and 2
+    constexpr uint32_t NumScenes = 3u;
+    for (uint32_t i = 0u; i < NumScenes; ++i)
+    {
+        createPublishAndSubscribeScene();
+        mapScene(i);
+        showScene(i);
+    }
+
+    IScene& providerScene = *stagingScene[0u];
+    const NodeHandle providerNode = providerScene.allocateNode();
+    const TransformHandle providerTransform = providerScene.allocateTransform(providerNode);
+    const DataSlotId providerId(getNextFreeDataSlotIdForDataLinking());
+    providerScene.allocateDataSlot({ EDataSlotType_TransformationProvider, providerId, providerNode, {}, ResourceContentHash::Invalid(), TextureSamplerHandle() });
+    performFlush(0u);
+    update();
+    expectSceneEvent(ERendererEventType::SceneDataSlotProviderCreated);
+
+    std::vector<DataSlotId> consumerIds;
+    for (uint32_t i = 1u; i < NumScenes; ++i)
+    {
+        expectResourcesReferencedAndProvided({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash, MockResourceHash::VertArrayHash }, i);
+        createRenderable(i, true);
+        setRenderableResources(i);
+
+        IScene& scene = *stagingScene[i];
+        scene.setDataResource(geometryDataInstanceHandle, DataFieldHandle(1u), MockResourceHash::VertArrayHash, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.setTranslation(scene.allocateTransform(NodeHandle(1u)), { 0.f, 0.f, -5.f });
+
+        // perspective camera looking at renderable, placed by provider scene
+        const NodeHandle cameraNode = scene.allocateNode();
+        scene.allocateTransform(cameraNode);
+        const auto dataLayout = scene.allocateDataLayout({ DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference}, DataFieldInfo{EDataType::DataReference} }, {});
+        const auto dataInstance = scene.allocateDataInstance(dataLayout);
+        const auto vec2iLayout = scene.allocateDataLayout({ DataFieldInfo{EDataType::Vector2I} }, {});
+        const auto vpOffsetInstance = scene.allocateDataInstance(vec2iLayout);
+        const auto vpSizeInstance = scene.allocateDataInstance(vec2iLayout);
+        const auto frustumPlanes = scene.allocateDataInstance(scene.allocateDataLayout({ DataFieldInfo{EDataType::Vector4F} }, {}));
+        const auto frustumNearFar = scene.allocateDataInstance(scene.allocateDataLayout({ DataFieldInfo{EDataType::Vector2F} }, {}));
+        scene.setDataReference(dataInstance, Camera::ViewportOffsetField, vpOffsetInstance);
+        scene.setDataReference(dataInstance, Camera::ViewportSizeField, vpSizeInstance);
+        scene.setDataReference(dataInstance, Camera::FrustumPlanesField, frustumPlanes);
+        scene.setDataReference(dataInstance, Camera::FrustumNearFarPlanesField, frustumNearFar);
+        scene.setDataSingleVector2i(vpSizeInstance, DataFieldHandle{ 0 }, { 16, 16 });
+        scene.setDataSingleVector4f(frustumPlanes, DataFieldHandle{ 0 }, { -1.f, 1.f, -1.f, 1.f });
+        scene.setDataSingleVector2f(frustumNearFar, DataFieldHandle{ 0 }, { 1.f, 100.f });
+        scene.setRenderPassCamera(RenderPassHandle(2u), scene.allocateCamera(ECameraProjectionType::Perspective, cameraNode, dataInstance));
+
+        const DataSlotId consumerId(getNextFreeDataSlotIdForDataLinking());
+        scene.allocateDataSlot({ EDataSlotType_TransformationConsumer, consumerId, cameraNode, {}, ResourceContentHash::Invalid(), TextureSamplerHandle() });
+        performFlush(i);
+        expectModifiedScenesReportedToRenderer({ i });
+        expectVertexArrayUploaded(i);
+        update();
+        expectRenderableResourcesClean(i);
+        expectSceneEvent(ERendererEventType::SceneDataSlotConsumerCreated);
+        consumerIds.push_back(consumerId);
+    }
+
+    for (uint32_t i = 1u; i < NumScenes; ++i)
+        linkProviderToConsumer(getSceneId(0u), providerId, getSceneId(i), consumerIds[i - 1u]);
+    expectModifiedScenesReportedToRenderer({ 1u, 2u });
+    update();
+    for (uint32_t i = 1u; i < NumScenes; ++i)
+    {
+        const RenderableVector& renderables = rendererScenes.getScene(getSceneId(i)).getOrderedRenderablesForPass(RenderPassHandle(2u));
+        EXPECT_EQ(RenderableVector{ renderableHandle }, renderables);
+    }
+
+    // moving provider moves both linked cameras away from their renderables
+    providerScene.setTranslation(providerTransform, { 100.f, 0.f, 0.f });
+    performFlush(0u);
+    expectModifiedScenesReportedToRenderer({ 0u, 1u, 2u });
+    update();
+    for (uint32_t i = 1u; i < NumScenes; ++i)
+    {
+        const RendererCachedScene& scene = rendererScenes.getScene(getSceneId(i));
+        EXPECT_TRUE(scene.getOrderedRenderablesForPass(RenderPassHandle(2u)).empty());
+        const auto& cameraWorldMatrix = scene.updateMatrixCacheWithLinks(ETransformationMatrixType_World, scene.getCamera(scene.getRenderPass(RenderPassHandle(2u)).camera).node);
+        EXPECT_FLOAT_EQ(100.f, cameraWorldMatrix[3][0]);
+    }
+
+    for (uint32_t i = 0u; i < NumScenes; ++i)
+    {
+        hideScene(i);
+        unmapScene(i);
+    }
+    destroyDisplay();
+}
+
 }
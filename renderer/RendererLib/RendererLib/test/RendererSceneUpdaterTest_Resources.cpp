@@ -167,6 +167,45 @@ TEST_F(ARendererSceneUpdater, sameResourceComingFromMultipleScenesIsReferencedAn
     destroyDisplay();
 }
 
+TEST_F(ARendererSceneUpdater, flushWithResourcesUploadedForOtherSceneIsNotAppliedBeforeItIsPreparedAndReferencesThem)
+{
+    DisplayConfig displayConfig;
+    displayConfig.setAsyncFlushPreparationEnabled(true);
+    createDisplayAndExpectSuccess(displayConfig);
+    const auto s1 = createPublishAndSubscribeScene();
+    const auto s2 = createPublishAndSubscribeScene();
+    mapScene(s1);
+    mapScene(s2);
+
+    expectResourcesReferencedAndProvided({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash }, s1);
+    createRenderable(s1);
+    setRenderableResources(s1);
+    update();
+    EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(s1));
+    EXPECT_EQ(1, getResourceRefCount(MockResourceHash::EffectHash));
+    EXPECT_EQ(1, getResourceRefCount(MockResourceHash::IndexArrayHash));
+
+    // resources are uploaded already because of s1 but s2 did not reference them yet
+    rendererSceneUpdater->holdFlushPreparations(true);
+    createRenderable(s2);
+    setRenderableResources(s2);
+    update();
+    EXPECT_FALSE(lastFlushWasAppliedOnRendererScene(s2));
+    EXPECT_EQ(1, getResourceRefCount(MockResourceHash::EffectHash));
+    EXPECT_EQ(1, getResourceRefCount(MockResourceHash::IndexArrayHash));
+
+    rendererSceneUpdater->holdFlushPreparations(false);
+    expectResourcesReferencedAndProvided({ MockResourceHash::EffectHash, MockResourceHash::IndexArrayHash }, s2);
+    update();
+    EXPECT_TRUE(lastFlushWasAppliedOnRendererScene(s2));
+    EXPECT_EQ(2, getResourceRefCount(MockResourceHash::EffectHash));
+    EXPECT_EQ(2, getResourceRefCount(MockResourceHash::IndexArrayHash));
+
+    unmapScene(s1);
+    unmapScene(s2);
+    destroyDisplay();
+}
+
 TEST_F(ARendererSceneUpdater, sameResourceComingFromMultipleScenesIsUnreferencedWhenSceneUnmappedOrUnpublished)
 {
     createDisplayAndExpectSuccess();
@@ -49,6 +49,20 @@ TEST_F(ARendererStatistics, tracksDrawCallsPerFrame)
     EXPECT_EQ(3u, stats.getDrawCallsPerFrame());
 }
 
+TEST_F(ARendererStatistics, tracksAvoidedStateChangesPerFrame)
+{
+    stats.frameFinished(0u, 10u);
+    stats.frameFinished(0u, 20u);
+    EXPECT_EQ(15u, stats.getAvoidedStateChangesPerFrame());
+    EXPECT_EQ(0u, stats.getDrawCallsPerFrame());
+
+    stats.reset();
+    EXPECT_EQ(0u, stats.getAvoidedStateChangesPerFrame());
+
+    stats.frameFinished(3u, 4u);
+    EXPECT_EQ(4u, stats.getAvoidedStateChangesPerFrame());
+}
+
 TEST_F(ARendererStatistics, tracksFrameCount)
 {
     stats.frameFinished(0u);
@@ -272,6 +272,51 @@ namespace ramses_internal
         EXPECT_TRUE(scene.renderableResourcesDirty(renderable2));
     }
 
+    TEST_F(AResourceCachedScene, DoesNotMarkDirtyRenderableNoLongerUsingSampler)
+    {
+        const RenderableHandle renderable = sceneHelper.createRenderable();
+        const TextureSamplerHandle sampler = sceneHelper.createTextureSamplerWithFakeTexture();
+        const TextureSamplerHandle sampler2 = sceneHelper.createTextureSamplerWithFakeTexture();
+        const DataInstanceHandle uniforms = sceneHelper.createAndAssignUniformDataInstance(renderable, sampler);
+        sceneHelper.createAndAssignVertexDataInstance(renderable);
+        sceneHelper.setResourcesToRenderable(renderable);
+        scene.setDataTextureSamplerHandle(uniforms, sceneHelper.samplerField, sampler2);
+        updateRenderableResourcesAndVertexArray({ renderable });
+        expectRenderableResourcesClean(renderable);
+
+        scene.setRenderableResourcesDirtyByTextureSampler(sampler);
+        scene.updateRenderablesResourcesDirtiness();
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderable));
+
+        scene.setRenderableResourcesDirtyByTextureSampler(sampler2);
+        scene.updateRenderablesResourcesDirtiness();
+        EXPECT_TRUE(scene.renderableResourcesDirty(renderable));
+    }
+
+    TEST_F(AResourceCachedScene, MarksDirtyOnlyRenderablesUsingDirtyDataInstance)
+    {
+        const TextureSamplerHandle sampler = sceneHelper.createTextureSamplerWithFakeTexture();
+        std::array<RenderableHandle, 3u> renderables;
+        for (auto& renderable : renderables)
+        {
+            renderable = sceneHelper.createRenderable();
+            sceneHelper.createAndAssignUniformDataInstance(renderable, sampler);
+            sceneHelper.createAndAssignVertexDataInstance(renderable);
+            sceneHelper.setResourcesToRenderable(renderable);
+        }
+        updateRenderableResourcesAndVertexArray(RenderableVector(renderables.begin(), renderables.end()));
+        EXPECT_TRUE(scene.getRenderablesWithDirtyVertexArrays().empty());
+
+        const DataInstanceHandle geometry = scene.getRenderable(renderables[1]).dataInstances[ERenderableDataSlotType_Geometry];
+        scene.setDataResource(geometry, sceneHelper.vertAttribField, MockResourceHash::VertArrayHash2, DataBufferHandle::Invalid(), 0u, 0u, 0u);
+        scene.updateRenderablesResourcesDirtiness();
+
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderables[0]));
+        EXPECT_TRUE(scene.renderableResourcesDirty(renderables[1]));
+        EXPECT_FALSE(scene.renderableResourcesDirty(renderables[2]));
+        EXPECT_EQ(RenderableVector{ renderables[1] }, scene.getRenderablesWithDirtyVertexArrays());
+    }
+
     TEST_F(AResourceCachedScene, RenderableWithAllResourcesAvailableButTextureResourceMarkedAsDirty)
     {
         const RenderableHandle renderable = sceneHelper.createRenderable();
@@ -0,0 +1,102 @@
+//  -------------------------------------------------------------------------
+//  Copyright (C) 2023 BMW AG
+//  -------------------------------------------------------------------------
+//  This Source Code Form is subject to the terms of the Mozilla Public
+//  License, v. 2.0. If a copy of the MPL was not distributed with this
+//  file, You can obtain one at https://mozilla.org/MPL/2.0/.
+//  -------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+#include "Platform_Base/UniformValueCache.h"
+#include "DataTypesImpl.h"
+#include <array>
+
+namespace ramses_internal
+{
+    class AUniformValueCache : public ::testing::Test
+    {
+    protected:
+        UniformValueCache cache{ 3u };
+        const DataFieldHandle field{ 1u };
+    };
+
+    TEST_F(AUniformValueCache, requiresUploadOfFirstValue)
+    {
+        const glm::vec3 value{ 1.f, 2.f, 3.f };
+        EXPECT_TRUE(cache.updateValue(field, 1u, &value));
+    }
+
+    TEST_F(AUniformValueCache, doesNotRequireUploadOfUnchangedValue)
+    {
+        const glm::vec3 value{ 1.f, 2.f, 3.f };
+        EXPECT_TRUE(cache.updateValue(field, 1u, &value));
+        EXPECT_FALSE(cache.updateValue(field, 1u, &value));
+
+        const glm::vec3 sameValue{ 1.f, 2.f, 3.f };
+        EXPECT_FALSE(cache.updateValue(field, 1u, &sameValue));
+    }
+
+    TEST_F(AUniformValueCache, requiresUploadOfChangedValue)
+    {
+        const glm::vec3 value{ 1.f, 2.f, 3.f };
+        const glm::vec3 otherValue{ 1.f, 2.f, 4.f };
+        EXPECT_TRUE(cache.updateValue(field, 1u, &value));
+        EXPECT_TRUE(cache.updateValue(field, 1u, &otherValue));
+        EXPECT_FALSE(cache.updateValue(field, 1u, &otherValue));
+        EXPECT_TRUE(cache.updateValue(field, 1u, &value));
+    }
+
+    TEST_F(AUniformValueCache, requiresUploadOfChangedArrayElement)
+    {
+        std::array<glm::mat4, 2u> values{ glm::mat4(1.f), glm::mat4(2.f) };
+        EXPECT_TRUE(cache.updateValue(field, 2u, values.data()));
+        EXPECT_FALSE(cache.updateValue(field, 2u, values.data()));
+
+        values[1][3][0] = 5.f;
+        EXPECT_TRUE(cache.updateValue(field, 2u, values.data()));
+        EXPECT_FALSE(cache.updateValue(field, 2u, values.data()));
+    }
+
+    TEST_F(AUniformValueCache, requiresUploadIfElementCountChanges)
+    {
+        const std::array<float, 2u> values{ 1.f, 2.f };
+        EXPECT_TRUE(cache.updateValue(field, 2u, values.data()));
+        EXPECT_TRUE(cache.updateValue(field, 1u, values.data()));
+        EXPECT_FALSE(cache.updateValue(field, 1u, values.data()));
+    }
+
+    TEST_F(AUniformValueCache, tracksValuesOfUniformsIndependently)
+    {
+        const int32_t value = 7;
+        const DataFieldHandle otherField{ 2u };
+        EXPECT_TRUE(cache.updateValue(field, 1u, &value));
+        EXPECT_TRUE(cache.updateValue(otherField, 1u, &value));
+        EXPECT_FALSE(cache.updateValue(field, 1u, &value));
+        EXPECT_FALSE(cache.updateValue(otherField, 1u, &value));
+    }
+
+    TEST_F(AUniformValueCache, requiresUploadOfValueToOtherProgramAfterProgramSwitch)
+    {
+        // each program keeps its own uniform values, value uploaded to one program is not set in another
+        UniformValueCache otherProgramCache{ 3u };
+        const glm::vec4 value{ 1.f, 2.f, 3.f, 4.f };
+        EXPECT_TRUE(cache.updateValue(field, 1u, &value));
+        EXPECT_TRUE(otherProgramCache.updateValue(field, 1u, &value));
+
+        // switching back to first program does not require upload, program object still holds the value
+        EXPECT_FALSE(cache.updateValue(field, 1u, &value));
+        EXPECT_FALSE(otherProgramCache.updateValue(field, 1u, &value));
+    }
+
+    TEST_F(AUniformValueCache, requiresUploadOfValueToProgramCreatedInNewContext)
+    {
+        const glm::ivec2 value{ 1, 2 };
+        EXPECT_TRUE(cache.updateValue(field, 1u, &value));
+        EXPECT_FALSE(cache.updateValue(field, 1u, &value));
+
+        // program of same effect uploaded to new context (e.g. after display was recreated) starts with new cache
+        UniformValueCache newContextProgramCache{ 3u };
+        EXPECT_TRUE(newContextProgramCache.updateValue(field, 1u, &value));
+        EXPECT_FALSE(newContextProgramCache.updateValue(field, 1u, &value));
+    }
+}
@@ -43,6 +43,7 @@ public:
     MOCK_METHOD(IRenderBackend&, getRenderBackend, (), (const, override));
     MOCK_METHOD(IEmbeddedCompositingManager&, getEmbeddedCompositingManager, (), (override));
     MOCK_METHOD(void, validateRenderingStatusHealthy, (), (const, override));
+    MOCK_METHOD(uint32_t, getAndResetAvoidedStateChangeCount, (), (override));
 };
 }
 #endif
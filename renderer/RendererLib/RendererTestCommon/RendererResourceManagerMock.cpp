@@ -71,6 +71,7 @@ RendererResourceManagerMock::RendererResourceManagerMock()
     EXPECT_CALL(*this, getResourcesInUseByScene(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getExternalBufferDeviceHandle(_)).Times(AnyNumber());
     EXPECT_CALL(*this, getEmptyExternalBufferDeviceHandle()).Times(AnyNumber());
+    EXPECT_CALL(*this, getResourceBoundingBox(_)).Times(AnyNumber());
 }
 
 RendererResourceManagerRefCountMock::~RendererResourceManagerRefCountMock()
@@ -27,6 +27,7 @@ public:
     RendererResourceManagerMock();
     // IResourceDeviceHandleAccessor
     MOCK_METHOD(DeviceResourceHandle, getResourceDeviceHandle, (const ResourceContentHash&), (const, override));
+    MOCK_METHOD(BoundingBox, getResourceBoundingBox, (const ResourceContentHash&), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getRenderTargetDeviceHandle, (RenderTargetHandle, SceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getRenderTargetBufferDeviceHandle, (RenderBufferHandle, SceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getOffscreenBufferDeviceHandle, (OffscreenBufferHandle), (const, override));
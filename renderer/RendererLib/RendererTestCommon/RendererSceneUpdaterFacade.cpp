@@ -12,6 +12,7 @@
 #include "RendererAPI/IRenderBackend.h"
 #include "RendererLib/IResourceUploader.h"
 #include "Watchdog/IThreadAliveNotifier.h"
+#include <cassert>
 
 namespace ramses_internal
 {
@@ -97,4 +98,19 @@ namespace ramses_internal
         RendererSceneUpdaterPartialMock::destroyResourceManager();
         RendererSceneUpdater::destroyResourceManager(); // NOLINT clang-tidy: We really mean to call into RendererSceneUpdater
     }
+
+    void RendererSceneUpdaterFacade::holdFlushPreparations(bool hold)
+    {
+        assert(m_flushPreparationWorker);
+        if (hold)
+        {
+            m_flushPreparationWorker->holdPreparations(true);
+            return;
+        }
+
+        // preparations are finished in order, waiting for the last one makes released flushes deterministically prepared for next update
+        const auto lastTicket = m_flushPreparationWorker->prepare({});
+        m_flushPreparationWorker->holdPreparations(false);
+        m_flushPreparationWorker->waitUntilPrepared(lastTicket);
+    }
 }
@@ -42,6 +42,10 @@ namespace ramses_internal
 
         void setForceMapTimeout(std::chrono::milliseconds timeout);
 
+        // holds back flushes as if their resource data was still being decompressed, requires async flush preparation enabled in display config,
+        // when released it waits until all held flushes are prepared
+        void holdFlushPreparations(bool hold);
+
         testing::StrictMock<RendererResourceManagerRefCountMock>* m_resourceManagerMock = nullptr;
 
     protected:
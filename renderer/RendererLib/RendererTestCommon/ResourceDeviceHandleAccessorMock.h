@@ -20,6 +20,7 @@ class ResourceDeviceHandleAccessorMock : public IResourceDeviceHandleAccessor
 {
 public:
     MOCK_METHOD(DeviceResourceHandle, getResourceDeviceHandle, (const ResourceContentHash& resourceHash), (const, override));
+    MOCK_METHOD(BoundingBox, getResourceBoundingBox, (const ResourceContentHash& resourceHash), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getRenderTargetDeviceHandle, (RenderTargetHandle targetHandle, SceneId sceneId), (const, override));
     MOCK_METHOD(DeviceResourceHandle, getRenderTargetBufferDeviceHandle, (RenderBufferHandle bufferHandle, SceneId sceneId), (const, override));
     MOCK_METHOD(void, getBlitPassRenderTargetsDeviceHandle, (BlitPassHandle blitPassHandle, SceneId sceneId, DeviceResourceHandle&, DeviceResourceHandle&), (const, override));
@@ -27,7 +27,7 @@ namespace ramses
 
         /**
         * @brief Construct a DefaultRendererResourceCache with a given maximum size. Whenever the size
-        *        limit is exceeded, items will automatically be unloaded in a FIFO-manner.
+        *        limit is exceeded, least recently used items will automatically be unloaded.
         * @param maxCacheSizeInBytes Maximum size of cache content in bytes
         */
         explicit DefaultRendererResourceCache(uint32_t maxCacheSizeInBytes);
@@ -94,6 +94,8 @@ namespace ramses
 
         /**
         * @brief Load all content from a file. It is assumed that the file has been created using saveToFile(...).
+        *        Only the index of the file is read on load, resource data is read from the memory mapped file
+        *        when first requested. The file must therefore not be modified by others while the cache uses it.
         * @param filePath The file path to load from.
         * @return true if the load was successful.
         */
@@ -560,6 +560,95 @@ namespace ramses
         */
         RAMSES_API status_t setResourceUploadBatchSize(uint32_t batchSize);
 
+        /**
+        * @brief Enables view frustum culling of renderables
+        *
+        * When enabled, the renderer computes a bounding box for every renderable from its vertex attribute
+        * resources and skips renderables whose bounding box lies completely outside of the frustum of the camera
+        * used by the render pass they are rendered with.
+        * Only renderables whose vertex attributes are all non-interleaved float resources are culled,
+        * renderables using data buffers, instancing, interleaved or custom (ByteBlob) vertex data are always rendered.
+        * Culling relies on the vertex shader not displacing vertices beyond the bounds of their attribute values,
+        * i.e. the attributes must represent object space positions transformed by the model, view and projection matrices.
+        * Do not enable this if any shader used on this display violates this assumption.
+        *
+        * @param[in] enabled true to enable frustum culling (default: false)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        RAMSES_API status_t setFrustumCullingEnabled(bool enabled);
+
+        /**
+        * @brief Sets the number of worker threads used to update scenes on this display
+        *
+        * The renderer can distribute parts of the per frame scene update (e.g. computation of the transformation
+        * matrices of renderables in big scenes) to worker threads. The render thread always participates in the work,
+        * the worker threads are idle otherwise. Work is only distributed when it is big enough to benefit from it.
+        * When multiple scenes are rendered, CPU side update stages which are independent across scenes
+        * (transformation matrices of scenes without transformation links, resource cache and render queue update,
+        * frustum culling) are distributed per scene instead.
+        * The same number of worker threads is used to decompress large compressed resources before they are uploaded.
+        *
+        * @param[in] threadCount number of worker threads in addition to the render thread, at most 32
+        *                        (default: 0, i.e. scenes are updated by the render thread only)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        RAMSES_API status_t setSceneUpdateWorkerThreadCount(uint32_t threadCount);
+
+        /**
+        * @brief Enables sorting of renderables by device state
+        *
+        * By default renderables with equal render order inside a render group are only grouped by effect.
+        * When enabled, the renderer additionally groups them by texture samplers, render state and geometry,
+        * so that consecutive draw calls share as much state as possible and redundant state changes can be skipped.
+        * The order given by the render order of renderables, render groups and render passes is always respected,
+        * only renderables with equal render order can change their relative order.
+        * Do not enable this if content relies on the order of renderables with equal render order (e.g. blending).
+        *
+        * @param[in] enabled true to enable state sorting (default: false)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        RAMSES_API status_t setStateSortingEnabled(bool enabled);
+
+        /**
+        * @brief Enables merging of consecutive draw calls into a single draw call
+        *
+        * When enabled, the renderer merges consecutive renderables of a render pass into one draw call
+        * if they use the same effect, geometry, render state and uniform data. Merged renderables must either
+        * - be placed equally (equal world matrix), draw the same number of instances and have index ranges
+        *   directly following each other (e.g. icons packed into a shared vertex/index buffer), or
+        * - draw the same index range without instancing, at any place (e.g. list items sharing geometry and appearance).
+        *   Such renderables are drawn as instances of one draw call, this requires that the effect takes
+        *   all its transformation dependent semantic inputs (model, model view, model view projection and normal matrix)
+        *   as arrays indexed by gl_InstanceID, the array size limits the number of instances per draw call.
+        *   Geometry using instanced vertex attributes is never merged this way.
+        * Combine with state sorting (#setStateSortingEnabled) to make such renderables consecutive
+        * if they have equal render order.
+        *
+        * @param[in] enabled true to enable draw call batching (default: false)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        RAMSES_API status_t setDrawCallBatchingEnabled(bool enabled);
+
+        /**
+        * @brief Enables asynchronous decompression of resources received with scene flushes
+        *
+        * When enabled, resource data received together with a scene flush is decompressed on a worker thread
+        * as soon as the flush arrives, instead of on the render thread when the resource is being uploaded.
+        * No other part of flush processing is moved off the render thread.
+        * Flushes whose resources are not decompressed yet are not applied in the current frame,
+        * rendering continues with the previous state of the scene (same as when resources of a flush are not uploaded yet).
+        * This reduces frame time spikes caused by flushes carrying large compressed resources.
+        *
+        * @param[in] enabled true to enable asynchronous resource decompression (default: false)
+        * @return StatusOK on success, otherwise the returned status can be used
+        *         to resolve error message using getStatusMessage().
+        */
+        RAMSES_API status_t setAsyncFlushPreparationEnabled(bool enabled);
+
         /**
          * @brief Copy constructor
          * @param other source to copy from
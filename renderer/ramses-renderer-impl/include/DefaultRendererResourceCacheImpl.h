@@ -10,14 +10,22 @@
 #define RAMSES_RENDERERAPI_DEFAULTRENDERERRESOURCECACHEIMPL_H
 
 #include "Collections/Vector.h"
+#include "Collections/FlatHashMap.h"
 #include "RendererAPI/Types.h"
+#include "SceneAPI/ResourceContentHash.h"
 #include "ramses-renderer-api/Types.h"
 #include "ramses-renderer-api/IRendererResourceCache.h"
 
-#include <deque>
+#include <list>
 #include <memory>
+#include <mutex>
 #include <string_view>
 
+namespace ramses_internal
+{
+    class MemoryMappedFile;
+}
+
 namespace ramses
 {
     class IDataFunctor;
@@ -36,35 +44,69 @@ namespace ramses
         void saveToFile(std::string_view filePath) const;
         bool loadFromFile(std::string_view filePath);
 
+        // File layout: FileHeader, entry count, index of FileIndexEntry (written field by field), payloads.
+        // Header checksum covers entry count and index only, so that loading needs to read the index only.
+        // Payloads stay in the memory mapped file and are verified against their checksum when first accessed.
+        // Files with other format version are rejected, version must be increased whenever layout changes.
         struct FileHeader
         {
             uint32_t fileSize;
             uint32_t transportVersion;
+            uint32_t formatVersion;
             uint32_t checksum;
         };
+        static constexpr uint32_t FileFormatVersion = 2u;
+
+        struct FileIndexEntry
+        {
+            uint64_t resourceIdLowPart;
+            uint64_t resourceIdHighPart;
+            uint32_t dataOffset;
+            uint32_t dataSize;
+            uint32_t dataChecksum;
+        };
+        static constexpr uint32_t FileIndexEntrySize = 2u * sizeof(uint64_t) + 3u * sizeof(uint32_t);
 
     private:
 
         using ByteVector = std::vector<uint8_t>;
 
-        bool storeResourceInternal(rendererResourceId_t resourceId, ByteVector& data);
-        void clear();
-        void makeSpaceForNewItem(uint32_t newItemSizeInBytes);
-        void removeOldestItem();
-
-        void iterateDataToSave(IDataFunctor& functor) const;
-
         struct ResourceData
         {
             rendererResourceId_t resourceId;
+            // either owned data or data referencing the memory mapped cache file
             ByteVector data;
+            const uint8_t* mappedData = nullptr;
+            uint32_t size = 0u;
+            uint32_t dataChecksum = 0u;
+            bool dataVerified = false;
         };
 
-        using ResourceDataTable = std::deque<ResourceData>;
+        // most recently used entry at front
+        using ResourceDataList = std::list<ResourceData>;
+        using ResourceDataMap = ramses_internal::FlatHashMap<ramses_internal::ResourceContentHash, ResourceDataList::iterator, ramses_internal::ResourceContentHashFoldingHasher>;
+
+        [[nodiscard]] ResourceDataList::iterator findResource(rendererResourceId_t resourceId) const;
+        [[nodiscard]] bool verifyData(ResourceDataList::iterator entry) const;
+        [[nodiscard]] static const uint8_t* GetData(const ResourceData& entry);
+        [[nodiscard]] static ramses_internal::ResourceContentHash GetKey(rendererResourceId_t resourceId);
+
+        bool addResource(ResourceData&& entry);
+        void removeResource(ResourceDataList::iterator entry) const;
+        void clear();
+        void removeLeastRecentlyUsedItem();
+        void copyMappedDataAndReleaseFile() const;
+
+        void iterateIndexToSave(IDataFunctor& functor) const;
 
-        ResourceDataTable m_resourceData;
+        // lookup and LRU order are updated on access from const getters, every public method locks
+        // so that cache can be used by renderer threads while application saves or loads it
+        mutable std::mutex m_lock;
+        mutable ResourceDataList m_resourceData;
+        mutable ResourceDataMap m_resourceLookup;
+        mutable std::unique_ptr<ramses_internal::MemoryMappedFile> m_mappedFile;
         uint32_t m_maxCacheSizeInBytes;
-        uint32_t m_currentCacheSizeInBytes;
+        mutable uint32_t m_currentCacheSizeInBytes;
     };
 }
 
@@ -84,6 +84,21 @@ namespace ramses
         status_t setResourceUploadBatchSize(uint32_t batchSize);
         uint32_t getResourceUploadBatchSize() const;
 
+        status_t setFrustumCullingEnabled(bool enabled);
+        bool isFrustumCullingEnabled() const;
+
+        status_t setSceneUpdateWorkerThreadCount(uint32_t threadCount);
+        uint32_t getSceneUpdateWorkerThreadCount() const;
+
+        status_t setStateSortingEnabled(bool enabled);
+        bool isStateSortingEnabled() const;
+
+        status_t setDrawCallBatchingEnabled(bool enabled);
+        bool isDrawCallBatchingEnabled() const;
+
+        status_t setAsyncFlushPreparationEnabled(bool enabled);
+        bool isAsyncFlushPreparationEnabled() const;
+
         status_t validate() const override;
 
         //impl methods
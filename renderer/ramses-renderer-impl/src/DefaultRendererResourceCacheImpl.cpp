@@ -11,10 +11,13 @@
 #include "Utils/LogMacros.h"
 #include "Utils/BinaryFileInputStream.h"
 #include "Utils/BinaryFileOutputStream.h"
+#include "Utils/BinaryInputStream.h"
+#include "Utils/MemoryMappedFile.h"
 #include "Utils/Adler32Checksum.h"
 #include "PlatformAbstraction/PlatformMemory.h"
 #include "TransportCommon/RamsesTransportProtocolVersion.h"
 #include <cassert>
+#include <iterator>
 
 namespace ramses
 {
@@ -73,43 +76,83 @@ namespace ramses
 
     void DefaultRendererResourceCacheImpl::clear()
     {
+        m_resourceLookup.clear();
         m_resourceData.clear();
+        m_mappedFile.reset();
         m_currentCacheSizeInBytes = 0;
     }
 
+    ramses_internal::ResourceContentHash DefaultRendererResourceCacheImpl::GetKey(rendererResourceId_t resourceId)
+    {
+        return ramses_internal::ResourceContentHash(resourceId.lowPart, resourceId.highPart);
+    }
+
+    const uint8_t* DefaultRendererResourceCacheImpl::GetData(const ResourceData& entry)
+    {
+        return entry.mappedData != nullptr ? entry.mappedData : entry.data.data();
+    }
+
+    DefaultRendererResourceCacheImpl::ResourceDataList::iterator DefaultRendererResourceCacheImpl::findResource(rendererResourceId_t resourceId) const
+    {
+        const auto* entry = m_resourceLookup.get(GetKey(resourceId));
+        return entry != nullptr ? *entry : m_resourceData.end();
+    }
+
+    bool DefaultRendererResourceCacheImpl::verifyData(ResourceDataList::iterator entry) const
+    {
+        if (entry->dataVerified)
+        {
+            return true;
+        }
+
+        // data loaded from file is verified lazily on first access, so that loading does not need to read all payloads
+        ramses_internal::Adler32Checksum checksum;
+        checksum.addData(GetData(*entry), entry->size);
+        if (checksum.getResult() != entry->dataChecksum)
+        {
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl: Checksum of cached resource data was wrong, file is corrupt - resource is removed from cache");
+            removeResource(entry);
+            return false;
+        }
+
+        entry->dataVerified = true;
+        return true;
+    }
+
     bool DefaultRendererResourceCacheImpl::hasResource(rendererResourceId_t resourceId, uint32_t& size) const
     {
-        for (const auto &it : m_resourceData)
+        std::lock_guard<std::mutex> g(m_lock);
+        const auto entry = findResource(resourceId);
+        if (entry == m_resourceData.end() || !verifyData(entry))
         {
-            if (it.resourceId == resourceId)
-            {
-                size = static_cast<uint32_t>(it.data.size());
-                return true;
-            }
+            size = 0;
+            return false;
         }
 
-        size = 0;
-        return false;
+        size = entry->size;
+        return true;
     }
 
     bool DefaultRendererResourceCacheImpl::getResourceData(rendererResourceId_t resourceId, uint8_t* buffer, uint32_t bufferSize) const
     {
-        for (const auto &it : m_resourceData)
+        std::lock_guard<std::mutex> g(m_lock);
+        const auto entry = findResource(resourceId);
+        if (entry == m_resourceData.end())
         {
-            if (it.resourceId == resourceId)
-            {
-                if (bufferSize < it.data.size())
-                {
-                    return false;
-                }
+            assert(false);
+            return false;
+        }
 
-                ramses_internal::PlatformMemory::Copy(buffer, it.data.data(), it.data.size());
-                return true;
-            }
+        if (!verifyData(entry) || bufferSize < entry->size)
+        {
+            return false;
         }
 
-        assert(false);
-        return false;
+        ramses_internal::PlatformMemory::Copy(buffer, GetData(*entry), entry->size);
+
+        // mark as most recently used, splicing keeps iterators stored in lookup valid
+        m_resourceData.splice(m_resourceData.begin(), m_resourceData, entry);
+        return true;
     }
 
     bool DefaultRendererResourceCacheImpl::shouldResourceBeCached(rendererResourceId_t resourceId, uint32_t resourceDataSize, resourceCacheFlag_t cacheFlag, sceneId_t sceneId) const
@@ -132,79 +175,107 @@ namespace ramses
         UNUSED(cacheFlag);
         UNUSED(sceneId);
 
-        ByteVector data;
-        data.resize(resourceDataSize);
-        ramses_internal::PlatformMemory::Copy(data.data(), resourceData, resourceDataSize);
+        std::lock_guard<std::mutex> g(m_lock);
+        ResourceData newData;
+        newData.resourceId = resourceId;
+        newData.data.resize(resourceDataSize);
+        ramses_internal::PlatformMemory::Copy(newData.data.data(), resourceData, resourceDataSize);
+        newData.size = resourceDataSize;
+
+        ramses_internal::Adler32Checksum checksum;
+        checksum.addData(resourceData, resourceDataSize);
+        newData.dataChecksum = checksum.getResult();
+        newData.dataVerified = true;
 
-        const bool storingSuccessful = storeResourceInternal(resourceId, data);
+        const bool storingSuccessful = addResource(std::move(newData));
         assert(storingSuccessful);
         UNUSED(storingSuccessful);
     }
 
-    bool DefaultRendererResourceCacheImpl::storeResourceInternal(rendererResourceId_t resourceId, ByteVector& data)
+    bool DefaultRendererResourceCacheImpl::addResource(ResourceData&& entry)
     {
-        uint32_t tempSize;
-        if (hasResource(resourceId, tempSize))
+        if (findResource(entry.resourceId) != m_resourceData.end())
         {
             return false;
         }
-        UNUSED(tempSize);
 
-        if (data.size() > m_maxCacheSizeInBytes || data.empty())
+        if (entry.size > m_maxCacheSizeInBytes || entry.size == 0)
         {
             return false;
         }
 
-        makeSpaceForNewItem(static_cast<uint32_t>(data.size()));
-        if (m_currentCacheSizeInBytes + data.size() > m_maxCacheSizeInBytes)
+        while (m_currentCacheSizeInBytes + entry.size > m_maxCacheSizeInBytes)
         {
-            return false;
+            removeLeastRecentlyUsedItem();
         }
 
-        ResourceData newData;
-        newData.data.swap(data);
-        newData.resourceId = resourceId;
+        m_currentCacheSizeInBytes += entry.size;
+        m_resourceData.push_front(std::move(entry));
+        m_resourceLookup.put(GetKey(m_resourceData.front().resourceId), m_resourceData.begin());
 
-        m_resourceData.push_back(newData);
-        m_currentCacheSizeInBytes += static_cast<uint32_t>(newData.data.size());
+        return true;
+    }
 
-        return m_currentCacheSizeInBytes <= m_maxCacheSizeInBytes;
+    void DefaultRendererResourceCacheImpl::removeResource(ResourceDataList::iterator entry) const
+    {
+        m_currentCacheSizeInBytes -= entry->size;
+        m_resourceLookup.remove(GetKey(entry->resourceId));
+        m_resourceData.erase(entry);
     }
 
-    void DefaultRendererResourceCacheImpl::makeSpaceForNewItem(uint32_t newItemSizeInBytes)
+    void DefaultRendererResourceCacheImpl::removeLeastRecentlyUsedItem()
     {
-        assert(newItemSizeInBytes <= m_maxCacheSizeInBytes);
+        assert(!m_resourceData.empty());
+        removeResource(std::prev(m_resourceData.end()));
+    }
 
-        while (m_currentCacheSizeInBytes + newItemSizeInBytes > m_maxCacheSizeInBytes)
+    void DefaultRendererResourceCacheImpl::copyMappedDataAndReleaseFile() const
+    {
+        if (!m_mappedFile)
         {
-            removeOldestItem();
+            return;
         }
-    }
 
-    void DefaultRendererResourceCacheImpl::removeOldestItem()
-    {
-        assert(!m_resourceData.empty());
-        m_currentCacheSizeInBytes -= static_cast<uint32_t>(m_resourceData[0].data.size());
-        m_resourceData.pop_front();
+        for (auto it = m_resourceData.begin(); it != m_resourceData.end();)
+        {
+            const auto next = std::next(it);
+            if (it->mappedData != nullptr && verifyData(it))
+            {
+                it->data.assign(it->mappedData, it->mappedData + it->size);
+                it->mappedData = nullptr;
+            }
+            it = next;
+        }
+
+        m_mappedFile.reset();
     }
 
-    void DefaultRendererResourceCacheImpl::iterateDataToSave(IDataFunctor& functor) const
+    void DefaultRendererResourceCacheImpl::iterateIndexToSave(IDataFunctor& functor) const
     {
         const uint32_t numberOfEntries = static_cast<uint32_t>(m_resourceData.size());
         functor.addData(&numberOfEntries, sizeof(numberOfEntries));
 
-        for (const auto &it : m_resourceData)
+        // entries are saved in LRU order, payloads follow the index in same order
+        uint32_t dataOffset = static_cast<uint32_t>(sizeof(FileHeader) + sizeof(numberOfEntries) + numberOfEntries * FileIndexEntrySize);
+        for (const auto& it : m_resourceData)
         {
-            const uint32_t dataSize = static_cast<uint32_t>(it.data.size());
-
-            functor.addData(&it.resourceId, sizeof(it.resourceId));
-            functor.addData(&dataSize, sizeof(dataSize));
-            functor.addData(it.data.data(), dataSize);
+            const FileIndexEntry indexEntry{ it.resourceId.lowPart, it.resourceId.highPart, dataOffset, it.size, it.dataChecksum };
+            functor.addData(&indexEntry.resourceIdLowPart, sizeof(indexEntry.resourceIdLowPart));
+            functor.addData(&indexEntry.resourceIdHighPart, sizeof(indexEntry.resourceIdHighPart));
+            functor.addData(&indexEntry.dataOffset, sizeof(indexEntry.dataOffset));
+            functor.addData(&indexEntry.dataSize, sizeof(indexEntry.dataSize));
+            functor.addData(&indexEntry.dataChecksum, sizeof(indexEntry.dataChecksum));
+            dataOffset += it.size;
         }
     }
 
     void DefaultRendererResourceCacheImpl::saveToFile(std::string_view filePath) const
     {
+        std::lock_guard<std::mutex> g(m_lock);
+
+        // file to write might be the one currently mapped, it must not be modified while mapped
+        copyMappedDataAndReleaseFile();
+
         ramses_internal::File file(filePath);
         ramses_internal::BinaryFileOutputStream outputStream(file);
 
@@ -216,21 +287,28 @@ namespace ramses
         }
 
         ChecksumDataFunctor checksumFunctor;
-        iterateDataToSave(checksumFunctor);
+        iterateIndexToSave(checksumFunctor);
 
         FileHeader header       = {};
-        header.fileSize         = static_cast<uint32_t>(checksumFunctor.m_totalSize + sizeof(header));
+        header.fileSize         = static_cast<uint32_t>(checksumFunctor.m_totalSize + sizeof(header) + m_currentCacheSizeInBytes);
         header.transportVersion = RAMSES_TRANSPORT_PROTOCOL_VERSION_MAJOR;
+        header.formatVersion    = FileFormatVersion;
         header.checksum         = checksumFunctor.m_checksum.getResult();
 
         outputStream.write(&header, sizeof(header));
 
         SaveDataFunctor saveFunctor(outputStream);
-        iterateDataToSave(saveFunctor);
+        iterateIndexToSave(saveFunctor);
+
+        for (const auto& it : m_resourceData)
+        {
+            outputStream.write(GetData(it), it.size);
+        }
     }
 
     bool DefaultRendererResourceCacheImpl::loadFromFile(std::string_view filePath)
     {
+        std::lock_guard<std::mutex> g(m_lock);
         clear();
 
         ramses_internal::File file(filePath);
@@ -241,23 +319,25 @@ namespace ramses
             return false;
         }
 
-        ramses_internal::BinaryFileInputStream inputStream(file);
-        if (inputStream.getState() != ramses_internal::EStatus::Ok)
+        // only header and index are read here, payloads are loaded by OS from the mapping when accessed
+        auto mappedFile = std::make_unique<ramses_internal::MemoryMappedFile>(filePath);
+        if (!mappedFile->isValid())
         {
-            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: failed to load file: " << filePath << " errorstate: " << inputStream.getState());
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: failed to load file: " << filePath);
             return false;
         }
 
-        FileHeader fileHeader;
-
-        size_t actualFileSize = 0;
-        if (!file.getSizeInBytes(actualFileSize) || actualFileSize < sizeof(FileHeader))
+        const size_t actualFileSize = mappedFile->size();
+        if (actualFileSize < sizeof(FileHeader) + sizeof(uint32_t))
         {
             LOG_WARN(ramses_internal::CONTEXT_RENDERER,
                      "DefaultRendererResourceCacheImpl::loadFromFile: Invalid file size, file is corrupt - cache needs to be repopulated and saved again");
             return false;
         }
 
+        ramses_internal::BinaryInputStream inputStream(mappedFile->data());
+
+        FileHeader fileHeader;
         inputStream >> fileHeader.fileSize;
 
         if (actualFileSize != fileHeader.fileSize)
@@ -280,70 +360,78 @@ namespace ramses
             return false;
         }
 
-        ramses_internal::Adler32Checksum calculatedChecksum;
+        inputStream >> fileHeader.formatVersion;
+
+        if (fileHeader.formatVersion != FileFormatVersion)
+        {
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER,
+                     "DefaultRendererResourceCacheImpl::loadFromFile: File format version "
+                         << fileHeader.formatVersion << " did not match the supported format version " << FileFormatVersion
+                         << " - cache needs to be repopulated and saved again");
+            return false;
+        }
 
         inputStream >> fileHeader.checksum;
 
         uint32_t itemCount = 0;
         inputStream >> itemCount;
-        calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&itemCount), sizeof(itemCount));
 
-        for (uint32_t i = 0; i < itemCount; i++)
+        const size_t indexStart = sizeof(FileHeader);
+        const uint64_t indexEnd = sizeof(FileHeader) + sizeof(itemCount) + static_cast<uint64_t>(itemCount) * FileIndexEntrySize;
+        if (indexEnd > actualFileSize)
         {
-            uint64_t resIdLowPart = 0;
-            inputStream >> resIdLowPart;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resIdLowPart), sizeof(resIdLowPart));
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER,
+                     "DefaultRendererResourceCacheImpl::loadFromFile: Wrong item count: " << itemCount <<
+                     ", file is corrupt - cache needs to be repopulated and saved again");
+            return false;
+        }
 
-            uint64_t resIdHighPart = 0;
-            inputStream >> resIdHighPart;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resIdHighPart), sizeof(resIdHighPart));
+        ramses_internal::Adler32Checksum calculatedChecksum;
+        calculatedChecksum.addData(mappedFile->data() + indexStart, static_cast<uint32_t>(indexEnd - indexStart));
+        if (calculatedChecksum.getResult() != fileHeader.checksum)
+        {
+            LOG_WARN(ramses_internal::CONTEXT_RENDERER,
+                     "DefaultRendererResourceCacheImpl::loadFromFile: Checksum was wrong, file is corrupt - cache "
+                     "needs to be repopulated and saved again");
+            return false;
+        }
 
-            uint32_t resourceSize = 0;
-            inputStream >> resourceSize;
-            calculatedChecksum.addData(reinterpret_cast<ramses_internal::Byte*>(&resourceSize), sizeof(resourceSize));
+        std::vector<FileIndexEntry> index(itemCount);
+        for (auto& indexEntry : index)
+        {
+            inputStream >> indexEntry.resourceIdLowPart;
+            inputStream >> indexEntry.resourceIdHighPart;
+            inputStream >> indexEntry.dataOffset;
+            inputStream >> indexEntry.dataSize;
+            inputStream >> indexEntry.dataChecksum;
 
-            if (resourceSize > actualFileSize)
+            if (indexEntry.dataOffset < indexEnd || static_cast<uint64_t>(indexEntry.dataOffset) + indexEntry.dataSize > actualFileSize)
             {
-                // resourceSize is larger than whole file size, so it must be wrong
                 LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                    "DefaultRendererResourceCacheImpl::loadFromFile: Wrong resourceSize: " << resourceSize <<
-                    ", file is corrupt - cache needs to be repopulated and saved again");
-                clear();
+                    "DefaultRendererResourceCacheImpl::loadFromFile: Wrong resource data range, file is corrupt - cache needs to be repopulated and saved again");
                 return false;
             }
+        }
 
-            ByteVector data;
-            data.resize(resourceSize);
-            inputStream.read(reinterpret_cast<char*>(data.data()), resourceSize);
-            calculatedChecksum.addData(data.data(), resourceSize);
+        // index is in LRU order, insert least recently used first so that order is kept and most recent items win if cache is smaller now
+        for (auto it = index.crbegin(); it != index.crend(); ++it)
+        {
+            ResourceData entry;
+            entry.resourceId = rendererResourceId_t(it->resourceIdLowPart, it->resourceIdHighPart);
+            entry.mappedData = mappedFile->data() + it->dataOffset;
+            entry.size = it->dataSize;
+            entry.dataChecksum = it->dataChecksum;
 
-            if (!storeResourceInternal(rendererResourceId_t(resIdLowPart, resIdHighPart), data))
+            if (!addResource(std::move(entry)))
             {
-                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: storeResourceInternal failed"
+                LOG_WARN(ramses_internal::CONTEXT_RENDERER, "DefaultRendererResourceCacheImpl::loadFromFile: storing resource failed"
                                 << ", either file is corrupt or cache size too small  - cache needs to be repopulated and saved again");
                 clear();
                 return false;
             }
-
-            if (inputStream.getState() != ramses_internal::EStatus::Ok)
-            {
-                LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                         "DefaultRendererResourceCacheImpl::loadFromFile: Reading failed, file is corrupt - cache "
-                         "needs to be repopulated and saved again");
-                clear();
-                return false;
-            }
-        }
-
-        if (calculatedChecksum.getResult() != fileHeader.checksum)
-        {
-            LOG_WARN(ramses_internal::CONTEXT_RENDERER,
-                     "DefaultRendererResourceCacheImpl::loadFromFile: Checksum was wrong, file is corrupt - cache "
-                     "needs to be repopulated and saved again");
-            clear();
-            return false;
         }
 
+        m_mappedFile = std::move(mappedFile);
         return true;
     }
 }
@@ -284,4 +284,39 @@ namespace ramses
     {
         return m_impl.get().setResourceUploadBatchSize(batchSize);
     }
+
+    status_t DisplayConfig::setFrustumCullingEnabled(bool enabled)
+    {
+        const status_t status = m_impl.get().setFrustumCullingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    status_t DisplayConfig::setSceneUpdateWorkerThreadCount(uint32_t threadCount)
+    {
+        const status_t status = m_impl.get().setSceneUpdateWorkerThreadCount(threadCount);
+        LOG_HL_RENDERER_API1(status, threadCount);
+        return status;
+    }
+
+    status_t DisplayConfig::setStateSortingEnabled(bool enabled)
+    {
+        const status_t status = m_impl.get().setStateSortingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    status_t DisplayConfig::setDrawCallBatchingEnabled(bool enabled)
+    {
+        const status_t status = m_impl.get().setDrawCallBatchingEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
+
+    status_t DisplayConfig::setAsyncFlushPreparationEnabled(bool enabled)
+    {
+        const status_t status = m_impl.get().setAsyncFlushPreparationEnabled(enabled);
+        LOG_HL_RENDERER_API1(status, enabled);
+        return status;
+    }
 }
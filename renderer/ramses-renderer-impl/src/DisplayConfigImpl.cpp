@@ -387,6 +387,65 @@ namespace ramses
         return m_internalConfig.getResourceUploadBatchSize();
     }
 
+    status_t DisplayConfigImpl::setFrustumCullingEnabled(bool enabled)
+    {
+        m_internalConfig.setFrustumCullingEnabled(enabled);
+        return StatusOK;
+    }
+
+    bool DisplayConfigImpl::isFrustumCullingEnabled() const
+    {
+        return m_internalConfig.isFrustumCullingEnabled();
+    }
+
+    status_t DisplayConfigImpl::setSceneUpdateWorkerThreadCount(uint32_t threadCount)
+    {
+        if (threadCount > 32u)
+        {
+            return addErrorEntry("DisplayConfig::setSceneUpdateWorkerThreadCount failed - threadCount cannot exceed 32!");
+        }
+        m_internalConfig.setSceneUpdateWorkerThreadCount(threadCount);
+        return StatusOK;
+    }
+
+    uint32_t DisplayConfigImpl::getSceneUpdateWorkerThreadCount() const
+    {
+        return m_internalConfig.getSceneUpdateWorkerThreadCount();
+    }
+
+    status_t DisplayConfigImpl::setStateSortingEnabled(bool enabled)
+    {
+        m_internalConfig.setStateSortingEnabled(enabled);
+        return StatusOK;
+    }
+
+    bool DisplayConfigImpl::isStateSortingEnabled() const
+    {
+        return m_internalConfig.isStateSortingEnabled();
+    }
+
+    status_t DisplayConfigImpl::setDrawCallBatchingEnabled(bool enabled)
+    {
+        m_internalConfig.setDrawCallBatchingEnabled(enabled);
+        return StatusOK;
+    }
+
+    bool DisplayConfigImpl::isDrawCallBatchingEnabled() const
+    {
+        return m_internalConfig.isDrawCallBatchingEnabled();
+    }
+
+    status_t DisplayConfigImpl::setAsyncFlushPreparationEnabled(bool enabled)
+    {
+        m_internalConfig.setAsyncFlushPreparationEnabled(enabled);
+        return StatusOK;
+    }
+
+    bool DisplayConfigImpl::isAsyncFlushPreparationEnabled() const
+    {
+        return m_internalConfig.isAsyncFlushPreparationEnabled();
+    }
+
     status_t DisplayConfigImpl::validate() const
     {
         status_t status = StatusObjectImpl::validate();
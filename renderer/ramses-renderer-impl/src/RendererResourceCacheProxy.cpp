@@ -24,21 +24,25 @@ namespace ramses
 
     bool RendererResourceCacheProxy::hasResource(ramses_internal::ResourceContentHash resourceId, uint32_t& size) const
     {
+        std::lock_guard<std::mutex> g(m_cacheLock);
         return m_cache.hasResource(ConvertInternalTypeToPublic(resourceId), size);
     }
 
     bool RendererResourceCacheProxy::getResourceData(ramses_internal::ResourceContentHash resourceId, uint8_t* buffer, uint32_t bufferSize) const
     {
+        std::lock_guard<std::mutex> g(m_cacheLock);
         return m_cache.getResourceData(ConvertInternalTypeToPublic(resourceId), buffer, bufferSize);
     }
 
     bool RendererResourceCacheProxy::shouldResourceBeCached(ramses_internal::ResourceContentHash resourceId, uint32_t resourceDataSize, ramses_internal::ResourceCacheFlag cacheFlag, ramses_internal::SceneId sceneId) const
     {
+        std::lock_guard<std::mutex> g(m_cacheLock);
         return m_cache.shouldResourceBeCached(ConvertInternalTypeToPublic(resourceId), resourceDataSize, ConvertInternalTypeToPublic(cacheFlag), ConvertInternalTypeToPublic(sceneId));
     }
 
     void RendererResourceCacheProxy::storeResource(ramses_internal::ResourceContentHash resourceId, const uint8_t* resourceData, uint32_t resourceDataSize, ramses_internal::ResourceCacheFlag cacheFlag, ramses_internal::SceneId sceneId)
     {
+        std::lock_guard<std::mutex> g(m_cacheLock);
         m_cache.storeResource(ConvertInternalTypeToPublic(resourceId), resourceData, resourceDataSize, ConvertInternalTypeToPublic(cacheFlag), ConvertInternalTypeToPublic(sceneId));
     }
 
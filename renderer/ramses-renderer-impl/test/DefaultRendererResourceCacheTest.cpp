@@ -17,6 +17,9 @@
 #include "TransportCommon/RamsesTransportProtocolVersion.h"
 
 #include <string>
+#include <array>
+#include <thread>
+#include <vector>
 
 using namespace ramses_internal;
 
@@ -140,6 +143,26 @@ protected:
         delete[] readBuffer;
     }
 
+    static uint32_t CountValidItems(const ramses::DefaultRendererResourceCache& cache)
+    {
+        const std::array<ramses::rendererResourceId_t, 3> ids = {
+            ramses::rendererResourceId_t(0xFFFFFFFF123, 0x321FFFFFFFF),
+            ramses::rendererResourceId_t(0x0, 0x1),
+            ramses::rendererResourceId_t(0x123456, 0x12345)
+        };
+
+        uint32_t count = 0u;
+        for (const auto& id : ids)
+        {
+            uint32_t size = 0u;
+            if (cache.hasResource(id, size))
+            {
+                ++count;
+            }
+        }
+        return count;
+    }
+
     const std::string m_saveFilePath;
 };
 
@@ -278,27 +301,140 @@ TEST_F(ADefaultRendererResourceCache, reportsFailOnFileShorterThanHeader)
     EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
 }
 
-TEST_F(ADefaultRendererResourceCache, reportsFailForAnyByteCorruptionInFile)
+TEST_F(ADefaultRendererResourceCache, reportsFailForAnyByteCorruptionInHeaderAndIndex)
 {
-    ramses::DefaultRendererResourceCache cache(100);
-
     createTestFile();
+    const uint32_t indexEnd = sizeof(ramses::DefaultRendererResourceCacheImpl::FileHeader) + sizeof(uint32_t) + 3u * ramses::DefaultRendererResourceCacheImpl::FileIndexEntrySize;
 
-    ramses_internal::File file(m_saveFilePath);
-    size_t fileSize(0);
-    EXPECT_TRUE(file.getSizeInBytes(fileSize));
-
-    for (size_t offset = 0; offset < fileSize; offset++)
+    for (uint32_t offset = 0; offset < indexEnd; offset++)
     {
         if (offset > 0)
         {
             createTestFile();
         }
-        corruptTestFile(static_cast<uint32_t>(offset));
+        corruptTestFile(offset);
+        ramses::DefaultRendererResourceCache cache(100);
         EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
     }
 }
 
+TEST_F(ADefaultRendererResourceCache, removesResourceForAnyByteCorruptionInResourceDataWhenAccessed)
+{
+    createTestFile();
+    const uint32_t indexEnd = sizeof(ramses::DefaultRendererResourceCacheImpl::FileHeader) + sizeof(uint32_t) + 3u * ramses::DefaultRendererResourceCacheImpl::FileIndexEntrySize;
+
+    ramses_internal::File file(m_saveFilePath);
+    size_t fileSize(0);
+    EXPECT_TRUE(file.getSizeInBytes(fileSize));
+
+    for (uint32_t offset = indexEnd; offset < fileSize; offset++)
+    {
+        createTestFile();
+        corruptTestFile(offset);
+
+        // resource data is only read and verified on access
+        ramses::DefaultRendererResourceCache cache(100);
+        EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+        EXPECT_EQ(2u, CountValidItems(cache));
+    }
+}
+
+TEST_F(ADefaultRendererResourceCache, removesCorruptedResourceWhenSavingAgain)
+{
+    createTestFile();
+    corruptTestFile(static_cast<uint32_t>(sizeof(ramses::DefaultRendererResourceCacheImpl::FileHeader) + sizeof(uint32_t) + 3u * ramses::DefaultRendererResourceCacheImpl::FileIndexEntrySize));
+
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+        // saving to same file that is loaded from
+        cache.saveToFile(m_saveFilePath.c_str());
+    }
+
+    ramses::DefaultRendererResourceCache cache(100);
+    EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+    EXPECT_EQ(2u, CountValidItems(cache));
+    uint32_t size = 0;
+    // most recently stored resource comes first in file
+    EXPECT_FALSE(cache.hasResource(ramses::rendererResourceId_t(0x123456, 0x12345), size));
+}
+
+TEST_F(ADefaultRendererResourceCache, unloadsLeastRecentlyUsedItemWhenOutOfSpace)
+{
+    uint8_t inputBuffer[100] = {};
+    uint8_t readBuffer[100] = {};
+    uint32_t size;
+    ramses::DefaultRendererResourceCache cache(100);
+
+    cache.storeResource(ramses::rendererResourceId_t(1, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    cache.storeResource(ramses::rendererResourceId_t(2, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+
+    // reading makes oldest item the most recently used one
+    EXPECT_TRUE(cache.getResourceData(ramses::rendererResourceId_t(1, 0), readBuffer, sizeof(readBuffer)));
+
+    cache.storeResource(ramses::rendererResourceId_t(3, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+    EXPECT_FALSE(cache.hasResource(ramses::rendererResourceId_t(2, 0), size)); // Now gone
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(3, 0), size));
+}
+
+TEST_F(ADefaultRendererResourceCache, keepsUsageOrderWhenSavedAndLoaded)
+{
+    uint8_t inputBuffer[100] = {};
+    uint8_t readBuffer[100] = {};
+    uint32_t size;
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        cache.storeResource(ramses::rendererResourceId_t(1, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+        cache.storeResource(ramses::rendererResourceId_t(2, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+        EXPECT_TRUE(cache.getResourceData(ramses::rendererResourceId_t(1, 0), readBuffer, sizeof(readBuffer)));
+        cache.saveToFile(m_saveFilePath.c_str());
+    }
+
+    ramses::DefaultRendererResourceCache cache(100);
+    EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+    cache.storeResource(ramses::rendererResourceId_t(3, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+    EXPECT_FALSE(cache.hasResource(ramses::rendererResourceId_t(2, 0), size));
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(3, 0), size));
+}
+
+TEST_F(ADefaultRendererResourceCache, loadsOnlyMostRecentlyUsedItemsIntoSmallerCache)
+{
+    uint8_t inputBuffer[100] = {};
+    uint32_t size;
+    {
+        ramses::DefaultRendererResourceCache cache(100);
+        cache.storeResource(ramses::rendererResourceId_t(1, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+        cache.storeResource(ramses::rendererResourceId_t(2, 0), inputBuffer, 40, ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+        cache.saveToFile(m_saveFilePath.c_str());
+    }
+
+    ramses::DefaultRendererResourceCache cache(50);
+    EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+    EXPECT_FALSE(cache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+    EXPECT_TRUE(cache.hasResource(ramses::rendererResourceId_t(2, 0), size));
+}
+
+TEST_F(ADefaultRendererResourceCache, findsResourcesAmongManyItems)
+{
+    ramses::DefaultRendererResourceCache cache(100000);
+    uint8_t data[10] = {};
+    for (uint64_t i = 0u; i < 5000u; ++i)
+    {
+        data[0] = static_cast<uint8_t>(i);
+        cache.storeResource(ramses::rendererResourceId_t(i, i * 3u), data, sizeof(data), ramses::resourceCacheFlag_t(1), ramses::sceneId_t(7));
+    }
+
+    for (uint64_t i = 0u; i < 5000u; ++i)
+    {
+        data[0] = static_cast<uint8_t>(i);
+        CheckItemInCache(cache, ramses::rendererResourceId_t(i, i * 3u), data, sizeof(data));
+    }
+    uint32_t size;
+    EXPECT_FALSE(cache.hasResource(ramses::rendererResourceId_t(1, 0), size));
+}
+
 TEST_F(ADefaultRendererResourceCache, reportsFailOnInvalidFileVersion)
 {
     ramses::DefaultRendererResourceCache cache(100);
@@ -307,6 +443,52 @@ TEST_F(ADefaultRendererResourceCache, reportsFailOnInvalidFileVersion)
     EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
 }
 
+TEST_F(ADefaultRendererResourceCache, reportsFailOnInvalidFileFormatVersion)
+{
+    ramses::DefaultRendererResourceCache cache(100);
+    createTestFile();
+    corruptTestFile(offsetof(ramses::DefaultRendererResourceCacheImpl::FileHeader, formatVersion));
+    EXPECT_FALSE(cache.loadFromFile(m_saveFilePath.c_str()));
+    EXPECT_EQ(0u, CountValidItems(cache));
+}
+
+TEST_F(ADefaultRendererResourceCache, canBeUsedFromMultipleThreadsConcurrently)
+{
+    ramses::DefaultRendererResourceCache cache(100);
+    const std::array<uint8_t, 10u> data{ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+
+    // each thread stores and reads its own items, cache is too small for all of them so that items are evicted meanwhile
+    std::vector<std::thread> threads;
+    for (uint64_t t = 0u; t < 4u; ++t)
+    {
+        threads.emplace_back([&cache, &data, t]()
+        {
+            for (uint64_t i = 0u; i < 100u; ++i)
+            {
+                const ramses::rendererResourceId_t id(t, i % 5u);
+                uint32_t size = 0u;
+                if (cache.hasResource(id, size))
+                {
+                    std::array<uint8_t, 10u> readData{};
+                    if (cache.getResourceData(id, readData.data(), static_cast<uint32_t>(readData.size())))
+                    {
+                        EXPECT_EQ(data, readData);
+                    }
+                }
+                else
+                {
+                    cache.storeResource(id, data.data(), static_cast<uint32_t>(data.size()), ramses::resourceCacheFlag_t(0u), ramses::sceneId_t(1u));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+        thread.join();
+
+    cache.saveToFile(m_saveFilePath.c_str());
+    EXPECT_TRUE(cache.loadFromFile(m_saveFilePath.c_str()));
+}
+
 TEST_F(ADefaultRendererResourceCache, reportsFailWhenCacheTooSmall)
 {
     ramses::DefaultRendererResourceCache cache(1);
@@ -306,3 +306,47 @@ TEST_F(ADisplayConfig, canSetResourceUploadBatchSize)
     EXPECT_EQ(1u, config.m_impl.get().getResourceUploadBatchSize());
 }
 
+TEST_F(ADisplayConfig, canSetFrustumCullingEnabled)
+{
+    EXPECT_FALSE(config.m_impl.get().isFrustumCullingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setFrustumCullingEnabled(true));
+    EXPECT_TRUE(config.m_impl.get().isFrustumCullingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setFrustumCullingEnabled(false));
+    EXPECT_FALSE(config.m_impl.get().isFrustumCullingEnabled());
+}
+
+TEST_F(ADisplayConfig, canSetSceneUpdateWorkerThreadCount)
+{
+    EXPECT_EQ(0u, config.m_impl.get().getSceneUpdateWorkerThreadCount());
+    EXPECT_EQ(ramses::StatusOK, config.setSceneUpdateWorkerThreadCount(4u));
+    EXPECT_EQ(4u, config.m_impl.get().getSceneUpdateWorkerThreadCount());
+    EXPECT_NE(ramses::StatusOK, config.setSceneUpdateWorkerThreadCount(33u));
+    EXPECT_EQ(4u, config.m_impl.get().getSceneUpdateWorkerThreadCount());
+}
+
+TEST_F(ADisplayConfig, canSetStateSortingEnabled)
+{
+    EXPECT_FALSE(config.m_impl.get().isStateSortingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setStateSortingEnabled(true));
+    EXPECT_TRUE(config.m_impl.get().isStateSortingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setStateSortingEnabled(false));
+    EXPECT_FALSE(config.m_impl.get().isStateSortingEnabled());
+}
+
+TEST_F(ADisplayConfig, canSetDrawCallBatchingEnabled)
+{
+    EXPECT_FALSE(config.m_impl.get().isDrawCallBatchingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setDrawCallBatchingEnabled(true));
+    EXPECT_TRUE(config.m_impl.get().isDrawCallBatchingEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setDrawCallBatchingEnabled(false));
+    EXPECT_FALSE(config.m_impl.get().isDrawCallBatchingEnabled());
+}
+
+TEST_F(ADisplayConfig, canSetAsyncFlushPreparationEnabled)
+{
+    EXPECT_FALSE(config.m_impl.get().isAsyncFlushPreparationEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setAsyncFlushPreparationEnabled(true));
+    EXPECT_TRUE(config.m_impl.get().isAsyncFlushPreparationEnabled());
+    EXPECT_EQ(ramses::StatusOK, config.setAsyncFlushPreparationEnabled(false));
+    EXPECT_FALSE(config.m_impl.get().isAsyncFlushPreparationEnabled());
+}